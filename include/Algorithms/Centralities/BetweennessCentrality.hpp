@@ -12,9 +12,22 @@
     #include <omp.h>
 #endif // OPENMP_AVAILABLE
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <vector>
+
 #include "Algorithms/PathFinding/DominatingThetaPath.hpp"
+#include "DataStructures/Graphs/BlockCutTree.hpp"
 #include "IO/Statistics/DtpRuntimeCollection.hpp"
 
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Timer.hpp"
+
 namespace egoa {
 
 enum class CentralityCounter {
@@ -22,6 +35,49 @@ enum class CentralityCounter {
     counterAtVertices = 1
 };
 
+/**
+ * @brief      The order in which the sources are distributed among the
+ *     threads.
+ */
+enum class SourceScheduling {
+    standard     = 0,   /**< The sources are processed by the vertex loop of the graph. */
+    largestFirst = 1    /**< The sources are sorted by their estimated costs in decreasing order and handed out dynamically in chunks. */
+};
+
+/**
+ * @brief      The way the path counters of the threads are combined.
+ */
+enum class CounterReduction {
+    replicated = 0,     /**< Each thread counts into its own copy of the counters, which are summed up serially after the run. */
+    treeMerge  = 1,     /**< Each thread counts into its own copy of the counters, which are merged pairwise in parallel rounds. This speeds up the merge, but does not lower the peak memory, since all copies exist at the end of the run. */
+    atomic     = 2      /**< All threads count into the total counters by atomic updates. The memory does not depend on the number of threads. */
+};
+
+/**
+ * @brief      The sources from which the paths are counted.
+ */
+enum class SourceSampling {
+    exact      = 0,     /**< All sources are processed. */
+    uniform    = 1,     /**< The sources are sampled uniformly at random. */
+    stratified = 2      /**< The sources are divided into strata of similar estimated costs and each stratum is sampled proportionally to its size. */
+};
+
+/**
+ * @brief      The parameters of the sampling-based approximation of the
+ *     betweenness centrality.
+ *
+ * @see        BetweennessCentrality#Sampling
+ */
+struct SamplingParameters {
+    SourceSampling  Method                  = SourceSampling::exact;    /**< The way the sources are selected. */
+    Types::count    Seed                    = 0;                        /**< The seed of the random number generator, i.e., the same seed yields the same sample. */
+    Types::real     ErrorBound              = 0.01;                     /**< The sampling stops if the half-width of all confidence intervals of the normalized centrality is at most this bound. */
+    Types::real     Confidence              = 0.95;                     /**< The confidence level of the confidence intervals. */
+    Types::count    BatchSize               = 32;                       /**< The number of samples between two convergence checks. */
+    Types::count    MaximumNumberOfSamples  = Const::INFTY;             /**< The sampling stops after this number of samples. */
+    Types::count    NumberOfStrata          = 4;                        /**< The number of strata for SourceSampling::stratified. */
+};
+
 /**
  * @brief      Class for betweenness centrality.
  * @details    This algorithm measures the centrality of a graph based on a
@@ -81,13 +137,17 @@ class BetweennessCentrality {
     protected:
 #ifdef OPENMP_AVAILABLE
         using TAlgoHandling          = std::vector<TAlgorithm>;
-        using TNumberOfPaths         = std::vector<std::vector<Types::count>>;
-        using TRelativeNumberOfPaths = std::vector<std::vector<Types::real>>;
+        template<typename TCounter>
+        using TCountersPerThread     = std::vector<std::vector<TCounter>>;
 #else
         using TAlgoHandling          = TAlgorithm;
-        using TNumberOfPaths         = std::vector<Types::count>;
-        using TRelativeNumberOfPaths = std::vector<Types::real>;
+        template<typename TCounter>
+        using TCountersPerThread     = std::vector<TCounter>;
 #endif
+        using TNumberOfPaths         = TCountersPerThread<Types::count>;
+        using TRelativeNumberOfPaths = TCountersPerThread<Types::real>;
+
+        static constexpr Types::count CACHE_LINE_SIZE = 64;        /**< The assumed cache line size in bytes, see CopyOfThread. */
     public:
         ///@name Constructors and Destructor
         ///@{
@@ -106,6 +166,11 @@ class BetweennessCentrality {
 #else
             , algo_( graph_ )
 #endif
+            , scheduling_( SourceScheduling::standard )
+            , chunkSize_( 1 )
+            , reduction_( CounterReduction::replicated )
+            , sampling_()
+            , numberOfSamples_( 0 )
             {}
 
             /**
@@ -128,9 +193,38 @@ class BetweennessCentrality {
              *     more information see <a
              *     href="https://en.cppreference.com/w/cpp/container">
              *     https://en.cppreference.com/w/cpp/container </a>.
+             *
+             *     If the #Sampling method is not SourceSampling::exact, the
+             *     centrality is estimated from a sample of the sources, see
+             *     #RunSampled.
              */
             inline void Run ()
             {
+                if ( Scheduling() == SourceScheduling::largestFirst
+                  || Sampling().Method != SourceSampling::exact )
+                {
+                    std::vector<TVertexId> sources;
+                    sources.reserve ( graph_.NumberOfVertices() );
+                    graph_.template for_all_vertex_identifiers<ExecutionPolicy::sequential> ( [ & sources ] ( TVertexId vertexId )
+                    {
+                        sources.emplace_back ( vertexId );
+                    });
+
+                    Types::real const m_BNormalization = 1 / static_cast<Types::real>( graph_.NumberOfVertices() * ( graph_.NumberOfVertices() - 1 ) );
+                    if ( Sampling().Method != SourceSampling::exact )
+                    {
+                        RunSampled ( sources
+                                   , std::vector<Types::real>()
+                                   , m_BNormalization
+                                   , []( TMeasurementRow & ) {} );
+                    } else {
+                        RunLargestSourcesFirst ( sources
+                                               , m_BNormalization
+                                               , []( TMeasurementRow & ) {} );
+                    }
+                    return;
+                }
+
                 TNumberOfPaths         numberOfPaths;
                 TRelativeNumberOfPaths relativeNumberOfPaths;
 
@@ -175,6 +269,123 @@ class BetweennessCentrality {
                                        , relativeNumberOfPaths
                                        , 1 / static_cast<Types::real>( graph_.NumberOfVertices() * ( graph_.NumberOfVertices() - 1 ) ) );
             }
+
+            /**
+             * @brief      Update the betweenness centrality after some edges
+             *     changed, e.g., by SwitchEdges.
+             * @details    A simple path between a source @f$\source@f$ and a
+             *     sink @f$\sink@f$ can only use an edge of a block
+             *     @f$B@f$ if @f$B@f$ lies on the path between
+             *     @f$\source@f$ and @f$\sink@f$ in the BlockCutTree. Thus,
+             *     only these pairs are recounted. For each source the search
+             *     is restricted to the blocks that lie between the source
+             *     and its affected sinks, see DominatingThetaPath#SearchSpace.
+             *     The paths of the affected pairs are counted once before
+             *     and once after @p modifyEdges is called, and their
+             *     difference patches #TotalNumberOfPaths and
+             *     #TotalRelativeNumberOfPaths in place.
+             *
+             *     The savings depend on the block structure. If the
+             *     estimated work of the two restricted passes is not smaller
+             *     than the work of a full run, @p modifyEdges is called and
+             *     the centrality is recomputed by #Run. The collection is not
+             *     extended by an update.
+             *
+             *     The BlockCutTree is built by the first update after #Run,
+             *     which takes @f$\Theta(n + m)@f$ time, and is reused by
+             *     the following updates, since the topology does not change.
+             *
+             *     The update does not refresh the property columns of the
+             *     graph. If the graph has property columns, @p modifyEdges
+             *     has to refresh the columns of the changed edges, see
+             *     StaticGraph#RefreshPropertyColumns.
+             *
+             * @code{.cpp}
+             *      betweennessCentrality.IgnoreSwitchedEdges ( true );
+             *      betweennessCentrality.Run();
+             *      betweennessCentrality.Update ( { edgeId }, [ & graph, edgeId ]()
+             *      {
+             *          graph.EdgeAt ( edgeId ).Properties().Status() = false;
+             *      });
+             * @endcode
+             *
+             * @pre        #Run was called before and the topology of the
+             *     graph did not change since then. The edges of the graph
+             *     are only changed by @p modifyEdges and only the edges in
+             *     @p edgeIds are changed.
+             *
+             * @param[in]  edgeIds      The identifiers of the changed edges.
+             * @param[in]  modifyEdges  The function object that changes the
+             *     edges, e.g., by switching them.
+             *
+             * @tparam     FUNCTION     The type of the function object.
+             *
+             * @return     @p true if the centrality was patched, @p false if
+             *     it was recomputed.
+             */
+            template<typename FUNCTION>
+            inline bool Update ( std::vector<TEdgeId> const & edgeIds
+                               , FUNCTION                     modifyEdges )
+            {
+                USAGE_ASSERT ( countersSize_ > 0 );
+                USAGE_ASSERT ( totalNumberOfPaths_.size() == countersSize_ );
+
+                Types::count const numberOfVertices = graph_.NumberOfVertices();
+                if ( blockCutTree_ == nullptr )
+                {
+                    blockCutTree_ = std::make_unique<BlockCutTree<TGraph>> ( BlockCutTree<TGraph>::Build ( graph_ ) );
+                }
+                BlockCutTree<TGraph> const & blockCutTree = *blockCutTree_;
+
+                std::vector<SeparatedBlock> blocks;
+                std::vector<bool> isChanged ( blockCutTree.NumberOfBlocks(), false );
+                for ( TEdgeId edgeId : edgeIds )
+                {
+                    USAGE_ASSERT ( edgeId < graph_.NumberOfEdges() );
+                    Types::blockId const blockId = blockCutTree.BlockOfEdge ( edgeId );
+                    if ( isChanged[blockId] ) continue;
+                    isChanged[blockId] = true;
+                    blocks.emplace_back ( SeparateAt ( blockCutTree, blockId ) );
+                }
+
+                // Select the sources with affected sinks and estimate the work
+                std::vector<TVertexId> sources;
+                Types::count           work = 0;
+                graph_.template for_all_vertex_identifiers<ExecutionPolicy::sequential> ( [ & ] ( TVertexId vertexId )
+                {
+                    Types::count const size = AffectedRegionSizeOf ( vertexId, blocks );
+                    if ( size == 0 ) return;
+                    sources.emplace_back ( vertexId );
+                    work += size;
+                });
+
+                if ( 2 * work >= numberOfVertices * numberOfVertices )
+                {
+                    modifyEdges();
+                    Run();
+                    return false;
+                }
+
+                std::vector<Types::count> removedPaths;
+                std::vector<Types::real>  removedRelativePaths;
+                std::vector<Types::count> addedPaths;
+                std::vector<Types::real>  addedRelativePaths;
+
+                CountAffectedPaths ( sources, blockCutTree, blocks, removedPaths, removedRelativePaths );
+                modifyEdges();
+                CountAffectedPaths ( sources, blockCutTree, blocks, addedPaths, addedRelativePaths );
+
+                Types::real const m_BNormalization = 1 / static_cast<Types::real>( numberOfVertices * ( numberOfVertices - 1 ) );
+                for ( Types::count counter = 0
+                    ; counter < countersSize_
+                    ; ++counter )
+                {
+                    ESSENTIAL_ASSERT ( totalNumberOfPaths_[counter] >= removedPaths[counter] );
+                    totalNumberOfPaths_[counter]         = totalNumberOfPaths_[counter] - removedPaths[counter] + addedPaths[counter];
+                    totalRelativeNumberOfPaths_[counter] += ( addedRelativePaths[counter] - removedRelativePaths[counter] ) * m_BNormalization;
+                }
+                return true;
+            }
         ///@}
 
         ///@name Getter and Setter
@@ -203,6 +414,35 @@ class BetweennessCentrality {
                 return totalNumberOfPaths_;
             }
 
+            /**
+             * @brief      Getter for the half-widths of the confidence
+             *     intervals of the total relative number of paths.
+             * @details    After an approximate run the true centrality of a
+             *     counter lies in the interval
+             *     #TotalRelativeNumberOfPaths @f$\pm@f$ half-width with a
+             *     probability of about SamplingParameters#Confidence. After
+             *     an exact run all half-widths are zero.
+             *
+             * @return     The half-width of the confidence interval per
+             *     edge or vertex.
+             */
+            inline std::vector<Types::real> const & TotalRelativeNumberOfPathsHalfWidth () const
+            {
+                USAGE_ASSERT ( totalRelativeNumberOfPathsHalfWidth_.size() == countersSize_ );
+                return totalRelativeNumberOfPathsHalfWidth_;
+            }
+
+            /**
+             * @brief      Getter for the number of samples.
+             *
+             * @return     The number of sampled sources of the last
+             *     approximate run, or zero after an exact run.
+             */
+            inline Types::count NumberOfSamples () const
+            {
+                return numberOfSamples_;
+            }
+
             /**
              * @brief      Setter for the algorithm.
              *
@@ -242,6 +482,120 @@ class BetweennessCentrality {
             {
                 return collection_;
             }
+
+            /**
+             * @brief      Getter for the source scheduling.
+             *
+             * @return     The source scheduling.
+             */
+            inline SourceScheduling Scheduling () const
+            {
+                return scheduling_;
+            }
+
+            /**
+             * @brief      Setter for the source scheduling.
+             * @details    With SourceScheduling::largestFirst the sources are
+             *     sorted by their estimated costs and handed out dynamically
+             *     in chunks of #ChunkSize sources. The estimate of a source
+             *     is its running time in the previous run, or its degree if
+             *     there was no previous run. The measurements are buffered
+             *     per thread and added to the collection once at the end.
+             *
+             * @return     The source scheduling.
+             */
+            inline SourceScheduling & Scheduling ()
+            {
+                return scheduling_;
+            }
+
+            /**
+             * @brief      Getter for the number of sources per chunk.
+             *
+             * @return     The number of sources per chunk.
+             */
+            inline Types::count ChunkSize () const
+            {
+                return chunkSize_;
+            }
+
+            /**
+             * @brief      Setter for the number of sources per chunk.
+             * @details    This is only used by SourceScheduling::largestFirst.
+             *     Small chunks balance the load better, while large chunks
+             *     reduce the scheduling overhead.
+             *
+             * @return     The number of sources per chunk.
+             */
+            inline Types::count & ChunkSize ()
+            {
+                return chunkSize_;
+            }
+
+            /**
+             * @brief      Getter for the counter reduction.
+             *
+             * @return     The counter reduction.
+             */
+            inline CounterReduction Reduction () const
+            {
+                return reduction_;
+            }
+
+            /**
+             * @brief      Setter for the counter reduction.
+             * @details    With CounterReduction::replicated and
+             *     CounterReduction::treeMerge each thread owns a copy of the
+             *     counters, i.e., the memory grows with the number of
+             *     threads. A copy is allocated when its thread counts the
+             *     first paths, thus threads without a source do not cost
+             *     memory. The merge of CounterReduction::treeMerge releases
+             *     copies, but only after all of them were filled. With
+             *     CounterReduction::atomic there are no copies,
+             *     but each counted path costs atomic updates, which pays off
+             *     for many threads and large graphs. The reduction can be
+             *     changed between two runs. Approximate runs, see #RunSampled,
+             *     need the counters of each sample and thus, always count
+             *     into copies.
+             *
+             * @return     The counter reduction.
+             */
+            inline CounterReduction & Reduction ()
+            {
+                return reduction_;
+            }
+
+            /**
+             * @brief      Getter for the sampling parameters.
+             *
+             * @return     The sampling parameters.
+             */
+            inline SamplingParameters const & Sampling () const
+            {
+                return sampling_;
+            }
+
+            /**
+             * @brief      Setter for the sampling parameters.
+             * @details    With SourceSampling::uniform or
+             *     SourceSampling::stratified, #Run processes the sources in
+             *     batches of SamplingParameters#BatchSize random sources and
+             *     stops as soon as the confidence intervals are narrow
+             *     enough, e.g.,
+             * @code{.cpp}
+             *      betweennessCentrality.Sampling().Method     = SourceSampling::stratified;
+             *      betweennessCentrality.Sampling().ErrorBound = 0.001;
+             *      betweennessCentrality.Run();
+             *      // betweennessCentrality.TotalRelativeNumberOfPathsHalfWidth()
+             * @endcode
+             *     The scheduling does not apply to approximate runs.
+             *
+             * @return     The sampling parameters.
+             */
+            inline SamplingParameters & Sampling ()
+            {
+                return sampling_;
+            }
         ///@}
 
         ///@name Modifier
@@ -262,8 +616,32 @@ class BetweennessCentrality {
                     countersSize_ = graph_.NumberOfVertices();
                 }
 
-                totalRelativeNumberOfPaths_.assign ( countersSize_, 0.0 );
-                totalNumberOfPaths_.assign         ( countersSize_, 0   );
+                totalRelativeNumberOfPaths_.assign          ( countersSize_, 0.0 );
+                totalNumberOfPaths_.assign                  ( countersSize_, 0   );
+                totalRelativeNumberOfPathsHalfWidth_.assign ( countersSize_, 0.0 );
+                numberOfSamples_ = 0;
+                blockCutTree_.reset();
+            }
+
+            /**
+             * @brief      Set whether the path finding algorithms ignore
+             *     switched edges.
+             * @details    This is needed if #Update is used with switched
+             *     edges, see DominatingThetaPath#IgnoreSwitchedEdges.
+             *
+             * @param[in]  ignore  @p true if edges with status @p false are
+             *     ignored, @p false otherwise.
+             */
+            inline void IgnoreSwitchedEdges ( bool ignore )
+            {
+#ifdef OPENMP_AVAILABLE
+                for ( TAlgorithm & algorithm : Algorithm() )
+                {
+                    algorithm.IgnoreSwitchedEdges() = ignore;
+                }
+#else
+                Algorithm().IgnoreSwitchedEdges() = ignore;
+#endif
             }
         ///@}
 
@@ -283,53 +661,140 @@ class BetweennessCentrality {
              *     e.g., for the @f$\SBC@f$ @f$\sbc@f$ the normalization
              *     factor is defined by @f$m_B = |V|\cdot (|V|-1)@f$.
              */
-            inline void JoinThreadBasedResults ( TNumberOfPaths         const & numberOfPaths
-                                               , TRelativeNumberOfPaths const & relativeNumberOfPaths
+            inline void JoinThreadBasedResults ( TNumberOfPaths               & numberOfPaths
+                                               , TRelativeNumberOfPaths       & relativeNumberOfPaths
                                                , Types::real            const & m_BNormalization      )
             {
-#ifdef OPENMP_AVAILABLE
                 ESSENTIAL_ASSERT ( totalRelativeNumberOfPaths_.size() == countersSize_ );
-                ESSENTIAL_ASSERT ( relativeNumberOfPaths.size()       == omp_get_max_threads () );
-                ESSENTIAL_ASSERT ( relativeNumberOfPaths[0].size()    == countersSize_ );
                 ESSENTIAL_ASSERT ( totalNumberOfPaths_.size()         == countersSize_ );
-                ESSENTIAL_ASSERT ( numberOfPaths.size()               == omp_get_max_threads () );
-                ESSENTIAL_ASSERT ( numberOfPaths[0].size()            == countersSize_ );
 
-                for ( Types::count counterThreads = 0
-                    ; counterThreads < omp_get_max_threads()
-                    ; ++counterThreads )
+                // With atomic counters the totals are already complete
+                if ( Reduction() != CounterReduction::atomic )
                 {
-                    for ( Types::count counterEdgesOrVertices = 0
-                        ; counterEdgesOrVertices < countersSize_
-                        ; ++counterEdgesOrVertices )
-                    {
-                        // Total relative number of paths per edge
-                        totalRelativeNumberOfPaths_[counterEdgesOrVertices]    += relativeNumberOfPaths[counterThreads][counterEdgesOrVertices];
-                        totalNumberOfPaths_[counterEdgesOrVertices]            += numberOfPaths[counterThreads][counterEdgesOrVertices];
-                    }
+#ifdef OPENMP_AVAILABLE
+                    ESSENTIAL_ASSERT ( relativeNumberOfPaths.size()       == omp_get_max_threads () );
+                    ESSENTIAL_ASSERT ( numberOfPaths.size()               == omp_get_max_threads () );
+
+                    MergeThreadBasedCounters ( numberOfPaths
+                                             , relativeNumberOfPaths
+                                             , totalNumberOfPaths_
+                                             , totalRelativeNumberOfPaths_ );
+#else // OPENMP IS NOT AVAILABLE
+                    ESSENTIAL_ASSERT ( relativeNumberOfPaths.size()       == countersSize_ );
+                    ESSENTIAL_ASSERT ( numberOfPaths.size()               == countersSize_ );
+
+                    // Total relative number of paths per edge
+                    totalRelativeNumberOfPaths_ = relativeNumberOfPaths;
+                    totalNumberOfPaths_         = numberOfPaths;
+#endif
                 }
 
                 std::transform ( totalRelativeNumberOfPaths_.begin()
                                , totalRelativeNumberOfPaths_.end()
                                , totalRelativeNumberOfPaths_.begin()
                                , std::bind( std::multiplies<Types::real>(), std::placeholders::_1, m_BNormalization ) );
+            }
 
-#else // OPENMP IS NOT AVAILABLE
-                ESSENTIAL_ASSERT ( totalRelativeNumberOfPaths_.size() == countersSize_ );
-                ESSENTIAL_ASSERT ( relativeNumberOfPaths.size()       == countersSize_ );
-                ESSENTIAL_ASSERT ( totalNumberOfPaths_.size()         == countersSize_ );
-                ESSENTIAL_ASSERT ( numberOfPaths.size()               == countersSize_ );
+#ifdef OPENMP_AVAILABLE
+            /**
+             * @brief      Add the counters of all threads to @p
+             *     numberOfPaths and @p relativeNumberOfPaths.
+             * @details    With CounterReduction::treeMerge the copies are
+             *     merged pairwise in @f$\lceil\log_2 p\rceil@f$ rounds for
+             *     @f$p@f$ threads. Each round runs in parallel over blocks of
+             *     counters and releases the copies that were merged.
+             *     Otherwise, the copies are summed up serially. Copies of
+             *     threads that did not count any path are empty and skipped.
+             *
+             *     The merge does not bound the peak memory, since all
+             *     copies are filled during the run before they are merged.
+             *     Only CounterReduction::atomic bounds the memory.
+             *
+             * @param      threadNumberOfPaths          The number of paths per thread.
+             * @param      threadRelativeNumberOfPaths  The relative number of paths per thread.
+             * @param      numberOfPaths                The number of paths.
+             * @param      relativeNumberOfPaths        The relative number of paths.
+             */
+            inline void MergeThreadBasedCounters ( TNumberOfPaths            & threadNumberOfPaths
+                                                 , TRelativeNumberOfPaths    & threadRelativeNumberOfPaths
+                                                 , std::vector<Types::count> & numberOfPaths
+                                                 , std::vector<Types::real>  & relativeNumberOfPaths ) const
+            {
+                Types::count const numberOfThreads = threadNumberOfPaths.size();
 
-                // Total relative number of paths per edge
-                totalRelativeNumberOfPaths_ = relativeNumberOfPaths;
-                totalNumberOfPaths_         = numberOfPaths;
+                if ( Reduction() == CounterReduction::treeMerge )
+                {
+                    Types::count const blockSize       = 4096;
+                    Types::count const numberOfBlocks  = ( countersSize_ + blockSize - 1 ) / blockSize;
 
-                std::transform ( totalRelativeNumberOfPaths_.begin()
-                               , totalRelativeNumberOfPaths_.end()
-                               , totalRelativeNumberOfPaths_.begin()
-                               , std::bind( std::multiplies<Types::real>(), std::placeholders::_1, m_BNormalization ) );
-#endif
+                    for ( Types::count stride = 1
+                        ; stride < numberOfThreads
+                        ; stride *= 2 )
+                    {
+                        #pragma omp parallel for schedule(static)
+                        for ( Types::index block = 0; block < numberOfBlocks; ++block )
+                        {
+                            Types::index const begin = block * blockSize;
+                            Types::index const end   = std::min ( begin + blockSize, countersSize_ );
+                            for ( Types::index thread = 0
+                                ; thread + stride < numberOfThreads
+                                ; thread += 2 * stride )
+                            {
+                                if ( threadNumberOfPaths[thread].empty()
+                                  || threadNumberOfPaths[thread + stride].empty() ) continue;
+
+                                for ( Types::index counter = begin; counter < end; ++counter )
+                                {
+                                    threadNumberOfPaths[thread][counter]         += threadNumberOfPaths[thread + stride][counter];
+                                    threadRelativeNumberOfPaths[thread][counter] += threadRelativeNumberOfPaths[thread + stride][counter];
+                                }
+                            }
+                        }
+
+                        // The merged copies are not needed anymore, and a
+                        // copy is moved if its partner is empty
+                        for ( Types::index thread = stride
+                            ; thread < numberOfThreads
+                            ; thread += 2 * stride )
+                        {
+                            if ( threadNumberOfPaths[thread - stride].empty() )
+                            {
+                                threadNumberOfPaths[thread - stride].swap         ( threadNumberOfPaths[thread] );
+                                threadRelativeNumberOfPaths[thread - stride].swap ( threadRelativeNumberOfPaths[thread] );
+                            }
+                            std::vector<Types::count>().swap ( threadNumberOfPaths[thread] );
+                            std::vector<Types::real>().swap  ( threadRelativeNumberOfPaths[thread] );
+                        }
+                    }
+
+                    if ( threadNumberOfPaths[0].empty() ) return;
+                    for ( Types::count counter = 0
+                        ; counter < countersSize_
+                        ; ++counter )
+                    {
+                        numberOfPaths[counter]         += threadNumberOfPaths[0][counter];
+                        relativeNumberOfPaths[counter] += threadRelativeNumberOfPaths[0][counter];
+                    }
+                    return;
+                }
+
+                for ( Types::count counterThreads = 0
+                    ; counterThreads < numberOfThreads
+                    ; ++counterThreads )
+                {
+                    if ( threadNumberOfPaths[counterThreads].empty() ) continue;
+
+                    for ( Types::count counterEdgesOrVertices = 0
+                        ; counterEdgesOrVertices < countersSize_
+                        ; ++counterEdgesOrVertices )
+                    {
+                        // Total relative number of paths per edge
+                        relativeNumberOfPaths[counterEdgesOrVertices]  += threadRelativeNumberOfPaths[counterThreads][counterEdgesOrVertices];
+                        numberOfPaths[counterEdgesOrVertices]          += threadNumberOfPaths[counterThreads][counterEdgesOrVertices];
+                    }
+                }
             }
+#endif // OPENMP_AVAILABLE
 
             /**
              * @brief      Total number of paths.
@@ -343,51 +808,1074 @@ class BetweennessCentrality {
                                            , TRelativeNumberOfPaths & relativeNumberOfPaths )
             {
 #ifdef OPENMP_AVAILABLE
-                if ( CentralityCounterType == CentralityCounter::counterAtEdges )
+                CountPaths ( Algorithm()[ omp_get_thread_num() ]
+                           , CountersOfThread ( numberOfPaths )
+                           , CountersOfThread ( relativeNumberOfPaths ) );
+#else
+                CountPaths ( Algorithm()
+                           , CountersOfThread ( numberOfPaths )
+                           , CountersOfThread ( relativeNumberOfPaths ) );
+#endif
+            }
+
+            /**
+             * @brief      The counters into which the calling thread counts.
+             * @details    These are the total counters for
+             *     CounterReduction::atomic and the copy of the calling thread
+             *     otherwise, see #CopyOfThread.
+             *
+             * @param      numberOfPaths  The number of paths per thread.
+             *
+             * @return     The counters of the calling thread.
+             */
+            inline std::vector<Types::count> & CountersOfThread ( TNumberOfPaths & numberOfPaths )
+            {
+                return CountersOfThread ( numberOfPaths, totalNumberOfPaths_ );
+            }
+
+            /**
+             * @brief      The counters into which the calling thread counts.
+             *
+             * @param      relativeNumberOfPaths  The relative number of paths per thread.
+             *
+             * @return     The counters of the calling thread.
+             */
+            inline std::vector<Types::real> & CountersOfThread ( TRelativeNumberOfPaths & relativeNumberOfPaths )
+            {
+                return CountersOfThread ( relativeNumberOfPaths, totalRelativeNumberOfPaths_ );
+            }
+
+            /**
+             * @brief      The counters into which the calling thread counts.
+             * @details    These are @p sharedCounters for
+             *     CounterReduction::atomic and the copy of the calling thread
+             *     otherwise, see #CopyOfThread.
+             *
+             * @param      copies          The copies of the counters per thread.
+             * @param      sharedCounters  The counters that all threads share.
+             *
+             * @tparam     TCounter        The type of a counter.
+             *
+             * @return     The counters of the calling thread.
+             */
+            template<typename TCounter>
+            inline std::vector<TCounter> & CountersOfThread ( TCountersPerThread<TCounter> & copies
+                                                            , std::vector<TCounter>        & sharedCounters )
+            {
+                if ( Reduction() == CounterReduction::atomic ) return sharedCounters;
+                return CopyOfThread ( copies );
+            }
+
+            /**
+             * @brief      The copy of the counters of the calling thread.
+             * @details    The copy is allocated on the first call, thus,
+             *     threads without a source do not cost memory. A copy
+             *     reserves a spare cache line behind its counters, thus, the
+             *     copies of two threads never share a cache line.
+             *
+             * @param      copies    The copies of the counters per thread.
+             *
+             * @tparam     TCounter  The type of a counter.
+             *
+             * @return     The copy of the calling thread.
+             */
+            template<typename TCounter>
+            inline std::vector<TCounter> & CopyOfThread ( TCountersPerThread<TCounter> & copies )
+            {
+#ifdef OPENMP_AVAILABLE
+                std::vector<TCounter> & counters = copies[ omp_get_thread_num() ];
+#else
+                std::vector<TCounter> & counters = copies;
+#endif
+                if ( counters.empty() )
                 {
-                    Algorithm()[ omp_get_thread_num() ].TotalNumberOfPathsThroughEdge ( numberOfPaths[ omp_get_thread_num() ]
-                                                                                      , relativeNumberOfPaths[ omp_get_thread_num() ] );
-                } else {
-                    Algorithm()[ omp_get_thread_num() ].TotalNumberOfPathsThroughVertex ( numberOfPaths[ omp_get_thread_num() ]
-                                                                                        , relativeNumberOfPaths[ omp_get_thread_num() ] );
+                    counters.reserve ( countersSize_ + CACHE_LINE_SIZE / sizeof ( TCounter ) );
+                    counters.assign  ( countersSize_, TCounter ( 0 ) );
                 }
-#else
-                if ( CentralityCounterType == CentralityCounter::counterAtEdges )
+                return counters;
+            }
+
+            /**
+             * @brief      Count the paths from the current source of @p
+             *     algorithm to all sinks.
+             * @details    This method abstracts the usage of the
+             *     CentralityCounter and the CounterReduction.
+             *
+             * @param      algorithm              The path finding algorithm of the calling thread.
+             * @param      numberOfPaths          The number of paths.
+             * @param      relativeNumberOfPaths  The relative number of paths.
+             */
+            inline void CountPaths ( TAlgorithm                & algorithm
+                                   , std::vector<Types::count> & numberOfPaths
+                                   , std::vector<Types::real>  & relativeNumberOfPaths )
+            {
+                if ( Reduction() == CounterReduction::atomic )
+                {
+                    graph_.template for_all_vertex_identifiers<ExecutionPolicy::sequential> ( [ & ] ( TVertexId sink )
+                    {
+                        CountPathsTo ( algorithm, sink, numberOfPaths, relativeNumberOfPaths );
+                    });
+                } else if ( CentralityCounterType == CentralityCounter::counterAtEdges )
                 {
-                    Algorithm().TotalNumberOfPathsThroughEdge   ( numberOfPaths, relativeNumberOfPaths );
+                    algorithm.TotalNumberOfPathsThroughEdge   ( numberOfPaths, relativeNumberOfPaths );
                 } else {
-                    Algorithm().TotalNumberOfPathsThroughVertex ( numberOfPaths, relativeNumberOfPaths );
+                    algorithm.TotalNumberOfPathsThroughVertex ( numberOfPaths, relativeNumberOfPaths );
                 }
-#endif
             }
-        ///@}
-
-        ///@name Protected Modifiers
-        ///@{
-#pragma mark PROTECTED_MODIFIERS
 
             /**
-             * @brief      Clear all.
+             * @brief      Count the paths from the current source of @p
+             *     algorithm to one sink.
+             * @details    With CounterReduction::atomic the counters are
+             *     shared by all threads and updated atomically.
              *
+             * @param      algorithm              The path finding algorithm of the calling thread.
+             * @param[in]  sink                   The sink.
              * @param      numberOfPaths          The number of paths.
              * @param      relativeNumberOfPaths  The relative number of paths.
              */
-            inline void Clear ( TNumberOfPaths         & numberOfPaths
-                              , TRelativeNumberOfPaths & relativeNumberOfPaths )
+            inline void CountPathsTo ( TAlgorithm                & algorithm
+                                     , TVertexId                   sink
+                                     , std::vector<Types::count> & numberOfPaths
+                                     , std::vector<Types::real>  & relativeNumberOfPaths )
             {
-                Clear();
+                if ( Reduction() != CounterReduction::atomic )
+                {
+                    if ( CentralityCounterType == CentralityCounter::counterAtEdges )
+                    {
+                        algorithm.NumberOfPathsThroughEdge   ( sink, numberOfPaths, relativeNumberOfPaths );
+                    } else {
+                        algorithm.NumberOfPathsThroughVertex ( sink, numberOfPaths, relativeNumberOfPaths );
+                    }
+                    return;
+                }
+
+                auto count = [ & numberOfPaths
+                             , & relativeNumberOfPaths ] ( Types::index index, Types::real weightOfPath )
+                {
 #ifdef OPENMP_AVAILABLE
-                numberOfPaths.assign         ( omp_get_max_threads(), std::vector<Types::count> ( countersSize_, 0   ) );
-                relativeNumberOfPaths.assign ( omp_get_max_threads(), std::vector<Types::real>  ( countersSize_, 0.0 ) );
-#else
-                numberOfPaths.assign         ( countersSize_, 0   );
-                relativeNumberOfPaths.assign ( countersSize_, 0.0 );
+                    #pragma omp atomic
 #endif
-            }
-        ///@}
+                    ++numberOfPaths[index];
+#ifdef OPENMP_AVAILABLE
+                    #pragma omp atomic
+#endif
+                    relativeNumberOfPaths[index] += weightOfPath;
+                };
 
-#pragma mark MEMBERS
-    private:
+                if ( CentralityCounterType == CentralityCounter::counterAtEdges )
+                {
+                    algorithm.for_all_edges_on_optimal_paths_to    ( sink, count );
+                } else {
+                    algorithm.for_all_vertices_on_optimal_paths_to ( sink, count );
+                }
+            }
+        ///@}
+
+        ///@name Source Scheduling
+        ///@{
+#pragma mark SOURCE_SCHEDULING
+
+            /**
+             * @brief      Run the path finding algorithm from all @p sources,
+             *     the most expensive sources first.
+             * @details    The sources are handed out dynamically in chunks of
+             *     #ChunkSize sources, i.e., a thread that finishes early takes
+             *     the next chunk. Since the expensive sources are started
+             *     first, the remaining chunks at the end of the run are cheap.
+             *     The measurements are buffered per thread and merged once
+             *     after all sources are processed.
+             *
+             * @param      sources           The sources.
+             * @param[in]  m_BNormalization  The normalization factor.
+             * @param[in]  updateRow         The function object that is
+             *     called for each measurement row before it is added to the
+             *     collection, e.g.,
+             * @code{.cpp}
+             *      []( TMeasurementRow & row ) { row.NumberOfGenerators = 3; }
+             * @endcode
+             *
+             * @tparam     FUNCTION          The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void RunLargestSourcesFirst ( std::vector<TVertexId>         sources
+                                               , Types::real            const   m_BNormalization
+                                               , FUNCTION                       updateRow )
+            {
+                USAGE_ASSERT ( ChunkSize() > 0 );
+
+                TNumberOfPaths         numberOfPaths;
+                TRelativeNumberOfPaths relativeNumberOfPaths;
+
+                Clear ( numberOfPaths, relativeNumberOfPaths );
+                SortByEstimatedCosts ( sources );
+
+#ifdef OPENMP_AVAILABLE
+                std::vector<std::vector<TMeasurementRow>> rows ( omp_get_max_threads() );
+                Types::count const numberOfSources = sources.size();
+                Types::count const chunkSize       = ChunkSize();
+
+                #pragma omp parallel for schedule(dynamic, chunkSize)
+                for ( Types::index index = 0; index < numberOfSources; ++index )
+                {
+                    Types::index const threadId = omp_get_thread_num();
+                    RunSource ( sources[index]
+                              , Algorithm()[threadId]
+                              , CountersOfThread ( numberOfPaths )
+                              , CountersOfThread ( relativeNumberOfPaths )
+                              , rows[threadId] );
+                }
+
+                for ( std::vector<TMeasurementRow> & threadRows : rows )
+                {
+                    for ( TMeasurementRow & row : threadRows )
+                    {
+                        updateRow ( row );
+                        Collection() += row;
+                    }
+                }
+#else // OPENMP IS NOT AVAILABLE
+                std::vector<TMeasurementRow> rows;
+                for ( TVertexId source : sources )
+                {
+                    RunSource ( source
+                              , Algorithm()
+                              , CountersOfThread ( numberOfPaths )
+                              , CountersOfThread ( relativeNumberOfPaths )
+                              , rows );
+                }
+
+                for ( TMeasurementRow & row : rows )
+                {
+                    updateRow ( row );
+                    Collection() += row;
+                }
+#endif // OPENMP_AVAILABLE
+
+                JoinThreadBasedResults ( numberOfPaths
+                                       , relativeNumberOfPaths
+                                       , m_BNormalization );
+            }
+
+            /**
+             * @brief      Run the path finding algorithm from one source and
+             *     add its paths to the counters of the calling thread.
+             *
+             * @param[in]  source                 The source.
+             * @param      algorithm              The path finding algorithm of the calling thread.
+             * @param      numberOfPaths          The number of paths of the calling thread.
+             * @param      relativeNumberOfPaths  The relative number of paths of the calling thread.
+             * @param      rows                   The measurements of the calling thread.
+             */
+            inline void RunSource ( TVertexId                      source
+                                  , TAlgorithm                   & algorithm
+                                  , std::vector<Types::count>    & numberOfPaths
+                                  , std::vector<Types::real>     & relativeNumberOfPaths
+                                  , std::vector<TMeasurementRow> & rows )
+            {
+                Auxiliary::Timer timer;
+
+                algorithm.Clear();
+                algorithm.Source ( source );
+                algorithm.Run();
+                CountPaths ( algorithm, numberOfPaths, relativeNumberOfPaths );
+
+                // Each source is processed by exactly one thread
+                sourceCosts_[source] = timer.ElapsedMilliseconds();
+
+#ifdef EGOA_ENABLE_STATISTIC_BETWEENNESS_CENTRALITY
+                rows.emplace_back ( algorithm.Statistic() );
+#else
+                static_cast<void>( rows );
+#endif // EGOA_ENABLE_STATISTIC_BETWEENNESS_CENTRALITY
+            }
+
+            /**
+             * @brief      Sort the sources by their estimated costs in
+             *     decreasing order.
+             * @details    The estimate is the running time of the source in
+             *     the previous run. Before the first run, the degree of the
+             *     source is used.
+             *
+             * @param      sources  The sources.
+             */
+            inline void SortByEstimatedCosts ( std::vector<TVertexId> & sources )
+            {
+                EstimateSourceCosts();
+                std::stable_sort ( sources.begin(), sources.end()
+                                 , [ this ] ( TVertexId lhs, TVertexId rhs )
+                                 {
+                                     return sourceCosts_[lhs] > sourceCosts_[rhs];
+                                 });
+            }
+
+            /**
+             * @brief      Initialize the estimated costs of the sources by
+             *     their degrees if there was no previous run.
+             */
+            inline void EstimateSourceCosts ()
+            {
+                if ( sourceCosts_.size() == graph_.NumberOfVertices() ) return;
+
+                sourceCosts_.assign ( graph_.NumberOfVertices(), 0.0 );
+                graph_.template for_all_vertex_identifiers<ExecutionPolicy::sequential> ( [ this ] ( TVertexId vertexId )
+                {
+                    sourceCosts_[vertexId] = static_cast<Types::real>( graph_.DegreeAt ( vertexId ) );
+                });
+            }
+        ///@}
+
+        ///@name Source Sampling
+        ///@{
+#pragma mark SOURCE_SAMPLING
+
+            /**
+             * @brief      A stratum of the sources together with the sums
+             *     over its samples.
+             */
+            struct SampleStratum {
+                std::vector<TVertexId>                  sources;                        /**< The sources of the stratum. */
+                std::vector<Types::real>                weights;                        /**< The sampling weights of the sources, or empty for uniform weights. */
+                std::discrete_distribution<Types::index> distribution;                  /**< The distribution of the positions of the sources with respect to the weights. */
+                Types::real                             size;                           /**< The number of sources, or the sum of the weights. */
+                Types::count                            numberOfSamples;                /**< The number of samples drawn from the stratum. */
+                std::vector<Types::real>                numberOfPaths;                  /**< The sum of the scaled number of paths of the samples. */
+                std::vector<Types::real>                relativeNumberOfPaths;          /**< The sum of the scaled relative number of paths of the samples. */
+                std::vector<Types::real>                squaredRelativeNumberOfPaths;   /**< The sum of the squared scaled relative number of paths of the samples. */
+            };
+
+            /**
+             * @brief      A sampled source.
+             */
+            struct Sample {
+                TVertexId       source;         /**< The source. */
+                Types::index    stratum;        /**< The stratum of the source. */
+                Types::real     scale;          /**< The inverse of the probability to draw the source from its stratum. */
+                Types::count    multiplicity;   /**< The number of times the source was drawn in the batch. */
+            };
+
+            /**
+             * @brief      Estimate the betweenness centrality from a sample
+             *     of @p sources.
+             * @details    Without @p weights the sources of each stratum are
+             *     sampled without replacement. A sample @f$\source@f$ of a
+             *     stratum with @f$N_h@f$ sources contributes its paths scaled
+             *     by @f$N_h@f$. With @p weights the sources are sampled with
+             *     replacement with probability @f$p_{\source} =
+             *     w_{\source}/W_h@f$ and contribute their paths scaled by
+             *     @f$1/p_{\source}@f$. In both cases the mean of the scaled
+             *     samples of a stratum is an unbiased estimate of its sum,
+             *     and the estimate of the centrality is the sum over all
+             *     strata.
+             *
+             *     The samples are drawn in batches of
+             *     SamplingParameters#BatchSize sources from the seeded
+             *     generator, i.e., the sample does not depend on the number
+             *     of threads. After each batch the variance of the estimate
+             *     is derived from the sample variances of the strata. The
+             *     sampling stops if the half-width of all confidence
+             *     intervals is at most SamplingParameters#ErrorBound, if
+             *     SamplingParameters#MaximumNumberOfSamples sources are
+             *     sampled, or if all sources are sampled. In the latter case
+             *     the result is exact. Since sampling with replacement never
+             *     runs out of sources, weighted sampling needs one of the
+             *     first two stopping rules.
+             *
+             * @pre        If @p weights are given, either
+             *     SamplingParameters#ErrorBound is positive or
+             *     SamplingParameters#MaximumNumberOfSamples is finite.
+             *
+             * @param      sources           The sources.
+             * @param[in]  weights           The sampling weight per vertex,
+             *     or empty for uniform sampling. The weights of the sources
+             *     have to be positive.
+             * @param[in]  m_BNormalization  The normalization factor.
+             * @param[in]  updateRow         The function object that is
+             *     called for each measurement row before it is added to the
+             *     collection.
+             *
+             * @tparam     FUNCTION          The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void RunSampled ( std::vector<TVertexId>                 sources
+                                   , std::vector<Types::real>       const & weights
+                                   , Types::real                    const   m_BNormalization
+                                   , FUNCTION                               updateRow )
+            {
+                USAGE_ASSERT ( Sampling().BatchSize > 0 );
+                USAGE_ASSERT ( Sampling().Confidence > 0 && Sampling().Confidence < 1 );
+                USAGE_ASSERT ( weights.empty() || weights.size() == graph_.NumberOfVertices() );
+                USAGE_ASSERT ( weights.empty()
+                            || Sampling().ErrorBound > 0
+                            || Sampling().MaximumNumberOfSamples != Const::INFTY );
+
+                Clear();
+                if ( sources.empty() ) return;
+
+                // The sources record their running times, see RunSource
+                EstimateSourceCosts();
+
+                std::mt19937_64 generator ( Sampling().Seed );
+                std::vector<SampleStratum> strata = Stratify ( sources, weights, generator );
+                Types::real const quantile = StandardNormalQuantile ( ( 1 + Sampling().Confidence ) / 2 );
+
+                // Each sample needs its own counters, thus, the threads count
+                // into their copies also for CounterReduction::atomic
+                TNumberOfPaths         numberOfPaths;
+                TRelativeNumberOfPaths relativeNumberOfPaths;
+#ifdef OPENMP_AVAILABLE
+                numberOfPaths.resize         ( omp_get_max_threads() );
+                relativeNumberOfPaths.resize ( omp_get_max_threads() );
+                std::vector<std::vector<TMeasurementRow>> rows ( omp_get_max_threads() );
+#else // OPENMP IS NOT AVAILABLE
+                std::vector<TMeasurementRow> rows;
+#endif // OPENMP_AVAILABLE
+
+                std::vector<Sample> batch;
+                while ( numberOfSamples_ < Sampling().MaximumNumberOfSamples )
+                {
+                    DrawBatch ( strata
+                              , Sampling().MaximumNumberOfSamples - numberOfSamples_
+                              , generator
+                              , batch );
+                    if ( batch.empty() ) break;
+
+#ifdef OPENMP_AVAILABLE
+                    Types::count const batchSize = batch.size();
+
+                    #pragma omp parallel for schedule(dynamic, 1)
+                    for ( Types::index index = 0; index < batchSize; ++index )
+                    {
+                        Types::index const threadId = omp_get_thread_num();
+                        RunSample ( batch[index]
+                                  , strata
+                                  , Algorithm()[threadId]
+                                  , CopyOfThread ( numberOfPaths )
+                                  , CopyOfThread ( relativeNumberOfPaths )
+                                  , rows[threadId] );
+                    }
+#else // OPENMP IS NOT AVAILABLE
+                    for ( Sample const & sample : batch )
+                    {
+                        RunSample ( sample
+                                  , strata
+                                  , Algorithm()
+                                  , CopyOfThread ( numberOfPaths )
+                                  , CopyOfThread ( relativeNumberOfPaths )
+                                  , rows );
+                    }
+#endif // OPENMP_AVAILABLE
+
+                    for ( Sample const & sample : batch )
+                    {
+                        numberOfSamples_ += sample.multiplicity;
+                    }
+
+                    if ( Estimate ( strata, quantile, m_BNormalization ) <= Sampling().ErrorBound ) break;
+                }
+                Estimate ( strata, quantile, m_BNormalization );
+
+#ifdef OPENMP_AVAILABLE
+                for ( std::vector<TMeasurementRow> & threadRows : rows )
+                {
+                    for ( TMeasurementRow & row : threadRows )
+                    {
+                        updateRow ( row );
+                        Collection() += row;
+                    }
+                }
+#else // OPENMP IS NOT AVAILABLE
+                for ( TMeasurementRow & row : rows )
+                {
+                    updateRow ( row );
+                    Collection() += row;
+                }
+#endif // OPENMP_AVAILABLE
+            }
+
+            /**
+             * @brief      Divide the sources into strata.
+             * @details    With SourceSampling::stratified the sources are
+             *     sorted by their estimated costs, see #SortByEstimatedCosts,
+             *     and cut into SamplingParameters#NumberOfStrata strata of
+             *     equal size. Thus, each stratum contains sources of similar
+             *     costs and, for most graphs, of similar contributions.
+             *     Otherwise, there is only one stratum.
+             *
+             * @param      sources    The sources.
+             * @param[in]  weights    The sampling weight per vertex, or empty.
+             * @param      generator  The random number generator.
+             *
+             * @return     The strata without samples.
+             */
+            inline std::vector<SampleStratum> Stratify ( std::vector<TVertexId>         & sources
+                                                       , std::vector<Types::real> const & weights
+                                                       , std::mt19937_64                & generator )
+            {
+                Types::count numberOfStrata = 1;
+                if ( Sampling().Method == SourceSampling::stratified )
+                {
+                    USAGE_ASSERT ( Sampling().NumberOfStrata > 0 );
+                    numberOfStrata = std::min<Types::count> ( Sampling().NumberOfStrata, sources.size() );
+                    SortByEstimatedCosts ( sources );
+                }
+
+                std::vector<SampleStratum> strata ( numberOfStrata );
+                for ( Types::index index = 0; index < sources.size(); ++index )
+                {
+                    SampleStratum & stratum = strata[ index * numberOfStrata / sources.size() ];
+                    stratum.sources.emplace_back ( sources[index] );
+                    if ( weights.empty() ) continue;
+
+                    USAGE_ASSERT ( weights[sources[index]] > 0 );
+                    stratum.weights.emplace_back ( weights[sources[index]] );
+                }
+
+                for ( SampleStratum & stratum : strata )
+                {
+                    if ( stratum.weights.empty() )
+                    {
+                        std::shuffle ( stratum.sources.begin(), stratum.sources.end(), generator );
+                        stratum.size = static_cast<Types::real>( stratum.sources.size() );
+                    } else {
+                        stratum.distribution = std::discrete_distribution<Types::index> ( stratum.weights.begin(), stratum.weights.end() );
+                        stratum.size         = std::accumulate ( stratum.weights.begin(), stratum.weights.end(), 0.0 );
+                    }
+                    stratum.numberOfSamples = 0;
+                    stratum.numberOfPaths.assign                ( countersSize_, 0.0 );
+                    stratum.relativeNumberOfPaths.assign        ( countersSize_, 0.0 );
+                    stratum.squaredRelativeNumberOfPaths.assign ( countersSize_, 0.0 );
+                }
+                return strata;
+            }
+
+            /**
+             * @brief      Draw the next batch of samples.
+             * @details    Each stratum gets a share of the batch that is
+             *     proportional to its size, but at least one sample, and at
+             *     least two samples in total to estimate its variance. A
+             *     source that is drawn several times is run only once.
+             *
+             * @param      strata     The strata.
+             * @param[in]  limit      The maximum number of samples.
+             * @param      generator  The random number generator.
+             * @param      batch      The samples of the batch.
+             */
+            inline void DrawBatch ( std::vector<SampleStratum> & strata
+                                  , Types::count                 limit
+                                  , std::mt19937_64            & generator
+                                  , std::vector<Sample>        & batch ) const
+            {
+                batch.clear();
+
+                Types::real totalSize = 0.0;
+                for ( SampleStratum const & stratum : strata )
+                {
+                    totalSize += stratum.size;
+                }
+
+                Types::count numberOfSamples = 0;
+                for ( Types::index index = 0
+                    ; index < strata.size() && numberOfSamples < limit
+                    ; ++index )
+                {
+                    SampleStratum & stratum = strata[index];
+                    Types::count number = std::max<Types::count> ( 1, std::llround ( Sampling().BatchSize * stratum.size / totalSize ) );
+                    number = std::max<Types::count> ( number, 2 - std::min<Types::count> ( 2, stratum.numberOfSamples ) );
+                    number = std::min<Types::count> ( number, limit - numberOfSamples );
+
+                    if ( stratum.weights.empty() )
+                    { // Without replacement, the sources are shuffled
+                        number = std::min<Types::count> ( number, stratum.sources.size() - stratum.numberOfSamples );
+                        for ( Types::count counter = 0; counter < number; ++counter )
+                        {
+                            batch.emplace_back ( Sample { stratum.sources[stratum.numberOfSamples + counter]
+                                                        , index
+                                                        , stratum.size
+                                                        , 1 } );
+                        }
+                    } else
+                    { // With replacement
+                        std::vector<Types::index> positions ( number );
+                        for ( Types::index & position : positions )
+                        {
+                            position = stratum.distribution ( generator );
+                        }
+                        std::sort ( positions.begin(), positions.end() );
+
+                        for ( Types::index begin = 0, end = 0; begin < number; begin = end )
+                        {
+                            while ( end < number && positions[end] == positions[begin] ) ++end;
+                            batch.emplace_back ( Sample { stratum.sources[positions[begin]]
+                                                        , index
+                                                        , stratum.size / stratum.weights[positions[begin]]
+                                                        , end - begin } );
+                        }
+                    }
+                    stratum.numberOfSamples += number;
+                    numberOfSamples         += number;
+                }
+            }
+
+            /**
+             * @brief      Run the path finding algorithm from a sampled
+             *     source and add its scaled paths to the sums of its stratum.
+             *
+             * @param[in]  sample                 The sample.
+             * @param      strata                 The strata.
+             * @param      algorithm              The path finding algorithm of the calling thread.
+             * @param      numberOfPaths          The number of paths of the calling thread.
+             * @param      relativeNumberOfPaths  The relative number of paths of the calling thread.
+             * @param      rows                   The measurements of the calling thread.
+             */
+            inline void RunSample ( Sample                       const & sample
+                                  , std::vector<SampleStratum>         & strata
+                                  , TAlgorithm                         & algorithm
+                                  , std::vector<Types::count>          & numberOfPaths
+                                  , std::vector<Types::real>           & relativeNumberOfPaths
+                                  , std::vector<TMeasurementRow>       & rows )
+            {
+                std::fill ( numberOfPaths.begin(),         numberOfPaths.end(),         0   );
+                std::fill ( relativeNumberOfPaths.begin(), relativeNumberOfPaths.end(), 0.0 );
+                RunSource ( sample.source, algorithm, numberOfPaths, relativeNumberOfPaths, rows );
+
+                SampleStratum    & stratum      = strata[sample.stratum];
+                Types::real const  multiplicity = static_cast<Types::real>( sample.multiplicity );
+#ifdef OPENMP_AVAILABLE
+                #pragma omp critical
+#endif // OPENMP_AVAILABLE
+                {
+                    for ( Types::count counter = 0
+                        ; counter < countersSize_
+                        ; ++counter )
+                    {
+                        Types::real const relative = sample.scale * relativeNumberOfPaths[counter];
+                        stratum.numberOfPaths[counter]                += multiplicity * sample.scale * numberOfPaths[counter];
+                        stratum.relativeNumberOfPaths[counter]        += multiplicity * relative;
+                        stratum.squaredRelativeNumberOfPaths[counter] += multiplicity * relative * relative;
+                    }
+                }
+            }
+
+            /**
+             * @brief      Set the totals and the half-widths of the
+             *     confidence intervals to the estimates of the strata.
+             *
+             * @param[in]  strata            The strata.
+             * @param[in]  quantile          The quantile of the standard
+             *     normal distribution that belongs to the confidence level.
+             * @param[in]  m_BNormalization  The normalization factor.
+             *
+             * @return     The maximum half-width of all confidence intervals.
+             */
+            inline Types::real Estimate ( std::vector<SampleStratum> const & strata
+                                        , Types::real                        quantile
+                                        , Types::real                        m_BNormalization )
+            {
+                Types::real maximumHalfWidth = 0.0;
+                for ( Types::count counter = 0
+                    ; counter < countersSize_
+                    ; ++counter )
+                {
+                    Types::real numberOfPaths         = 0.0;
+                    Types::real relativeNumberOfPaths = 0.0;
+                    Types::real variance              = 0.0;
+                    for ( SampleStratum const & stratum : strata )
+                    {
+                        variance += VarianceOfMean ( stratum, counter );
+                        if ( stratum.numberOfSamples == 0 ) continue;
+                        numberOfPaths         += stratum.numberOfPaths[counter]         / stratum.numberOfSamples;
+                        relativeNumberOfPaths += stratum.relativeNumberOfPaths[counter] / stratum.numberOfSamples;
+                    }
+
+                    totalNumberOfPaths_[counter]                  = static_cast<Types::count>( std::llround ( numberOfPaths ) );
+                    totalRelativeNumberOfPaths_[counter]          = relativeNumberOfPaths * m_BNormalization;
+                    totalRelativeNumberOfPathsHalfWidth_[counter] = quantile * std::sqrt ( variance ) * m_BNormalization;
+                    maximumHalfWidth = std::max ( maximumHalfWidth, totalRelativeNumberOfPathsHalfWidth_[counter] );
+                }
+                return maximumHalfWidth;
+            }
+
+            /**
+             * @brief      The estimated variance of the mean of the scaled
+             *     relative number of paths of a stratum.
+             * @details    Without replacement the sample variance is
+             *     multiplied by the finite population correction
+             *     @f$1 - n_h/N_h@f$, i.e., a completely sampled stratum
+             *     has no variance.
+             *
+             * @param[in]  stratum  The stratum.
+             * @param[in]  counter  The edge or vertex.
+             *
+             * @return     The variance, or infinity if it cannot be
+             *     estimated yet.
+             */
+            inline Types::real VarianceOfMean ( SampleStratum const & stratum
+                                              , Types::index          counter ) const
+            {
+                Types::real const numberOfSamples = static_cast<Types::real>( stratum.numberOfSamples );
+                Types::real correction = 1.0;
+                if ( stratum.weights.empty() )
+                {
+                    if ( stratum.numberOfSamples == stratum.sources.size() ) return 0.0;
+                    correction = 1 - numberOfSamples / stratum.size;
+                }
+                if ( stratum.numberOfSamples < 2 ) return std::numeric_limits<Types::real>::infinity();
+
+                Types::real const mean     = stratum.relativeNumberOfPaths[counter] / numberOfSamples;
+                Types::real const variance = ( stratum.squaredRelativeNumberOfPaths[counter] - numberOfSamples * mean * mean )
+                                           / ( numberOfSamples - 1 );
+                return correction * std::max ( variance, 0.0 ) / numberOfSamples;
+            }
+
+            /**
+             * @brief      The quantile function of the standard normal
+             *     distribution.
+             *
+             * @param[in]  probability  The probability in @f$(0,1)@f$.
+             *
+             * @return     The value @f$z@f$ with @f$\Phi(z) = @f$ @p probability.
+             */
+            static inline Types::real StandardNormalQuantile ( Types::real probability )
+            {
+                USAGE_ASSERT ( probability > 0 && probability < 1 );
+
+                Types::real lower = -10.0;
+                Types::real upper =  10.0;
+                for ( Types::count iteration = 0; iteration < 100; ++iteration )
+                {
+                    Types::real const middle = ( lower + upper ) / 2;
+                    if ( std::erfc ( -middle / std::sqrt ( 2.0 ) ) / 2 < probability )
+                    {
+                        lower = middle;
+                    } else {
+                        upper = middle;
+                    }
+                }
+                return ( lower + upper ) / 2;
+            }
+        ///@}
+
+        ///@name Incremental Update
+        ///@{
+#pragma mark INCREMENTAL_UPDATE
+
+            /**
+             * @brief      A changed block of the BlockCutTree together with
+             *     the way from each vertex to it.
+             */
+            struct SeparatedBlock {
+                Types::blockId              identifier;         /**< The identifier of the changed block. */
+                std::vector<TVertexId>      attachment;         /**< The vertex of the changed block through which a vertex reaches the block. */
+                std::vector<Types::blockId> upperBlock;         /**< The block through which a vertex reaches the changed block. */
+                std::vector<TVertexId>      parentCutVertex;    /**< The cut vertex through which a block reaches the changed block. */
+                std::vector<Types::count>   attachmentSize;     /**< The number of vertices per attachment. */
+                std::vector<Types::count>   wayToBlockSize;     /**< The number of vertices of the blocks between a block and the changed block. */
+            };
+
+            /**
+             * @brief      Root the BlockCutTree at a changed block.
+             * @details    Two vertices with the same attachment are
+             *     connected by simple paths that do not use an edge of the
+             *     block. The sizes of the attachments and of the ways to the
+             *     block are counted once here, so that the affected region
+             *     of a source can be estimated without scanning all vertices,
+             *     see #AffectedRegionSizeOf. This takes @f$\Theta(n + m)@f$
+             *     time.
+             *
+             * @param[in]  blockCutTree  The block-cut tree of the graph.
+             * @param[in]  blockId       The identifier of the changed block.
+             *
+             * @return     The block with the attachment and the upper block
+             *     of each vertex.
+             */
+            inline SeparatedBlock SeparateAt ( BlockCutTree<TGraph> const & blockCutTree
+                                             , Types::blockId               blockId ) const
+            {
+                SeparatedBlock result;
+                result.identifier = blockId;
+                result.attachment.assign      ( graph_.NumberOfVertices(),     Const::NONE );
+                result.upperBlock.assign      ( graph_.NumberOfVertices(),     Const::NONE );
+                result.parentCutVertex.assign ( blockCutTree.NumberOfBlocks(), Const::NONE );
+                result.attachmentSize.assign  ( graph_.NumberOfVertices(),     0 );
+                result.wayToBlockSize.assign  ( blockCutTree.NumberOfBlocks(), 0 );
+
+                for ( TVertexId vertexId : blockCutTree.BlockAt ( blockId ).Subgraph().Vertices() )
+                {
+                    result.attachment[vertexId] = vertexId;
+                    result.upperBlock[vertexId] = blockId;
+                }
+
+                std::vector<bool> visited ( blockCutTree.NumberOfBlocks(), false );
+                std::queue<Types::blockId> queue;
+                visited[blockId] = true;
+                queue.push ( blockId );
+
+                while ( !queue.empty() )
+                {
+                    Types::blockId const current = queue.front();
+                    queue.pop();
+
+                    for ( TVertexId cutVertex : blockCutTree.BlockAt ( current ).Subgraph().Vertices() )
+                    {
+                        if ( !blockCutTree.IsCutVertex ( cutVertex )
+                          || cutVertex == result.parentCutVertex[current] ) continue;
+
+                        for ( Types::blockId child : blockCutTree.BlocksOfVertex ( cutVertex ) )
+                        {
+                            if ( visited[child] ) continue;
+                            visited[child]                = true;
+                            result.parentCutVertex[child] = cutVertex;
+                            result.wayToBlockSize[child]  = ( current == blockId ? 0 : result.wayToBlockSize[current] )
+                                                          + blockCutTree.BlockAt ( child ).Subgraph().Vertices().size();
+
+                            for ( TVertexId vertexId : blockCutTree.BlockAt ( child ).Subgraph().Vertices() )
+                            {
+                                if ( vertexId == cutVertex ) continue;
+                                result.attachment[vertexId] = result.attachment[cutVertex];
+                                result.upperBlock[vertexId] = child;
+                            }
+                            queue.push ( child );
+                        }
+                    }
+                }
+
+                for ( TVertexId attachment : result.attachment )
+                {
+                    if ( attachment == Const::NONE ) continue;
+                    ++result.attachmentSize[attachment];
+                }
+                return result;
+            }
+
+            /**
+             * @brief      Estimate the size of the affected region of a
+             *     source.
+             * @details    The sinks of different changed blocks are counted
+             *     separately, while the ways from the source to the changed
+             *     blocks are assumed to overlap, i.e., only the longest way
+             *     is counted. The estimate uses the sizes that are counted
+             *     once by #SeparateAt and thus, takes @f$\Theta(k)@f$ time
+             *     for @f$k@f$ changed blocks instead of the
+             *     @f$\Theta(nk)@f$ time of #AffectedRegionOf.
+             *
+             * @param[in]  source  The source.
+             * @param[in]  blocks  The changed blocks.
+             *
+             * @return     The estimated size of the search space, or 0 if
+             *     there is no affected sink.
+             */
+            inline Types::count AffectedRegionSizeOf ( TVertexId                           source
+                                                     , std::vector<SeparatedBlock> const & blocks ) const
+            {
+                Types::count const numberOfVertices = graph_.NumberOfVertices();
+                Types::count numberOfSinks  = 0;
+                Types::count wayToBlockSize = 0;
+
+                for ( SeparatedBlock const & block : blocks )
+                {
+                    TVertexId const attachment = block.attachment[source];
+                    if ( attachment == Const::NONE ) continue;
+
+                    numberOfSinks += numberOfVertices - block.attachmentSize[attachment];
+                    if ( block.upperBlock[source] != block.identifier )
+                    {
+                        wayToBlockSize = std::max ( wayToBlockSize, block.wayToBlockSize[ block.upperBlock[source] ] );
+                    }
+                }
+
+                if ( numberOfSinks == 0 ) return 0;
+                return std::min ( numberOfVertices, 1 + numberOfSinks + wayToBlockSize );
+            }
+
+            /**
+             * @brief      The affected sinks of a source and the vertices
+             *     that lie on their simple paths.
+             * @details    A sink is affected if it has another attachment
+             *     than the source for at least one changed block. The
+             *     search space contains all vertices of other attachments
+             *     and the blocks between the source and the changed block.
+             *     A source that does not reach a changed block has no
+             *     affected sink for it. This takes @f$\Theta(n)@f$ time per
+             *     changed block and is only called for the selected sources.
+             *
+             * @param[in]  source        The source.
+             * @param[in]  blockCutTree  The block-cut tree of the graph.
+             * @param[in]  blocks        The changed blocks.
+             * @param      searchSpace   The vertices the search may enter.
+             * @param      sinks         The affected sinks.
+             */
+            inline void AffectedRegionOf ( TVertexId                           source
+                                                 , BlockCutTree<TGraph>        const & blockCutTree
+                                                 , std::vector<SeparatedBlock> const & blocks
+                                                 , std::vector<bool>                 & searchSpace
+                                                 , std::vector<bool>                 & sinks ) const
+            {
+                Types::count const numberOfVertices = graph_.NumberOfVertices();
+                searchSpace.assign ( numberOfVertices, false );
+                sinks.assign       ( numberOfVertices, false );
+                searchSpace[source] = true;
+
+                for ( SeparatedBlock const & block : blocks )
+                {
+                    TVertexId const attachment = block.attachment[source];
+                    if ( attachment == Const::NONE ) continue;
+
+                    for ( TVertexId vertexId = 0; vertexId < numberOfVertices; ++vertexId )
+                    {
+                        if ( block.attachment[vertexId] == attachment ) continue;
+                        searchSpace[vertexId] = true;
+                        sinks[vertexId]       = true;
+                    }
+
+                    // The blocks on the way from the source to the changed block
+                    Types::blockId current = block.upperBlock[source];
+                    while ( current != block.identifier
+                         && current != Const::NONE )
+                    {
+                        for ( TVertexId vertexId : blockCutTree.BlockAt ( current ).Subgraph().Vertices() )
+                        {
+                            searchSpace[vertexId] = true;
+                        }
+                        current = block.upperBlock[ block.parentCutVertex[current] ];
+                    }
+                }
+            }
+
+            /**
+             * @brief      Count the paths between the sources and their
+             *     affected sinks.
+             *
+             * @param[in]  sources                The sources.
+             * @param[in]  blockCutTree           The block-cut tree of the graph.
+             * @param[in]  blocks                 The changed blocks.
+             * @param      numberOfPaths          The number of paths.
+             * @param      relativeNumberOfPaths  The relative number of paths.
+             */
+            inline void CountAffectedPaths ( std::vector<TVertexId>      const & sources
+                                           , BlockCutTree<TGraph>        const & blockCutTree
+                                           , std::vector<SeparatedBlock> const & blocks
+                                           , std::vector<Types::count>         & numberOfPaths
+                                           , std::vector<Types::real>          & relativeNumberOfPaths )
+            {
+                numberOfPaths.assign         ( countersSize_, 0   );
+                relativeNumberOfPaths.assign ( countersSize_, 0.0 );
+
+#ifdef OPENMP_AVAILABLE
+                // The copies are allocated by the threads, see CountersOfThread
+                TNumberOfPaths         threadNumberOfPaths         ( omp_get_max_threads() );
+                TRelativeNumberOfPaths threadRelativeNumberOfPaths ( omp_get_max_threads() );
+                Types::count const numberOfSources = sources.size();
+                Types::count const chunkSize       = ChunkSize();
+
+                #pragma omp parallel
+                {
+                    std::vector<bool> searchSpace;
+                    std::vector<bool> sinks;
+
+                    #pragma omp for schedule(dynamic, chunkSize)
+                    for ( Types::index index = 0; index < numberOfSources; ++index )
+                    {
+                        AffectedRegionOf ( sources[index], blockCutTree, blocks, searchSpace, sinks );
+                        CountAffectedPathsOf ( sources[index]
+                                             , Algorithm()[omp_get_thread_num()]
+                                             , searchSpace
+                                             , sinks
+                                             , CountersOfThread ( threadNumberOfPaths,         numberOfPaths )
+                                             , CountersOfThread ( threadRelativeNumberOfPaths, relativeNumberOfPaths ) );
+                    }
+                }
+
+                if ( Reduction() != CounterReduction::atomic )
+                {
+                    MergeThreadBasedCounters ( threadNumberOfPaths
+                                             , threadRelativeNumberOfPaths
+                                             , numberOfPaths
+                                             , relativeNumberOfPaths );
+                }
+#else // OPENMP IS NOT AVAILABLE
+                std::vector<bool> searchSpace;
+                std::vector<bool> sinks;
+                for ( TVertexId source : sources )
+                {
+                    AffectedRegionOf ( source, blockCutTree, blocks, searchSpace, sinks );
+                    CountAffectedPathsOf ( source
+                                         , Algorithm()
+                                         , searchSpace
+                                         , sinks
+                                         , numberOfPaths
+                                         , relativeNumberOfPaths );
+                }
+#endif // OPENMP_AVAILABLE
+            }
+
+            /**
+             * @brief      Run the path finding algorithm from one source
+             *     within its search space and count the paths to its
+             *     affected sinks.
+             *
+             * @param[in]  source                 The source.
+             * @param      algorithm              The path finding algorithm of the calling thread.
+             * @param      searchSpace            The vertices the search may enter.
+             * @param[in]  sinks                  The affected sinks.
+             * @param      numberOfPaths          The number of paths of the calling thread.
+             * @param      relativeNumberOfPaths  The relative number of paths of the calling thread.
+             */
+            inline void CountAffectedPathsOf ( TVertexId                   source
+                                             , TAlgorithm                & algorithm
+                                             , std::vector<bool>         & searchSpace
+                                             , std::vector<bool>   const & sinks
+                                             , std::vector<Types::count> & numberOfPaths
+                                             , std::vector<Types::real>  & relativeNumberOfPaths )
+            {
+                algorithm.SearchSpace().swap ( searchSpace );
+                algorithm.Clear();
+                algorithm.Source ( source );
+                algorithm.Run();
+
+                for ( TVertexId sink = 0; sink < sinks.size(); ++sink )
+                {
+                    if ( !sinks[sink] ) continue;
+                    CountPathsTo ( algorithm, sink, numberOfPaths, relativeNumberOfPaths );
+                }
+
+                algorithm.SearchSpace().swap ( searchSpace );
+            }
+        ///@}
+
+        ///@name Protected Modifiers
+        ///@{
+#pragma mark PROTECTED_MODIFIERS
+
+            /**
+             * @brief      Clear all.
+             *
+             * @param      numberOfPaths          The number of paths.
+             * @param      relativeNumberOfPaths  The relative number of paths.
+             */
+            inline void Clear ( TNumberOfPaths         & numberOfPaths
+                              , TRelativeNumberOfPaths & relativeNumberOfPaths )
+            {
+                Clear();
+                if ( Reduction() == CounterReduction::atomic )
+                { // All threads count into the totals
+                    numberOfPaths.clear();
+                    relativeNumberOfPaths.clear();
+                    return;
+                }
+#ifdef OPENMP_AVAILABLE
+                // The copies are allocated by the threads, see CountersOfThread
+                numberOfPaths.assign         ( omp_get_max_threads(), std::vector<Types::count>() );
+                relativeNumberOfPaths.assign ( omp_get_max_threads(), std::vector<Types::real>()  );
+#else
+                numberOfPaths.assign         ( countersSize_, 0   );
+                relativeNumberOfPaths.assign ( countersSize_, 0.0 );
+#endif
+            }
+        ///@}
+
+#pragma mark MEMBERS
+    private:
         Types::count              countersSize_;    /**< */
         TGraph            const & graph_;           /**< The graph @f$\graph = (\vertices,\edges)@f$ on which the DTP is calculated. */
         TAlgoHandling             algo_;            /**< Multiple path finding algorithm are used for the parallelization. */
@@ -395,6 +1883,17 @@ class BetweennessCentrality {
 
         std::vector<Types::real>  totalRelativeNumberOfPaths_;   /**< */
         std::vector<Types::count> totalNumberOfPaths_;           /**< */
+
+        SourceScheduling          scheduling_;      /**< The order in which the sources are distributed among the threads. */
+        Types::count              chunkSize_;       /**< The number of sources per chunk for SourceScheduling::largestFirst. */
+        std::vector<Types::real>  sourceCosts_;     /**< The estimated costs per source, i.e., the running time of the previous run in milliseconds. */
+        CounterReduction          reduction_;       /**< The way the path counters of the threads are combined. */
+
+        SamplingParameters        sampling_;        /**< The parameters of the sampling-based approximation. */
+        std::vector<Types::real>  totalRelativeNumberOfPathsHalfWidth_; /**< The half-widths of the confidence intervals of the total relative number of paths. */
+        Types::count              numberOfSamples_; /**< The number of sampled sources of the last approximate run. */
+
+        std::unique_ptr<BlockCutTree<TGraph>> blockCutTree_; /**< The block-cut tree used by #Update, built by its first call after #Run. */
 };
 
 } // egoa
@@ -0,0 +1,776 @@
+/*
+ * BlockDecomposedBetweennessCentrality.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__ALGORITHMS__CENTRALITY__BLOCK_DECOMPOSED_BETWEENNESS_CENTRALITY_HPP
+#define EGOA__ALGORITHMS__CENTRALITY__BLOCK_DECOMPOSED_BETWEENNESS_CENTRALITY_HPP
+
+#ifdef OPENMP_AVAILABLE
+    #include <omp.h>
+#endif // OPENMP_AVAILABLE
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Algorithms/PathFinding/DominatingThetaPath.hpp"
+#include "DataStructures/Graphs/BlockCutTree.hpp"
+#include "DataStructures/Labels/SusceptanceNormLabel.hpp"
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      Class for the betweenness centrality that is computed block by
+ *     block of the BlockCutTree.
+ * @details    Each simple path between two vertices of a block stays inside
+ *     the block, and each simple path between two blocks passes through the
+ *     cut vertices between them. Thus, the paths from a source
+ *     @f$\source@f$ to a sink @f$\sink@f$ that use an edge of a block
+ *     @f$B@f$ enter @f$B@f$ at the vertex @f$x\in B@f$ closest to
+ *     @f$\source@f$ in the block-cut tree and leave it at the vertex
+ *     @f$y\in B@f$ closest to @f$\sink@f$. If the number of optimal paths
+ *     multiplies along the blocks, i.e.,
+ *     @f$\sigma(\source,\sink) = \sigma(\source,x)\cdot\sigma_B(x,y)\cdot\sigma(y,\sink)@f$,
+ *     the counters of the edges of @f$B@f$ only depend on
+ *     - @f$\sigma_B(x,y,\edge)@f$ and @f$\sigma_B(x,y)@f$, which are computed
+ *       by a path finding algorithm from each vertex of @f$B@f$ that is
+ *       restricted to @f$B@f$, see DominatingThetaPath#SearchSpace, and
+ *     - the number of vertices that are attached to @f$x@f$ outside of
+ *       @f$B@f$ and the number of their paths to @f$x@f$, which are
+ *       computed by two passes over the block-cut tree from the searches
+ *       starting at the cut vertices.
+ *
+ *     The searches of all blocks are independent and run in parallel if
+ *     OpenMP is available. Blocks that are bridges are counted without a
+ *     search. In contrast to BetweennessCentrality each search only
+ *     explores one block, i.e., the many small radial blocks of a
+ *     transmission grid are explored once per vertex of the block instead
+ *     of once per vertex of the graph. Since a search only clears the
+ *     labels of the vertices it reached, see DominatingThetaPath#Clear, it
+ *     takes time in the size of its block.
+ *
+ *     The counters equal the edge counters of BetweennessCentrality with
+ *     the same path finding algorithm if the labels are additive along a
+ *     path, e.g., for the SusceptanceNormLabel. This is not the case for
+ *     the VoltageAngleDifferenceLabel, whose value depends on the minimum
+ *     capacity of the whole path. Thus, the label of the path finding
+ *     algorithm has to be additive, see internal::IsAdditiveLabel.
+ *
+ * @code{.cpp}
+ *      BlockDecomposedBetweennessCentrality<TGraph> betweennessCentrality ( graph );
+ *      betweennessCentrality.Run();
+ *      // betweennessCentrality.TotalRelativeNumberOfPaths()
+ * @endcode
+ *
+ * @pre        The graph is connected. Only edges are counted, see
+ *     CentralityCounter::counterAtEdges.
+ *
+ * @tparam     GraphType             The graph should at least provide the
+ *     same interface as the StaticGraph.
+ * @tparam     PathFindingAlgorithm  The path finding algorithm with additive
+ *     labels that is run in each block such as DTP with
+ *     SusceptanceNormLabel.
+ *
+ * @see BetweennessCentrality
+ * @see BlockCutTree
+ * @see DominatingThetaPath
+ */
+template< typename GraphType            = StaticGraph< Vertices::ElectricalProperties<Vertices::IeeeBusType>
+                                                     , Edges::ElectricalProperties >
+        , typename PathFindingAlgorithm = DominatingThetaPath< GraphType
+                                                             , SusceptanceNormLabel<typename GraphType::TEdge> > >
+class BlockDecomposedBetweennessCentrality {
+    public:
+#pragma mark TYPE_ALIASING
+        // Graph specific types
+        using TGraph                 = GraphType;                   /**< The graph type.  */
+        using TVertexId              = typename TGraph::TVertexId;  /**< The vertex identifier type. */
+        using TEdgeId                = typename TGraph::TEdgeId;    /**< The edge identifier type. */
+        using TBlockCutTree          = BlockCutTree<TGraph>;        /**< The block-cut tree type. */
+        using TBlock                 = typename TBlockCutTree::Block; /**< The block type. */
+
+        using TAlgorithm             = PathFindingAlgorithm;        /**< The path finding algorithm in use in each block such as DTP. */
+
+        static_assert ( internal::IsAdditiveLabel<typename TAlgorithm::TLabel>::value
+                      , "The labels of the path finding algorithm have to be additive along a path, e.g., SusceptanceNormLabel." );
+
+    protected:
+#ifdef OPENMP_AVAILABLE
+        using TAlgoHandling          = std::vector<TAlgorithm>;
+        using TNumberOfPaths         = std::vector<std::vector<Types::count>>;
+        using TRelativeNumberOfPaths = std::vector<std::vector<Types::real>>;
+#else
+        using TAlgoHandling          = TAlgorithm;
+        using TNumberOfPaths         = std::vector<Types::count>;
+        using TRelativeNumberOfPaths = std::vector<Types::real>;
+#endif
+
+        /**
+         * @brief      The paths inside a block and the weights of its
+         *     vertices.
+         * @details    The @f$k@f$ cut vertices of the block are indexed by
+         *     their order in #cutVertexPositions. All other vectors of size
+         *     @f$|B|@f$ are indexed by the position of a vertex in the
+         *     vertices of the block.
+         */
+        struct BlockWeights {
+            std::vector<Types::index> cutVertexPositions;       /**< The positions of the cut vertices in the vertices of the block. */
+            std::vector<Types::index> cutVertexIndices;         /**< The index of each vertex in #cutVertexPositions, or Const::NONE. */
+            std::vector<Types::count> pathsBetweenCutVertices;  /**< The @f$k\times k@f$ numbers of paths between the cut vertices. */
+            std::vector<Types::count> pathsToInnerVertices;     /**< The number of paths from each cut vertex to the other vertices. */
+            std::vector<Types::count> reachedInnerVertices;     /**< The number of other vertices each cut vertex reaches. */
+            std::vector<Types::count> attachedPaths;            /**< The number of paths from each cut vertex to the vertices behind the block. */
+            std::vector<Types::count> attachedVertices;         /**< The number of vertices behind the block that each cut vertex reaches. */
+            std::vector<Types::count> pathWeights;              /**< The number of paths from the vertices attached to a vertex of the block. */
+            std::vector<Types::count> vertexWeights;            /**< The number of vertices attached to a vertex of the block including itself. */
+        };
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTORS
+
+            /**
+             * @brief      Constructs the block decomposed betweenness
+             *     centrality object.
+             *
+             * @param      graph  The const graph.
+             */
+            BlockDecomposedBetweennessCentrality ( TGraph const & graph )
+            : graph_( graph )
+#if defined(OPENMP_AVAILABLE)
+            , algo_( omp_get_max_threads(), TAlgorithm( graph_ ) )
+#else
+            , algo_( graph_ )
+#endif
+            , ignoreSwitchedEdges_( false )
+            {}
+
+            /**
+             * @brief      Destroys the object.
+             */
+            ~BlockDecomposedBetweennessCentrality () {}
+        ///@}
+
+        ///@name Execute the Betweenness Centrality Algorithm
+        ///@{
+#pragma mark EXECUTE_ALGORITHM
+
+            /**
+             * @brief      Run the betweenness centrality.
+             * @details    The block-cut tree is built, the paths between the
+             *     cut vertices of each block are counted, the weights are
+             *     propagated through the block-cut tree, and finally the
+             *     paths between all vertices of each block are counted. The
+             *     searches of the first and the last step run in parallel if
+             *     OpenMP is available.
+             *
+             * @pre        The graph is connected.
+             */
+            inline void Run ()
+            {
+                Clear();
+                if ( graph_.NumberOfVertices() < 2 ) return;
+
+                TBlockCutTree const blockCutTree = TBlockCutTree::Build ( graph_ );
+                graph_.template for_all_vertex_identifiers<ExecutionPolicy::sequential> ( [ & blockCutTree ] ( TVertexId vertexId )
+                {
+                    USAGE_ASSERT ( !blockCutTree.BlocksOfVertex ( vertexId ).empty() );
+                });
+
+                std::vector<BlockWeights> weights = InitializeWeights ( blockCutTree );
+                PrepareSearchSpaces ( true );
+
+                CountPathsBetweenCutVertices ( blockCutTree, weights );
+                AttachWeights                ( blockCutTree, weights );
+
+                TNumberOfPaths         numberOfPaths;
+                TRelativeNumberOfPaths relativeNumberOfPaths;
+                CountPathsInBlocks ( blockCutTree, weights, numberOfPaths, relativeNumberOfPaths );
+
+                PrepareSearchSpaces ( false );
+                JoinThreadBasedResults ( numberOfPaths
+                                       , relativeNumberOfPaths
+                                       , 1 / static_cast<Types::real>( graph_.NumberOfVertices() * ( graph_.NumberOfVertices() - 1 ) ) );
+            }
+        ///@}
+
+        ///@name Getter and Setter
+        ///@{
+#pragma mark GETTER_AND_SETTER
+
+            /**
+             * @brief      Getter for the total relative number of paths per edge.
+             *
+             * @return     The total relative number of paths per edge.
+             */
+            inline std::vector<Types::real> const & TotalRelativeNumberOfPaths () const
+            {
+                return totalRelativeNumberOfPaths_;
+            }
+
+            /**
+             * @brief      Getter for the total number of paths per edge.
+             *
+             * @return     The total number of paths per edge.
+             */
+            inline std::vector<Types::count> const & TotalNumberOfPaths () const
+            {
+                return totalNumberOfPaths_;
+            }
+
+            /**
+             * @brief      Getter for the path finding algorithms.
+             *
+             * @return     The path finding algorithm, or one per thread if
+             *     OpenMP is available.
+             */
+            inline TAlgoHandling & Algorithm ()
+            {
+                return algo_;
+            }
+
+            /**
+             * @brief      Getter for the path finding algorithms.
+             *
+             * @return     The path finding algorithm, or one per thread if
+             *     OpenMP is available.
+             */
+            inline TAlgoHandling const & Algorithm () const
+            {
+                return algo_;
+            }
+        ///@}
+
+        ///@name Modifier
+        ///@{
+#pragma mark MODIFIER
+
+            /**
+             * @brief      Clears the counters.
+             */
+            inline void Clear ()
+            {
+                totalRelativeNumberOfPaths_.assign ( graph_.NumberOfEdges(), 0.0 );
+                totalNumberOfPaths_.assign         ( graph_.NumberOfEdges(), 0   );
+            }
+
+            /**
+             * @brief      Set whether the path finding algorithms ignore
+             *     switched edges.
+             * @details    Bridges that are switched off are ignored as
+             *     well, see DominatingThetaPath#IgnoreSwitchedEdges.
+             *
+             * @param[in]  ignore  @p true if edges with status @p false are
+             *     ignored, @p false otherwise.
+             */
+            inline void IgnoreSwitchedEdges ( bool ignore )
+            {
+                ignoreSwitchedEdges_ = ignore;
+#ifdef OPENMP_AVAILABLE
+                for ( TAlgorithm & algorithm : Algorithm() )
+                {
+                    algorithm.IgnoreSwitchedEdges() = ignore;
+                }
+#else
+                Algorithm().IgnoreSwitchedEdges() = ignore;
+#endif
+            }
+        ///@}
+
+    protected:
+        ///@name Block Weights
+        ///@{
+#pragma mark BLOCK_WEIGHTS
+
+            /**
+             * @brief      Initializes the weights of all blocks.
+             *
+             * @param[in]  blockCutTree  The block-cut tree of the graph.
+             *
+             * @return     The weights of each block.
+             */
+            inline std::vector<BlockWeights> InitializeWeights ( TBlockCutTree const & blockCutTree ) const
+            {
+                std::vector<BlockWeights> weights ( blockCutTree.NumberOfBlocks() );
+
+                for ( Types::blockId blockId = 0; blockId < blockCutTree.NumberOfBlocks(); ++blockId )
+                {
+                    auto const   vertices = blockCutTree.BlockAt ( blockId ).Subgraph().Vertices();
+                    BlockWeights & block  = weights[blockId];
+
+                    block.cutVertexIndices.assign ( vertices.size(), Const::NONE );
+                    for ( Types::index position = 0; position < vertices.size(); ++position )
+                    {
+                        if ( !blockCutTree.IsCutVertex ( vertices[position] ) ) continue;
+                        block.cutVertexIndices[position] = block.cutVertexPositions.size();
+                        block.cutVertexPositions.emplace_back ( position );
+                    }
+
+                    Types::count const numberOfCutVertices = block.cutVertexPositions.size();
+                    block.pathsBetweenCutVertices.assign ( numberOfCutVertices * numberOfCutVertices, 0 );
+                    block.pathsToInnerVertices.assign    ( numberOfCutVertices, 0 );
+                    block.reachedInnerVertices.assign    ( numberOfCutVertices, 0 );
+                    block.attachedPaths.assign           ( numberOfCutVertices, 0 );
+                    block.attachedVertices.assign        ( numberOfCutVertices, 0 );
+                }
+                return weights;
+            }
+
+            /**
+             * @brief      Count the paths from each cut vertex to the other
+             *     vertices of its blocks.
+             *
+             * @param[in]  blockCutTree  The block-cut tree of the graph.
+             * @param      weights       The weights of each block.
+             */
+            inline void CountPathsBetweenCutVertices ( TBlockCutTree             const & blockCutTree
+                                                     , std::vector<BlockWeights>       & weights )
+            {
+                std::vector<std::pair<Types::blockId, Types::index>> searches;
+                for ( Types::blockId blockId = 0; blockId < weights.size(); ++blockId )
+                {
+                    for ( Types::index index = 0; index < weights[blockId].cutVertexPositions.size(); ++index )
+                    {
+                        searches.emplace_back ( blockId, index );
+                    }
+                }
+
+                auto countFrom = [ this, & blockCutTree, & weights ] ( TAlgorithm & algorithm
+                                                                     , Types::blockId blockId
+                                                                     , Types::index   index )
+                {
+                    TBlock       const & block    = blockCutTree.BlockAt ( blockId );
+                    BlockWeights       & weight   = weights[blockId];
+                    auto         const   vertices = block.Subgraph().Vertices();
+                    Types::index const   source   = weight.cutVertexPositions[index];
+                    Types::count const   numberOfCutVertices = weight.cutVertexPositions.size();
+
+                    SearchInBlock ( algorithm, block, vertices[source] );
+                    for ( Types::index position = 0; position < vertices.size(); ++position )
+                    {
+                        if ( position == source ) continue;
+                        Types::count const numberOfPaths = NumberOfPathsInBlock ( algorithm, block, vertices[position] );
+                        if ( weight.cutVertexIndices[position] != Const::NONE )
+                        {
+                            weight.pathsBetweenCutVertices[index * numberOfCutVertices + weight.cutVertexIndices[position]] = numberOfPaths;
+                        } else if ( numberOfPaths > 0 )
+                        {
+                            weight.pathsToInnerVertices[index] += numberOfPaths;
+                            ++weight.reachedInnerVertices[index];
+                        }
+                    }
+                };
+
+#ifdef OPENMP_AVAILABLE
+                Types::count const numberOfSearches = searches.size();
+
+                #pragma omp parallel for schedule(dynamic, 1)
+                for ( Types::index search = 0; search < numberOfSearches; ++search )
+                {
+                    countFrom ( Algorithm()[omp_get_thread_num()]
+                              , searches[search].first
+                              , searches[search].second );
+                }
+#else // OPENMP IS NOT AVAILABLE
+                for ( auto const & search : searches )
+                {
+                    countFrom ( Algorithm(), search.first, search.second );
+                }
+#endif // OPENMP_AVAILABLE
+            }
+
+            /**
+             * @brief      Propagate the weights through the block-cut tree.
+             * @details    For a cut vertex @f$c@f$ of a block @f$B@f$ the
+             *     number of paths from @f$c@f$ to the vertices behind
+             *     @f$B@f$ is
+             *     @f[
+             *      T(B,c) := \sum_{y\in B\setminus\{c\}} \sigma_B(c,y)\cdot F(B,y),
+             *     @f]
+             *     where @f$F(B,y)@f$ is @f$1@f$ plus the sum of @f$T(B',y)@f$
+             *     over all other blocks @f$B'@f$ of @f$y@f$. The block-cut
+             *     tree is rooted at the block 0. A first pass from the leaves
+             *     to the root computes @f$T(B,c)@f$ for the parent @f$c@f$ of
+             *     each block, and a second pass from the root to the leaves
+             *     computes it for the children. The number of reached
+             *     vertices is propagated in the same way.
+             *
+             * @param[in]  blockCutTree  The block-cut tree of the graph.
+             * @param      weights       The weights of each block.
+             */
+            inline void AttachWeights ( TBlockCutTree             const & blockCutTree
+                                      , std::vector<BlockWeights>       & weights ) const
+            {
+                // Breadth-first order of the blocks and their parent cut vertices
+                std::vector<Types::blockId> order ( 1, 0 );
+                std::vector<TVertexId>      parentOf ( weights.size(), Const::NONE );
+                order.reserve ( weights.size() );
+                for ( Types::index next = 0; next < order.size(); ++next )
+                {
+                    Types::blockId const blockId = order[next];
+                    for ( TVertexId cutVertex : blockCutTree.BlockAt ( blockId ).CutVertices() )
+                    {
+                        if ( cutVertex == parentOf[blockId] ) continue;
+                        for ( Types::blockId child : blockCutTree.CutVertexAt ( cutVertex ).Blocks() )
+                        {
+                            if ( child == blockId ) continue;
+                            parentOf[child] = cutVertex;
+                            order.emplace_back ( child );
+                        }
+                    }
+                }
+                ESSENTIAL_ASSERT ( order.size() == weights.size() );
+
+                // The sums of T(B,c) and of the reached vertices over the blocks computed so far
+                std::vector<Types::count> attachedPaths    ( graph_.NumberOfVertices(), 0 );
+                std::vector<Types::count> attachedVertices ( graph_.NumberOfVertices(), 0 );
+
+                auto attach = [ & blockCutTree, & weights, & attachedPaths, & attachedVertices ] ( Types::blockId blockId
+                                                                                                 , Types::index   index )
+                {
+                    BlockWeights const & weight   = weights[blockId];
+                    auto         const   vertices = blockCutTree.BlockAt ( blockId ).Subgraph().Vertices();
+                    Types::count const   numberOfCutVertices = weight.cutVertexPositions.size();
+
+                    std::pair<Types::count, Types::count> result ( weight.pathsToInnerVertices[index]
+                                                                 , weight.reachedInnerVertices[index] );
+                    for ( Types::index other = 0; other < numberOfCutVertices; ++other )
+                    {
+                        Types::count const numberOfPaths = weight.pathsBetweenCutVertices[index * numberOfCutVertices + other];
+                        if ( other == index || numberOfPaths == 0 ) continue;
+
+                        TVertexId const cutVertex = vertices[weight.cutVertexPositions[other]];
+                        result.first  += numberOfPaths * ( 1 + attachedPaths[cutVertex]    - weight.attachedPaths[other]    );
+                        result.second +=                   1 + attachedVertices[cutVertex] - weight.attachedVertices[other];
+                    }
+                    return result;
+                };
+
+                // From the leaves to the root
+                for ( Types::index next = order.size() - 1; next > 0; --next )
+                {
+                    Types::blockId const blockId  = order[next];
+                    BlockWeights       & weight   = weights[blockId];
+                    auto         const   vertices = blockCutTree.BlockAt ( blockId ).Subgraph().Vertices();
+                    for ( Types::index index = 0; index < weight.cutVertexPositions.size(); ++index )
+                    {
+                        TVertexId const cutVertex = vertices[weight.cutVertexPositions[index]];
+                        if ( cutVertex != parentOf[blockId] ) continue;
+
+                        std::tie ( weight.attachedPaths[index], weight.attachedVertices[index] ) = attach ( blockId, index );
+                        attachedPaths[cutVertex]    += weight.attachedPaths[index];
+                        attachedVertices[cutVertex] += weight.attachedVertices[index];
+                    }
+                }
+
+                // From the root to the leaves
+                std::vector<std::pair<Types::count, Types::count>> children;
+                for ( Types::blockId blockId : order )
+                {
+                    BlockWeights & weight   = weights[blockId];
+                    auto   const   vertices = blockCutTree.BlockAt ( blockId ).Subgraph().Vertices();
+
+                    children.clear();
+                    for ( Types::index index = 0; index < weight.cutVertexPositions.size(); ++index )
+                    {
+                        children.emplace_back ( vertices[weight.cutVertexPositions[index]] == parentOf[blockId]
+                                                    ? std::make_pair ( weight.attachedPaths[index], weight.attachedVertices[index] )
+                                                    : attach ( blockId, index ) );
+                    }
+                    for ( Types::index index = 0; index < weight.cutVertexPositions.size(); ++index )
+                    {
+                        TVertexId const cutVertex = vertices[weight.cutVertexPositions[index]];
+                        if ( cutVertex == parentOf[blockId] ) continue;
+
+                        std::tie ( weight.attachedPaths[index], weight.attachedVertices[index] ) = children[index];
+                        attachedPaths[cutVertex]    += weight.attachedPaths[index];
+                        attachedVertices[cutVertex] += weight.attachedVertices[index];
+                    }
+                }
+
+                // The weights of the vertices of each block
+                for ( Types::blockId blockId = 0; blockId < weights.size(); ++blockId )
+                {
+                    BlockWeights & weight   = weights[blockId];
+                    auto   const   vertices = blockCutTree.BlockAt ( blockId ).Subgraph().Vertices();
+
+                    weight.pathWeights.assign   ( vertices.size(), 1 );
+                    weight.vertexWeights.assign ( vertices.size(), 1 );
+                    for ( Types::index index = 0; index < weight.cutVertexPositions.size(); ++index )
+                    {
+                        Types::index const position  = weight.cutVertexPositions[index];
+                        TVertexId    const cutVertex = vertices[position];
+                        weight.pathWeights[position]   += attachedPaths[cutVertex]    - weight.attachedPaths[index];
+                        weight.vertexWeights[position] += attachedVertices[cutVertex] - weight.attachedVertices[index];
+                    }
+                }
+            }
+        ///@}
+
+        ///@name Counting Paths
+        ///@{
+#pragma mark COUNTING_PATHS
+
+            /**
+             * @brief      Count the paths between all vertices of each block
+             *     weighted by the attached vertices and paths.
+             * @details    For an edge @f$\edge@f$ of a block @f$B@f$ and
+             *     each ordered pair @f$x\neq y@f$ of vertices of @f$B@f$ the
+             *     number of paths is increased by
+             *     @f$S(x)\cdot\sigma_B(x,y,\edge)\cdot S(y)@f$ and the
+             *     relative number of paths by
+             *     @f$A(x)\cdot A(y)\cdot\sigma_B(x,y,\edge)/\sigma_B(x,y)@f$,
+             *     where @f$S@f$ are the path weights and @f$A@f$ are the
+             *     vertex weights.
+             *
+             * @param[in]  blockCutTree           The block-cut tree of the graph.
+             * @param[in]  weights                The weights of each block.
+             * @param      numberOfPaths          The number of paths.
+             * @param      relativeNumberOfPaths  The relative number of paths.
+             */
+            inline void CountPathsInBlocks ( TBlockCutTree             const & blockCutTree
+                                           , std::vector<BlockWeights> const & weights
+                                           , TNumberOfPaths                  & numberOfPaths
+                                           , TRelativeNumberOfPaths          & relativeNumberOfPaths )
+            {
+                std::vector<std::pair<Types::blockId, Types::index>> searches;
+                for ( Types::blockId blockId = 0; blockId < weights.size(); ++blockId )
+                {
+                    for ( Types::index position = 0; position < weights[blockId].pathWeights.size(); ++position )
+                    {
+                        searches.emplace_back ( blockId, position );
+                    }
+                }
+
+                auto countFrom = [ this, & blockCutTree, & weights ] ( TAlgorithm                & algorithm
+                                                                     , Types::blockId              blockId
+                                                                     , Types::index                source
+                                                                     , std::vector<Types::count> & threadNumberOfPaths
+                                                                     , std::vector<Types::real>  & threadRelativeNumberOfPaths )
+                {
+                    TBlock       const & block    = blockCutTree.BlockAt ( blockId );
+                    BlockWeights const & weight   = weights[blockId];
+                    auto         const   vertices = block.Subgraph().Vertices();
+
+                    SearchInBlock ( algorithm, block, vertices[source] );
+                    for ( Types::index position = 0; position < vertices.size(); ++position )
+                    {
+                        if ( position == source ) continue;
+
+                        Types::count const pathWeight   = weight.pathWeights[source]   * weight.pathWeights[position];
+                        Types::real  const vertexWeight = static_cast<Types::real> ( weight.vertexWeights[source] * weight.vertexWeights[position] );
+
+                        for_all_edges_on_paths_in_block ( algorithm, block, vertices[position],
+                            [ & ] ( TEdgeId edgeId, Types::real weightOfPath )
+                            {
+                                threadNumberOfPaths[edgeId]         += pathWeight;
+                                threadRelativeNumberOfPaths[edgeId] += vertexWeight * weightOfPath;
+                            }
+                        );
+                    }
+                };
+
+#ifdef OPENMP_AVAILABLE
+                numberOfPaths.assign         ( omp_get_max_threads(), std::vector<Types::count> ( graph_.NumberOfEdges(), 0   ) );
+                relativeNumberOfPaths.assign ( omp_get_max_threads(), std::vector<Types::real>  ( graph_.NumberOfEdges(), 0.0 ) );
+                Types::count const numberOfSearches = searches.size();
+
+                #pragma omp parallel for schedule(dynamic, 1)
+                for ( Types::index search = 0; search < numberOfSearches; ++search )
+                {
+                    Types::index const threadId = omp_get_thread_num();
+                    countFrom ( Algorithm()[threadId]
+                              , searches[search].first
+                              , searches[search].second
+                              , numberOfPaths[threadId]
+                              , relativeNumberOfPaths[threadId] );
+                }
+#else // OPENMP IS NOT AVAILABLE
+                numberOfPaths.assign         ( graph_.NumberOfEdges(), 0   );
+                relativeNumberOfPaths.assign ( graph_.NumberOfEdges(), 0.0 );
+                for ( auto const & search : searches )
+                {
+                    countFrom ( Algorithm()
+                              , search.first
+                              , search.second
+                              , numberOfPaths
+                              , relativeNumberOfPaths );
+                }
+#endif // OPENMP_AVAILABLE
+            }
+
+            /**
+             * @brief      Sum up the counters of all threads and normalize
+             *     the relative number of paths.
+             *
+             * @param      numberOfPaths          The number of paths.
+             * @param      relativeNumberOfPaths  The relative number of paths.
+             * @param[in]  m_BNormalization       The normalization factor.
+             */
+            inline void JoinThreadBasedResults ( TNumberOfPaths         const & numberOfPaths
+                                               , TRelativeNumberOfPaths const & relativeNumberOfPaths
+                                               , Types::real            const   m_BNormalization )
+            {
+#ifdef OPENMP_AVAILABLE
+                for ( Types::index threadId = 0; threadId < numberOfPaths.size(); ++threadId )
+                {
+                    for ( TEdgeId edgeId = 0; edgeId < graph_.NumberOfEdges(); ++edgeId )
+                    {
+                        totalNumberOfPaths_[edgeId]         += numberOfPaths[threadId][edgeId];
+                        totalRelativeNumberOfPaths_[edgeId] += relativeNumberOfPaths[threadId][edgeId];
+                    }
+                }
+#else // OPENMP IS NOT AVAILABLE
+                totalNumberOfPaths_         = numberOfPaths;
+                totalRelativeNumberOfPaths_ = relativeNumberOfPaths;
+#endif // OPENMP_AVAILABLE
+
+                for ( Types::real & totalRelativeNumberOfPaths : totalRelativeNumberOfPaths_ )
+                {
+                    totalRelativeNumberOfPaths *= m_BNormalization;
+                }
+            }
+        ///@}
+
+        ///@name Searching in Blocks
+        ///@{
+#pragma mark SEARCHING_IN_BLOCKS
+
+            /**
+             * @brief      Sets or resets the search spaces of all path
+             *     finding algorithms.
+             *
+             * @param[in]  restrict  If @p true, the search space of each
+             *     algorithm is set to no vertex, otherwise, to all vertices.
+             */
+            inline void PrepareSearchSpaces ( bool restrict )
+            {
+#ifdef OPENMP_AVAILABLE
+                for ( TAlgorithm & algorithm : Algorithm() )
+                {
+                    algorithm.SearchSpace().assign ( restrict ? graph_.NumberOfVertices() : 0, false );
+                }
+#else
+                Algorithm().SearchSpace().assign ( restrict ? graph_.NumberOfVertices() : 0, false );
+#endif
+            }
+
+            /**
+             * @brief      Run the path finding algorithm from a vertex of a
+             *     block restricted to the block.
+             * @details    Bridges are not searched, see
+             *     #NumberOfPathsInBlock. Setting the source clears only the
+             *     labels of the previous search, which were all inside a
+             *     block.
+             *
+             * @param      algorithm  The path finding algorithm of the calling thread.
+             * @param[in]  block      The block.
+             * @param[in]  source     The source.
+             */
+            inline void SearchInBlock ( TAlgorithm       & algorithm
+                                      , TBlock     const & block
+                                      , TVertexId          source ) const
+            {
+                if ( block.IsBridge() ) return;
+
+                std::vector<bool> & searchSpace = algorithm.SearchSpace();
+                for ( TVertexId vertexId : block.Subgraph().Vertices() )
+                {
+                    searchSpace[vertexId] = true;
+                }
+
+                algorithm.Source ( source );
+                algorithm.Run();
+
+                for ( TVertexId vertexId : block.Subgraph().Vertices() )
+                {
+                    searchSpace[vertexId] = false;
+                }
+            }
+
+            /**
+             * @brief      Whether the single edge of a bridge is used.
+             *
+             * @param[in]  block  The bridge.
+             *
+             * @return     @p true if the edge is used, @p false otherwise.
+             */
+            inline bool IsActiveBridge ( TBlock const & block ) const
+            {
+                ESSENTIAL_ASSERT ( block.IsBridge() );
+                return !ignoreSwitchedEdges_
+                    || graph_.EdgeAt ( block.Subgraph().Edges()[0] ).Properties().Status();
+            }
+
+            /**
+             * @brief      Number of paths inside the block from the source
+             *     of the last #SearchInBlock to a target.
+             *
+             * @param[in]  algorithm  The path finding algorithm of the calling thread.
+             * @param[in]  block      The block.
+             * @param[in]  target     The target, which is not the source.
+             *
+             * @return     The number of paths.
+             */
+            inline Types::count NumberOfPathsInBlock ( TAlgorithm const & algorithm
+                                                     , TBlock     const & block
+                                                     , TVertexId          target ) const
+            {
+                if ( block.IsBridge() ) return IsActiveBridge ( block ) ? 1 : 0;
+                return algorithm.NumberOfPathsTo ( target );
+            }
+
+            /**
+             * @brief      The @p for loop over all edges on the paths inside
+             *     the block from the source of the last #SearchInBlock to a
+             *     target.
+             *
+             * @param      algorithm  The path finding algorithm of the calling thread.
+             * @param[in]  block      The block.
+             * @param[in]  target     The target, which is not the source.
+             * @param[in]  function   The function object that is called for
+             *     each edge on a path, see
+             *     DominatingThetaPath#for_all_edges_on_optimal_paths_to.
+             *
+             * @tparam     FUNCTION   The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void for_all_edges_on_paths_in_block ( TAlgorithm       & algorithm
+                                                        , TBlock     const & block
+                                                        , TVertexId          target
+                                                        , FUNCTION           function ) const
+            {
+                if ( block.IsBridge() )
+                {
+                    if ( IsActiveBridge ( block ) )
+                    {
+                        function ( block.Subgraph().Edges()[0], 1.0 );
+                    }
+                    return;
+                }
+                algorithm.for_all_edges_on_optimal_paths_to ( target, function );
+            }
+        ///@}
+
+#pragma mark MEMBERS
+    private:
+        TGraph            const & graph_;                       /**< The graph @f$\graph = (\vertices,\edges)@f$ on which the centrality is calculated. */
+        TAlgoHandling             algo_;                        /**< Multiple path finding algorithm are used for the parallelization. */
+        bool                      ignoreSwitchedEdges_;         /**< Whether edges with status @p false are ignored. */
+
+        std::vector<Types::real>  totalRelativeNumberOfPaths_;  /**< The total relative number of paths per edge. */
+        std::vector<Types::count> totalNumberOfPaths_;          /**< The total number of paths per edge. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__ALGORITHMS__CENTRALITY__BLOCK_DECOMPOSED_BETWEENNESS_CENTRALITY_HPP
@@ -78,8 +78,13 @@ class GeneratorBasedBetweennessCentrality final : public BetweennessCentrality <
                                                              , CentralityCounterType >;
         using TGeneratorId           = Types::generatorId;
     private:
+        using TGeneratorProperties   = typename TNetwork::TGeneratorProperties;
         using typename TBetweennessCentrality::TNumberOfPaths;
         using typename TBetweennessCentrality::TRelativeNumberOfPaths;
+        using typename TBetweennessCentrality::TMeasurementRow;
+        using typename TBetweennessCentrality::TVertexId;
+        // The update counts all pairs of vertices and not only generators and loads
+        using TBetweennessCentrality::Update;
     public:
         ///@name Constructors and Destructor
         ///@{
@@ -109,9 +114,44 @@ class GeneratorBasedBetweennessCentrality final : public BetweennessCentrality <
              *     more information see <a
              *     href="https://en.cppreference.com/w/cpp/container">
              *     https://en.cppreference.com/w/cpp/container </a>.
+             *
+             *     If the sampling method is not SourceSampling::exact, the
+             *     generator vertices are sampled with probabilities
+             *     proportional to their generation capacities, see
+             *     #GenerationWeights.
              */
             inline void Run ()
             {
+                if ( this->Scheduling() == SourceScheduling::largestFirst
+                  || this->Sampling().Method != SourceSampling::exact )
+                {
+                    std::vector<TVertexId> sources;
+                    network_.template for_all_vertex_identifiers_with_generator<ExecutionPolicy::sequential> ( [ & sources ] ( TVertexId vertexId )
+                    {
+                        sources.emplace_back ( vertexId );
+                    });
+
+                    Types::real const m_BNormalization = 1 / static_cast<Types::real>( network_.NumberOfGenerators() * network_.NumberOfLoads() );
+                    auto updateRow = [ this ] ( TMeasurementRow & row )
+                    {
+                        row.NumberOfGenerators = network_.NumberOfGenerators();
+                        row.NumberOfLoads      = network_.NumberOfLoads();
+                    };
+
+                    if ( this->Sampling().Method != SourceSampling::exact )
+                    {
+                        this->RunSampled ( sources
+                                         , GenerationWeights ( sources )
+                                         , m_BNormalization
+                                         , updateRow );
+                    } else {
+                        this->RunLargestSourcesFirst ( sources
+                                                     , m_BNormalization
+                                                     , updateRow );
+                    }
+                    return;
+                }
+
                 TNumberOfPaths         numberOfPaths;
                 TRelativeNumberOfPaths relativeNumberOfPaths;
 
@@ -152,6 +192,8 @@ class GeneratorBasedBetweennessCentrality final : public BetweennessCentrality <
                     this->TotalNumberOfPaths ( numberOfPaths, relativeNumberOfPaths );
 
 #ifdef EGOA_ENABLE_STATISTIC_BETWEENNESS_CENTRALITY
+                    this->Algorithm().Statistic().NumberOfGenerators = network_.NumberOfGenerators();
+                    this->Algorithm().Statistic().NumberOfLoads      = network_.NumberOfLoads();
                     this->Collection() += this->Algorithm().Statistic();
 #endif // EGOA_ENABLE_STATISTIC_BETWEENNESS_CENTRALITY
 #endif // OPENMP_AVAILABLE
@@ -162,6 +204,47 @@ class GeneratorBasedBetweennessCentrality final : public BetweennessCentrality <
             }
         ///@}
 
+    private:
+        ///@name Sampling Weights
+        ///@{
+#pragma mark SAMPLING_WEIGHTS
+
+            /**
+             * @brief      The sampling weights of the generator vertices.
+             * @details    The weight of a vertex is the sum of the maximum
+             *     real power of its generators. If a generator has no
+             *     finite positive maximum real power, the capacities are
+             *     not comparable and the weight of a vertex is its number of
+             *     generators instead.
+             *
+             * @param[in]  sources  The vertices with generators.
+             *
+             * @return     The sampling weight per vertex.
+             */
+            inline std::vector<Types::real> GenerationWeights ( std::vector<TVertexId> const & sources ) const
+            {
+                std::vector<Types::real> capacities         ( network_.Graph().NumberOfVertices(), 0.0 );
+                std::vector<Types::real> numberOfGenerators ( network_.Graph().NumberOfVertices(), 0.0 );
+                bool hasCapacities = true;
+
+                for ( TVertexId vertexId : sources )
+                {
+                    network_.template for_all_generators_at<ExecutionPolicy::sequential> ( vertexId
+                        , [ & ] ( TGeneratorProperties const & generator )
+                        {
+                            Types::real const maximum = generator.RealPowerBound().Maximum();
+                            if ( !( maximum > 0 ) || maximum >= Const::REAL_INFTY )
+                            {
+                                hasCapacities = false;
+                            }
+                            capacities[vertexId]         += maximum;
+                            numberOfGenerators[vertexId] += 1;
+                        });
+                }
+                return hasCapacities ? capacities : numberOfGenerators;
+            }
+        ///@}
+
 #pragma mark MEMBERS
     private:
         TNetwork          const & network_;           /**< The network @f$\network = (\graph = (\vertices,\edges),\generators,\consumers, \capacity, \susceptance, \dots )@f$ on which the generator-based betweenness centrality is calculated. */
@@ -7,14 +7,15 @@
 #ifndef EGOA__ALGORITHMS__GRAPH_TRAVERSAL__ARTICULATION_VERTEX_DETECTION__HPP
 #define EGOA__ALGORITHMS__GRAPH_TRAVERSAL__ARTICULATION_VERTEX_DETECTION__HPP
 
-#include "Algorithms/GraphTraversal/DepthFirstSearch.hpp"
+#include "Algorithms/GraphTraversal/IterativeDepthFirstSearch.hpp"
 
 namespace egoa {
 
 /**
  * @brief      Class to find articulation vertices.
  * @details    Key thing of the DFS is that it distinguish  the edges into
- *     tree edges and back edges.
+ *     tree edges and back edges. The hooks are called by the explicit stack
+ *     of IterativeDepthFirstSearch and are resolved at compile time.
  *
  * @tparam     GraphType  The graph should at least provide the same interface
  *     as the StaticGraph().
@@ -23,22 +24,23 @@ namespace egoa {
  */
 template< typename GraphType
         , bool IsDirected    = false >
-class ArticulationVertexDetection : public DepthFirstSearch<GraphType, IsDirected> {
-        using TTime = typename DepthFirstSearch<GraphType, IsDirected>::TTime;
+class ArticulationVertexDetection final
+    : public IterativeDepthFirstSearch<ArticulationVertexDetection<GraphType, IsDirected>, GraphType, IsDirected> {
+        using TSearch   = IterativeDepthFirstSearch<ArticulationVertexDetection<GraphType, IsDirected>, GraphType, IsDirected>;
+        using TTime     = typename TSearch::TTime;
+        friend TSearch;
     public:
         using TGraph    = GraphType;
         using TVertexId = typename TGraph::TVertexId;
 
 #pragma mark CONSTRUCTOR_AND_DESTRUCTOR
         ArticulationVertexDetection ( TGraph const & graph, TVertexId source )
-        : DepthFirstSearch<TGraph, IsDirected> ( graph, source )
+        : TSearch ( graph, source )
         , timeOfOldestReachableAncestor_( graph.NumberOfVertices(), Const::NONE )
+        , treeOutDegree_( graph.NumberOfVertices(), 0 )
         , isArticulationVertex_( graph.NumberOfVertices(), false )
-        , treeOutDegree_( std::vector<TVertexId>( graph.NumberOfVertices(), 0 ) )
         {}
 
-        virtual ~ArticulationVertexDetection(){}
-
 #pragma mark GETTER_AND_SETTER
     protected:
         /**
@@ -46,7 +48,7 @@ class ArticulationVertexDetection : public DepthFirstSearch<GraphType, IsDirecte
          *
          * @param[in]  vertex  The vertex identifier.
          *
-         * @return     @todo description
+         * @return     The number of children of @p vertex in the DFS tree.
          */
         ///@{
             inline Types::count   TreeOutDegree ( TVertexId const vertex ) const { return treeOutDegree_[vertex]; }
@@ -66,7 +68,7 @@ class ArticulationVertexDetection : public DepthFirstSearch<GraphType, IsDirecte
          *
          * @param[in]  vertex  The vertex identifier.
          */
-        virtual inline void PreprocessingVertexWith ( TVertexId const vertex ) override
+        inline void PreprocessingVertexWith ( TVertexId const vertex )
         {
             TimeOfOldestReachableAncestor( vertex ) = this->EntryTimeAt( vertex );
         }
@@ -75,42 +77,34 @@ class ArticulationVertexDetection : public DepthFirstSearch<GraphType, IsDirecte
          * @brief      Update the oldest reachable ancestor.
          * @details    The oldest reachable ancestor is updated whenever a
          *     backward edge is detected that goes to a older vertex than the
-         *     previous detected one. Note that the age can be easily
-         *     determined by the time counter.
+         *     previous detected one, or a tree edge leads to a child that
+         *     reaches an older vertex. Note that the age can be easily
+         *     determined by the time counter. For a backward edge the entry
+         *     time of its target counts, since the oldest reachable ancestor
+         *     of the target might not be reachable without the target.
+         *
+         *     Only the tree edge itself leads to the child. Further parallel
+         *     edges are backward edges from the child to its parent.
          *
          * @param[in]  source  The source identifier.
          * @param[in]  target  The target identifier.
+         * @param[in]  edgeId  The edge identifier.
          */
-        virtual inline void ProcessingEdgeWith  ( TVertexId     source
-                                                , TVertexId     target
-                                                , Types::edgeId edgeId ) override
+        inline void PostprocessingEdgeWith ( TVertexId     source
+                                           , TVertexId     target
+                                           , Types::edgeId edgeId )
         {
-            // Ignore edges that directly lead to the parent again.
-            if (target == this->ParentOf(source)) {
-                return;
-            }
-
-            DfsEdgeType edgeType = this->TypifyEdge ( source, target );
-
-            if ( edgeType == DfsEdgeType::tree ) {
+            bool isTreeEdge = ( this->ParentEdgeOf ( target ) == edgeId );
+            if ( isTreeEdge ) {
                 ++TreeOutDegree ( source );
             }
-        }
 
-        virtual inline void PostprocessingEdgeWith(TVertexId     source,
-                                                   TVertexId     target,
-                                                   Types::edgeId edgeId ) override
-        {
-            // Ignore edges that directly lead to the parent again.
-            if (target == this->ParentOf(source)) {
-                return;
-            }
-
-            TTime oldestTimeSeenAtTarget = TimeOfOldestReachableAncestor( target );
+            TTime oldestTimeSeenAtTarget = isTreeEdge ? TimeOfOldestReachableAncestor( target )
+                                                      : this->EntryTimeAt( target );
             TTime & oldestTimeSeenAtSource = TimeOfOldestReachableAncestor( source );
 
-
-            if ( oldestTimeSeenAtTarget >= this->EntryTimeAt( source )
+            if ( isTreeEdge
+                && oldestTimeSeenAtTarget >= this->EntryTimeAt( source )
                 && !IsRoot( source ) ) {
                 // The source is at least as old as the oldest reachable vertex
                 // from the target. Therefore, the source is an articulation vertex.
@@ -128,7 +122,7 @@ class ArticulationVertexDetection : public DepthFirstSearch<GraphType, IsDirecte
          *
          * @param[in]  vertexId  The vertex identifier.
          */
-        virtual inline void PostprocessingVertexWith ( TVertexId vertexId ) override
+        inline void PostprocessingVertexWith ( TVertexId vertexId )
         {
             if ( IsRoot( vertexId ) ) {
                 isArticulationVertex_[ vertexId ] = (TreeOutDegree( vertexId ) > 1);
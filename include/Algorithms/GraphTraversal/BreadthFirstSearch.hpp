@@ -9,6 +9,9 @@
 
 #include "Algorithms/GraphTraversal/Traversal.hpp"
 #include "DataStructures/Container/Queues/StdQueue.hpp"
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Graphs/Vertices/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
 
 namespace egoa {
 
@@ -32,18 +35,24 @@ namespace egoa {
  * @tparam     QueueType  The queue should provide the same interface as Queue().
  * @tparam     IsDirected  If @p true the graph is treated as a directed graph,
  *     if @p false the graph is treated as an undirected graph.
+ *
+ * @see        ParallelBFS for a level-synchronous variant that uses all
+ *     threads on large graphs.
  */
 template< typename GraphType = StaticGraph<Vertices::ElectricalProperties<>,Edges::ElectricalProperties>
-        , typename QueueType = StdQueue<GraphType::TVertexId>
+        , typename QueueType = StdQueue<typename GraphType::TVertexId>
         , bool     IsDirected= false >
-class BFS final : Traversal<IsDirected> {
+class BFS : public Traversal<GraphType, IsDirected> {
     public:
         // Type aliasing
-        using TQueue    = QueueType;
+        using TGraph     = GraphType;
+        using TVertexId  = typename TGraph::TVertexId;
+        using TQueue     = QueueType;
+        using TTraversal = Traversal<GraphType, IsDirected>;
 
     public:
 #pragma mark CONSTRUCTOR_AND_DESTRUCTOR
-        BFS ( TGraph const & graph, TVertex source )
+        BFS ( TGraph const & graph, TVertexId source )
         : TTraversal ( graph, source )
         , queue_()
         {}
@@ -57,29 +66,28 @@ class BFS final : Traversal<IsDirected> {
         virtual inline void Run() {
             ESSENTIAL_ASSERT ( queue_.Empty() );
 
-            EnqueueVertexWith  ( source_ );
-            SetVertexVisitedAt ( source_ );
+            EnqueueVertexWith        ( this->Source() );
+            this->SetVertexVisitedAt ( this->Source() );
 
             while ( !queue_.Empty() ) {
-                ESSENTIAL_ASSERT ( queue_.Empty() );
-                TVertex sourceId = DequeueVertex();
-                ESSENTIAL_ASSERT ( graph_.VertexExists ( sourceId ) );
-                ESSENTIAL_ASSERT ( VisitedVertexAt ( sourceId ) );
+                TVertexId sourceId = DequeueVertex();
+                ESSENTIAL_ASSERT ( this->VertexExists ( sourceId ) );
+                ESSENTIAL_ASSERT ( this->VisitedVertexAt ( sourceId ) );
 
-                PreprocessingVertexWith ( sourceId );
-                SetVertexProcessedAt    ( sourceId );
+                PreprocessingVertexWith    ( sourceId );
+                this->SetVertexProcessedAt ( sourceId );
 
-                for_all_edges_at( sourceId, []( ElectricalEdge & edge ) {
-                    TVertex targetId = edge.Other  ( sourceId );
-                    ESSENTIAL_ASSERT ( graph_.VertexExists ( targetId ) );
+                this->for_all_edges_at( sourceId, [this, sourceId]( typename TGraph::TEdge const & edge ) {
+                    TVertexId targetId = edge.Other  ( sourceId );
+                    ESSENTIAL_ASSERT ( this->VertexExists ( targetId ) );
 
-                    if ( !ProcessedVertexAt( targetId ) || graph_.IsDirected() ) {
-                        ProcessingEdgeWith ( edge.Identifier() );
+                    if ( !this->ProcessedVertexAt( targetId ) || IsDirected ) {
+                        ProcessingEdgeWith ( sourceId, targetId, edge.Identifier() );
                     }
-                    if ( !VisitedVertexAt( targetId ) ) {
-                        EnqueueVertexWith  ( targetId );
-                        SetVertexVisitedAt ( targetId );
-                        ParentOf ( targetId ) = sourceId;
+                    if ( !this->VisitedVertexAt( targetId ) ) {
+                        EnqueueVertexWith        ( targetId );
+                        this->SetVertexVisitedAt ( targetId );
+                        this->ParentOf ( targetId ) = sourceId;
                     }
                 });
                 PostprocessingVertexWith ( sourceId );
@@ -95,8 +103,8 @@ class BFS final : Traversal<IsDirected> {
          *
          * @param[in]  vertexId  The vertex identifier.
          */
-        inline void EnqueueVertexWith ( TVertex vertexId ) {
-            USAGE_ASSERT ( graph_.VertexExists ( vertexId ) );
+        inline void EnqueueVertexWith ( TVertexId vertexId ) {
+            USAGE_ASSERT ( this->VertexExists ( vertexId ) );
             queue_.Push ( vertexId );
         }
 
@@ -107,19 +115,19 @@ class BFS final : Traversal<IsDirected> {
          *
          * @return     The next unprocessed but visited vertex.
          */
-        inline TVertex DequeueVertex ( ) {
-            USAGE_ASSERT ( graph_.VertexExists ( vertexId ) );
-            TVertex vertexId = queue_.front();
-            queue_.Pop();
-            return vertexId;
+        inline TVertexId DequeueVertex ( ) {
+            USAGE_ASSERT ( !queue_.Empty() );
+            return queue_.DeleteTop();
         }
 
 //exact behavior of the Breadth-First Search (BFS) depends on the processing methods
 #pragma mark FURTHER_PROCESSING
-        virtual inline void PreprocessingVertexWith  ( TVertex vertexId ) override {}
-        virtual inline void PostprocessingVertexWith ( TVertex vertexId ) override {}
-        virtual inline void ProcessingEdgeWith  ( TVertex sourceId
-                                                , TVertex targetId ) override {}
+    protected:
+        virtual inline void PreprocessingVertexWith  ( TVertexId /*vertexId*/ ) {}
+        virtual inline void PostprocessingVertexWith ( TVertexId /*vertexId*/ ) {}
+        virtual inline void ProcessingEdgeWith  ( TVertexId     /*sourceId*/
+                                                , TVertexId     /*targetId*/
+                                                , Types::edgeId /*edgeId*/ ) {}
 
 #pragma mark MEMBERS
     private:
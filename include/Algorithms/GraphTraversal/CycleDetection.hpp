@@ -7,16 +7,36 @@
 #ifndef EGOA__ALGORITHMS__GRAPH_TRAVERSAL__CYCLE_DETECTION__HPP
 #define EGOA__ALGORITHMS__GRAPH_TRAVERSAL__CYCLE_DETECTION__HPP
 
-#include "Algorithms/GraphTraversal/DepthFirstSearch.hpp"
+#include <algorithm>
+#include <vector>
+
+#include "Algorithms/GraphTraversal/IterativeDepthFirstSearch.hpp"
+
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Graphs/Vertices/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
 
 namespace egoa {
 
 /**
  * @brief      Class to detect a cycle in the graph.
- * @details    Similar to DFS, but overriding the @p ProcessingEdgeWith
- *     method. Note that a cycle detection can only be if the target vertex
- *     was already visited, but not processed. This represent the second
- *     branch in the if condition of the @p breakable_for_all_edges_at.
+ * @details    Similar to DFS, but hiding the @p ProcessingEdgeWith hook of
+ *     IterativeDepthFirstSearch. Note that a cycle can only be detected if the
+ *     target vertex was already visited, but not processed, i.e., the target
+ *     is on the current path of the search.
+ *
+ *     In the undirected case, the first non-tree edge that is scanned always
+ *     leads from the deeper end to an ancestor on the current path. Thus,
+ *     every non-tree edge closes a cycle, including parallel edges and
+ *     self-loops.
+ *
+ * @code{.cpp}
+ *      CycleDetection<TGraph> cycleDetection ( graph, 0 );
+ *      cycleDetection.Run();
+ *      if ( cycleDetection.HasCycle() ) {
+ *          for ( auto vertexId : cycleDetection.Cycle() ) { ... }
+ *      }
+ * @endcode
  *
  * @tparam     GraphType  The graph should at least provide the same interface
  *     as the StaticGraph().
@@ -25,31 +45,112 @@ namespace egoa {
  */
 template< typename GraphType = StaticGraph<Vertices::ElectricalProperties<>,Edges::ElectricalProperties>
         , bool IsDirected    = false >
-class CycleDetection final : public DFS<GraphType, IsDirected> {
+class CycleDetection final
+    : public IterativeDepthFirstSearch<CycleDetection<GraphType, IsDirected>, GraphType, IsDirected> {
+        using TSearch   = IterativeDepthFirstSearch<CycleDetection<GraphType, IsDirected>, GraphType, IsDirected>;
+        friend TSearch;
     public:
+        using TGraph    = GraphType;
+        using TVertexId = typename TGraph::TVertexId;
+
 #pragma mark CONSTRUCTOR_AND_DESTRUCTOR
-        CycleDetection ( TGraph const & graph, TVertex source )
-        : DFS ( graph, source ){}
+        CycleDetection ( TGraph const & graph, TVertexId source )
+        : TSearch ( graph, source )
+        , cycle_()
+        , cycleEdges_()
+        {}
+
+#pragma mark GETTER
+        /**
+         * @brief      Whether the search found a cycle.
+         *
+         * @return     @p true if a cycle was found, @p false otherwise.
+         */
+        inline bool HasCycle() const
+        {
+            return !cycleEdges_.empty();
+        }
+
+        /**
+         * @brief      The vertices of the cycle.
+         * @details    The cycle starts at the vertex that was entered first.
+         *     The edge <tt>CycleEdges()[i]</tt> connects <tt>Cycle()[i]</tt>
+         *     and <tt>Cycle()[(i + 1) % Cycle().size()]</tt>.
+         *
+         * @return     The vertex identifiers of the cycle, or an empty
+         *     vector if there is no cycle.
+         */
+        inline std::vector<TVertexId> const & Cycle() const
+        {
+            return cycle_;
+        }
+
+        /**
+         * @brief      The edges of the cycle.
+         *
+         * @return     The edge identifiers of the cycle, or an empty vector
+         *     if there is no cycle.
+         */
+        inline std::vector<Types::edgeId> const & CycleEdges() const
+        {
+            return cycleEdges_;
+        }
 
+    private:
 #pragma mark FURTHER_PROCESSING
         /**
-         * @brief      Detect backward edge and thus, detect the first cycle found.
-         * @details    Note that the DFS algorithm processes every edge
-         *     exactly once using @p breakable_for_all_edges_at. Thus, there
-         *     are no spurious two-vertex cycles in undirected graphs such as
-         *     paths = (u,v) and (v,u).
+         * @brief      Detect a backward edge and thus, the first cycle found.
+         *
+         * @param[in]  source  The source identifier.
+         * @param[in]  target  The target identifier.
+         * @param[in]  edgeId  The edge identifier.
+         */
+        inline void ProcessingEdgeWith ( TVertexId     source
+                                       , TVertexId     target
+                                       , Types::edgeId edgeId )
+        {
+            if ( this->ProcessedVertexAt ( target ) ) return;
+
+            ExtractCycle ( source, target, edgeId );
+            this->SetTerminate();
+        }
+
+        /**
+         * @brief      Extract the cycle that is closed by the backward edge
+         *     from @p source to its ancestor @p target.
          *
          * @param[in]  source  The source identifier.
          * @param[in]  target  The target identifier.
+         * @param[in]  edgeId  The edge identifier.
          */
-        virtual inline void ProcessingEdgeWith  ( TVertex const source
-                                                , TVertex const target ) override
+        inline void ExtractCycle ( TVertexId     source
+                                 , TVertexId     target
+                                 , Types::edgeId edgeId )
         {
-            if ( source != ParentOf ( target ) ) {
-                ExtractPath ( source, target );
-                SetTerminate();
+            cycle_.clear();
+            cycleEdges_.clear();
+
+            cycleEdges_.push_back ( edgeId );
+            for ( TVertexId vertexId = source
+                ; vertexId != target
+                ; vertexId = this->ParentOf ( vertexId ) )
+            {
+                ESSENTIAL_ASSERT ( vertexId != Const::NONE );
+                cycle_.push_back      ( vertexId );
+                cycleEdges_.push_back ( this->ParentEdgeOf ( vertexId ) );
             }
+            cycle_.push_back ( target );
+
+            std::reverse ( cycle_.begin(),      cycle_.end() );
+            std::reverse ( cycleEdges_.begin(), cycleEdges_.end() );
         }
+
+#pragma mark MEMBERS
+    private:
+        std::vector<TVertexId>      cycle_;         /**< The vertices of the cycle */
+        std::vector<Types::edgeId>  cycleEdges_;    /**< The edges of the cycle */
 };
 
+} // namespace egoa
+
 #endif // EGOA__ALGORITHMS__GRAPH_TRAVERSAL__CYCLE_DETECTION__HPP
@@ -0,0 +1,411 @@
+/*
+ * IterativeDepthFirstSearch.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+#ifndef EGOA__ALGORITHMS__GRAPH_TRAVERSAL__ITERATIVE_DEPTH_FIRST_SEARCH__HPP
+#define EGOA__ALGORITHMS__GRAPH_TRAVERSAL__ITERATIVE_DEPTH_FIRST_SEARCH__HPP
+
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "DataStructures/Graphs/CsrGraph.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+enum class DfsEdgeType {
+        tree        = 0
+    ,   backward    = 1
+    ,   forward     = 2
+    ,   cross       = 3
+    ,   none        = 99
+};
+
+/**
+ * @brief      Depth-First Search (DFS) with an explicit stack and
+ *     compile-time hooks.
+ * @details    The search keeps a stack of the vertices on the current path
+ *     together with the position of their next incident edge in the packed
+ *     adjacency. Thus, the depth of the search is not limited by the call
+ *     stack, e.g., on long radial feeders.
+ *
+ *     The hooks are resolved at compile time by the curiously recurring
+ *     template pattern (CRTP). A derived class @p Derived hides the hooks it
+ *     needs, i.e.,
+ *      - @p PreprocessingVertexWith ( vertexId ) after entering a vertex,
+ *      - @p ProcessingEdgeWith ( source, target, edgeId ) for each non-tree
+ *        edge,
+ *      - @p PostprocessingEdgeWith ( source, target, edgeId ) for each
+ *        non-tree edge and for each tree edge after its target is finished,
+ *      - @p PostprocessingVertexWith ( vertexId ) before leaving a vertex.
+ *     The remaining hooks default to empty functions that are inlined away.
+ *     If the hooks are not public, @p Derived has to befriend this class.
+ *
+ *     In the undirected case, only the tree edge to the parent is skipped.
+ *     Thus, a parallel edge to the parent is a backward edge.
+ *
+ *     The run time is in O(n + m).
+ *
+ * @code{.cpp}
+ *      template<typename GraphType>
+ *      class LeafCounter final
+ *          : public IterativeDepthFirstSearch<LeafCounter<GraphType>, GraphType> {
+ *          using TSearch = IterativeDepthFirstSearch<LeafCounter<GraphType>, GraphType>;
+ *          friend TSearch;
+ *          public:
+ *              LeafCounter ( GraphType const & graph, Types::vertexId source )
+ *              : TSearch ( graph, source ) {}
+ *
+ *              Types::count numberOfLeaves = 0;
+ *          private:
+ *              inline void PostprocessingVertexWith ( Types::vertexId vertexId )
+ *              {
+ *                  if ( this->ExitTimeAt ( vertexId ) == this->EntryTimeAt ( vertexId ) + 1 )
+ *                      ++numberOfLeaves;
+ *              }
+ *      };
+ * @endcode
+ *
+ * @tparam     Derived     The derived class that provides the hooks.
+ * @tparam     GraphType   The graph should at least provide the same
+ *     interface as the StaticGraph().
+ * @tparam     IsDirected  If @p true the graph is treated as a directed
+ *     graph, if @p false the graph is treated as an undirected graph.
+ */
+template< typename Derived
+        , typename GraphType
+        , bool     IsDirected = false >
+class IterativeDepthFirstSearch {
+    public:
+        using TGraph    = GraphType;
+        using TVertexId = typename TGraph::TVertexId;
+        using TEdgeId   = Types::edgeId;
+        using TTime     = Types::count;
+
+    private:
+        /**
+         * @brief      The entry and the exit time of a vertex.
+         * @details    Both times are stored next to each other, since they
+         *     are mostly accessed together.
+         */
+        struct TimeStamps {
+            TTime entry;
+            TTime exit;
+        };
+
+        /**
+         * @brief      A vertex on the stack and the position of its next
+         *     incident edge.
+         */
+        struct Frame {
+            TVertexId    vertex;
+            Types::index next;
+        };
+
+    public:
+        ///@name Constructors and destructor
+        ///@{
+#pragma mark CONSTRUCTOR_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs a new DFS instance.
+             *
+             * @param      graph   The graph
+             * @param[in]  source  The source
+             */
+            IterativeDepthFirstSearch ( TGraph const & graph
+                                      , TVertexId      source )
+            : csr_( graph )
+            , source_( source )
+            , time_( 0 )
+            , terminate_( false )
+            , parent_( graph.NumberOfVertices(), Const::NONE )
+            , parentEdge_( graph.NumberOfVertices(), Const::NONE )
+            , times_( graph.NumberOfVertices(), TimeStamps{ Const::NONE, Const::NONE } )
+            , stack_()
+            {}
+        ///@}
+
+#pragma mark DEPTH_FIRST_SEARCH
+        /**
+         * @brief      Run the Depth-First Search (DFS) from the source.
+         */
+        inline void Run()
+        {
+            USAGE_ASSERT ( VertexExists ( Source() ) );
+            ESSENTIAL_ASSERT ( stack_.empty() );
+
+            EnterVertex ( Source() );
+
+            while ( !stack_.empty() )
+            {
+                if ( Terminate() ) break;
+
+                TVertexId    const source = stack_.back().vertex;
+                Types::index const index  = stack_.back().next;
+
+                if ( index == csr_.EndAt ( source ) )
+                {
+                    LeaveVertex ( source );
+                    continue;
+                }
+                ++stack_.back().next;
+
+                TVertexId const target = csr_.NeighborAt ( index );
+                TEdgeId   const edgeId = csr_.EdgeIdAt   ( index );
+
+                // Ignore the tree edge that leads back to the parent
+                if ( edgeId == ParentEdgeOf ( source ) ) continue;
+
+                if ( !VisitedVertexAt ( target ) )
+                {
+                    parent_[target]     = source;
+                    parentEdge_[target] = edgeId;
+                    EnterVertex ( target );
+                    continue;
+                }
+
+                Self().ProcessingEdgeWith     ( source, target, edgeId );
+                Self().PostprocessingEdgeWith ( source, target, edgeId );
+            }
+            stack_.clear();
+        }
+
+        /**
+         * @brief      Clears the search such that it can be run again.
+         */
+        inline void Clear()
+        {
+            time_      = 0;
+            terminate_ = false;
+            parent_.assign     ( parent_.size(),     Const::NONE );
+            parentEdge_.assign ( parentEdge_.size(), Const::NONE );
+            times_.assign      ( times_.size(),      TimeStamps{ Const::NONE, Const::NONE } );
+            stack_.clear();
+        }
+
+#pragma mark DFS_EDGE_TYPE
+        /**
+         * @brief      Determine DFS edge type.
+         *
+         * @param[in]  source  The source identifier.
+         * @param[in]  target  The target identifier.
+         *
+         * @return     The DFS edge type.
+         */
+        inline DfsEdgeType TypifyEdge ( TVertexId source, TVertexId target ) const
+        {
+            if ( source == ParentOf ( target ) )                        return DfsEdgeType::tree;
+            if ( VisitedVertexAt ( target )
+                && !ProcessedVertexAt ( target ) )                      return DfsEdgeType::backward;
+            if ( ProcessedVertexAt ( target )
+                && EntryTimeAt ( target ) > EntryTimeAt ( source ) )    return DfsEdgeType::forward;
+            if ( ProcessedVertexAt ( target )
+                && EntryTimeAt ( target ) < EntryTimeAt ( source ) )    return DfsEdgeType::cross;
+            return DfsEdgeType::none;
+        }
+
+#pragma mark GETTER_AND_SETTER
+        /**
+         * @brief      Getter and setter for the source vertex.
+         *
+         * @return     The source's identifier.
+         */
+        ///@{
+            inline TVertexId   Source() const { return source_; }
+            inline TVertexId & Source()       { return source_; }
+        ///@}
+
+        /**
+         * @brief      Terminate the DFS
+         *
+         * @return     @p true if the DFS is terminated, @p false otherwise.
+         */
+        inline bool Terminate()    const { return terminate_; }
+        inline void SetTerminate()       { terminate_ = true; }
+
+        /**
+         * @brief      The entry time of a vertex.
+         *
+         * @param      vertexId  The vertex identifier.
+         *
+         * @return     The entry time, or @p Const::NONE if the vertex was not
+         *     visited.
+         */
+        inline TTime EntryTimeAt ( TVertexId vertexId ) const
+        {
+            USAGE_ASSERT ( VertexExists ( vertexId ) );
+            return times_[vertexId].entry;
+        }
+
+        /**
+         * @brief      Returns the exit time of a vertex.
+         *
+         * @param      vertexId  The vertex identifier.
+         *
+         * @return     The exit time for a vertex during the DFS, or @p
+         *     Const::NONE if the vertex was not processed.
+         */
+        inline TTime ExitTimeAt ( TVertexId vertexId ) const
+        {
+            USAGE_ASSERT ( VertexExists ( vertexId ) );
+            return times_[vertexId].exit;
+        }
+
+        /**
+         * @brief      Whether the vertex was entered.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     @p true if the vertex was visited, otherwise @p false.
+         */
+        inline bool VisitedVertexAt ( TVertexId vertexId ) const
+        {
+            return EntryTimeAt ( vertexId ) != Const::NONE;
+        }
+
+        /**
+         * @brief      Whether the vertex was left.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     @p true if the vertex is processed, otherwise @p false.
+         */
+        inline bool ProcessedVertexAt ( TVertexId vertexId ) const
+        {
+            return ExitTimeAt ( vertexId ) != Const::NONE;
+        }
+
+        /**
+         * @brief      The parent of a vertex in the DFS tree.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     The vertex identifier of the parent, or @p Const::NONE
+         *     for the source and unvisited vertices.
+         */
+        inline TVertexId ParentOf ( TVertexId vertexId ) const
+        {
+            USAGE_ASSERT ( VertexExists ( vertexId ) );
+            return parent_[vertexId];
+        }
+
+        /**
+         * @brief      The tree edge from the parent of a vertex.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     The edge identifier, or @p Const::NONE for the source
+         *     and unvisited vertices.
+         */
+        inline TEdgeId ParentEdgeOf ( TVertexId vertexId ) const
+        {
+            USAGE_ASSERT ( VertexExists ( vertexId ) );
+            return parentEdge_[vertexId];
+        }
+
+#pragma mark RESULT_EXTRACTION
+        /**
+         * @brief      The DFS tree in form of parent pointers.
+         *
+         * @param      parent  The parent of each vertex.
+         */
+        inline void Result ( std::vector<TVertexId> & parent ) const
+        {
+            parent = parent_;
+        }
+
+    protected:
+        ///@name Hooks
+        ///@{
+#pragma mark FURTHER_PROCESSING
+            inline void PreprocessingVertexWith  ( TVertexId /*vertexId*/ ) {}
+            inline void PostprocessingVertexWith ( TVertexId /*vertexId*/ ) {}
+            inline void ProcessingEdgeWith       ( TVertexId /*source*/
+                                                 , TVertexId /*target*/
+                                                 , TEdgeId   /*edgeId*/ ) {}
+            inline void PostprocessingEdgeWith   ( TVertexId /*source*/
+                                                 , TVertexId /*target*/
+                                                 , TEdgeId   /*edgeId*/ ) {}
+        ///@}
+
+        inline bool VertexExists ( TVertexId vertexId ) const
+        {
+            return vertexId < csr_.NumberOfVertices();
+        }
+
+        inline Types::count NumberOfVertices() const
+        {
+            return csr_.NumberOfVertices();
+        }
+
+    private:
+#pragma mark STACK_METHODS
+        inline Derived & Self()
+        {
+            return static_cast<Derived &>( *this );
+        }
+
+        /**
+         * @brief      Enters a vertex and pushes it onto the stack.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         */
+        inline void EnterVertex ( TVertexId vertexId )
+        {
+            times_[vertexId].entry = time_++;
+            stack_.push_back ( Frame{ vertexId, FirstScannedEntryAt ( vertexId ) } );
+            Self().PreprocessingVertexWith ( vertexId );
+        }
+
+        /**
+         * @brief      Leaves a vertex, pops it from the stack, and
+         *     postprocesses the tree edge from its parent.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         */
+        inline void LeaveVertex ( TVertexId vertexId )
+        {
+            times_[vertexId].exit = time_++;
+            stack_.pop_back();
+            Self().PostprocessingVertexWith ( vertexId );
+
+            if ( !stack_.empty() )
+            {
+                Self().PostprocessingEdgeWith ( ParentOf ( vertexId )
+                                              , vertexId
+                                              , ParentEdgeOf ( vertexId ) );
+            }
+        }
+
+        /**
+         * @brief      The first entry that is scanned, i.e., the first
+         *     outgoing edge in the directed case.
+         */
+        inline Types::index FirstScannedEntryAt ( TVertexId vertexId ) const
+        {
+            return IsDirected ? csr_.EndAt ( vertexId ) - csr_.OutDegreeAt ( vertexId )
+                              : csr_.BeginAt ( vertexId );
+        }
+
+#pragma mark MEMBERS
+    private:
+        CsrGraph                    csr_;           /**< The packed adjacency of the graph G=(V,E) */
+        TVertexId                   source_;        /**< Source vertex from which DFS starts */
+        TTime                       time_;          /**< Current time counter */
+        bool                        terminate_;     /**< Terminate search */
+
+        std::vector<TVertexId>      parent_;        /**< DFS structure in form of parent pointers */
+        std::vector<TEdgeId>        parentEdge_;    /**< The tree edge from the parent per vertex */
+        std::vector<TimeStamps>     times_;         /**< Entry and exit time per vertex */
+        std::vector<Frame>          stack_;         /**< The vertices on the current path */
+}; // class IterativeDepthFirstSearch
+
+} // namespace egoa
+
+#endif // EGOA__ALGORITHMS__GRAPH_TRAVERSAL__ITERATIVE_DEPTH_FIRST_SEARCH__HPP
@@ -0,0 +1,563 @@
+/*
+ * ParallelBreadthFirstSearch.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+#ifndef EGOA__ALGORITHMS__GRAPH_TRAVERSAL__PARALLEL_BREADTH_FIRST_SEARCH__HPP
+#define EGOA__ALGORITHMS__GRAPH_TRAVERSAL__PARALLEL_BREADTH_FIRST_SEARCH__HPP
+
+#ifdef OPENMP_AVAILABLE
+    #include <omp.h>
+#endif // OPENMP_AVAILABLE
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "DataStructures/Graphs/CsrGraph.hpp"
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Graphs/Vertices/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      Class for a level-synchronous, direction-optimizing
+ *     Breadth-First Search (BFS).
+ * @details    The search processes the graph level by level. Each level is
+ *     either expanded top-down, i.e., the vertices of the frontier claim
+ *     their unvisited neighbors, or bottom-up, i.e., each unvisited vertex
+ *     looks for a neighbor in the frontier and stops at the first one. The
+ *     bottom-up steps pay off if the frontier is large, since most edges of
+ *     the unvisited vertices would be scanned top-down anyway, but the
+ *     bottom-up scan of a vertex ends early. Let @f$m_f@f$ be the number of
+ *     edges at the frontier, @f$m_u@f$ the number of edges at unvisited
+ *     vertices, and @f$n_f@f$ the number of vertices in the frontier. The
+ *     search switches to bottom-up if @f$m_f\cdot\alpha > m_u@f$ and back to
+ *     top-down if @f$n_f\cdot\beta < n@f$, see Beamer, Asanović, and
+ *     Patterson, "Direction-Optimizing Breadth-First Search", SC 2012.
+ *
+ *     The top-down frontier is a list of vertices and the vertices are
+ *     claimed by an atomic compare-and-swap of their parent. The bottom-up
+ *     frontier is a bitmap and each thread owns whole words of the bitmap,
+ *     so no synchronization is necessary. If OpenMP is available, all
+ *     levels run in parallel. Otherwise, the same steps run sequentially.
+ *
+ *     The resulting parent pointers form a BFS tree, i.e., the parent of a
+ *     vertex is on the previous level. In a top-down step the tree depends
+ *     on the order in which the threads claim the vertices, but the
+ *     distances do not.
+ *
+ *     The run time is in O(n + m) per search.
+ *
+ * @code{.cpp}
+ *      ParallelBFS<TGraph> bfs ( graph, sourceId );
+ *      bfs.Run();
+ *      if ( bfs.NumberOfVisitedVertices() < graph.NumberOfVertices() )
+ *      {
+ *          // The network is split into islands.
+ *      }
+ *      std::vector<Types::vertexId> parent;
+ *      bfs.Result ( parent );
+ * @endcode
+ *
+ * @pre        The vertex identifiers are consecutive, i.e., in @f$\{0,
+ *     \ldots, n-1\}@f$.
+ *
+ * @tparam     GraphType   The graph should at least provide the same
+ *     interface as the StaticGraph().
+ * @tparam     IsDirected  If @p true the graph is treated as a directed
+ *     graph, if @p false the graph is treated as an undirected graph.
+ *
+ * @see        BFS
+ */
+template< typename GraphType = StaticGraph<Vertices::ElectricalProperties<>,Edges::ElectricalProperties>
+        , bool     IsDirected= false >
+class ParallelBFS {
+    public:
+        // Type aliasing
+        using TGraph    = GraphType;
+        using TVertexId = typename TGraph::TVertexId;
+
+    private:
+        using TWord     = std::uint64_t;
+
+    public:
+        ///@name Constructors and destructor
+        ///@{
+#pragma mark CONSTRUCTOR_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs a new parallel BFS instance.
+             * @details    The adjacency of the graph is packed once. Thus,
+             *     the instance can be reused for several searches as long
+             *     as no vertex or edge is added to or removed from the
+             *     graph.
+             *
+             * @param      graph   The graph
+             * @param[in]  source  The source
+             */
+            ParallelBFS ( TGraph const & graph, TVertexId source )
+            : csr_( graph )
+            , source_( source )
+            , alpha_( 14.0 )
+            , beta_( 24.0 )
+            , parent_( graph.NumberOfVertices() )
+            , distance_( graph.NumberOfVertices(), Const::NONE )
+            , frontier_()
+            , frontierBits_( NumberOfWords() , 0 )
+            , nextBits_( NumberOfWords() , 0 )
+            , numberOfVisitedVertices_( 0 )
+            , numberOfTopDownSteps_( 0 )
+            , numberOfBottomUpSteps_( 0 )
+            {
+                Clear();
+            }
+        ///@}
+
+#pragma mark GETTER_AND_SETTER
+        /**
+         * @brief      Getter and setter for the source vertex.
+         *
+         * @return     The source's identifier.
+         */
+        ///@{
+            inline TVertexId   Source() const { return source_; }
+            inline TVertexId & Source()       { return source_; }
+        ///@}
+
+        /**
+         * @brief      Getter and setter for the factor @f$\alpha@f$.
+         * @details    The search switches to bottom-up if
+         *     @f$m_f\cdot\alpha > m_u@f$. The default is 14. A value of 0
+         *     results in a top-down search only.
+         *
+         * @return     The factor @f$\alpha@f$.
+         */
+        ///@{
+            inline Types::real   Alpha() const { return alpha_; }
+            inline Types::real & Alpha()       { return alpha_; }
+        ///@}
+
+        /**
+         * @brief      Getter and setter for the factor @f$\beta@f$.
+         * @details    The search switches back to top-down if
+         *     @f$n_f\cdot\beta < n@f$. The default is 24. Together with an
+         *     infinite @f$\alpha@f$, an infinite value results in a
+         *     bottom-up search only.
+         *
+         * @return     The factor @f$\beta@f$.
+         */
+        ///@{
+            inline Types::real   Beta() const { return beta_; }
+            inline Types::real & Beta()       { return beta_; }
+        ///@}
+
+#pragma mark BREADTH_FIRST_SEARCH
+        /**
+         * @brief      Run the Breadth-First search (BFS) from the source.
+         * @details    The results of a previous run are discarded.
+         */
+        inline void Run()
+        {
+            USAGE_ASSERT ( VertexExists ( Source() ) );
+
+            Clear();
+
+            parent_[Source()].store ( Source(), std::memory_order_relaxed );
+            distance_[Source()]      = 0;
+            frontier_.push_back ( Source() );
+            numberOfVisitedVertices_ = 1;
+
+            Types::count frontierSize  = 1;
+            Types::count frontierEdges = DegreeAt ( Source() );
+            Types::count unvisitedEdges = 0;
+            for ( TVertexId vertexId = 0; vertexId < NumberOfVertices(); ++vertexId )
+            {
+                unvisitedEdges += DegreeAt ( vertexId );
+            }
+            unvisitedEdges -= frontierEdges;
+
+            bool isBottomUp = false;
+            for ( Types::count level = 0
+                ; frontierSize > 0 && numberOfVisitedVertices_ < NumberOfVertices()
+                ; ++level )
+            {
+                if ( !isBottomUp
+                    && static_cast<Types::real>( frontierEdges ) * Alpha() > unvisitedEdges )
+                {
+                    FrontierToBitmap();
+                    isBottomUp = true;
+                } else if ( isBottomUp
+                    && static_cast<Types::real>( frontierSize ) * Beta() < NumberOfVertices() )
+                {
+                    BitmapToFrontier();
+                    isBottomUp = false;
+                }
+
+                if ( isBottomUp )
+                {
+                    BottomUpStep ( level, frontierSize, frontierEdges );
+                    ++numberOfBottomUpSteps_;
+                } else {
+                    TopDownStep ( level, frontierSize, frontierEdges );
+                    ++numberOfTopDownSteps_;
+                }
+
+                numberOfVisitedVertices_ += frontierSize;
+                unvisitedEdges           -= frontierEdges;
+            }
+        }
+
+        /**
+         * @brief      Clears the results and the frontiers.
+         */
+        inline void Clear()
+        {
+            for ( auto & parent : parent_ )
+            {
+                parent.store ( Const::NONE, std::memory_order_relaxed );
+            }
+            distance_.assign ( NumberOfVertices(), Const::NONE );
+            frontier_.clear();
+            numberOfVisitedVertices_ = 0;
+            numberOfTopDownSteps_    = 0;
+            numberOfBottomUpSteps_   = 0;
+        }
+
+#pragma mark RESULT_EXTRACTION
+        /**
+         * @brief      The BFS tree in form of parent pointers.
+         * @details    The source and the vertices that were not reached have
+         *     the parent @p Const::NONE.
+         *
+         * @param      parent  The parent of each vertex.
+         */
+        inline void Result ( std::vector<TVertexId> & parent ) const
+        {
+            parent.resize ( NumberOfVertices() );
+            for ( TVertexId vertexId = 0; vertexId < NumberOfVertices(); ++vertexId )
+            {
+                parent[vertexId] = ParentOf ( vertexId );
+            }
+        }
+
+        /**
+         * @brief      The parent of a vertex in the BFS tree.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     The vertex identifier of the parent, or @p Const::NONE
+         *     for the source and the vertices that were not reached.
+         */
+        inline TVertexId ParentOf ( TVertexId vertexId ) const
+        {
+            USAGE_ASSERT ( VertexExists ( vertexId ) );
+            if ( vertexId == Source() ) return Const::NONE;
+            return parent_[vertexId].load ( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief      The number of edges on a shortest path from the source.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     The hop distance, or @p Const::NONE if the vertex was
+         *     not reached.
+         */
+        inline Types::count DistanceAt ( TVertexId vertexId ) const
+        {
+            USAGE_ASSERT ( VertexExists ( vertexId ) );
+            return distance_[vertexId];
+        }
+
+        /**
+         * @brief      Whether the vertex was reached from the source.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         *
+         * @return     @p true if the vertex was visited, otherwise @p false.
+         */
+        inline bool VisitedVertexAt ( TVertexId vertexId ) const
+        {
+            return DistanceAt ( vertexId ) != Const::NONE;
+        }
+
+        /**
+         * @brief      The number of vertices that were reached from the
+         *     source including the source.
+         *
+         * @return     The size of the connected component of the source in
+         *     the undirected case.
+         */
+        inline Types::count NumberOfVisitedVertices() const
+        {
+            return numberOfVisitedVertices_;
+        }
+
+        /**
+         * @brief      The number of levels that were expanded top-down.
+         *
+         * @return     The number of top-down steps of the last run.
+         */
+        inline Types::count NumberOfTopDownSteps() const
+        {
+            return numberOfTopDownSteps_;
+        }
+
+        /**
+         * @brief      The number of levels that were expanded bottom-up.
+         *
+         * @return     The number of bottom-up steps of the last run.
+         */
+        inline Types::count NumberOfBottomUpSteps() const
+        {
+            return numberOfBottomUpSteps_;
+        }
+
+    private:
+        ///@name Steps
+        ///@{
+#pragma mark STEPS
+            /**
+             * @brief      Expands the frontier list by claiming the unvisited
+             *     neighbors of its vertices.
+             *
+             * @param[in]  level          The level of the frontier.
+             * @param      frontierSize   The size of the next frontier.
+             * @param      frontierEdges  The number of edges at the next
+             *     frontier.
+             */
+            inline void TopDownStep ( Types::count   level
+                                    , Types::count & frontierSize
+                                    , Types::count & frontierEdges )
+            {
+                std::vector<TVertexId> next;
+                Types::count           nextEdges = 0;
+                Types::count const     numberOfFrontierVertices = frontier_.size();
+
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel
+#endif // OPENMP_AVAILABLE
+                {
+                    std::vector<TVertexId> localNext;
+                    Types::count           localEdges = 0;
+
+#ifdef OPENMP_AVAILABLE
+                    #pragma omp for schedule ( dynamic, 64 ) nowait
+#endif // OPENMP_AVAILABLE
+                    for ( Types::index position = 0; position < numberOfFrontierVertices; ++position )
+                    {
+                        TVertexId const sourceId = frontier_[position];
+                        for ( Types::index index = TopDownBeginAt ( sourceId )
+                            ; index < csr_.EndAt ( sourceId )
+                            ; ++index )
+                        {
+                            TVertexId const targetId = csr_.NeighborAt ( index );
+                            TVertexId       expected = Const::NONE;
+                            if ( parent_[targetId].load ( std::memory_order_relaxed ) != Const::NONE ) continue;
+                            if ( !parent_[targetId].compare_exchange_strong ( expected, sourceId
+                                                                            , std::memory_order_relaxed ) ) continue;
+                            distance_[targetId] = level + 1;
+                            localNext.push_back ( targetId );
+                            localEdges += DegreeAt ( targetId );
+                        }
+                    }
+
+#ifdef OPENMP_AVAILABLE
+                    #pragma omp critical
+#endif // OPENMP_AVAILABLE
+                    {
+                        next.insert ( next.end(), localNext.begin(), localNext.end() );
+                        nextEdges += localEdges;
+                    }
+                }
+
+                frontier_.swap ( next );
+                frontierSize  = frontier_.size();
+                frontierEdges = nextEdges;
+            }
+
+            /**
+             * @brief      Expands the frontier bitmap by letting each
+             *     unvisited vertex look for a parent in the frontier.
+             *
+             * @param[in]  level          The level of the frontier.
+             * @param      frontierSize   The size of the next frontier.
+             * @param      frontierEdges  The number of edges at the next
+             *     frontier.
+             */
+            inline void BottomUpStep ( Types::count   level
+                                     , Types::count & frontierSize
+                                     , Types::count & frontierEdges )
+            {
+                Types::count const numberOfWords = NumberOfWords();
+                Types::count       nextSize      = 0;
+                Types::count       nextEdges     = 0;
+
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( dynamic, 16 ) reduction ( + : nextSize, nextEdges )
+#endif // OPENMP_AVAILABLE
+                for ( Types::index word = 0; word < numberOfWords; ++word )
+                {
+                    TWord bits = 0;
+                    TVertexId const end = std::min<TVertexId> ( ( word + 1 ) * BitsPerWord, NumberOfVertices() );
+                    for ( TVertexId vertexId = word * BitsPerWord; vertexId < end; ++vertexId )
+                    {
+                        if ( parent_[vertexId].load ( std::memory_order_relaxed ) != Const::NONE ) continue;
+                        for ( Types::index index = csr_.BeginAt ( vertexId )
+                            ; index < BottomUpEndAt ( vertexId )
+                            ; ++index )
+                        {
+                            TVertexId const neighborId = csr_.NeighborAt ( index );
+                            if ( !IsInFrontier ( neighborId ) ) continue;
+                            parent_[vertexId].store ( neighborId, std::memory_order_relaxed );
+                            distance_[vertexId] = level + 1;
+                            bits |= TWord(1) << ( vertexId % BitsPerWord );
+                            ++nextSize;
+                            nextEdges += DegreeAt ( vertexId );
+                            break;
+                        }
+                    }
+                    nextBits_[word] = bits;
+                }
+
+                frontierBits_.swap ( nextBits_ );
+                frontierSize  = nextSize;
+                frontierEdges = nextEdges;
+            }
+        ///@}
+
+        ///@name Frontier conversion
+        ///@{
+#pragma mark FRONTIER_CONVERSION
+            /**
+             * @brief      Converts the frontier list into the bitmap.
+             */
+            inline void FrontierToBitmap()
+            {
+                frontierBits_.assign ( NumberOfWords(), 0 );
+                for ( TVertexId vertexId : frontier_ )
+                {
+                    frontierBits_[vertexId / BitsPerWord] |= TWord(1) << ( vertexId % BitsPerWord );
+                }
+                frontier_.clear();
+            }
+
+            /**
+             * @brief      Converts the frontier bitmap into the list.
+             */
+            inline void BitmapToFrontier()
+            {
+                frontier_.clear();
+                for ( Types::index word = 0; word < frontierBits_.size(); ++word )
+                {
+                    for ( TWord bits = frontierBits_[word]; bits != 0; bits &= bits - 1 )
+                    {
+                        frontier_.push_back ( word * BitsPerWord + CountTrailingZeros ( bits ) );
+                    }
+                }
+            }
+
+            /**
+             * @brief      Whether a vertex is in the frontier bitmap.
+             */
+            inline bool IsInFrontier ( TVertexId vertexId ) const
+            {
+                return ( frontierBits_[vertexId / BitsPerWord] >> ( vertexId % BitsPerWord ) ) & 1;
+            }
+
+            /**
+             * @brief      The position of the lowest set bit.
+             *
+             * @pre        @p bits is not zero.
+             */
+            static inline Types::count CountTrailingZeros ( TWord bits )
+            {
+                Types::count count = 0;
+                for ( ; ( bits & 1 ) == 0; bits >>= 1 ) ++count;
+                return count;
+            }
+        ///@}
+
+        ///@name Adjacency
+        ///@{
+#pragma mark ADJACENCY
+            /**
+             * @brief      The first entry that is scanned top-down, i.e.,
+             *     the first outgoing edge in the directed case.
+             */
+            inline Types::index TopDownBeginAt ( TVertexId vertexId ) const
+            {
+                return IsDirected ? csr_.EndAt ( vertexId ) - csr_.OutDegreeAt ( vertexId )
+                                  : csr_.BeginAt ( vertexId );
+            }
+
+            /**
+             * @brief      The entry behind the last entry that is scanned
+             *     bottom-up, i.e., behind the last incoming edge in the
+             *     directed case.
+             */
+            inline Types::index BottomUpEndAt ( TVertexId vertexId ) const
+            {
+                return IsDirected ? csr_.BeginAt ( vertexId ) + csr_.InDegreeAt ( vertexId )
+                                  : csr_.EndAt ( vertexId );
+            }
+
+            /**
+             * @brief      The number of edges that are scanned top-down at a
+             *     vertex.
+             */
+            inline Types::count DegreeAt ( TVertexId vertexId ) const
+            {
+                return IsDirected ? csr_.OutDegreeAt ( vertexId )
+                                  : csr_.DegreeAt ( vertexId );
+            }
+
+            inline Types::count NumberOfVertices() const
+            {
+                return csr_.NumberOfVertices();
+            }
+
+            inline Types::count NumberOfWords() const
+            {
+                return ( NumberOfVertices() + BitsPerWord - 1 ) / BitsPerWord;
+            }
+
+            inline bool VertexExists ( TVertexId vertexId ) const
+            {
+                return vertexId < NumberOfVertices();
+            }
+        ///@}
+
+#pragma mark MEMBERS
+    private:
+        static constexpr Types::count BitsPerWord = std::numeric_limits<TWord>::digits;
+
+        CsrGraph                                csr_;                       /**< The packed adjacency of the graph G=(V,E) */
+        TVertexId                               source_;                    /**< Source vertex from which BFS starts */
+        Types::real                             alpha_;                     /**< Factor to switch to bottom-up steps */
+        Types::real                             beta_;                      /**< Factor to switch back to top-down steps */
+
+        std::vector<std::atomic<TVertexId>>     parent_;                    /**< BFS structure in form of parent pointers, the source is its own parent */
+        std::vector<Types::count>               distance_;                  /**< Hop distance from the source */
+        std::vector<TVertexId>                  frontier_;                  /**< Frontier of the top-down steps */
+        std::vector<TWord>                      frontierBits_;              /**< Frontier of the bottom-up steps */
+        std::vector<TWord>                      nextBits_;                  /**< Next frontier of the bottom-up steps */
+
+        Types::count                            numberOfVisitedVertices_;   /**< Number of vertices reached from the source */
+        Types::count                            numberOfTopDownSteps_;      /**< Number of levels expanded top-down */
+        Types::count                            numberOfBottomUpSteps_;     /**< Number of levels expanded bottom-up */
+}; // class ParallelBFS
+
+} // namespace egoa
+
+#endif // EGOA__ALGORITHMS__GRAPH_TRAVERSAL__PARALLEL_BREADTH_FIRST_SEARCH__HPP
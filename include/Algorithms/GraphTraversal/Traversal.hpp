@@ -70,10 +70,16 @@ class Traversal {
         ///@}
 
 #pragma mark RESULT_EXTRACTION
-        virtual inline void Result ( std::vector<TVertexId> parent )
+        /**
+         * @brief      The search tree in form of parent pointers.
+         * @details    The source and the vertices that were not reached have
+         *     the parent @p Const::NONE.
+         *
+         * @param      parent  The parent of each vertex.
+         */
+        virtual inline void Result ( std::vector<TVertexId> & parent ) const
         {
-            // @todo Implement, see MST
-            throw std::runtime_error("Not implemented yet!");
+            parent = parent_;
         }
 
     protected:
@@ -326,7 +332,7 @@ class GraphTypeLoopDifferentiation< GraphType, false > {
 
         template<typename FUNCTION>
         static inline
-        void for_all_edges_at ( TGraph          & graph
+        void for_all_edges_at ( TGraph    const & graph
                               , TVertexId const & vertex
                               , FUNCTION          function )
         {
@@ -0,0 +1,505 @@
+/*
+ * BidirectionalDominatingThetaPath.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__ALGORITHMS__PATH_FINDING__BIDIRECTIONAL_DOMINATING_THETA_PATH_HPP
+#define EGOA__ALGORITHMS__PATH_FINDING__BIDIRECTIONAL_DOMINATING_THETA_PATH_HPP
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "Algorithms/PathFinding/DominatingThetaPath.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      Dominating theta path for a single source-target pair that
+ *     searches from both ends.
+ * @details    A forward DominatingThetaPath from the source to the target
+ *     and a backward one from the target to the source are run in turns.
+ *     Both are point-to-point queries, see DominatingThetaPath#Target. Each
+ *     label that is settled at a vertex @f$\vertex@f$ is combined with the
+ *     labels that the other search has already settled at @f$\vertex@f$,
+ *     i.e., the two paths meet in the middle. If the combination is a simple
+ *     path from the source to the target, its value is an upper bound on the
+ *     optimal value and prunes the labels of both searches.
+ *
+ *     The search stops as soon as the lower bounds of the unsettled labels
+ *     of both searches exceed the best value found so far, see
+ *     DominatingThetaPath#IsPruned. Every path that is not worse is then
+ *     the combination of a settled forward label and a settled backward
+ *     label at a common vertex. Thus, the result is built from the best
+ *     meetings and is the same as for DominatingThetaPath with the same
+ *     target, e.g.,
+ * @code{.cpp}
+ *      BidirectionalDominatingThetaPath<TGraph> dtp ( graph );
+ *      dtp.Source ( source );
+ *      dtp.Target ( target );
+ *      dtp.Run();
+ *
+ *      std::vector<std::vector<Types::vertexId>> parent;
+ *      Types::real value = dtp.Result ( parent );
+ * @endcode
+ *
+ *     The bounds of the unsettled labels are kept in a lazy priority queue
+ *     per search. Its entries are refreshed at the neighbors of each settled
+ *     vertex and validated when they reach the top.
+ *
+ * @tparam     GraphType     The graph type, e.g., StaticGraph<Vertices::ElectricalProperties, Edges::ElectricalProperties>.
+ * @tparam     LabelType     The label type such as SusceptanceNormLabel and VoltageAngleDifferenceLabel.
+ * @tparam     QueueType     The priority queue type such as MappingBinaryHeap.
+ * @tparam     LabelSetType  The label set type representing the bucket Bucket.
+ * @tparam     Domination    The domination criterion DominationCriterion, e.g., DominationCriterion::strict.
+ *
+ * @see        DominatingThetaPath
+ */
+template < typename GraphType             = StaticGraph< Vertices::ElectricalProperties<Vertices::IeeeBusType>, Edges::ElectricalProperties >
+         , typename LabelType             = VoltageAngleDifferenceLabel< typename GraphType::TEdge >
+         , typename QueueType             = MappingBinaryHeap< typename GraphType::TVertexId, LabelType >
+         , typename LabelSetType          = Bucket< BinaryHeap< LabelType > >
+         , DominationCriterion Domination = DominationCriterion::strict >
+class BidirectionalDominatingThetaPath final {
+    public:
+#pragma mark TYPE_ALIASING
+        using TGraph        = GraphType;                        /**< The graph type. */
+        using TVertexId     = typename GraphType::TVertexId;    /**< The vertex identifier type. */
+        using TEdge         = typename GraphType::TEdge;        /**< The edge type. */
+        using TLabel        = LabelType;                        /**< The label type. */
+        using TDtp          = DominatingThetaPath< GraphType
+                                                 , LabelType
+                                                 , QueueType
+                                                 , LabelSetType
+                                                 , Domination >; /**< The search in one direction. */
+    private:
+        using TBound        = std::pair<Types::real, TVertexId>;
+        using TBoundQueue   = std::priority_queue< TBound
+                                                 , std::vector<TBound>
+                                                 , std::greater<TBound> >; /**< The smallest bound of the unsettled labels per vertex. */
+
+        /**
+         * @brief      A forward and a backward label that are combined to a
+         *     path from the source to the target.
+         */
+        struct Meeting {
+            TVertexId       vertex;         /**< The common vertex. */
+            Types::labelId  forwardLabel;   /**< The index of the forward label at the vertex. */
+            Types::labelId  backwardLabel;  /**< The index of the backward label at the vertex. */
+        };
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTORS
+
+            /**
+             * @brief      Constructs the searches on a graph.
+             *
+             * @param      graph  The graph.
+             */
+            BidirectionalDominatingThetaPath ( TGraph const & graph )
+            : graph_( graph )
+            , forward_( graph )
+            , backward_( graph )
+            , source_( Const::NONE )
+            , target_( Const::NONE )
+            , bestValue_( Const::REAL_INFTY )
+            {}
+        ///@}
+
+        ///@name Execute the Bidirectional DTP Algorithm
+        ///@{
+#pragma mark EXECUTE_ALGORITHM
+
+            /**
+             * @brief      Run the bidirectional DTP algorithm.
+             * @details    The searches take turns. A search only settles
+             *     labels as long as the smallest bound of its unsettled
+             *     labels does not exceed the #UpperBound, and the run stops
+             *     if this holds for neither search.
+             *
+             * @pre        The source and the target are set.
+             */
+            inline void Run ()
+            {
+                USAGE_ASSERT ( source_ != Const::NONE );
+                USAGE_ASSERT ( target_ != Const::NONE );
+
+                forward_.Source  ( source_ );
+                backward_.Source ( target_ );
+                meetings_.clear();
+                bestValue_ = Const::REAL_INFTY;
+
+                forwardBounds_  = TBoundQueue();
+                backwardBounds_ = TBoundQueue();
+                forwardBounds_.emplace  ( forward_.MinimumBoundAt ( source_ ),  source_ );
+                backwardBounds_.emplace ( backward_.MinimumBoundAt ( target_ ), target_ );
+
+                while ( true )
+                {
+                    bool const isForwardDone  = IsDone ( forward_,  forwardBounds_ );
+                    bool const isBackwardDone = IsDone ( backward_, backwardBounds_ );
+                    if ( isForwardDone && isBackwardDone ) break;
+
+                    if ( !isForwardDone )
+                    {
+                        TLabel const label = forward_.Step();
+                        UpdateBoundsAround ( label.Vertex(), forward_, forwardBounds_ );
+                        Meet ( label, forward_, backward_, true );
+                    }
+                    if ( !isBackwardDone )
+                    {
+                        TLabel const label = backward_.Step();
+                        UpdateBoundsAround ( label.Vertex(), backward_, backwardBounds_ );
+                        Meet ( label, backward_, forward_, false );
+                    }
+                }
+            }
+        ///@}
+
+        ///@name Access information
+        ///@{
+#pragma mark ACCESS_INFORMATION
+
+            /**
+             * @brief      Extract the optimal paths and the optimal value.
+             * @details    The paths are constructed from the source to the
+             *     target by following the forward label of each best
+             *     meeting to the source and its backward label to the
+             *     target. A path that is found at several common vertices
+             *     is added once, and the paths are sorted
+             *     lexicographically.
+             *
+             * @param      parent  The paths, one row per optimal path.
+             *
+             * @return     The optimal value, or Const::REAL_INFTY if the
+             *     target is not reachable.
+             */
+            inline Types::real Result ( std::vector<std::vector<TVertexId>> & parent )
+            {
+                MonotonicArena::Scope scope ( *forward_.arena_ );
+
+                std::vector<std::vector<TVertexId>> paths;
+                for ( Meeting const & meeting : meetings_ )
+                {
+                    std::vector<TVertexId> path;
+                    for ( TLabel const * label = &forward_.LabelAt ( meeting.vertex, meeting.forwardLabel )
+                        ; ; label = &forward_.LabelAt ( label->PreviousVertex(), label->PreviousLabel() ) )
+                    {
+                        path.emplace_back ( label->Vertex() );
+                        if ( label->PreviousVertex() == Const::NONE ) break;
+                    }
+                    std::reverse ( path.begin(), path.end() );
+
+                    for ( TLabel const * label = &backward_.LabelAt ( meeting.vertex, meeting.backwardLabel )
+                        ; label->PreviousVertex() != Const::NONE
+                        ; label = &backward_.LabelAt ( label->PreviousVertex(), label->PreviousLabel() ) )
+                    {
+                        path.emplace_back ( label->PreviousVertex() );
+                    }
+                    paths.emplace_back ( std::move ( path ) );
+                }
+
+                std::sort ( paths.begin(), paths.end() );
+                paths.erase ( std::unique ( paths.begin(), paths.end() ), paths.end() );
+                for ( std::vector<TVertexId> & path : paths )
+                {
+                    parent.emplace_back ( std::move ( path ) );
+                }
+                return bestValue_;
+            }
+
+            /**
+             * @brief      Current number of labels of both searches.
+             *
+             * @return     Total number of labels.
+             */
+            inline Types::count NumberOfLabels ()
+            {
+                return forward_.NumberOfLabels() + backward_.NumberOfLabels();
+            }
+
+            /**
+             * @brief      The best value of a path from the source to the
+             *     target found so far.
+             *
+             * @return     The upper bound on the optimal value.
+             */
+            inline Types::real UpperBound () const
+            {
+                return std::min ( forward_.UpperBound(), backward_.UpperBound() );
+            }
+        ///@}
+
+        ///@name Modifiers
+        ///@{
+#pragma mark MODIFIERS
+
+            /**
+             * @brief      Set the source.
+             * @details    The distances to the source are computed for the
+             *     backward search, see DominatingThetaPath#Target.
+             *
+             * @param[in]  source  The source.
+             */
+            inline void Source ( TVertexId source )
+            {
+                USAGE_ASSERT ( source < graph_.NumberOfVertices() );
+                source_ = source;
+                backward_.Target ( source );
+            }
+
+            /**
+             * @brief      Set the target.
+             * @details    The distances to the target are computed for the
+             *     forward search, see DominatingThetaPath#Target.
+             *
+             * @param[in]  target  The target.
+             */
+            inline void Target ( TVertexId target )
+            {
+                USAGE_ASSERT ( target < graph_.NumberOfVertices() );
+                target_ = target;
+                forward_.Target ( target );
+            }
+
+            /**
+             * @brief      Getter for the search from the source.
+             *
+             * @return     The forward search.
+             */
+            inline TDtp const & Forward () const
+            {
+                return forward_;
+            }
+
+            /**
+             * @brief      Getter for the search from the target.
+             *
+             * @return     The backward search.
+             */
+            inline TDtp const & Backward () const
+            {
+                return backward_;
+            }
+        ///@}
+
+    private:
+        ///@name Meeting in the Middle
+        ///@{
+#pragma mark MEETING_IN_THE_MIDDLE
+
+            /**
+             * @brief      Whether a search cannot settle a label anymore that
+             *     leads to a path that is not worse than the #UpperBound.
+             * @details    The top entries of @p bounds are validated against
+             *     the current labels of their vertices. An outdated entry is
+             *     replaced by the current bound of its vertex.
+             *
+             * @param      search  The search.
+             * @param      bounds  The bounds of the unsettled labels of @p
+             *     search.
+             *
+             * @return     @p true if all unsettled labels of @p search would
+             *     be pruned, @p false otherwise.
+             */
+            inline bool IsDone ( TDtp        & search
+                               , TBoundQueue & bounds )
+            {
+                if ( search.QueueEmpty() ) return true;
+
+                Types::real bound = Const::REAL_INFTY;
+                while ( !bounds.empty() )
+                {
+                    TBound const top     = bounds.top();
+                    Types::real  current = search.MinimumBoundAt ( top.second );
+                    if ( current == top.first )
+                    {
+                        bound = current;
+                        break;
+                    }
+                    bounds.pop();
+                    if ( current != Const::REAL_INFTY )
+                    {
+                        bounds.emplace ( current, top.second );
+                    }
+                }
+
+                Types::real const upperBound = UpperBound();
+                return bound == Const::REAL_INFTY
+                    || ( bound > upperBound
+                      && !Auxiliary::EQ ( bound, upperBound, 1e-9, 1e-9 ) );
+            }
+
+            /**
+             * @brief      Add the bounds of the vertex of a settled label and
+             *     of its neighbors, since only they may have new labels.
+             *
+             * @param[in]  vertexId  The vertex of the settled label.
+             * @param      search    The search that settled the label.
+             * @param      bounds    The bounds of the unsettled labels of @p
+             *     search.
+             */
+            inline void UpdateBoundsAround ( TVertexId     vertexId
+                                           , TDtp        & search
+                                           , TBoundQueue & bounds )
+            {
+                auto update = [ & search, & bounds ] ( TVertexId vertex )
+                {
+                    Types::real const bound = search.MinimumBoundAt ( vertex );
+                    if ( bound == Const::REAL_INFTY ) return;
+                    bounds.emplace ( bound, vertex );
+                };
+
+                update ( vertexId );
+                graph_.template for_all_incident_edges_at<ExecutionPolicy::sequential> ( vertexId,
+                    [ & update ]( TEdge const &, TVertexId other ) { update ( other ); } );
+            }
+
+            /**
+             * @brief      Combine a settled label with the settled labels of
+             *     the other search at the same vertex.
+             * @details    The meetings with the best value are kept for
+             *     #Result.
+             *
+             * @param      label      The label that was settled by @p search.
+             * @param      search     The search that settled the label.
+             * @param      other      The other search.
+             * @param[in]  isForward  Whether @p search is the forward search.
+             */
+            inline void Meet ( TLabel const & label
+                             , TDtp         & search
+                             , TDtp         & other
+                             , bool           isForward )
+            {
+                other.LabelSetAt ( label.Vertex() ).template for_all_processed_elements<ExecutionPolicy::sequential> (
+                    [ & ]( TLabel const & otherLabel )
+                    {
+                        TLabel const & forwardLabel  = isForward ? label      : otherLabel;
+                        TLabel const & backwardLabel = isForward ? otherLabel : label;
+                        TDtp         & forward       = isForward ? search     : other;
+                        TDtp         & backward      = isForward ? other      : search;
+
+                        Types::real const value = Combine ( forwardLabel, backwardLabel, forward, backward );
+                        if ( value == Const::REAL_INFTY ) return;
+
+                        if ( !Auxiliary::EQ ( value, bestValue_, 1e-9, 1e-9 ) )
+                        {
+                            if ( value > bestValue_ ) return;
+                            bestValue_ = value;
+                            meetings_.clear();
+                        }
+                        meetings_.push_back ( Meeting { label.Vertex()
+                                                      , forwardLabel.Index()
+                                                      , backwardLabel.Index() } );
+                    }
+                );
+                forward_.UpperBound()  = std::min ( forward_.UpperBound(),  bestValue_ );
+                backward_.UpperBound() = std::min ( backward_.UpperBound(), bestValue_ );
+            }
+
+            /**
+             * @brief      The value of the path that follows a forward label
+             *     and then a backward label in reverse.
+             * @details    The forward label is extended along the edges of
+             *     the backward label's path, which detects if both paths
+             *     share a vertex. The labels do not store their edges. Thus,
+             *     in a multigraph, the edge between two consecutive vertices
+             *     is the one that extends the backward label's predecessor
+             *     to the backward label, see #EdgeOf.
+             *
+             * @param      forwardLabel   The label of the forward search.
+             * @param      backwardLabel  The label of the backward search at
+             *     the same vertex.
+             * @param      forward        The forward search.
+             * @param      backward       The backward search.
+             *
+             * @return     The value of the combined path, or
+             *     Const::REAL_INFTY if the paths are not disjoint.
+             */
+            inline Types::real Combine ( TLabel const & forwardLabel
+                                       , TLabel const & backwardLabel
+                                       , TDtp         & forward
+                                       , TDtp         & backward )
+            {
+                ESSENTIAL_ASSERT ( forwardLabel.Vertex() == backwardLabel.Vertex() );
+                MonotonicArena::Scope scope ( *forward.arena_ );
+                ElectricalPropertyColumns const * columns = forward.PropertyColumns();
+
+                TLabel         label    = forwardLabel;
+                TLabel const * previous = &backwardLabel;
+                while ( previous->PreviousVertex() != Const::NONE )
+                {
+                    TLabel const & next = backward.LabelAt ( previous->PreviousVertex()
+                                                           , previous->PreviousLabel() );
+
+                    TEdge const * edge = EdgeOf ( *previous, next, backward, columns );
+                    if ( edge == nullptr ) return Const::REAL_INFTY;
+
+                    TLabel extendedLabel;
+                    if ( forward.ProduceCycle ( extendedLabel, forward.Extend ( label, *edge, columns ) ) ) return Const::REAL_INFTY;
+                    label    = extendedLabel;
+                    previous = &next;
+                }
+                return label.Value();
+            }
+
+            /**
+             * @brief      The edge by which a search extended a label to
+             *     another label.
+             * @details    Among the edges between the vertices of both
+             *     labels, the first one is chosen whose extension of @p
+             *     previous equals @p label. Parallel edges that yield an
+             *     equal label lead to the same value of the combined path.
+             *
+             * @param[in]  label     The extended label.
+             * @param[in]  previous  The label from which @p label was
+             *     created.
+             * @param      search    The search of both labels.
+             * @param[in]  columns   The property columns, or @p nullptr.
+             *
+             * @return     The edge, or @p nullptr if there is none.
+             */
+            inline TEdge const * EdgeOf ( TLabel                            const & label
+                                        , TLabel                            const & previous
+                                        , TDtp                                    & search
+                                        , ElectricalPropertyColumns const *         columns ) const
+            {
+                TEdge const * edge = nullptr;
+                graph_.template for_all_incident_edges_at<ExecutionPolicy::sequential> ( label.Vertex(),
+                    [ & ]( TEdge const & incidentEdge, TVertexId other )
+                    {
+                        if ( edge != nullptr || other != previous.Vertex() ) return;
+                        if ( search.IgnoreSwitchedEdges() && !search.IsActive ( incidentEdge, columns ) ) return;
+
+                        std::pair<TLabel, bool> const extension = search.Extend ( previous, incidentEdge, columns );
+                        if ( extension.first.SusceptanceNorm() != label.SusceptanceNorm()
+                          || extension.first.Value()           != label.Value() ) return;
+                        edge = &incidentEdge;
+                    }
+                );
+                return edge;
+            }
+        ///@}
+
+#pragma mark MEMBERS
+        TGraph const &  graph_;     /**< The graph. */
+        TDtp            forward_;   /**< The search from the source. */
+        TDtp            backward_;  /**< The search from the target. */
+        TVertexId       source_;    /**< The source. */
+        TVertexId       target_;    /**< The target. */
+
+        TBoundQueue             forwardBounds_;     /**< The bounds of the unsettled labels of the forward search. */
+        TBoundQueue             backwardBounds_;    /**< The bounds of the unsettled labels of the backward search. */
+        std::vector<Meeting>    meetings_;          /**< The meetings with the best value. */
+        Types::real             bestValue_;         /**< The best value of a meeting. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__ALGORITHMS__PATH_FINDING__BIDIRECTIONAL_DOMINATING_THETA_PATH_HPP
@@ -8,7 +8,13 @@
 #ifndef EGOA__ALGORITHMS__PATH_FINDING__DOMINATING_THETA_PATH_HPP
 #define EGOA__ALGORITHMS__PATH_FINDING__DOMINATING_THETA_PATH_HPP
 
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 #include "Exceptions/Assertions.hpp"
 
@@ -27,15 +33,70 @@
 #include "DataStructures/Container/Queues/MappingBinaryHeap.hpp"
 
 #include "DataStructures/Container/DominationCriterion.hpp"
+#include "DataStructures/Container/Allocators/MonotonicArena.hpp"
 
 #include "IO/Statistics/DtpRuntimeRow.hpp"
 
+#include "Auxiliary/Auxiliary.hpp"
 #include "Auxiliary/Timer.hpp"
 
 namespace egoa {
 
+template<typename, typename, typename, typename, DominationCriterion>
+class BidirectionalDominatingThetaPath;
+
+namespace internal {
+
+/**
+ * @brief      Whether a label of type @p LabelType can be extended by an
+ *     EdgeColumnView, i.e., reads the edge attributes from the property
+ *     columns.
+ *
+ * @tparam     LabelType  The label type.
+ * @tparam     EdgeType   The edge type.
+ */
+template<typename LabelType, typename EdgeType, typename = void>
+struct HasColumnRelaxation : std::false_type {};
+
+template<typename LabelType, typename EdgeType>
+struct HasColumnRelaxation< LabelType
+                          , EdgeType
+                          , std::enable_if_t< std::is_same_v< decltype ( std::declval<LabelType const &>()
+                                                                       + std::declval<EdgeColumnView<EdgeType> const &>() )
+                                                            , std::pair<LabelType, bool> > > >
+    : std::true_type {};
+
+} // namespace internal
+
 /**
  * @brief      Class for dominating theta path.
+ * @details    Each object owns a MonotonicArena that is installed as the
+ *     current arena of the calling thread while the labels are created or
+ *     copied, e.g., by #Run and #Result.
+ *     Label and label set types whose containers use the ArenaAllocator,
+ *     e.g.,
+ * @code{.cpp}
+ *      using TVertexSet = std::unordered_set< Types::vertexId
+ *                                           , std::hash<Types::vertexId>
+ *                                           , std::equal_to<Types::vertexId>
+ *                                           , ArenaAllocator<Types::vertexId> >;
+ *      using TLabel     = VoltageAngleDifferenceLabel< TEdge, TVertexSet >;
+ *      using TLabelSet  = Bucket< BinaryHeap< TLabel, ArenaAllocator<TLabel> >
+ *                               , ArenaAllocator<TLabel> >;
+ *      DominatingThetaPath< TGraph, TLabel, MappingBinaryHeap<Types::vertexId, TLabel>, TLabelSet > dtp ( graph );
+ * @endcode
+ *     draw their memory from this arena, which is reset in
+ *     @f$\Theta(1)@f$ by #Clear. Thus, running the algorithm for many sources,
+ *     e.g., in BetweennessCentrality, reuses the same memory and does not
+ *     contend with other threads in the global allocator. Types that use the
+ *     standard allocator are not affected.
+ *
+ *     If the graph has property columns, see StaticGraph#BuildPropertyColumns,
+ *     the status, the thermal limit, and the precomputed susceptance norm of
+ *     the edges are read from the columns instead of the edge objects. In
+ *     particular, labels such as SusceptanceNormLabel and
+ *     VoltageAngleDifferenceLabel are extended by an EdgeColumnView.
+ *     Outdated columns, see StaticGraph#PropertiesChanged, are not used.
  *
  * @todo       Usage example
  *
@@ -81,14 +142,52 @@ class DominatingThetaPath final {
              */
             DominatingThetaPath ( TGraph const & graph )
             : graph_( graph )
-            , labelSets_( graph.NumberOfVertices(), TLabelSet() )
+            , arena_( std::make_unique<MonotonicArena>() )
+            , labelSets_( )
+            , touchedVertices_( )
             , queue_( )
+            , ignoreSwitchedEdges_( false )
+            , searchSpace_( )
+            , target_( Const::NONE )
+            , targetDistances_( )
+            , minimumCapacity_( Const::REAL_INFTY )
+            , upperBound_( Const::REAL_INFTY )
             {
+                MonotonicArena::Scope scope ( *arena_ );
+                labelSets_.assign( graph.NumberOfVertices(), TLabelSet() );
 #ifdef EGOA_ENABLE_STATISTIC_DTP // NAME OF THE PROBLEM
                 dtpRuntimeRow_.NameOfProblem = "DtpStandard";
 #endif
             }
 
+            /**
+             * @brief      Copy constructor.
+             * @details    The copy gets its own arena into which the labels
+             *     of @p other are copied.
+             *
+             * @param      other  The other object.
+             */
+            DominatingThetaPath ( DominatingThetaPath const & other )
+            : graph_( other.graph_ )
+            , arena_( std::make_unique<MonotonicArena>() )
+            , labelSets_( )
+            , touchedVertices_( other.touchedVertices_ )
+            , queue_( )
+            , ignoreSwitchedEdges_( other.ignoreSwitchedEdges_ )
+            , searchSpace_( other.searchSpace_ )
+            , target_( other.target_ )
+            , targetDistances_( other.targetDistances_ )
+            , minimumCapacity_( other.minimumCapacity_ )
+            , upperBound_( other.upperBound_ )
+            , dtpRuntimeRow_( other.dtpRuntimeRow_ )
+            {
+                MonotonicArena::Scope scope ( *arena_ );
+                labelSets_ = other.labelSets_;
+                queue_     = other.queue_;
+            }
+
+            DominatingThetaPath ( DominatingThetaPath && other ) = default;
+
             /**
              * @brief      Constructs the object.
              *
@@ -110,8 +209,13 @@ class DominatingThetaPath final {
 
             /**
              * @brief      Run the DTP algorithm.
+             * @details    If a #Target is set, the search is restricted to
+             *     the labels that may still lead to an optimal label at the
+             *     target, see #Target.
              */
             inline void Run () {
+                MonotonicArena::Scope scope ( *arena_ );
+
 #ifdef EGOA_ENABLE_STATISTIC_DTP // GRAPH INFORMATION
                 dtpRuntimeRow_.Name             = graph_.Name();
                 dtpRuntimeRow_.NumberOfVertices = graph_.NumberOfVertices();
@@ -122,39 +226,7 @@ class DominatingThetaPath final {
 
                 while ( !QueueEmpty() )
                 { // Q != {}
-                    TLabel const label   = QueueDeleteMinimum();
-                    const TVertexId u     = label.Vertex();
-                    ESSENTIAL_ASSERT ( u < graph_.NumberOfVertices() );
-
-                    // For all incident edges
-                    graph_.template for_all_edges_at<ExecutionPolicy::sequential>( u,
-                        [&]( TEdge const & edge )
-                        {
-                            ESSENTIAL_ASSERT ( u < graph_.NumberOfVertices() );
-
-                            TVertexId v = edge.Other(u);
-
-                            ESSENTIAL_ASSERT ( v < graph_.NumberOfVertices() );
-
-#ifdef EGOA_ENABLE_STATISTIC_DTP // NUMBER OF SCANNED EDGES -> TOTAL NUMBER
-                            ++dtpRuntimeRow_.NumberOfScannedEdges;
-#endif
-                            TLabel newlabel;
-
-                            if ( ProduceCycle( newlabel, label + edge ) ) return;
-                            SetParentOf( newlabel, label );
-
-#ifdef EGOA_ENABLE_STATISTIC_DTP // NUMBER OF EDGES NOT PRODUCING A CYCLE
-                            ++dtpRuntimeRow_.NumberOfEdgesProducingNoCycle;
-#endif
-                            if ( ! MergeLabelAt( v, newlabel ) ) return;
-
-#ifdef EGOA_ENABLE_STATISTIC_DTP // NUMBER OF RELAXED EDGES
-                            ++dtpRuntimeRow_.NumberOfRelaxedEdges;
-#endif
-                            UpdateQueueWith ( newlabel );
-                        }
-                    );
+                    Step();
 
 #ifdef EGOA_ENABLE_STATISTIC_DTP // TOTAL NUMBER OF LABELS
                     dtpRuntimeRow_.GlobalElapsedMilliseconds = dtpTime.ElapsedMilliseconds();
@@ -171,6 +243,71 @@ class DominatingThetaPath final {
 #endif
                 }
             }
+
+            /**
+             * @brief      Settle the next label of the queue and relax its
+             *     incident edges.
+             * @details    This is one iteration of #Run. It allows to
+             *     interleave several searches, e.g., in
+             *     BidirectionalDominatingThetaPath.
+             *
+             * @pre        The queue is not empty.
+             *
+             * @return     The settled label, whose index refers to the
+             *     processed labels of its vertex.
+             */
+            inline TLabel Step ()
+            {
+                USAGE_ASSERT ( !QueueEmpty() );
+                MonotonicArena::Scope scope ( *arena_ );
+
+                TLabel const label   = QueueDeleteMinimum();
+                const TVertexId u     = label.Vertex();
+                ESSENTIAL_ASSERT ( u < graph_.NumberOfVertices() );
+
+                // The upper bound might have decreased since the label was queued,
+                // and paths to the target end at the target
+                if ( IsPruned ( label ) || u == target_ ) return label;
+
+                ElectricalPropertyColumns const * columns = PropertyColumns();
+
+                // For all incident edges
+                graph_.template for_all_incident_edges_at<ExecutionPolicy::sequential>( u,
+                    [&]( TEdge const & edge, TVertexId v )
+                    {
+                        ESSENTIAL_ASSERT ( u < graph_.NumberOfVertices() );
+                        ESSENTIAL_ASSERT ( v == edge.Other(u) );
+                        ESSENTIAL_ASSERT ( v < graph_.NumberOfVertices() );
+
+#ifdef EGOA_ENABLE_STATISTIC_DTP // NUMBER OF SCANNED EDGES -> TOTAL NUMBER
+                        ++dtpRuntimeRow_.NumberOfScannedEdges;
+#endif
+                        if ( IgnoreSwitchedEdges() && !IsActive ( edge, columns ) ) return;
+                        if ( !searchSpace_.empty() && !searchSpace_[v] ) return;
+
+                        TLabel newlabel;
+
+                        if ( ProduceCycle( newlabel, Extend ( label, edge, columns ) ) ) return;
+                        SetParentOf( newlabel, label );
+
+#ifdef EGOA_ENABLE_STATISTIC_DTP // NUMBER OF EDGES NOT PRODUCING A CYCLE
+                        ++dtpRuntimeRow_.NumberOfEdgesProducingNoCycle;
+#endif
+                        if ( IsPruned ( newlabel ) ) return;
+                        if ( ! MergeLabelAt( v, newlabel ) ) return;
+
+#ifdef EGOA_ENABLE_STATISTIC_DTP // NUMBER OF RELAXED EDGES
+                        ++dtpRuntimeRow_.NumberOfRelaxedEdges;
+#endif
+                        if ( v == target_ )
+                        {
+                            upperBound_ = std::min ( upperBound_, newlabel.Value() );
+                        }
+                        UpdateQueueWith ( newlabel );
+                    }
+                );
+                return label;
+            }
         ///@}
 
         ///@name Access information
@@ -192,6 +329,7 @@ class DominatingThetaPath final {
                                       TVertexId const target)
             {
                 USAGE_ASSERT( graph_.VertexExists( target ) );
+                MonotonicArena::Scope scope ( *arena_ );
 
                 std::vector<bool> isVertexInSubgraph(graph_.NumberOfVertices(), false);
                 std::vector<bool> isEdgeInSubgraph(graph_.NumberOfEdges(), false);
@@ -261,6 +399,7 @@ class DominatingThetaPath final {
                                       , TVertexId                     const   target )
             {
                 USAGE_ASSERT ( graph_.VertexExists( target ) );
+                MonotonicArena::Scope scope ( *arena_ );
 
                 // Iterate over all optima
                 Types::real result = \
@@ -322,23 +461,192 @@ class DominatingThetaPath final {
             {
                 USAGE_ASSERT ( source < labelSets_.size() );
                 Clear();
+                MonotonicArena::Scope scope ( *arena_ );
 #ifdef EGOA_ENABLE_STATISTIC_DTP // SOURCE ID
                 dtpRuntimeRow_.SourceId     = source;
 #endif
                 TLabel sourceLabel          = TLabel::SourceLabel ( source );
+                touchedVertices_.emplace_back ( source );
                 labelSets_[source].template Merge<Domination>( sourceLabel );
                 Insert( sourceLabel );
+                if ( source == target_ )
+                {
+                    upperBound_ = sourceLabel.Value();
+                }
+            }
+
+            /**
+             * @brief      Set the target for a point-to-point query.
+             * @details    If only the labels at one target are needed, e.g.,
+             *     for #Result, the search prunes each label whose value
+             *     cannot become optimal at the target anymore. For this,
+             *     the lower bound TLabel::ValueBound of a label at
+             *     @f$\vertex@f$ uses the susceptance norm distance from
+             *     @f$\vertex@f$ to the target, which is computed here by
+             *     Dijkstra's algorithm in @f$O(m \log n)@f$ time, and the
+             *     minimum thermal limit of all edges. The label is pruned
+             *     if its bound exceeds the best value found at the target
+             *     so far, see #UpperBound. Labels at the target are not
+             *     extended. The labels at the target that are optimal are
+             *     the same as in an unrestricted search, while the labels
+             *     at other vertices are incomplete.
+             *
+             *     The target is kept by #Clear and #Source, i.e., many
+             *     sources can be queried for the same target, e.g.,
+             * @code{.cpp}
+             *      dtp.Target ( target );
+             *      for ( TVertexId source : sources )
+             *      {
+             *          dtp.Source ( source );
+             *          dtp.Run();
+             *          Types::real value = dtp.Result ( parent, target );
+             *      }
+             * @endcode
+             *
+             * @pre        The distances depend on the edges, on
+             *     #IgnoreSwitchedEdges, and on the #SearchSpace. Thus, the
+             *     target has to be set again after one of them changed.
+             *
+             * @param[in]  target  The target, or Const::NONE to count the
+             *     labels at all vertices.
+             */
+            inline void Target ( TVertexId target )
+            {
+                USAGE_ASSERT ( target == Const::NONE
+                            || target < graph_.NumberOfVertices() );
+
+                target_ = target;
+                targetDistances_.clear();
+                minimumCapacity_ = Const::REAL_INFTY;
+                if ( target == Const::NONE ) return;
+
+                ElectricalPropertyColumns const * columns = PropertyColumns();
+                if ( columns != nullptr )
+                {
+                    Types::real const * thermalLimits = columns->BranchData<BranchColumn::thermalLimit>();
+                    for ( TEdgeId edgeId = 0; edgeId < columns->NumberOfBranches(); ++edgeId )
+                    {
+                        if ( IgnoreSwitchedEdges() && !columns->IsActive ( edgeId ) ) continue;
+                        minimumCapacity_ = std::min ( minimumCapacity_, thermalLimits[edgeId] );
+                    }
+                } else {
+                    graph_.template for_all_edges<ExecutionPolicy::sequential> ( [ this ] ( TEdge const & edge )
+                    {
+                        if ( IgnoreSwitchedEdges() && !edge.Properties().Status() ) return;
+                        minimumCapacity_ = std::min ( minimumCapacity_, edge.Properties().ThermalLimit() );
+                    });
+                }
+
+                // Dijkstra's algorithm on the susceptance norm of the edges
+                targetDistances_.assign ( graph_.NumberOfVertices(), std::numeric_limits<Types::real>::infinity() );
+                MappingBinaryHeap<TVertexId, Types::real> heap;
+                targetDistances_[target] = 0.0;
+                heap.Insert ( target, 0.0 );
+
+                while ( !heap.Empty() )
+                {
+                    TVertexId   u;
+                    Types::real distance;
+                    std::tie ( u, distance ) = heap.DeleteTop();
+
+                    // A vertex outside of the search space can only be the source
+                    if ( !searchSpace_.empty() && !searchSpace_[u] && u != target ) continue;
+
+                    graph_.template for_all_incident_edges_at<ExecutionPolicy::sequential> ( u,
+                        [&]( TEdge const & edge, TVertexId v )
+                        {
+                            if ( IgnoreSwitchedEdges() && !IsActive ( edge, columns ) ) return;
+
+                            Types::real const length = distance + SusceptanceNormOf ( edge, columns );
+                            if ( length >= targetDistances_[v] ) return;
+
+                            if ( heap.HasKeyOf ( v ) )
+                            {
+                                heap.ChangeKey ( v, length );
+                            } else {
+                                heap.Insert ( v, length );
+                            }
+                            targetDistances_[v] = length;
+                        }
+                    );
+                }
+            }
+
+            /**
+             * @brief      Getter for the target.
+             *
+             * @return     The target, or Const::NONE if the labels at all
+             *     vertices are computed.
+             */
+            inline TVertexId Target () const
+            {
+                return target_;
+            }
+
+            /**
+             * @brief      Getter for the upper bound on the optimal value at
+             *     the target.
+             *
+             * @return     The best value found at the target so far.
+             */
+            inline Types::real UpperBound () const
+            {
+                return upperBound_;
+            }
+
+            /**
+             * @brief      Setter for the upper bound on the optimal value at
+             *     the target.
+             * @details    The bound is reset by #Clear and decreases during
+             *     the search whenever a better label reaches the #Target. A
+             *     smaller bound that is known in advance, e.g., the value of
+             *     any path from the source to the target, prunes more
+             *     labels. Labels with a value equal to the bound are kept.
+             *
+             * @pre        The bound is at least the optimal value at the
+             *     target.
+             *
+             * @return     The best value found at the target so far.
+             */
+            inline Types::real & UpperBound ()
+            {
+                return upperBound_;
             }
 
             /**
              * @brief      Clear all data structures.
+             * @details    All labels are destroyed before the arena is reset,
+             *     since they might hold memory of the arena. Only the label
+             *     sets of the vertices that received a label since the last
+             *     clear are replaced, i.e., clearing after a search that is
+             *     restricted to a small #SearchSpace does not take time
+             *     linear in the number of vertices.
              */
             inline void Clear()
             {
-                labelSets_.clear();
-                labelSets_.assign( graph_.NumberOfVertices(), TLabelSet() );
-
                 queue_.Clear();
+                upperBound_ = Const::REAL_INFTY;
+
+                if ( labelSets_.size() == graph_.NumberOfVertices() )
+                {
+                    { // An empty label set does not allocate and thus, survives the reset
+                        MonotonicArena::Scope scope ( *arena_ );
+                        for ( TVertexId vertexId : touchedVertices_ )
+                        {
+                            labelSets_[vertexId] = TLabelSet();
+                        }
+                    }
+                    touchedVertices_.clear();
+                    arena_->Reset();
+                } else
+                {
+                    labelSets_.clear();
+                    touchedVertices_.clear();
+                    arena_->Reset();
+
+                    MonotonicArena::Scope scope ( *arena_ );
+                    labelSets_.assign( graph_.NumberOfVertices(), TLabelSet() );
+                }
 #ifdef EGOA_ENABLE_STATISTIC_DTP // CLEAR
                 dtpRuntimeRow_.Clear();
 #endif
@@ -363,12 +671,79 @@ class DominatingThetaPath final {
             {
                 return dtpRuntimeRow_;
             }
+
+            /**
+             * @brief      Getter for ignoring switched edges.
+             *
+             * @return     @p true if edges with status @p false are ignored,
+             *     @p false otherwise.
+             */
+            inline bool IgnoreSwitchedEdges () const
+            {
+                return ignoreSwitchedEdges_;
+            }
+
+            /**
+             * @brief      Setter for ignoring switched edges.
+             * @details    If set, the search does not relax edges with
+             *     <tt> edge.Properties().Status() == false </tt>, e.g., edges
+             *     that were switched off by SwitchEdges. By default all edges
+             *     are used.
+             *
+             * @return     @p true if edges with status @p false are ignored,
+             *     @p false otherwise.
+             */
+            inline bool & IgnoreSwitchedEdges ()
+            {
+                return ignoreSwitchedEdges_;
+            }
+
+            /**
+             * @brief      Getter for the search space.
+             *
+             * @return     The vertices the search may enter.
+             */
+            inline std::vector<bool> const & SearchSpace () const
+            {
+                return searchSpace_;
+            }
+
+            /**
+             * @brief      Setter for the search space.
+             * @details    If the search space is not empty, it has one entry
+             *     per vertex and the search does not enter a vertex whose
+             *     entry is @p false. The search space is kept by #Clear and
+             *     #Source. Note that the labels are only equal to the ones
+             *     of an unrestricted search for vertices whose simple paths
+             *     from the source stay inside the search space.
+             *
+             * @return     The vertices the search may enter, or an empty
+             *     vector for all vertices.
+             */
+            inline std::vector<bool> & SearchSpace ()
+            {
+                return searchSpace_;
+            }
         ///@}
 
         ///@name Compute Path Numbers
         ///@{
 #pragma mark LABEL_OPERATIONS
 
+            /**
+             * @brief      Number of @f$\dtp{s}@f$ to a target.
+             *
+             * @param[in]  target  The target.
+             *
+             * @return     The number of optimal labels at @p target, i.e.,
+             *     0 if @p target was not reached and 1 for the source.
+             */
+            inline Types::count NumberOfPathsTo ( TVertexId target ) const
+            {
+                MonotonicArena::Scope scope ( *arena_ );
+                return LabelSetAt ( target ).Optima().size();
+            }
+
             /**
              * @brief      Total number of @f$\dtp@f$ paths through a vertex.
              *
@@ -403,36 +778,16 @@ class DominatingThetaPath final {
                                                    , std::vector<Types::count> & numberOfPathsPerVertex
                                                    , std::vector<Types::real>  & relativeNumberOfPathsPerVertex )
             {
-                //@todo This is inefficient.
-                Types::count numberOfOptimalLabels = LabelSetAt(target).Optima().size(); // Divide by this value
-                Types::real weightOfPath = static_cast<Types::real>(1) / numberOfOptimalLabels;
-
                 numberOfPathsPerVertex.resize( graph_.NumberOfVertices(), 0 );
 
-                labelSets_[target].for_all_optima (
-                    [&]( TLabel const & optLabel )
+                for_all_vertices_on_optimal_paths_to ( target,
+                    [&]( TVertexId vertexId, Types::real weightOfPath )
                     {
-                        Types::labelId  labelId  = optLabel.Index();
-                        TVertexId       vertexId = target;
-
-                        do {
-                            TLabel & label = LabelAt( vertexId, labelId );
-                            labelId        = label.Index();
-
-                            ESSENTIAL_ASSERT ( graph_.VertexExists( vertexId ) );
-
-                            // Increase number of paths
-                            ++numberOfPathsPerVertex[vertexId];
-                            relativeNumberOfPathsPerVertex[vertexId] += weightOfPath;
-
-                            // Extract next label on the DTP
-                            vertexId = label.PreviousVertex();
-                            labelId  = label.PreviousLabel();
-
-                        } while ( labelId  != Const::NONE
-                               && vertexId != Const::NONE );
+                        // Increase number of paths
+                        ++numberOfPathsPerVertex[vertexId];
+                        relativeNumberOfPathsPerVertex[vertexId] += weightOfPath;
                     }
-                ); // For all labels in DTP at target vertex
+                );
             }
 
             /**
@@ -472,6 +827,96 @@ class DominatingThetaPath final {
                                                  , std::vector<Types::count> & numberOfPathsPerEdge
                                                  , std::vector<Types::real>  & relativeNumberOfPathsPerEdge )
             {
+                for_all_edges_on_optimal_paths_to ( target,
+                    [&]( TEdgeId edgeId, Types::real weightOfPath )
+                    {
+                        // Increase number of paths at "edgeId"
+                        ++numberOfPathsPerEdge[edgeId];
+                        relativeNumberOfPathsPerEdge[edgeId] += weightOfPath;
+                    }
+                );
+            }
+
+            /**
+             * @brief      The @p for loop over all vertices on the
+             *     @f$\dtp{s}@f$ to a target.
+             * @details    A vertex is visited once per optimal label path
+             *     that contains it, including the source and the target.
+             *
+             * @param[in]  target    The target for which we visit the paths.
+             * @param[in]  function  The function object that is called for
+             *     each vertex on a path, e.g.,
+             * @code{.cpp}
+             *      []( TVertexId vertexId, Types::real weightOfPath )
+             *      {
+             *          // Do something with the vertex, where weightOfPath
+             *          // is one over the number of optimal paths.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             *
+             * @todo    Use DAG property of label paths.
+             */
+            template<typename FUNCTION>
+            inline void for_all_vertices_on_optimal_paths_to ( TVertexId target
+                                                             , FUNCTION  function )
+            {
+                MonotonicArena::Scope scope ( *arena_ );
+                //@todo This is inefficient.
+                Types::count numberOfOptimalLabels = LabelSetAt(target).Optima().size(); // Divide by this value
+                Types::real weightOfPath = static_cast<Types::real>(1) / numberOfOptimalLabels;
+
+                labelSets_[target].for_all_optima (
+                    [&]( TLabel const & optLabel )
+                    {
+                        Types::labelId  labelId  = optLabel.Index();
+                        TVertexId       vertexId = target;
+
+                        do {
+                            TLabel & label = LabelAt( vertexId, labelId );
+                            labelId        = label.Index();
+
+                            ESSENTIAL_ASSERT ( graph_.VertexExists( vertexId ) );
+
+                            function ( vertexId, weightOfPath );
+
+                            // Extract next label on the DTP
+                            vertexId = label.PreviousVertex();
+                            labelId  = label.PreviousLabel();
+
+                        } while ( labelId  != Const::NONE
+                               && vertexId != Const::NONE );
+                    }
+                ); // For all labels in DTP at target vertex
+            }
+
+            /**
+             * @brief      The @p for loop over all edges on the
+             *     @f$\dtp{s}@f$ to a target.
+             * @details    An edge is visited once per optimal label path
+             *     that contains it.
+             *
+             * @param[in]  target    The target for which we visit the paths.
+             * @param[in]  function  The function object that is called for
+             *     each edge on a path, e.g.,
+             * @code{.cpp}
+             *      []( TEdgeId edgeId, Types::real weightOfPath )
+             *      {
+             *          // Do something with the edge, where weightOfPath
+             *          // is one over the number of optimal paths.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             *
+             * @todo    Use DAG property of label paths.
+             */
+            template<typename FUNCTION>
+            inline void for_all_edges_on_optimal_paths_to ( TVertexId target
+                                                          , FUNCTION  function )
+            {
+                MonotonicArena::Scope scope ( *arena_ );
                 //@todo This is inefficient.
                 Types::count numberOfOptimalLabels = LabelSetAt(target).Optima().size(); // Divide by this value
                 Types::real weightOfPath = static_cast<Types::real>(1) / numberOfOptimalLabels;
@@ -490,16 +935,13 @@ class DominatingThetaPath final {
                             || ( vertexId == Const::NONE )
                            ) break; // Label is already on path
 
-                        // Increase number of paths at "edgeId"
                         TEdgeId edgeId = ( graph_.EdgeId( label.PreviousVertex(), vertexId ) != Const::NONE )
                                                 ? graph_.EdgeId( label.PreviousVertex(), vertexId )
                                                 : graph_.EdgeId( vertexId, label.PreviousVertex() );
 
                         ESSENTIAL_ASSERT ( edgeId != Const::NONE );
 
-                        ++numberOfPathsPerEdge[edgeId];
-
-                        relativeNumberOfPathsPerEdge[edgeId] += weightOfPath;
+                        function ( edgeId, weightOfPath );
 
                         // Extract next label on the DTP
                         vertexId = label.PreviousVertex();
@@ -512,6 +954,9 @@ class DominatingThetaPath final {
         ///@}
 
     private:
+        template<typename, typename, typename, typename, DominationCriterion>
+        friend class egoa::BidirectionalDominatingThetaPath;  /**< Interleaves two searches, see #Step. */
+
         ///@name Accessors
         ///@{
 #pragma mark ACCESSORS
@@ -574,6 +1019,88 @@ class DominatingThetaPath final {
 
                 return labelSets_[vertexId].ElementAt ( labelId );
             }
+
+            /**
+             * @brief      The property columns of the graph.
+             *
+             * @return     The columns if the graph has property columns
+             *     that are up to date with its properties, @p nullptr
+             *     otherwise, e.g., for a DynamicGraph.
+             *
+             * @see        StaticGraph#BuildPropertyColumns
+             */
+            inline ElectricalPropertyColumns const * PropertyColumns () const
+            {
+                if constexpr ( internal::HasPropertyColumns<TGraph>::value )
+                {
+                    return graph_.HasPropertyColumns() ? &graph_.PropertyColumns()
+                                                       : nullptr;
+                } else {
+                    return nullptr;
+                }
+            }
+
+            /**
+             * @brief      Whether an edge is switched on.
+             *
+             * @param[in]  edge     The edge.
+             * @param[in]  columns  The property columns, or @p nullptr.
+             *
+             * @return     The status of the edge, which is read from the
+             *     column if @p columns is available.
+             */
+            inline bool IsActive ( TEdge                             const & edge
+                                 , ElectricalPropertyColumns const *         columns ) const
+            {
+                return ( columns != nullptr ) ? columns->IsActive ( edge.Identifier() )
+                                              : edge.Properties().Status();
+            }
+
+            /**
+             * @brief      The susceptance norm @f$|b^{-1}|@f$ of an edge.
+             *
+             * @param[in]  edge     The edge.
+             * @param[in]  columns  The property columns, or @p nullptr.
+             *
+             * @return     The susceptance norm of the edge, which is read
+             *     from the column if @p columns is available.
+             */
+            inline Types::real SusceptanceNormOf ( TEdge                             const & edge
+                                                 , ElectricalPropertyColumns const *         columns ) const
+            {
+                if ( columns != nullptr )
+                {
+                    return columns->Branch<BranchColumn::susceptanceNorm> ( edge.Identifier() );
+                }
+                return fabs ( 1 / edge.Properties().template Susceptance<Edges::CarrierDifferentiationType::DC>() );
+            }
+
+            /**
+             * @brief      Extends a label by an edge.
+             * @details    If the graph has property columns and the label
+             *     supports it, the label reads the edge attributes from the
+             *     columns, see EdgeColumnView.
+             *
+             * @param[in]  label    The label.
+             * @param[in]  edge     The edge.
+             * @param[in]  columns  The property columns, or @p nullptr.
+             *
+             * @return     A pair of the extended label and a boolean that is
+             *     @p true if the edge does not create a cycle.
+             */
+            inline std::pair<TLabel, bool> Extend ( TLabel                            const & label
+                                                  , TEdge                             const & edge
+                                                  , ElectricalPropertyColumns const *         columns ) const
+            {
+                if constexpr ( internal::HasColumnRelaxation<TLabel, TEdge>::value )
+                {
+                    if ( columns != nullptr )
+                    {
+                        return label + EdgeColumnView<TEdge> ( edge, *columns );
+                    }
+                }
+                return label + edge;
+            }
         ///@}
 
         ///@name Label Set L(v) and Queue Q Operators
@@ -765,6 +1292,10 @@ class DominatingThetaPath final {
             inline bool MergeLabelAt( TVertexId vertexId
                                     , TLabel  & label )
             {
+                if ( labelSets_[vertexId].Empty() )
+                {
+                    touchedVertices_.emplace_back ( vertexId );
+                }
                 return labelSets_[vertexId].template Merge<Domination>( label );
             }
 
@@ -788,14 +1319,81 @@ class DominatingThetaPath final {
                 label = std::get<0>(pair);
                 return  !( std::get<1>(pair) );
             }
+
+            /**
+             * @brief      Check if a label cannot lead to an optimal label
+             *     at the #Target.
+             * @details    A label is pruned if the target cannot be reached
+             *     from its vertex, or if its lower bound exceeds the
+             *     #UpperBound. The comparison tolerates rounding errors,
+             *     since labels with the optimal value must not be pruned.
+             *
+             * @param      label  The label @f$\labelu@f$.
+             *
+             * @return     @p True if the label is pruned, @p False otherwise.
+             */
+            inline bool IsPruned ( TLabel const & label ) const
+            {
+                if ( targetDistances_.empty() ) return false;
+
+                Types::real const distance = targetDistances_[label.Vertex()];
+                if ( distance == std::numeric_limits<Types::real>::infinity() ) return true;
+                if ( upperBound_ == Const::REAL_INFTY ) return false;
+
+                Types::real const bound = label.ValueBound ( distance, minimumCapacity_ );
+                return bound > upperBound_
+                    && !Auxiliary::EQ ( bound, upperBound_, 1e-9, 1e-9 );
+            }
+
+            /**
+             * @brief      The smallest lower bound of the unprocessed labels
+             *     at a vertex.
+             * @details    The bound of a label is the same as in #IsPruned.
+             *     It never decreases when a label is extended, since the
+             *     distances to the #Target fulfill the triangle inequality.
+             *
+             * @pre        The #Target is set.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     The smallest bound, or Const::REAL_INFTY if there
+             *     is no unprocessed label at @p vertexId or the target is
+             *     not reachable from it.
+             */
+            inline Types::real MinimumBoundAt ( TVertexId vertexId ) const
+            {
+                ESSENTIAL_ASSERT ( !targetDistances_.empty() );
+
+                Types::real const distance = targetDistances_[vertexId];
+                if ( distance == std::numeric_limits<Types::real>::infinity() ) return Const::REAL_INFTY;
+
+                Types::real bound = Const::REAL_INFTY;
+                labelSets_[vertexId].template for_all_unprocessed_elements<ExecutionPolicy::sequential> (
+                    [ & ]( TLabel const & label )
+                    {
+                        bound = std::min ( bound, label.ValueBound ( distance, minimumCapacity_ ) );
+                    }
+                );
+                return bound;
+            }
         ///@}
 
 #pragma mark MEMBERS
     private:
         TGraph            const & graph_;           /**< The graph @f$\graph = (\vertices,\edges)@f$ on which the DTP is calculated. */
+        std::unique_ptr<MonotonicArena> arena_;     /**< The arena for labels and label sets that use the ArenaAllocator. It is declared before and thus destroyed after them. */
         std::vector<TLabelSet>    labelSets_;       /**< At each vertex @f$\vertex\in\vertices@f$ there is a set of labels @f$\labels(\vertex)@f$. */
+        std::vector<TVertexId>    touchedVertices_; /**< The vertices whose label sets might be non-empty, see #Clear. */
         TQueue                    queue_;           /**< The priority queue @f$\queue@f$. */
 
+        bool                      ignoreSwitchedEdges_; /**< Whether edges with status @p false are ignored. */
+        std::vector<bool>         searchSpace_;     /**< The vertices the search may enter, or empty for all vertices. */
+
+        TVertexId                 target_;          /**< The target of a point-to-point query, or Const::NONE. */
+        std::vector<Types::real>  targetDistances_; /**< The susceptance norm distance from each vertex to the target, or empty. */
+        Types::real               minimumCapacity_; /**< The minimum thermal limit of all edges. */
+        Types::real               upperBound_;      /**< The best value found at the target so far. */
+
         IO::DtpRuntimeRow         dtpRuntimeRow_;   /**< To measure quality and time information. */
 };
 
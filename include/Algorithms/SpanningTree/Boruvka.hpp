@@ -0,0 +1,210 @@
+/*
+ * Boruvka.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__ALGORITHMS__SPANNING_TREES__BORUVKA_HPP
+#define EGOA__ALGORITHMS__SPANNING_TREES__BORUVKA_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "Algorithms/SpanningTree/MST.hpp"
+
+#include "DataStructures/Container/ConcurrentUnionFind.hpp"
+
+namespace egoa {
+/**
+ *  @brief An implementation of Borůvka's algorithm for finding minimum
+ *         spanning trees.
+ *
+ *  @details The algorithm works in rounds. In each round, every component
+ *      of the spanning forest selects its lightest outgoing edge and all
+ *      selected edges are added at once. Thus, the number of components at
+ *      least halves in each round. Edges within a component are removed
+ *      after each round.
+ *
+ *      The lightest edges are selected in parallel if OpenMP is available,
+ *      i.e., each component keeps its lightest edge in an atomic that is
+ *      updated by compare-and-swap. The components are merged in parallel
+ *      using a ConcurrentUnionFind. Thus, the comparator is called by
+ *      several threads at the same time and must not modify shared state.
+ *
+ *      Edges that are equal with respect to the comparator are ordered by
+ *      their identifiers, so that the selected edges never close a cycle.
+ *
+ *  @code{.cpp}
+ *      Boruvka<TGraph> boruvka(graph, comparator);
+ *      boruvka.Run();
+ *      Subgraph<TGraph> spanningTree = boruvka.Result();
+ *  @endcode
+ *
+ *  @tparam GraphType  The type of the graph.
+ */
+template<typename GraphType>
+class Boruvka final : public MST<GraphType> {
+
+    using TSpanningTree = MST<GraphType>;
+    using typename TSpanningTree::TGraph;
+    using typename TSpanningTree::TEdge;
+    using typename TSpanningTree::TComparator;
+
+    public:
+        Boruvka(TGraph & graph,
+                TComparator comparator)
+        : TSpanningTree(graph, std::move(comparator))
+        {}
+
+        virtual ~Boruvka() {}
+
+        /**
+         * @brief Borůvka's Algorithm
+         * @details Borůvka's algorithm runs in O(|E| lg |V|), since there
+         *     are at most lg |V| rounds. Other than Prim's algorithm, it
+         *     computes a minimum spanning forest if the graph is not
+         *     connected.
+         *
+         *     Steps:
+         *          1. Each component selects its lightest outgoing edge
+         *          2. Add all selected edges and merge their components
+         *          3. Remove the edges within a component
+         *          4. Repeat until no edge between two components is left
+         */
+        virtual inline void Run() override {
+            // The rounds only read the graph, thus, the const accessors are used
+            TGraph const & graph = this->Graph();
+            Types::count const numberOfVertices = graph.NumberOfVertices();
+            ConcurrentUnionFind unionFind( numberOfVertices );
+
+            // Fill vectors with edge identifiers and their endpoints, which
+            // are kept together when the edges within a component are removed
+            std::vector<Types::edgeId>   edges;
+            std::vector<Types::vertexId> sources;
+            std::vector<Types::vertexId> targets;
+            edges.reserve(graph.NumberOfEdges());
+            sources.reserve(graph.NumberOfEdges());
+            targets.reserve(graph.NumberOfEdges());
+            graph.template for_all_edges<ExecutionPolicy::sequential>([&](TEdge const & edge) {
+                edges.push_back(edge.Identifier());
+                sources.push_back(edge.Source());
+                targets.push_back(edge.Target());
+            });
+
+            std::vector<std::atomic<Types::edgeId>> lightestEdge( numberOfVertices );
+            std::vector<Types::edgeId>              addedEdge( numberOfVertices, Const::NONE );
+            std::vector<char>                       isWithinComponent;
+            std::vector<Types::edgeId>              spanningTreeEdges;
+
+#ifdef OPENMP_AVAILABLE
+            #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+            for ( Types::vertexId vertex = 0; vertex < numberOfVertices; ++vertex )
+            {
+                lightestEdge[vertex].store ( Const::NONE, std::memory_order_relaxed );
+            }
+
+            while ( !edges.empty() )
+            {
+                // Select the lightest outgoing edge of each component
+                isWithinComponent.assign ( edges.size(), false );
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( dynamic, 1024 )
+#endif // OPENMP_AVAILABLE
+                for ( Types::index index = 0; index < edges.size(); ++index )
+                {
+                    Types::edgeId   const edge   = edges[index];
+                    Types::vertexId const source = unionFind.Find( sources[index] );
+                    Types::vertexId const target = unionFind.Find( targets[index] );
+
+                    if ( source == target )
+                    {
+                        isWithinComponent[index] = true;
+                        continue;
+                    }
+                    UpdateLightestEdge ( lightestEdge[source], edge );
+                    UpdateLightestEdge ( lightestEdge[target], edge );
+                }
+
+                // Remove the edges within a component
+                Types::index numberOfRemainingEdges = 0;
+                for ( Types::index index = 0; index < edges.size(); ++index )
+                {
+                    if ( isWithinComponent[index] ) continue;
+                    edges[numberOfRemainingEdges]   = edges[index];
+                    sources[numberOfRemainingEdges] = sources[index];
+                    targets[numberOfRemainingEdges] = targets[index];
+                    ++numberOfRemainingEdges;
+                }
+                edges.resize ( numberOfRemainingEdges );
+                sources.resize ( numberOfRemainingEdges );
+                targets.resize ( numberOfRemainingEdges );
+
+                if ( edges.empty() ) break;
+
+                // Add the selected edges. An edge that is selected by both
+                // of its components merges them only once.
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+                for ( Types::vertexId vertex = 0; vertex < numberOfVertices; ++vertex )
+                {
+                    Types::edgeId const edge = lightestEdge[vertex].load ( std::memory_order_relaxed );
+                    if ( edge == Const::NONE ) continue;
+                    lightestEdge[vertex].store ( Const::NONE, std::memory_order_relaxed );
+
+                    TEdge const & selectedEdge = graph.EdgeAt( edge );
+                    if ( unionFind.Union( selectedEdge.Source(), selectedEdge.Target() ) )
+                    {
+                        addedEdge[vertex] = edge;
+                    }
+                }
+
+                for ( Types::vertexId vertex = 0; vertex < numberOfVertices; ++vertex )
+                {
+                    if ( addedEdge[vertex] == Const::NONE ) continue;
+                    spanningTreeEdges.push_back ( addedEdge[vertex] );
+                    addedEdge[vertex] = Const::NONE;
+                }
+            }
+
+            this->SetResult(std::move(spanningTreeEdges));
+        }
+
+    private:
+        /**
+         * @brief      Whether the edge @p lhs is lighter than the edge @p rhs.
+         * @details    Edges that are equal with respect to the comparator
+         *     are ordered by their identifiers.
+         */
+        inline bool IsLighter ( Types::edgeId lhs, Types::edgeId rhs ) const
+        {
+            if ( this->Comparator()( lhs, rhs ) ) return true;
+            if ( this->Comparator()( rhs, lhs ) ) return false;
+            return lhs < rhs;
+        }
+
+        /**
+         * @brief      Replaces the lightest edge of a component by @p edge
+         *     if @p edge is lighter.
+         *
+         * @param      lightestEdge  The lightest edge of the component.
+         * @param[in]  edge          The edge identifier.
+         */
+        inline void UpdateLightestEdge ( std::atomic<Types::edgeId> & lightestEdge
+                                       , Types::edgeId                edge ) const
+        {
+            Types::edgeId current = lightestEdge.load ( std::memory_order_relaxed );
+            while ( ( current == Const::NONE || IsLighter ( edge, current ) )
+                    && !lightestEdge.compare_exchange_weak ( current
+                                                           , edge
+                                                           , std::memory_order_relaxed ) )
+            {}
+        }
+};
+
+} // namespace egoa
+
+#endif // EGOA__ALGORITHMS__SPANNING_TREES__BORUVKA_HPP
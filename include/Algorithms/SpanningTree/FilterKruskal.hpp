@@ -0,0 +1,317 @@
+/*
+ * FilterKruskal.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__ALGORITHMS__SPANNING_TREES__FILTER_KRUSKAL_HPP
+#define EGOA__ALGORITHMS__SPANNING_TREES__FILTER_KRUSKAL_HPP
+
+#ifdef OPENMP_AVAILABLE
+    #include <omp.h>
+#endif // OPENMP_AVAILABLE
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Algorithms/SpanningTree/MST.hpp"
+
+#include "DataStructures/Container/ConcurrentUnionFind.hpp"
+
+namespace egoa {
+/**
+ *  @brief An implementation of the Filter-Kruskal algorithm for finding
+ *         minimum spanning trees.
+ *
+ *  @details Instead of sorting all edges upfront, the edges are partitioned
+ *      around a pivot edge like in quicksort. The lighter edges are processed
+ *      first. Afterwards, all heavier edges whose endpoints are already in
+ *      the same component are filtered out before they are partitioned any
+ *      further. Only small ranges of edges are sorted and added as in
+ *      Kruskal's algorithm. The search stops as soon as the spanning tree is
+ *      complete.
+ *
+ *      The partitioning and the filtering run in parallel if OpenMP is
+ *      available. The filter queries the components concurrently using a
+ *      ConcurrentUnionFind. Thus, the comparator is called by several
+ *      threads at the same time and must not modify shared state.
+ *
+ *  @code{.cpp}
+ *      FilterKruskal<TGraph> kruskal(graph, comparator);
+ *      kruskal.Run();
+ *      Subgraph<TGraph> spanningTree = kruskal.Result();
+ *  @endcode
+ *
+ *  @tparam GraphType  The type of the graph.
+ *
+ *  @see Kruskal
+ */
+template<typename GraphType>
+class FilterKruskal final : public MST<GraphType> {
+
+    using TSpanningTree = MST<GraphType>;
+    using typename TSpanningTree::TGraph;
+    using typename TSpanningTree::TEdge;
+    using typename TSpanningTree::TComparator;
+
+    public:
+        FilterKruskal(TGraph & graph,
+                      TComparator comparator)
+        : TSpanningTree(graph, std::move(comparator))
+        , baseCaseSize_(1024)
+        {}
+
+        virtual ~FilterKruskal() {}
+
+        /**
+         * @brief Filter-Kruskal's Algorithm
+         * @details The expected running time is in O(|E| + |V| lg |V| lg
+         *     (|E| / |V|)) for random edge weights, since only the edges
+         *     that are lighter than the heaviest edge of the spanning tree
+         *     are sorted.
+         *
+         *     Steps:
+         *          1. If the range of edges is small, sort it and add the
+         *          edges as in Kruskal's algorithm
+         *          2. Otherwise, partition the edges around a pivot
+         *          3. Recurse on the lighter edges
+         *          4. Remove the heavier edges that lie within a component
+         *          5. Recurse on the remaining heavier edges
+         */
+        virtual inline void Run() override {
+            ConcurrentUnionFind unionFind( this->Graph().NumberOfVertices() );
+
+            // Fill vector with edge identifiers
+            edges_.clear();
+            edges_.reserve(this->Graph().NumberOfEdges());
+            this->Graph().template for_all_edge_identifiers<ExecutionPolicy::sequential>([this](Types::edgeId id) {
+                edges_.push_back(id);
+            });
+            buffer_.resize(edges_.size());
+            isLeft_.resize(edges_.size());
+
+            std::vector<Types::edgeId> spanningTreeEdges;
+            if ( this->Graph().NumberOfVertices() > 0 ) {
+                spanningTreeEdges.reserve( this->Graph().NumberOfVertices() - 1 );
+            }
+
+            FilterKruskalOn( 0, edges_.size(), unionFind, spanningTreeEdges );
+
+            this->SetResult(std::move(spanningTreeEdges));
+        }
+
+        ///@name Parameters
+        ///@{
+            /**
+             * @brief      The number of edges up to which a range is sorted
+             *     instead of partitioned.
+             */
+            inline Types::count   BaseCaseSize() const { return baseCaseSize_; }
+            inline Types::count & BaseCaseSize()       { return baseCaseSize_; }
+        ///@}
+
+    private:
+        /**
+         * @brief      Adds the edges in [@p begin, @p end) to the spanning
+         *     forest.
+         *
+         * @param[in]  begin              The first position in edges_.
+         * @param[in]  end                The position after the last one.
+         * @param      unionFind          The components of the spanning forest.
+         * @param      spanningTreeEdges  The edges of the spanning forest.
+         */
+        inline void FilterKruskalOn ( Types::index                 begin
+                                    , Types::index                 end
+                                    , ConcurrentUnionFind        & unionFind
+                                    , std::vector<Types::edgeId> & spanningTreeEdges )
+        {
+            // The heavier edges are handled by the loop to bound the recursion depth
+            while ( !IsSpanningTreeComplete ( spanningTreeEdges ) )
+            {
+                if ( end - begin <= std::max<Types::count>( BaseCaseSize(), 1 ) ) {
+                    KruskalOn ( begin, end, unionFind, spanningTreeEdges );
+                    return;
+                }
+
+                Types::edgeId const pivot = PivotOf ( begin, end );
+                Types::index middle = Partition ( begin, end, [this, pivot]( Types::edgeId edge ) {
+                    return !this->Comparator()( pivot, edge );
+                });
+
+                if ( middle == end )
+                { // The pivot is a heaviest edge, thus split off the edges that are as heavy as the pivot
+                    middle = Partition ( begin, end, [this, pivot]( Types::edgeId edge ) {
+                        return this->Comparator()( edge, pivot );
+                    });
+                }
+
+                if ( middle == begin )
+                { // All edges are as heavy as the pivot
+                    KruskalOn ( begin, end, unionFind, spanningTreeEdges );
+                    return;
+                }
+
+                FilterKruskalOn ( begin, middle, unionFind, spanningTreeEdges );
+
+                if ( IsSpanningTreeComplete ( spanningTreeEdges ) ) return;
+
+                // Remove the edges that would close a cycle
+                begin = middle;
+                end   = Partition ( begin, end, [this, &unionFind]( Types::edgeId edge ) {
+                    TEdge const & e = std::as_const( this->Graph() ).EdgeAt( edge );
+                    return !unionFind.InSameComponent( e.Source(), e.Target() );
+                });
+            }
+        }
+
+        /**
+         * @brief      Sorts the edges in [@p begin, @p end) and adds them as
+         *     in Kruskal's algorithm.
+         */
+        inline void KruskalOn ( Types::index                 begin
+                              , Types::index                 end
+                              , ConcurrentUnionFind        & unionFind
+                              , std::vector<Types::edgeId> & spanningTreeEdges )
+        {
+            std::sort( edges_.begin() + begin, edges_.begin() + end, this->Comparator() );
+
+            for ( Types::index index = begin; index < end; ++index )
+            {
+                Types::edgeId edge = edges_[index];
+                TEdge const & e    = std::as_const( this->Graph() ).EdgeAt( edge );
+                if ( unionFind.Union( e.Source(), e.Target() ) )
+                {
+                    spanningTreeEdges.push_back( edge );
+                    if ( IsSpanningTreeComplete ( spanningTreeEdges ) ) return;
+                }
+            }
+        }
+
+        /**
+         * @brief      Moves the edges in [@p begin, @p end) that fulfill the
+         *     @p predicate to the front of the range.
+         * @details    The predicate is evaluated once per edge. The order of
+         *     the edges within both parts is kept.
+         *
+         * @param[in]  begin      The first position in edges_.
+         * @param[in]  end        The position after the last one.
+         * @param[in]  predicate  The predicate @p bool(Types::edgeId).
+         *
+         * @tparam     FUNCTION   The type of the predicate.
+         *
+         * @return     The position of the first edge that does not fulfill
+         *     the predicate.
+         */
+        template<typename FUNCTION>
+        inline Types::index Partition ( Types::index begin
+                                      , Types::index end
+                                      , FUNCTION     predicate )
+        {
+            Types::count const count            = end - begin;
+            Types::count const numberOfBlocks   = NumberOfBlocks ( count );
+            Types::count const blockSize        = ( count + numberOfBlocks - 1 ) / numberOfBlocks;
+
+            std::vector<Types::count> numberOfLeftEdges ( numberOfBlocks, 0 );
+
+#ifdef OPENMP_AVAILABLE
+            #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+            for ( Types::index block = 0; block < numberOfBlocks; ++block )
+            {
+                Types::index const first = begin + std::min( block * blockSize, count );
+                Types::index const last  = begin + std::min( ( block + 1 ) * blockSize, count );
+                for ( Types::index index = first; index < last; ++index )
+                {
+                    isLeft_[index] = predicate ( edges_[index] );
+                    numberOfLeftEdges[block] += isLeft_[index];
+                }
+            }
+
+            Types::count numberOfLeft = 0;
+            for ( Types::count numberOfLeftInBlock : numberOfLeftEdges )
+            {
+                numberOfLeft += numberOfLeftInBlock;
+            }
+
+#ifdef OPENMP_AVAILABLE
+            #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+            for ( Types::index block = 0; block < numberOfBlocks; ++block )
+            {
+                Types::index const first = begin + std::min( block * blockSize, count );
+                Types::index const last  = begin + std::min( ( block + 1 ) * blockSize, count );
+
+                Types::index left = begin;
+                for ( Types::index previous = 0; previous < block; ++previous )
+                {
+                    left += numberOfLeftEdges[previous];
+                }
+                Types::index right = begin + numberOfLeft + ( first - begin ) - ( left - begin );
+
+                for ( Types::index index = first; index < last; ++index )
+                {
+                    if ( isLeft_[index] ) buffer_[left++]  = edges_[index];
+                    else                  buffer_[right++] = edges_[index];
+                }
+            }
+
+#ifdef OPENMP_AVAILABLE
+            #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+            for ( Types::index index = begin; index < end; ++index )
+            {
+                edges_[index] = buffer_[index];
+            }
+
+            return begin + numberOfLeft;
+        }
+
+        /**
+         * @brief      The median of three edges of the range.
+         */
+        inline Types::edgeId PivotOf ( Types::index begin
+                                     , Types::index end ) const
+        {
+            Types::count const count = end - begin;
+            Types::edgeId a = edges_[begin +     count / 4];
+            Types::edgeId b = edges_[begin +     count / 2];
+            Types::edgeId c = edges_[begin + 3 * count / 4];
+
+            TComparator const & comparator = this->Comparator();
+            if ( comparator ( b, a ) ) std::swap ( a, b );
+            if ( comparator ( c, b ) ) std::swap ( b, c );
+            if ( comparator ( b, a ) ) std::swap ( a, b );
+            return b;
+        }
+
+        /**
+         * @brief      The number of blocks in which a range of @p count edges
+         *     is partitioned, i.e., at most one per thread.
+         */
+        inline Types::count NumberOfBlocks ( Types::count count ) const
+        {
+            Types::count numberOfThreads = 1;
+#ifdef OPENMP_AVAILABLE
+            numberOfThreads = omp_get_max_threads();
+#endif // OPENMP_AVAILABLE
+            Types::count const minimumBlockSize = 4096;
+            return std::max<Types::count>( 1, std::min( numberOfThreads, count / minimumBlockSize ) );
+        }
+
+        inline bool IsSpanningTreeComplete ( std::vector<Types::edgeId> const & spanningTreeEdges ) const
+        {
+            return spanningTreeEdges.size() + 1 >= this->Graph().NumberOfVertices();
+        }
+
+    private:
+        Types::count                baseCaseSize_;  /**< The number of edges up to which a range is sorted */
+        std::vector<Types::edgeId>  edges_;         /**< The edges that are not yet filtered out */
+        std::vector<Types::edgeId>  buffer_;        /**< The target of the partitioning */
+        std::vector<char>           isLeft_;        /**< Whether the edge at a position fulfills the predicate */
+};
+
+} // namespace egoa
+
+#endif // EGOA__ALGORITHMS__SPANNING_TREES__FILTER_KRUSKAL_HPP
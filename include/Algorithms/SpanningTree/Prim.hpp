@@ -23,21 +23,38 @@ namespace egoa {
  *      Subgraph<TGraph> spanningTree = prim.Result();
  *  @endcode
  *
+ *  The priority queue maps vertex identifiers to the identifiers of their
+ *  cheapest edges and is constructed with the comparator of the edges. Prim
+ *  uses the comparator type of the queue, i.e., if the queue takes the
+ *  comparator as a template parameter, the comparisons are resolved at
+ *  compile time, e.g.,
+ *  @code{.cpp}
+ *      using TQueue = MappingDaryHeap< Types::vertexId
+ *                                    , Types::edgeId
+ *                                    , 4
+ *                                    , EdgeComparator >;
+ *      Prim<TGraph, TQueue> prim(graph, EdgeComparator(graph));
+ *  @endcode
+ *
  *  @tparam GraphType  The type of the graph.
- *  @tparam WeightType The type of the edge weights.
+ *  @tparam QueueType  The priority queue type such as MappingBinaryHeap,
+ *                     MappingDaryHeap, or PairingHeap. It has to provide
+ *                     the type @p TComparator of its comparator.
  */
-template< typename GraphType>
+template< typename GraphType
+        , typename QueueType = MappingBinaryHeap<Types::vertexId, Types::edgeId> >
 class Prim final : public MST<GraphType> {
 
     using TSpanningTree = MST<GraphType>;
     using typename TSpanningTree::TGraph;
     using typename TSpanningTree::TEdge;
-    using typename TSpanningTree::TComparator;
+    using TComparator   = typename QueueType::TComparator;
 
     public:
         Prim(TGraph & graph,
              TComparator comparator)
-        : TSpanningTree( graph, std::move(comparator) )
+        : TSpanningTree( graph, comparator )
+        , comparator_( std::move(comparator) )
         {}
 
         virtual ~Prim() {}
@@ -68,8 +85,7 @@ class Prim final : public MST<GraphType> {
             std::vector<bool> visited(numberOfVertices, false);
             std::vector<Types::edgeId> edgesInSpanningTree;
 
-            // TODO: Use vector instead of the default unordered_map
-            MappingBinaryHeap<Types::vertexId, Types::edgeId> heap(this->Comparator());
+            QueueType heap(comparator_);
 
             Types::vertexId currentVertex = 0;
             visited[currentVertex] = true;
@@ -89,7 +105,7 @@ class Prim final : public MST<GraphType> {
                         { // The neighbor has not been visited before
                             heap.Insert(neighbor, edge.Identifier());
                             visited[neighbor] = true;
-                        } else if ( this->Comparator()( edge.Identifier(), heap.KeyOf(neighbor) ) )
+                        } else if ( comparator_( edge.Identifier(), heap.KeyOf(neighbor) ) )
                         {
                             // Better edge to neighbor has been found
                             heap.ChangeKey(neighbor, edge.Identifier());
@@ -105,6 +121,9 @@ class Prim final : public MST<GraphType> {
 
             this->SetResult(std::move(edgesInSpanningTree));
         }
+
+    private:
+        TComparator comparator_;    /**< The comparator of the edges with the type used by the queue */
 };
 
 } // namespace egoa
@@ -0,0 +1,174 @@
+/*
+ * ArenaAllocator.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__ALLOCATORS__ARENA_ALLOCATOR_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__ALLOCATORS__ARENA_ALLOCATOR_HPP
+
+#include <new>
+#include <type_traits>
+
+#include "DataStructures/Container/Allocators/MonotonicArena.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      An allocator that draws from a MonotonicArena.
+ * @details    A default constructed allocator binds to the current arena of
+ *     the calling thread, see MonotonicArena::Scope. If there is no current
+ *     arena, the allocator falls back to the global @p operator @p new.
+ *     Deallocation is a no-op for arena memory, since the arena releases
+ *     everything at once by MonotonicArena::Reset.
+ *
+ *     Copies of a container that uses an arena bind to the arena that is
+ *     current at the time of the copy, and not to the arena of the copied
+ *     container. This is the lifetime contract of the allocator: a copy of
+ *     a container that uses an arena has to be made within a
+ *     MonotonicArena::Scope, and it
+ *     must be destroyed before the arena of that scope is reset. For
+ *     example, the labels that DominatingThetaPath copies live in its own
+ *     arena and are destroyed by DominatingThetaPath#Clear before the
+ *     arena is reset. To keep a label beyond that, copy it within the
+ *     scope of an arena that lives long enough. Copies of containers that
+ *     use the global allocator use the global allocator as well and may be
+ *     made anywhere.
+ *
+ *     The allocator is meant to be used in the label and label set types
+ *     of DominatingThetaPath, e.g.,
+ * @code{.cpp}
+ *      using TVertexSet = std::unordered_set< Types::vertexId
+ *                                           , std::hash<Types::vertexId>
+ *                                           , std::equal_to<Types::vertexId>
+ *                                           , ArenaAllocator<Types::vertexId> >;
+ *      using TLabel     = VoltageAngleDifferenceLabel< TEdge, TVertexSet >;
+ *      using TLabelSet  = Bucket< BinaryHeap< TLabel, ArenaAllocator<TLabel> >
+ *                               , ArenaAllocator<TLabel> >;
+ * @endcode
+ *
+ * @tparam     ElementType  The type of the allocated elements.
+ *
+ * @see        MonotonicArena
+ * @see        DominatingThetaPath
+ */
+template<typename ElementType>
+class ArenaAllocator {
+    public:
+        // Type aliasing
+        using value_type                                = ElementType;
+        using propagate_on_container_copy_assignment    = std::false_type;
+        using propagate_on_container_move_assignment    = std::true_type;
+        using propagate_on_container_swap               = std::true_type;
+        using is_always_equal                           = std::false_type;
+
+        template<typename OtherType>
+        struct rebind {
+            using other = ArenaAllocator<OtherType>;
+        };
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Binds the allocator to the current arena.
+             */
+            ArenaAllocator() noexcept
+            : arena_( MonotonicArena::Current() )
+            {}
+
+            /**
+             * @brief      Binds the allocator to @p arena.
+             *
+             * @param      arena  The arena, or @p nullptr for the global
+             *     allocator.
+             */
+            explicit ArenaAllocator ( MonotonicArena * arena ) noexcept
+            : arena_( arena )
+            {}
+
+            template<typename OtherType>
+            ArenaAllocator ( ArenaAllocator<OtherType> const & other ) noexcept
+            : arena_( other.Arena() )
+            {}
+        ///@}
+
+        ///@name Allocation
+        ///@{
+#pragma mark ALLOCATION
+
+            inline ElementType * allocate ( std::size_t number )
+            {
+                if ( arena_ == nullptr )
+                {
+                    return static_cast<ElementType *>( ::operator new ( number * sizeof(ElementType) ) );
+                }
+                return static_cast<ElementType *>( arena_->Allocate ( number * sizeof(ElementType)
+                                                                    , alignof(ElementType) ) );
+            }
+
+            inline void deallocate ( ElementType * pointer, std::size_t )
+            {
+                if ( arena_ == nullptr )
+                {
+                    ::operator delete ( pointer );
+                }
+            }
+
+            /**
+             * @brief      The allocator of a copied container.
+             *
+             * @pre        If this allocator draws from an arena, there is a
+             *     current arena, see MonotonicArena::Scope. The copy must be
+             *     destroyed before the current arena is reset.
+             *
+             * @return     The global allocator if this allocator uses the
+             *     global allocator, and an allocator bound to the current
+             *     arena otherwise.
+             */
+            inline ArenaAllocator select_on_container_copy_construction() const
+            {
+                USAGE_ASSERT ( arena_ == nullptr
+                            || MonotonicArena::Current() != nullptr );
+                return arena_ == nullptr ? ArenaAllocator ( nullptr )
+                                         : ArenaAllocator();
+            }
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            inline MonotonicArena * Arena() const noexcept
+            {
+                return arena_;
+            }
+        ///@}
+
+#pragma mark MEMBERS
+    private:
+        MonotonicArena * arena_;    /**< The arena, or nullptr for the global allocator */
+};
+
+template<typename LhsType, typename RhsType>
+inline bool operator== ( ArenaAllocator<LhsType> const & lhs
+                       , ArenaAllocator<RhsType> const & rhs ) noexcept
+{
+    return lhs.Arena() == rhs.Arena();
+}
+
+template<typename LhsType, typename RhsType>
+inline bool operator!= ( ArenaAllocator<LhsType> const & lhs
+                       , ArenaAllocator<RhsType> const & rhs ) noexcept
+{
+    return !( lhs == rhs );
+}
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__ALLOCATORS__ARENA_ALLOCATOR_HPP
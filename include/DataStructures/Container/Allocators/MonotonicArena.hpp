@@ -0,0 +1,235 @@
+/*
+ * MonotonicArena.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__ALLOCATORS__MONOTONIC_ARENA_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__ALLOCATORS__MONOTONIC_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A monotonic memory arena.
+ * @details    Memory is handed out by bumping a pointer through a list of
+ *     chunks. Single allocations are never freed. Instead, the whole arena
+ *     is rewound by #Reset in @f$\Theta(1)@f$ time, which keeps all chunks
+ *     for the next round. Thus, after a warm-up the arena does not call the
+ *     global allocator anymore, and an arena that is owned by one thread
+ *     never contends with other threads.
+ *
+ *     Containers draw from an arena through the ArenaAllocator. Since
+ *     default constructed allocators have to find their arena, an arena can
+ *     be installed as the current arena of the calling thread by a #Scope,
+ *     e.g.,
+ * @code{.cpp}
+ *      MonotonicArena arena;
+ *      {
+ *          MonotonicArena::Scope scope ( arena );
+ *          std::vector<int, ArenaAllocator<int>> numbers; // uses the arena
+ *          numbers.push_back ( 42 );
+ *      }
+ *      arena.Reset(); // numbers must not be alive anymore
+ * @endcode
+ *
+ * @pre        All objects that hold memory of the arena have to be destroyed
+ *     before #Reset is called.
+ *
+ * @see        ArenaAllocator
+ */
+class MonotonicArena {
+    public:
+        /**
+         * @brief      Installs an arena as the current arena of the calling
+         *     thread for the lifetime of the scope.
+         * @details    Scopes can be nested. The previously current arena is
+         *     restored on destruction.
+         */
+        class Scope {
+            public:
+                explicit Scope ( MonotonicArena & arena )
+                : previous_ ( Current() )
+                {
+                    Current() = &arena;
+                }
+
+                ~Scope()
+                {
+                    Current() = previous_;
+                }
+
+                Scope ( Scope const & )             = delete;
+                Scope & operator= ( Scope const & ) = delete;
+
+            private:
+                MonotonicArena * previous_;     /**< The arena that was current before this scope */
+        };
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs an empty arena.
+             * @details    No memory is allocated until the first request.
+             *
+             * @param[in]  chunkSize  The size of the first chunk in bytes.
+             *     Each further chunk doubles the size of the previous one.
+             */
+            explicit MonotonicArena ( Types::count chunkSize = 64 * 1024 )
+            : chunks_()
+            , chunkSize_( chunkSize )
+            , activeChunk_( 0 )
+            , offset_( 0 )
+            {
+                USAGE_ASSERT ( chunkSize > 0 );
+            }
+
+            MonotonicArena ( MonotonicArena const & )              = delete;
+            MonotonicArena & operator= ( MonotonicArena const & )   = delete;
+        ///@}
+
+        ///@name Allocation
+        ///@{
+#pragma mark ALLOCATION
+
+            /**
+             * @brief      Allocates memory from the arena.
+             *
+             * @param[in]  bytes      The number of bytes.
+             * @param[in]  alignment  The alignment, which has to be a power
+             *     of two.
+             *
+             * @return     A pointer to the uninitialized memory.
+             */
+            inline void * Allocate ( Types::count bytes
+                                   , Types::count alignment = alignof(std::max_align_t) )
+            {
+                USAGE_ASSERT ( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+                while ( activeChunk_ < chunks_.size() )
+                {
+                    Chunk & chunk = chunks_[activeChunk_];
+                    Types::count const begin = AlignUp ( chunk.memory.get(), offset_, alignment );
+                    if ( begin + bytes <= chunk.size )
+                    {
+                        offset_ = begin + bytes;
+                        return chunk.memory.get() + begin;
+                    }
+                    // The rest of the chunk is too small, go to the next one
+                    ++activeChunk_;
+                    offset_ = 0;
+                }
+
+                Types::count size = chunks_.empty() ? chunkSize_ : 2 * chunks_.back().size;
+                while ( size < bytes + alignment ) size *= 2;
+                chunks_.push_back ( Chunk { std::unique_ptr<char[]>( new char[size] ), size } );
+
+                activeChunk_ = chunks_.size() - 1;
+                Chunk & chunk = chunks_.back();
+                Types::count const begin = AlignUp ( chunk.memory.get(), 0, alignment );
+                offset_ = begin + bytes;
+                return chunk.memory.get() + begin;
+            }
+
+            /**
+             * @brief      Rewinds the arena.
+             * @details    All memory handed out so far becomes invalid. The
+             *     chunks are kept for reuse.
+             */
+            inline void Reset()
+            {
+                activeChunk_ = 0;
+                offset_      = 0;
+            }
+
+            /**
+             * @brief      Rewinds the arena and returns all chunks to the
+             *     global allocator.
+             */
+            inline void Release()
+            {
+                chunks_.clear();
+                Reset();
+            }
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            /**
+             * @brief      The number of bytes owned by the arena.
+             *
+             * @return     The sum of all chunk sizes in bytes.
+             */
+            inline Types::count Capacity() const
+            {
+                Types::count capacity = 0;
+                for ( Chunk const & chunk : chunks_ )
+                {
+                    capacity += chunk.size;
+                }
+                return capacity;
+            }
+
+            /**
+             * @brief      The number of chunks owned by the arena.
+             *
+             * @return     The number of chunks.
+             */
+            inline Types::count NumberOfChunks() const
+            {
+                return chunks_.size();
+            }
+
+            /**
+             * @brief      The current arena of the calling thread.
+             *
+             * @return     A reference to the pointer to the current arena,
+             *     which is @p nullptr if no Scope is active.
+             */
+            static inline MonotonicArena * & Current()
+            {
+                static thread_local MonotonicArena * current = nullptr;
+                return current;
+            }
+        ///@}
+
+    private:
+#pragma mark AUXILIARY
+        static inline Types::count AlignUp ( char const * base
+                                           , Types::count offset
+                                           , Types::count alignment )
+        {
+            std::uintptr_t const address = reinterpret_cast<std::uintptr_t>( base ) + offset;
+            std::uintptr_t const aligned = ( address + alignment - 1 ) & ~( static_cast<std::uintptr_t>( alignment ) - 1 );
+            return offset + ( aligned - address );
+        }
+
+        struct Chunk {
+            std::unique_ptr<char[]> memory;     /**< The memory of the chunk */
+            Types::count            size;       /**< The size of the chunk in bytes */
+        };
+
+#pragma mark MEMBERS
+        std::vector<Chunk>  chunks_;        /**< The chunks in the order of their allocation */
+        Types::count        chunkSize_;     /**< The size of the first chunk in bytes */
+        Types::index        activeChunk_;   /**< The chunk from which the next request is served */
+        Types::count        offset_;        /**< The first free byte in the active chunk */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__ALLOCATORS__MONOTONIC_ARENA_HPP
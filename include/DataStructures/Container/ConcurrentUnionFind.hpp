@@ -0,0 +1,411 @@
+/*
+ * ConcurrentUnionFind.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__CONTAINER__CONCURRENT_UNION_FIND_HPP
+#define EGOA__CONTAINER__CONCURRENT_UNION_FIND_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Auxiliary.hpp"
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A lock-free union find that can be used by several threads at
+ *     the same time.
+ * @details    In contrast to UnionFind, the parent pointer and the rank of
+ *     each vertex are packed into one atomic word. A root is linked to
+ *     another root by a compare-and-swap of its word, which fails if another
+ *     thread linked it or changed its rank in the meantime. In this case,
+ *     the union is retried with the new roots.
+ *
+ *     The root with the smaller pair (rank, identifier) becomes a child of
+ *     the other root. If both ranks are equal, the rank of the new root is
+ *     increased by another compare-and-swap, which may fail if the root was
+ *     linked in the meantime. Since the rank of a vertex does not change
+ *     after it was linked and the rank of a root only grows, the pairs
+ *     strictly increase along each path and no cycle can be created by
+ *     concurrent links.
+ *
+ *     Find uses path halving, i.e., every other vertex on the path to the
+ *     root is set to its grandparent. The pointers are only shortened by a
+ *     compare-and-swap, so concurrent finds and unions never see a vertex
+ *     outside of its component.
+ *
+ *     For the enumeration of scenarios, the unions can be taken back. After
+ *     Checkpoint() is called, each link is written to an undo log and Find
+ *     does not shorten paths, since the shortened paths could not be
+ *     restored. Rollback() takes back the links up to a checkpoint. Note
+ *     that the undo log is not thread-safe, i.e., while it is recorded
+ *     only one thread may call Union and batched unions run sequentially.
+ *
+ * @code{.cpp}
+ *      ConcurrentUnionFind unionFind ( graph.NumberOfVertices() );
+ *      unionFind.Union ( edges );
+ *
+ *      Types::index checkpoint = unionFind.Checkpoint();
+ *      unionFind.Union ( u, v );
+ *      ...
+ *      unionFind.Rollback ( checkpoint );
+ * @endcode
+ *
+ * @see        UnionFind
+ */
+class ConcurrentUnionFind {
+    private:
+        using TWord = std::uint64_t;
+
+        /**
+         * @brief      A word before it was changed by a link.
+         */
+        struct UndoEntry {
+            Types::vertexId vertex;
+            TWord           word;
+        };
+
+        static constexpr unsigned NumberOfParentBits = 56;
+        static constexpr TWord    ParentMask         = ( TWord(1) << NumberOfParentBits ) - 1;
+
+    public:
+        ConcurrentUnionFind( Types::count numberOfVertices )
+        : words_( numberOfVertices )
+        , numberOfVertices_( numberOfVertices )
+        , numberOfComponents_( numberOfVertices )
+        , isLogging_( false )
+        , undoLog_()
+        {
+            USAGE_ASSERT ( numberOfVertices <= ParentMask );
+
+            // Every vertex has itself as parent
+            for ( Types::count counter = 0
+                ; counter < NumberOfVertices()
+                ; ++counter )
+            {
+                words_[counter].store ( WordOf ( counter, 0 ), std::memory_order_relaxed );
+            }
+        }
+
+        ///@name Find and union
+        ///@{
+#pragma mark FIND_AND_UNION
+            /**
+             * @brief      Find the root of the vertex.
+             * @details    Find the tree root of element @p vertex and return
+             *     the root's identifier. Every other vertex on the path is
+             *     set to its grandparent unless the undo log is recorded.
+             *
+             * @param[in]  vertex  The vertex identifier.
+             *
+             * @return     The root's identifier at some point during the call.
+             */
+            inline Types::vertexId Find ( Types::vertexId vertex )
+            {
+                USAGE_ASSERT ( vertex < NumberOfVertices() );
+
+                TWord word = Word ( vertex );
+                while ( ParentOf ( word ) != vertex )
+                {
+                    Types::vertexId parent      = ParentOf ( word );
+                    TWord           parentWord  = Word ( parent );
+                    Types::vertexId grandparent = ParentOf ( parentWord );
+
+                    if ( grandparent == parent ) return parent;
+
+                    if ( !IsLogging() )
+                    { // Path halving, a failed exchange means that another
+                      // thread has already shortened the path
+                        words_[vertex].compare_exchange_weak ( word
+                                                             , WordOf ( grandparent, RankOf ( word ) )
+                                                             , std::memory_order_relaxed );
+                    }
+                    vertex = grandparent;
+                    word   = Word ( vertex );
+                }
+                return vertex;
+            }
+
+            /**
+             * @brief      Merges the components of both vertices.
+             *
+             * @param[in]  u     The vertex u.
+             * @param[in]  v     The vertex v.
+             *
+             * @return     @p true if the components were merged by this call,
+             *     @p false if both vertices were already in the same component.
+             */
+            inline bool Union ( Types::vertexId u, Types::vertexId v )
+            {
+                while ( true )
+                {
+                    u = Find ( u );
+                    v = Find ( v );
+
+                    if ( u == v ) return false;
+
+                    TWord wordU = Word ( u );
+                    TWord wordV = Word ( v );
+                    // One of the roots was linked in the meantime
+                    if ( ParentOf ( wordU ) != u || ParentOf ( wordV ) != v ) continue;
+
+                    if ( std::make_pair ( RankOf ( wordU ), u ) > std::make_pair ( RankOf ( wordV ), v ) )
+                    {
+                        std::swap ( u, v );
+                        std::swap ( wordU, wordV );
+                    }
+
+                    // Link the root u below the root v if u is still a root
+                    // with the same rank
+                    if ( !words_[u].compare_exchange_strong ( wordU
+                                                            , WordOf ( v, RankOf ( wordU ) )
+                                                            , std::memory_order_acq_rel ) )
+                    {
+                        continue;
+                    }
+                    numberOfComponents_.fetch_sub ( 1, std::memory_order_relaxed );
+                    if ( IsLogging() ) undoLog_.push_back ( UndoEntry{ u, wordU } );
+
+                    if ( RankOf ( wordU ) == RankOf ( wordV )
+                        && words_[v].compare_exchange_strong ( wordV
+                                                             , WordOf ( v, RankOf ( wordV ) + 1 )
+                                                             , std::memory_order_acq_rel ) )
+                    {
+                        if ( IsLogging() ) undoLog_.push_back ( UndoEntry{ v, wordV } );
+                    }
+                    return true;
+                }
+            }
+
+            /**
+             * @brief      Are both vertices in the same component.
+             * @details    If the roots differ, the answer is only @p false if
+             *     the root of @p u was still a root after the root of @p v
+             *     was found. Otherwise, the search is repeated.
+             *
+             * @param[in]  u     The vertex u.
+             * @param[in]  v     The vertex v.
+             *
+             * @return     If they are in the same component.
+             */
+            inline bool InSameComponent ( Types::vertexId u, Types::vertexId v )
+            {
+                while ( true )
+                {
+                    u = Find ( u );
+                    v = Find ( v );
+
+                    if ( u == v )             return true;
+                    if ( Parent ( u ) == u )  return false;
+                }
+            }
+        ///@}
+
+        ///@name Batch operations
+        ///@{
+#pragma mark BATCH_OPERATIONS
+            /**
+             * @brief      Merges the components of the endpoints of all
+             *     edges.
+             * @details    The edges are processed in parallel if OpenMP is
+             *     available and the undo log is not recorded.
+             *
+             * @param[in]  edges      The edges as pairs of vertex
+             *     identifiers, e.g., a std::vector<std::pair<Types::vertexId,
+             *     Types::vertexId>>.
+             *
+             * @tparam     EdgeRange  A random access range of pairs.
+             *
+             * @return     The number of edges that merged two components.
+             */
+            template<typename EdgeRange>
+            inline Types::count Union ( EdgeRange const & edges )
+            {
+                Types::count numberOfMerges = 0;
+                Types::count const numberOfEdges = edges.size();
+
+                if ( IsLogging() )
+                {
+                    for ( Types::index index = 0; index < numberOfEdges; ++index )
+                    {
+                        numberOfMerges += Union ( edges[index].first, edges[index].second );
+                    }
+                    return numberOfMerges;
+                }
+
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( dynamic, 1024 ) reduction ( + : numberOfMerges )
+#endif // OPENMP_AVAILABLE
+                for ( Types::index index = 0; index < numberOfEdges; ++index )
+                {
+                    numberOfMerges += Union ( edges[index].first, edges[index].second );
+                }
+                return numberOfMerges;
+            }
+
+            /**
+             * @brief      Find the roots of all vertices.
+             * @details    The vertices are processed in parallel if OpenMP
+             *     is available.
+             *
+             * @param[in]  vertices     The vertex identifiers.
+             * @param      roots        The root of each vertex in the same
+             *     order as @p vertices.
+             *
+             * @tparam     VertexRange  A random access range of vertex
+             *     identifiers.
+             */
+            template<typename VertexRange>
+            inline void Find ( VertexRange const            & vertices
+                             , std::vector<Types::vertexId> & roots )
+            {
+                Types::count const numberOfVertices = vertices.size();
+                roots.resize ( numberOfVertices );
+
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+                for ( Types::index index = 0; index < numberOfVertices; ++index )
+                {
+                    roots[index] = Find ( vertices[index] );
+                }
+            }
+        ///@}
+
+        ///@name Undo log
+        ///@{
+#pragma mark UNDO_LOG
+            /**
+             * @brief      Starts to record the undo log if it is not recorded
+             *     yet and marks the current state.
+             *
+             * @return     The checkpoint that can be passed to Rollback().
+             */
+            inline Types::index Checkpoint()
+            {
+                isLogging_ = true;
+                return undoLog_.size();
+            }
+
+            /**
+             * @brief      Takes back all unions since the @p checkpoint.
+             * @details    The undo log remains recorded. The run time is
+             *     linear in the number of unions that are taken back.
+             *
+             * @param[in]  checkpoint  The checkpoint.
+             *
+             * @pre        The checkpoint was returned by Checkpoint() since
+             *     the last call of Commit(), and no thread calls Union.
+             */
+            inline void Rollback ( Types::index checkpoint )
+            {
+                USAGE_ASSERT ( IsLogging() );
+                USAGE_ASSERT ( checkpoint <= undoLog_.size() );
+
+                while ( undoLog_.size() > checkpoint )
+                {
+                    UndoEntry const & entry = undoLog_.back();
+                    if ( ParentOf ( entry.word ) == entry.vertex
+                        && ParentOf ( Word ( entry.vertex ) ) != entry.vertex )
+                    { // The entry takes back a link and not a rank increase
+                        numberOfComponents_.fetch_add ( 1, std::memory_order_relaxed );
+                    }
+                    words_[entry.vertex].store ( entry.word, std::memory_order_relaxed );
+                    undoLog_.pop_back();
+                }
+            }
+
+            /**
+             * @brief      Keeps all unions, clears the undo log, and stops to
+             *     record it.
+             */
+            inline void Commit()
+            {
+                undoLog_.clear();
+                isLogging_ = false;
+            }
+
+            /**
+             * @brief      Whether the undo log is recorded.
+             *
+             * @return     @p true if the unions are recorded, @p false
+             *     otherwise.
+             */
+            inline bool IsLogging() const
+            {
+                return isLogging_;
+            }
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+            inline Types::count NumberOfVertices() const
+            {
+                return numberOfVertices_;
+            }
+
+            /**
+             * @brief      The number of components.
+             *
+             * @return     The number of components, which is exact if no
+             *     union is running.
+             */
+            inline Types::count NumberOfComponents() const
+            {
+                return numberOfComponents_.load ( std::memory_order_relaxed );
+            }
+
+            inline Types::vertexId Parent ( Types::vertexId vertex ) const
+            {
+                USAGE_ASSERT ( vertex < numberOfVertices_ );
+                return ParentOf ( Word ( vertex ) );
+            }
+
+            inline Types::count Rank ( Types::vertexId vertex ) const
+            {
+                USAGE_ASSERT ( vertex < numberOfVertices_ );
+                return RankOf ( Word ( vertex ) );
+            }
+        ///@}
+
+    private:
+#pragma mark PACKED_WORDS
+        inline TWord Word ( Types::vertexId vertex ) const
+        {
+            return words_[vertex].load ( std::memory_order_acquire );
+        }
+
+        static inline TWord WordOf ( Types::vertexId parent, Types::count rank )
+        {
+            return ( TWord(rank) << NumberOfParentBits ) | parent;
+        }
+
+        static inline Types::vertexId ParentOf ( TWord word )
+        {
+            return word & ParentMask;
+        }
+
+        static inline Types::count RankOf ( TWord word )
+        {
+            return word >> NumberOfParentBits;
+        }
+
+#pragma mark MEMBERS
+    private:
+        std::vector<std::atomic<TWord>> words_;                 /**< Parent pointer and rank per vertex */
+        Types::count                    numberOfVertices_;      /**< Number of vertices */
+        std::atomic<Types::count>       numberOfComponents_;    /**< Number of components */
+        bool                            isLogging_;             /**< Whether the undo log is recorded */
+        std::vector<UndoEntry>          undoLog_;               /**< The words before they were changed by a union */
+};
+
+} // namespace egoa
+
+#endif // EGOA__CONTAINER__CONCURRENT_UNION_FIND_HPP
@@ -0,0 +1,215 @@
+/*
+ * DenseIndexMap.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__DENSE_INDEX_MAP_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__DENSE_INDEX_MAP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A map from dense integer keys, e.g., vertex and edge
+ *     identifiers, to values that is stored in a vector.
+ * @details    The map supports the operations of @p std::unordered_map that
+ *     are needed by MappingBinaryHeap without hashing, i.e., each access is
+ *     a single vector lookup. Each entry carries the generation in which it
+ *     was written. Thus, #clear only starts a new generation in
+ *     @f$\Theta(1)@f$, which invalidates all entries at once and keeps the
+ *     memory for the next round, e.g., for the next source of
+ *     DominatingThetaPath.
+ *
+ *     Operation                                              | Effect
+ *     -------------------------------------------------------|----------------------------------------------------------
+ *     @code{.cpp} map[key] = value;                 @endcode | @p map maps @p key to @p value.
+ *     @code{.cpp} Value value = map.at(key);        @endcode | @p value is set to the value of @p key.
+ *     @code{.cpp} map.count(key);                   @endcode | 1 if @p map contains @p key, 0 otherwise.
+ *     @code{.cpp} map.erase(key);                   @endcode | The mapping for @p key is removed from @p map.
+ *     @code{.cpp} map.clear();                      @endcode | @p map does not contain any keys.
+ *
+ *     The memory is proportional to the largest key that was inserted.
+ *
+ * @tparam     KeyType    The type of the keys, which has to be an unsigned
+ *     integral type such as Types::vertexId.
+ * @tparam     ValueType  The type of the values, which has to be default
+ *     constructible.
+ *
+ * @see        MappingBinaryHeap
+ */
+template< typename KeyType
+        , typename ValueType = Types::index >
+class DenseIndexMap {
+    static_assert ( std::is_integral<KeyType>::value && std::is_unsigned<KeyType>::value
+                  , "The keys of a DenseIndexMap have to be identifiers." );
+
+    public:
+        // Type aliasing
+        using key_type      = KeyType;
+        using mapped_type   = ValueType;
+        using size_type     = Types::count;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs an empty map.
+             *
+             * @param[in]  capacity  The number of keys for which memory is
+             *     reserved, e.g., the number of vertices.
+             */
+            explicit DenseIndexMap ( Types::count capacity = 0 )
+            : values_( capacity )
+            , generations_( capacity, 0 )
+            , generation_( 1 )
+            , size_( 0 )
+            {}
+        ///@}
+
+        ///@name Element Access
+        ///@{
+#pragma mark ELEMENT_ACCESS
+
+            /**
+             * @brief      Access the value of a key, which is inserted with a
+             *     default constructed value if it does not exist.
+             *
+             * @param[in]  key   The key.
+             *
+             * @return     The value of the key.
+             */
+            inline ValueType & operator[] ( KeyType key )
+            {
+                if ( key >= generations_.size() )
+                {
+                    values_.resize ( key + 1 );
+                    generations_.resize ( key + 1, 0 );
+                }
+                if ( generations_[key] != generation_ )
+                {
+                    generations_[key] = generation_;
+                    values_[key]      = ValueType();
+                    ++size_;
+                }
+                return values_[key];
+            }
+
+            /**
+             * @brief      The value of a key.
+             *
+             * @param[in]  key   The key.
+             *
+             * @return     The value of the key.
+             *
+             * @throws     std::out_of_range if the map does not contain the key.
+             */
+            inline ValueType const & at ( KeyType key ) const
+            {
+                if ( !Contains ( key ) )
+                {
+                    throw std::out_of_range ( "DenseIndexMap::at: The key does not exist." );
+                }
+                return values_[key];
+            }
+
+            /**
+             * @copydoc    at(KeyType) const
+             */
+            inline ValueType & at ( KeyType key )
+            {
+                if ( !Contains ( key ) )
+                {
+                    throw std::out_of_range ( "DenseIndexMap::at: The key does not exist." );
+                }
+                return values_[key];
+            }
+
+            /**
+             * @brief      The number of entries of a key.
+             *
+             * @param[in]  key   The key.
+             *
+             * @return     1 if the map contains the key, 0 otherwise.
+             */
+            inline size_type count ( KeyType key ) const
+            {
+                return Contains ( key ) ? 1 : 0;
+            }
+        ///@}
+
+        ///@name Modifiers
+        ///@{
+#pragma mark MODIFIERS
+
+            /**
+             * @brief      Removes a key.
+             *
+             * @param[in]  key   The key.
+             *
+             * @return     The number of removed keys, i.e., 1 if the map
+             *     contained the key, 0 otherwise.
+             */
+            inline size_type erase ( KeyType key )
+            {
+                if ( !Contains ( key ) ) return 0;
+                generations_[key] = 0;
+                --size_;
+                return 1;
+            }
+
+            /**
+             * @brief      Removes all keys.
+             * @details    A new generation is started in @f$\Theta(1)@f$.
+             *     Only if the generation counter overflows, all entries are
+             *     reset.
+             */
+            inline void clear ()
+            {
+                ++generation_;
+                if ( generation_ == 0 )
+                {
+                    std::fill ( generations_.begin(), generations_.end(), 0 );
+                    generation_ = 1;
+                }
+                size_ = 0;
+            }
+        ///@}
+
+        ///@name Capacity
+        ///@{
+#pragma mark CAPACITY
+
+            inline bool      empty () const { return size_ == 0; }
+            inline size_type size  () const { return size_; }
+        ///@}
+
+    private:
+        inline bool Contains ( KeyType key ) const
+        {
+            return key < generations_.size()
+                && generations_[key] == generation_;
+        }
+
+#pragma mark MEMBERS
+        std::vector<ValueType>      values_;        /**< The values indexed by the keys. */
+        std::vector<std::uint32_t>  generations_;   /**< The generation in which each value was written, where 0 means erased. */
+        std::uint32_t               generation_;    /**< The current generation. */
+        Types::count                size_;          /**< The number of keys in the map. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__DENSE_INDEX_MAP_HPP
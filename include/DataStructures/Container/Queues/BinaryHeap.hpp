@@ -16,6 +16,7 @@
 
 #include <iomanip>
 #include <iterator>
+#include <memory>
 
 namespace egoa {
 
@@ -36,11 +37,11 @@ namespace internal {
  *      }
  * @endcode
  *
- * @tparam     Type     Type of the elements contained by the heap.
+ * @tparam     HeapType The type of the heap.
  * @tparam     inOrder  TRUE checks if identical (order-wise), FALSE checks
  *     for same elements.
  */
-template<typename Type, bool inOrder>
+template<typename HeapType, bool inOrder>
 class BinaryHeapCheck;
 
 /**
@@ -89,15 +90,21 @@ class BinaryHeapLoopDifferentiation;
  * @endcode
  *
  * @tparam     ElementType  Type of the elements contained by the heap.
+ * @tparam     Allocator    The allocator of the underlying vector, e.g.,
+ *     ArenaAllocator.
  */
-template<typename ElementType>
+template<typename ElementType, typename Allocator = std::allocator<ElementType>>
 class BinaryHeap {
     public:
         // Type aliasing
         /**
          * @brief      The type of the elements in the heap.
          */
-        using TElement  = ElementType;
+        using TElement   = ElementType;
+        /**
+         * @brief      The type of the vector that stores the heap.
+         */
+        using TContainer = std::vector<TElement, Allocator>;
 
         /// @name Constructors and Destructor
         /// @{
@@ -273,7 +280,7 @@ class BinaryHeap {
              */
             inline void BuildWith ( std::vector<TElement> const & elements )
             {
-                heap_ = elements;
+                heap_.assign ( elements.begin(), elements.end() );
                 MakeHeapProperty();
             }
         /// @}
@@ -502,7 +509,7 @@ class BinaryHeap {
             template<bool IsIdentical>
             inline bool IsEqualTo( BinaryHeap const & rhs ) const
             {
-                return internal::BinaryHeapCheck<TElement, IsIdentical>
+                return internal::BinaryHeapCheck<BinaryHeap, IsIdentical>
                     ::IsEqualTo(*this, rhs);
             }
 
@@ -512,7 +519,7 @@ class BinaryHeap {
              * @param      lhs   The left hand side BinaryHeaps
              * @param      rhs   The right hand side BinaryHeaps
              */
-            friend void swap ( BinaryHeap<TElement> & lhs, BinaryHeap<TElement> & rhs )
+            friend void swap ( BinaryHeap & lhs, BinaryHeap & rhs )
             { // Necessary for the copy and swap idiom
                 using std::swap; // enable ADL
                 swap( lhs.heap_,                    rhs.heap_ );
@@ -552,7 +559,7 @@ class BinaryHeap {
                 Types::largeNumber counter_;            /**< Counter */
                 Types::largeNumber begin_;              /**< Begin */
                 Types::largeNumber end_;                /**< End */
-                std::vector<TElement> const * vector_;  /**< Vector of elements */
+                TContainer const * vector_;             /**< Vector of elements */
             public:
                 using iterator_category = std::forward_iterator_tag;/**< Iterator category type */
                 using value_type        = TElement;                 /**< Value type */
@@ -560,14 +567,14 @@ class BinaryHeap {
                 using pointer           = const TElement*;          /**< Element pointer type */
                 using reference         = const TElement&;          /**< Element reference type */
 
-                explicit HeapIterator ( std::vector<TElement> const * vector
+                explicit HeapIterator ( TContainer const * vector
                                       , Types::largeNumber counter = 0      )
                 : counter_( counter )
                 , begin_( 0 )
                 , end_( vector->size() - 1 )
                 , vector_(vector){ }
 
-                explicit HeapIterator ( std::vector<TElement> const * vector
+                explicit HeapIterator ( TContainer const *            vector
                                       , Types::largeNumber            counter
                                       , Types::largeNumber            begin
                                       , Types::largeNumber            end )
@@ -899,8 +906,8 @@ class BinaryHeap {
         /// @}
 
 #pragma mark FRIENDS
-        friend internal::BinaryHeapCheck<TElement, true>;
-        friend internal::BinaryHeapCheck<TElement, false>;
+        friend internal::BinaryHeapCheck<BinaryHeap, true>;
+        friend internal::BinaryHeapCheck<BinaryHeap, false>;
         friend internal::BinaryHeapLoopDifferentiation<BinaryHeap, ExecutionPolicy::sequential>;
         friend internal::BinaryHeapLoopDifferentiation<BinaryHeap, ExecutionPolicy::breakable>;
         friend internal::BinaryHeapLoopDifferentiation<BinaryHeap, ExecutionPolicy::parallel>;
@@ -910,18 +917,18 @@ class BinaryHeap {
 
 #pragma mark MEMBERS
     private:
-        std::vector<TElement> heap_;
+        TContainer heap_;
         std::function<bool(TElement const & a, TElement const & b)> comparator_;
 };
 
 namespace internal {
 #pragma mark HEAPS_ARE_IDENTICAL_CHECK
-template<typename Type>
-class BinaryHeapCheck<Type, true> {
+template<typename HeapType>
+class BinaryHeapCheck<HeapType, true> {
 
     // Type aliasing
-    using TElement = Type;
-    using THeap    = BinaryHeap<TElement>;
+    using THeap    = HeapType;
+    using TElement = typename THeap::TElement;
 
     public:
         /**
@@ -946,12 +953,12 @@ class BinaryHeapCheck<Type, true> {
 };
 
 #pragma mark HEAPS_HAVE_SAME_ELEMENTS_CHECK
-template<typename Type>
-class BinaryHeapCheck<Type, false> {
+template<typename HeapType>
+class BinaryHeapCheck<HeapType, false> {
 
     // Template aliasing
-    using TElement = Type;
-    using THeap    = BinaryHeap<TElement>;
+    using THeap    = HeapType;
+    using TElement = typename THeap::TElement;
 
     public:
         /**
@@ -60,14 +60,18 @@ class BucketLoopDifferentiation;
  *     IsEqualTo                     |
  *     swap                          | Swap two heaps.
  *     operator<<                    | Writes the heap into an output stream.
+ *
+ * @tparam     Allocator      The allocator of the processed elements, e.g.,
+ *     ArenaAllocator.
  */
-template< typename PriorityQueue = BinaryHeap<VoltageAngleDifferenceLabel<Edges::Edge<Edges::ElectricalProperties> > > >
+template< typename PriorityQueue = BinaryHeap<VoltageAngleDifferenceLabel<Edges::Edge<Edges::ElectricalProperties> > >
+        , typename Allocator     = std::allocator<typename PriorityQueue::TElement> >
 class Bucket {
     public:
         // Type aliasing
         using TPriorityQueue = PriorityQueue;
         using TElement       = typename TPriorityQueue::TElement;
-        using TBucket        = Bucket< TPriorityQueue >;
+        using TBucket        = Bucket< TPriorityQueue, Allocator >;
         using TIterator      = std::iterator< std::input_iterator_tag
                                             , TElement
                                             , Types::largeNumber
@@ -662,7 +666,7 @@ class Bucket {
              *     using OpenMP, @p false otherwise.
              * @tparam     FUNCTION    The function pointer.
              */
-            template<ExecutionPolicy Policy, typename FUNCTION>
+            template<ExecutionPolicy Policy = ExecutionPolicy::sequential, typename FUNCTION>
             inline
             Types::real for_all_optima ( FUNCTION function )
             {
@@ -688,7 +692,7 @@ class Bucket {
              *     using OpenMP, @p false otherwise.
              * @tparam     FUNCTION    The function pointer.
              */
-            template<ExecutionPolicy Policy, typename FUNCTION>
+            template<ExecutionPolicy Policy = ExecutionPolicy::sequential, typename FUNCTION>
             inline
             Types::real for_all_optima ( FUNCTION function ) const
             {
@@ -801,7 +805,7 @@ class Bucket {
         friend internal::BucketLoopDifferentiation<Bucket const, ExecutionPolicy::parallel>;
 
 #pragma mark MEMBERS
-        std::vector<TElement>                     processedElements_;   /**< The processed elements that do not change their status and stay valid */
+        std::vector<TElement, Allocator>          processedElements_;   /**< The processed elements that do not change their status and stay valid */
         TPriorityQueue                          unprocessedElements_;   /**< The unprocessed elements that might change their status, e.g., to invalid */
         Types::count               numberOfValidUnprocessedElements_;   /**< The number of valid unprocessed elements. */
 };
@@ -12,9 +12,12 @@
 #include "Auxiliary/ContainerLoop.hpp"
 #include "Auxiliary/ExecutionPolicy.hpp"
 
+#include "DataStructures/Container/DenseIndexMap.hpp"
+
 #include "Exceptions/Assertions.hpp"
 
 #include <functional>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -41,6 +44,7 @@ namespace egoa {
  *             -------------------------------------------------------|----------------------------------------------------------
  *             @code{.cpp} map[element] = i;                 @endcode | @p map maps @p element to @p i.
  *             @code{.cpp} Types::index i = map.at(element); @endcode | @p i is set to the index of the element stored in the map.
+ *             @code{.cpp} map.count(element);               @endcode | 1 if @p map contains @p element, 0 otherwise.
  *             @code{.cpp} map.erase(element);               @endcode | The mapping for @p element is removed from @p map.
  *             @code{.cpp} map.clear();                      @endcode | @p map does not contain any elements.
  *             The methods have the following worst case time complexities:
@@ -62,13 +66,20 @@ namespace egoa {
  * @tparam     ElementType  The type of the elements
  * @tparam     KeyType      The type of the keys
  * @tparam     MapType      A mapping from elements to indices.
- *                          The default is <tt>std::unordered_map\<KeyType, Types::index\></tt>.
- *                          To use the default @p KeyType must satisfy all
+ *                          If the elements are identifiers, i.e., of an unsigned
+ *                          integral type such as Types::vertexId, the default is
+ *                          <tt>DenseIndexMap\<ElementType\></tt>, which avoids
+ *                          hashing. Otherwise, the default is
+ *                          <tt>std::unordered_map\<ElementType, Types::index\></tt>,
+ *                          and @p ElementType must satisfy all
  *                          requirements to be used as the key of a @p std::unordered_map.
  */
 template<typename ElementType,
          typename KeyType,
-         typename MapType = std::unordered_map<ElementType, Types::index>>
+         typename MapType = std::conditional_t< std::is_integral<ElementType>::value
+                                              && std::is_unsigned<ElementType>::value
+                                              , DenseIndexMap<ElementType>
+                                              , std::unordered_map<ElementType, Types::index> >>
 class MappingBinaryHeap {
 public:
     /**
@@ -207,7 +218,7 @@ public:
          * @return     @p True if the element exists, @p False otherwise.
          */
         bool HasKeyOf(TElement const & element) const {
-            return map_.find(element) != map_.end();
+            return map_.count(element) > 0;
         }
     /// @}
 
@@ -0,0 +1,472 @@
+/*
+ * MappingDaryHeap.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__MAPPING_DARY_HEAP_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__MAPPING_DARY_HEAP_HPP
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/ContainerLoop.hpp"
+#include "Auxiliary/ExecutionPolicy.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      Class for a @f$d@f$-ary heap, in which elements are sorted by
+ *     keys and the position of an element is stored in a vector.
+ * @details    The heap has the same interface as MappingBinaryHeap and can
+ *     be used as @p QueueType of DominatingThetaPath and Prim. In contrast
+ *     to MappingBinaryHeap,
+ *       - the elements are identifiers, e.g., vertex identifiers, that index
+ *         a vector of positions instead of a @p std::unordered_map,
+ *       - the comparator is a template parameter, i.e., calls to it are
+ *         resolved at compile time and can be inlined, and
+ *       - each node has @p Arity children, which makes the heap shallower
+ *         and the sift-down more cache friendly at the cost of more
+ *         comparisons per level.
+ *
+ *     The methods have the following worst case time complexities:
+ *     Function                      | Time Complexity
+ *     ------------------------------|---------------------
+ *     Top, KeyOf, HasKeyOf          | @f$\Theta(1)@f$
+ *     Insert, Emplace               | @f$\Theta(\log_d n)@f$
+ *     DeleteTop, Pop, Delete        | @f$\Theta(d \log_d n)@f$
+ *     ChangeKey                     | @f$\Theta(d \log_d n)@f$, and @f$\Theta(\log_d n)@f$ for decreasing keys
+ *     Clear                         | @f$\Theta(n)@f$
+ *
+ *     The memory for the positions is proportional to the largest element
+ *     that was inserted.
+ *
+ * @code{.cpp}
+ *      using TQueue = MappingDaryHeap< Types::vertexId, TLabel >;
+ *      DominatingThetaPath< TGraph, TLabel, TQueue > dtp ( graph );
+ * @endcode
+ *
+ * @tparam     ElementType     The type of the elements, which has to be an
+ *     unsigned integral type such as Types::vertexId.
+ * @tparam     KeyType         The type of the keys.
+ * @tparam     Arity           The number of children @f$d \geq 2@f$ of a node.
+ * @tparam     ComparatorType  The comparator implementing a strict order on
+ *     the keys, e.g., @p std::less<KeyType>. The smallest key is at the top.
+ *
+ * @see        MappingBinaryHeap
+ */
+template< typename ElementType
+        , typename KeyType
+        , Types::count Arity        = 4
+        , typename ComparatorType   = std::less<KeyType> >
+class MappingDaryHeap {
+    static_assert ( std::is_integral<ElementType>::value && std::is_unsigned<ElementType>::value
+                  , "The elements of a MappingDaryHeap have to be identifiers." );
+    static_assert ( Arity >= 2, "A MappingDaryHeap needs at least two children per node." );
+
+    public:
+        // Type aliasing
+        using TElement      = ElementType;
+        using TKey          = KeyType;
+        using TComparator   = ComparatorType;
+        using TIterator     = typename std::vector<std::pair<TElement, TKey>>::const_iterator;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs an empty heap.
+             *
+             * @param[in]  comparator  The comparator.
+             */
+            MappingDaryHeap ( TComparator comparator = TComparator() )
+            : elementKeyPairs_()
+            , positions_()
+            , comparator_( std::move(comparator) )
+            {}
+        ///@}
+
+        ///@name Element Access
+        ///@{
+#pragma mark ELEMENT_ACCESS
+
+            /**
+             * @brief      The element and the key at the top of the heap.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The pair of the top element and its key.
+             */
+            inline std::pair<TElement, TKey> const & Top () const
+            {
+                USAGE_ASSERT ( !Empty() );
+                return elementKeyPairs_.front();
+            }
+
+            /**
+             * @brief      The element at the top of the heap.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The top element.
+             */
+            inline TElement const & TopElement () const
+            {
+                USAGE_ASSERT ( !Empty() );
+                return elementKeyPairs_.front().first;
+            }
+
+            /**
+             * @brief      The key of the element at the top of the heap.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The key of the top element.
+             */
+            inline TKey const & TopKey () const
+            {
+                USAGE_ASSERT ( !Empty() );
+                return elementKeyPairs_.front().second;
+            }
+
+            /**
+             * @brief      The key of an element.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     The key of the element.
+             */
+            inline TKey const & KeyOf ( TElement element ) const
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+                return KeyAt ( positions_[element] );
+            }
+
+            /**
+             * @brief      Determines if the element is in the heap.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     @p true if the element is in the heap, @p false
+             *     otherwise.
+             */
+            inline bool HasKeyOf ( TElement element ) const
+            {
+                return element < positions_.size()
+                    && positions_[element] != Const::NONE;
+            }
+        ///@}
+
+        ///@name Add Elements
+        ///@{
+#pragma mark ADD_ELEMENTS
+
+            /**
+             * @brief      Inserts an element with a key.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  element  The element.
+             * @param[in]  key      The key.
+             */
+            inline void Insert ( TElement element, TKey key )
+            {
+                Emplace ( element, std::move(key) );
+            }
+
+            /**
+             * @brief      Inserts an element-key-pair.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  pair  The element and the key.
+             */
+            inline void Insert ( std::pair<TElement, TKey> pair )
+            {
+                Emplace ( pair.first, std::move(pair.second) );
+            }
+
+            /**
+             * @brief      Constructs the key of an element in place.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  element  The element.
+             * @param      args     The arguments of the constructor of the key.
+             *
+             * @tparam     Args     The types of the arguments.
+             */
+            template<typename... Args>
+            inline void Emplace ( TElement element, Args && ... args )
+            {
+                USAGE_ASSERT ( !HasKeyOf ( element ) );
+
+                if ( element >= positions_.size() )
+                {
+                    positions_.resize ( element + 1, Const::NONE );
+                }
+                elementKeyPairs_.emplace_back ( std::piecewise_construct
+                                              , std::forward_as_tuple ( element )
+                                              , std::forward_as_tuple ( std::forward<Args>(args)... ) );
+                positions_[element] = elementKeyPairs_.size() - 1;
+                SiftUp ( elementKeyPairs_.size() - 1 );
+            }
+        ///@}
+
+        ///@name Remove Elements
+        ///@{
+#pragma mark REMOVE_ELEMENTS
+
+            /**
+             * @brief      Deletes the top element and returns it with its key.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The former top element and its key.
+             */
+            inline std::pair<TElement, TKey> DeleteTop ()
+            {
+                USAGE_ASSERT ( !Empty() );
+                return DeleteAt ( 0 );
+            }
+
+            /**
+             * @brief      Deletes the top element.
+             *
+             * @pre        The heap is not empty.
+             */
+            inline void Pop ()
+            {
+                USAGE_ASSERT ( !Empty() );
+                DeleteAt ( 0 );
+            }
+
+            /**
+             * @brief      Deletes an element from the heap.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     The deleted element and its key.
+             */
+            inline std::pair<TElement, TKey> Delete ( TElement element )
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+                return DeleteAt ( positions_[element] );
+            }
+
+            /**
+             * @brief      Removes all elements from the heap.
+             * @details    Only the positions of the elements in the heap are
+             *     reset, i.e., the vector of positions keeps its size.
+             */
+            inline void Clear ()
+            {
+                for ( auto const & pair : elementKeyPairs_ )
+                {
+                    positions_[pair.first] = Const::NONE;
+                }
+                elementKeyPairs_.clear();
+            }
+        ///@}
+
+        ///@name Update Elements
+        ///@{
+#pragma mark UPDATE_ELEMENTS
+
+            /**
+             * @brief      Changes the key of an element.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             * @param[in]  newKey   The new key.
+             */
+            inline void ChangeKey ( TElement element, TKey newKey )
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+
+                Types::index const index = positions_[element];
+                bool const isDecrease    = comparator_ ( newKey, KeyAt ( index ) );
+                KeyAt ( index )          = std::move(newKey);
+                if ( isDecrease )
+                {
+                    SiftUp ( index );
+                } else {
+                    SiftDown ( index );
+                }
+            }
+        ///@}
+
+        ///@name Capacity
+        ///@{
+#pragma mark CAPACITY
+
+            /**
+             * @brief      Whether the heap is empty.
+             *
+             * @return     @p true if the heap is empty, @p false otherwise.
+             */
+            inline bool Empty () const
+            {
+                return elementKeyPairs_.empty();
+            }
+
+            /**
+             * @brief      The number of elements in the heap.
+             *
+             * @return     The number of elements.
+             */
+            inline Types::count Size () const
+            {
+                return elementKeyPairs_.size();
+            }
+        ///@}
+
+        ///@name Iteration
+        ///@{
+#pragma mark ITERATION
+
+            inline TIterator begin () const { return elementKeyPairs_.cbegin(); }
+            inline TIterator end   () const { return elementKeyPairs_.cend();   }
+
+            /**
+             * @brief      Iterates over all element-key-pairs in the heap.
+             *
+             * @param[in]  function  The function object, e.g.,
+             * @code{.cpp}
+             *      []( std::pair<TElement, TKey> const & pair ) { ... }
+             * @endcode
+             *
+             * @tparam     Policy    The execution policy.
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<ExecutionPolicy Policy, typename FUNCTION>
+            inline void for_all_elements ( FUNCTION function ) const
+            {
+                internal::ContainerLoop<Policy>::for_each ( elementKeyPairs_, function );
+            }
+        ///@}
+
+    private:
+#pragma mark ACCESSORS
+        inline TKey       & KeyAt ( Types::index index )       { ESSENTIAL_ASSERT ( index < Size() ); return elementKeyPairs_[index].second; }
+        inline TKey const & KeyAt ( Types::index index ) const { ESSENTIAL_ASSERT ( index < Size() ); return elementKeyPairs_[index].second; }
+
+        inline Types::index FirstChildOf ( Types::index index ) const { return Arity * index + 1; }
+        inline Types::index ParentOf     ( Types::index index ) const { return ( index - 1 ) / Arity; }
+
+#pragma mark SIFTS
+        /**
+         * @brief      Moves the element at @p index to the root until its
+         *     parent is not larger.
+         * @details    The element is moved into the hole only once, instead
+         *     of swapping it on each level.
+         *
+         * @param[in]  index  The index.
+         */
+        inline void SiftUp ( Types::index index )
+        {
+            std::pair<TElement, TKey> pair = std::move ( elementKeyPairs_[index] );
+            while ( index > 0 )
+            {
+                Types::index const parent = ParentOf ( index );
+                if ( !comparator_ ( pair.second, KeyAt ( parent ) ) ) break;
+                MoveTo ( parent, index );
+                index = parent;
+            }
+            Place ( std::move(pair), index );
+        }
+
+        /**
+         * @brief      Moves the element at @p index to the leaves until no
+         *     child is smaller.
+         *
+         * @param[in]  index  The index.
+         */
+        inline void SiftDown ( Types::index index )
+        {
+            std::pair<TElement, TKey> pair = std::move ( elementKeyPairs_[index] );
+            Types::count const size = Size();
+            while ( true )
+            {
+                Types::index const first = FirstChildOf ( index );
+                if ( first >= size ) break;
+
+                Types::index const last  = std::min ( first + Arity, size );
+                Types::index       child = first;
+                for ( Types::index other = first + 1; other < last; ++other )
+                {
+                    if ( comparator_ ( KeyAt ( other ), KeyAt ( child ) ) ) child = other;
+                }
+                if ( !comparator_ ( KeyAt ( child ), pair.second ) ) break;
+                MoveTo ( child, index );
+                index = child;
+            }
+            Place ( std::move(pair), index );
+        }
+
+        inline void MoveTo ( Types::index from, Types::index to )
+        {
+            elementKeyPairs_[to]                    = std::move ( elementKeyPairs_[from] );
+            positions_[elementKeyPairs_[to].first]  = to;
+        }
+
+        inline void Place ( std::pair<TElement, TKey> && pair, Types::index index )
+        {
+            positions_[pair.first]  = index;
+            elementKeyPairs_[index] = std::move(pair);
+        }
+
+        /**
+         * @brief      Removes the element at @p index by moving the last
+         *     element into its place.
+         *
+         * @param[in]  index  The index.
+         *
+         * @return     The removed element and its key.
+         */
+        inline std::pair<TElement, TKey> DeleteAt ( Types::index index )
+        {
+            std::pair<TElement, TKey> deleted = std::move ( elementKeyPairs_[index] );
+            positions_[deleted.first] = Const::NONE;
+
+            if ( index + 1 < Size() )
+            {
+                Place ( std::move ( elementKeyPairs_.back() ), index );
+                elementKeyPairs_.pop_back();
+                if ( index > 0 && comparator_ ( KeyAt ( index ), KeyAt ( ParentOf ( index ) ) ) )
+                {
+                    SiftUp ( index );
+                } else {
+                    SiftDown ( index );
+                }
+            } else {
+                elementKeyPairs_.pop_back();
+            }
+            return deleted;
+        }
+
+#pragma mark MEMBERS
+        std::vector<std::pair<TElement, TKey>>  elementKeyPairs_;   /**< The element-key-pairs satisfying the heap property. */
+        std::vector<Types::index>               positions_;         /**< The index of each element in elementKeyPairs_, or Const::NONE. */
+        TComparator                             comparator_;        /**< The comparator of the keys. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__MAPPING_DARY_HEAP_HPP
@@ -0,0 +1,467 @@
+/*
+ * PairingHeap.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__PAIRING_HEAP_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__PAIRING_HEAP_HPP
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      Class for a pairing heap, in which elements are sorted by keys.
+ * @details    A pairing heap is a heap-ordered tree, in which each node
+ *     keeps its children in a list. Inserting an element and decreasing its
+ *     key only link two trees, which is a single comparison. The tree is
+ *     restructured lazily by #DeleteTop that merges the children of the root
+ *     pairwise. Thus, the heap suits algorithms that decrease keys much more
+ *     often than they delete the top element, e.g., DominatingThetaPath on
+ *     dense grids.
+ *
+ *     The heap has the interface of MappingBinaryHeap that is used as @p
+ *     QueueType of DominatingThetaPath and Prim. The elements are
+ *     identifiers that index a vector of nodes, and the comparator is a
+ *     template parameter, i.e., calls to it are resolved at compile time.
+ *
+ *     The methods have the following amortized time complexities:
+ *     Function                      | Time Complexity
+ *     ------------------------------|---------------------
+ *     TopElement, TopKey, KeyOf     | @f$\Theta(1)@f$
+ *     Insert, Emplace               | @f$\Theta(1)@f$
+ *     ChangeKey (decreasing)        | @f$O(\log n)@f$, in practice almost constant
+ *     ChangeKey (increasing)        | @f$O(\log n)@f$
+ *     DeleteTop, Pop, Delete        | @f$O(\log n)@f$
+ *     Clear                         | @f$\Theta(n)@f$
+ *
+ * @code{.cpp}
+ *      using TQueue = PairingHeap< Types::vertexId, TLabel >;
+ *      DominatingThetaPath< TGraph, TLabel, TQueue > dtp ( graph );
+ * @endcode
+ *
+ * @tparam     ElementType     The type of the elements, which has to be an
+ *     unsigned integral type such as Types::vertexId.
+ * @tparam     KeyType         The type of the keys, which has to be default
+ *     constructible.
+ * @tparam     ComparatorType  The comparator implementing a strict order on
+ *     the keys, e.g., @p std::less<KeyType>. The smallest key is at the top.
+ *
+ * @see        MappingBinaryHeap
+ * @see        MappingDaryHeap
+ */
+template< typename ElementType
+        , typename KeyType
+        , typename ComparatorType = std::less<KeyType> >
+class PairingHeap {
+    static_assert ( std::is_integral<ElementType>::value && std::is_unsigned<ElementType>::value
+                  , "The elements of a PairingHeap have to be identifiers." );
+
+    public:
+        // Type aliasing
+        using TElement      = ElementType;
+        using TKey          = KeyType;
+        using TComparator   = ComparatorType;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs an empty heap.
+             *
+             * @param[in]  comparator  The comparator.
+             */
+            PairingHeap ( TComparator comparator = TComparator() )
+            : nodes_()
+            , root_( Const::NONE )
+            , size_( 0 )
+            , stack_()
+            , comparator_( std::move(comparator) )
+            {}
+        ///@}
+
+        ///@name Element Access
+        ///@{
+#pragma mark ELEMENT_ACCESS
+
+            /**
+             * @brief      The element at the top of the heap.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The top element.
+             */
+            inline TElement TopElement () const
+            {
+                USAGE_ASSERT ( !Empty() );
+                return static_cast<TElement>( root_ );
+            }
+
+            /**
+             * @brief      The key of the element at the top of the heap.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The key of the top element.
+             */
+            inline TKey const & TopKey () const
+            {
+                USAGE_ASSERT ( !Empty() );
+                return nodes_[root_].key;
+            }
+
+            /**
+             * @brief      The key of an element.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     The key of the element.
+             */
+            inline TKey const & KeyOf ( TElement element ) const
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+                return nodes_[element].key;
+            }
+
+            /**
+             * @brief      Determines if the element is in the heap.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     @p true if the element is in the heap, @p false
+             *     otherwise.
+             */
+            inline bool HasKeyOf ( TElement element ) const
+            {
+                return element < nodes_.size()
+                    && nodes_[element].isInHeap;
+            }
+        ///@}
+
+        ///@name Add Elements
+        ///@{
+#pragma mark ADD_ELEMENTS
+
+            /**
+             * @brief      Inserts an element with a key.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  element  The element.
+             * @param[in]  key      The key.
+             */
+            inline void Insert ( TElement element, TKey key )
+            {
+                USAGE_ASSERT ( !HasKeyOf ( element ) );
+
+                if ( element >= nodes_.size() )
+                {
+                    nodes_.resize ( element + 1 );
+                }
+                Node & node     = nodes_[element];
+                node.key        = std::move(key);
+                node.child      = Const::NONE;
+                node.sibling    = Const::NONE;
+                node.previous   = Const::NONE;
+                node.isInHeap   = true;
+
+                root_ = Link ( root_, element );
+                ++size_;
+            }
+
+            /**
+             * @brief      Inserts an element-key-pair.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  pair  The element and the key.
+             */
+            inline void Insert ( std::pair<TElement, TKey> pair )
+            {
+                Insert ( pair.first, std::move(pair.second) );
+            }
+
+            /**
+             * @brief      Constructs the key of an element.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  element  The element.
+             * @param      args     The arguments of the constructor of the key.
+             *
+             * @tparam     Args     The types of the arguments.
+             */
+            template<typename... Args>
+            inline void Emplace ( TElement element, Args && ... args )
+            {
+                Insert ( element, TKey ( std::forward<Args>(args)... ) );
+            }
+        ///@}
+
+        ///@name Remove Elements
+        ///@{
+#pragma mark REMOVE_ELEMENTS
+
+            /**
+             * @brief      Deletes the top element and returns it with its key.
+             * @details    The children of the root are merged pairwise from
+             *     left to right, and the resulting trees are merged from right
+             *     to left.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The former top element and its key.
+             */
+            inline std::pair<TElement, TKey> DeleteTop ()
+            {
+                USAGE_ASSERT ( !Empty() );
+
+                Types::index const top = root_;
+                root_ = MergePairs ( nodes_[top].child );
+                return Remove ( top );
+            }
+
+            /**
+             * @brief      Deletes the top element.
+             *
+             * @pre        The heap is not empty.
+             */
+            inline void Pop ()
+            {
+                DeleteTop();
+            }
+
+            /**
+             * @brief      Deletes an element from the heap.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     The deleted element and its key.
+             */
+            inline std::pair<TElement, TKey> Delete ( TElement element )
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+
+                if ( element == root_ ) return DeleteTop();
+
+                Cut ( element );
+                root_ = Link ( root_, MergePairs ( nodes_[element].child ) );
+                return Remove ( element );
+            }
+
+            /**
+             * @brief      Removes all elements from the heap.
+             * @details    The nodes in the heap are reset by traversing the
+             *     tree, i.e., the vector of nodes keeps its size.
+             */
+            inline void Clear ()
+            {
+                stack_.clear();
+                if ( root_ != Const::NONE ) stack_.push_back ( root_ );
+                while ( !stack_.empty() )
+                {
+                    Types::index const index = stack_.back();
+                    stack_.pop_back();
+                    for ( Types::index child = nodes_[index].child
+                        ; child != Const::NONE
+                        ; child = nodes_[child].sibling )
+                    {
+                        stack_.push_back ( child );
+                    }
+                    nodes_[index].isInHeap = false;
+                }
+                root_ = Const::NONE;
+                size_ = 0;
+            }
+        ///@}
+
+        ///@name Update Elements
+        ///@{
+#pragma mark UPDATE_ELEMENTS
+
+            /**
+             * @brief      Changes the key of an element.
+             * @details    If the key decreases, the subtree of the element is
+             *     cut and linked with the root. Otherwise, the element is
+             *     deleted and inserted again.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             * @param[in]  newKey   The new key.
+             */
+            inline void ChangeKey ( TElement element, TKey newKey )
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+
+                if ( !comparator_ ( newKey, nodes_[element].key ) )
+                {
+                    Delete ( element );
+                    Insert ( element, std::move(newKey) );
+                    return;
+                }
+
+                nodes_[element].key = std::move(newKey);
+                if ( element == root_ ) return;
+                Cut ( element );
+                root_ = Link ( root_, element );
+            }
+        ///@}
+
+        ///@name Capacity
+        ///@{
+#pragma mark CAPACITY
+
+            /**
+             * @brief      Whether the heap is empty.
+             *
+             * @return     @p true if the heap is empty, @p false otherwise.
+             */
+            inline bool Empty () const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             * @brief      The number of elements in the heap.
+             *
+             * @return     The number of elements.
+             */
+            inline Types::count Size () const
+            {
+                return size_;
+            }
+        ///@}
+
+    private:
+        /**
+         * @brief      A node of the pairing heap.
+         */
+        struct Node {
+            TKey            key;                        /**< The key of the element. */
+            Types::index    child    = Const::NONE;     /**< The first child. */
+            Types::index    sibling  = Const::NONE;     /**< The next sibling. */
+            Types::index    previous = Const::NONE;     /**< The previous sibling, or the parent of the first child. */
+            bool            isInHeap = false;           /**< Whether the element is in the heap. */
+        };
+
+#pragma mark TREE_OPERATIONS
+        /**
+         * @brief      Links two trees.
+         * @details    The root with the larger key becomes the first child of
+         *     the other root.
+         *
+         * @param[in]  first   The root of the first tree, or Const::NONE.
+         * @param[in]  second  The root of the second tree, or Const::NONE.
+         *
+         * @return     The root of the linked tree.
+         */
+        inline Types::index Link ( Types::index first, Types::index second )
+        {
+            if ( first  == Const::NONE ) return second;
+            if ( second == Const::NONE ) return first;
+            if ( comparator_ ( nodes_[second].key, nodes_[first].key ) ) std::swap ( first, second );
+
+            Node & parent = nodes_[first];
+            Node & child  = nodes_[second];
+            child.sibling  = parent.child;
+            child.previous = first;
+            if ( parent.child != Const::NONE ) nodes_[parent.child].previous = second;
+            parent.child   = second;
+            return first;
+        }
+
+        /**
+         * @brief      Detaches the subtree of a non-root node from its
+         *     parent.
+         *
+         * @param[in]  index  The node.
+         */
+        inline void Cut ( Types::index index )
+        {
+            Node & node = nodes_[index];
+            ESSENTIAL_ASSERT ( node.previous != Const::NONE );
+
+            if ( nodes_[node.previous].child == index )
+            {
+                nodes_[node.previous].child   = node.sibling;
+            } else {
+                nodes_[node.previous].sibling = node.sibling;
+            }
+            if ( node.sibling != Const::NONE ) nodes_[node.sibling].previous = node.previous;
+            node.sibling  = Const::NONE;
+            node.previous = Const::NONE;
+        }
+
+        /**
+         * @brief      Merges a list of siblings into one tree by the
+         *     two-pass method.
+         *
+         * @param[in]  first  The first sibling, or Const::NONE.
+         *
+         * @return     The root of the merged tree.
+         */
+        inline Types::index MergePairs ( Types::index first )
+        {
+            stack_.clear();
+            while ( first != Const::NONE )
+            {
+                Types::index const second = nodes_[first].sibling;
+                Types::index const next   = ( second != Const::NONE ) ? nodes_[second].sibling : Const::NONE;
+                Detach ( first );
+                if ( second != Const::NONE ) Detach ( second );
+                stack_.push_back ( Link ( first, second ) );
+                first = next;
+            }
+
+            Types::index root = Const::NONE;
+            while ( !stack_.empty() )
+            {
+                root = Link ( stack_.back(), root );
+                stack_.pop_back();
+            }
+            return root;
+        }
+
+        inline void Detach ( Types::index index )
+        {
+            nodes_[index].sibling  = Const::NONE;
+            nodes_[index].previous = Const::NONE;
+        }
+
+        inline std::pair<TElement, TKey> Remove ( Types::index index )
+        {
+            Node & node   = nodes_[index];
+            node.child    = Const::NONE;
+            node.isInHeap = false;
+            --size_;
+            return std::make_pair ( static_cast<TElement>( index ), std::move ( node.key ) );
+        }
+
+#pragma mark MEMBERS
+        std::vector<Node>           nodes_;         /**< The nodes indexed by the elements. */
+        Types::index                root_;          /**< The root, or Const::NONE if the heap is empty. */
+        Types::count                size_;          /**< The number of elements in the heap. */
+        std::vector<Types::index>   stack_;         /**< The scratch space of MergePairs and Clear. */
+        TComparator                 comparator_;    /**< The comparator of the keys. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__PAIRING_HEAP_HPP
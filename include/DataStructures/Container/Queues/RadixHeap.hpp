@@ -0,0 +1,487 @@
+/*
+ * RadixHeap.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__RADIX_HEAP_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__RADIX_HEAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "DataStructures/Labels/Label.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+namespace internal {
+/**
+ * @brief      The default radix of a key of the RadixHeap.
+ * @details    Arithmetic keys are their own radix. Labels have to be
+ *     additive, see IsAdditiveLabel, and use their susceptance norm, which
+ *     is also their order and never decreases while DominatingThetaPath
+ *     runs, since the susceptance norm of each edge is positive. Other
+ *     labels such as the VoltageAngleDifferenceLabel are ordered by a value
+ *     that does not grow monotonically along a path and are rejected.
+ */
+struct SusceptanceNormRadix {
+    template<typename KeyType>
+    inline Types::real operator() ( KeyType const & key ) const
+    {
+        static_assert ( std::is_arithmetic<KeyType>::value || IsAdditiveLabel<KeyType>::value
+                      , "The keys of a RadixHeap have to be numbers or additive labels, e.g., SusceptanceNormLabel." );
+
+        if constexpr ( std::is_arithmetic<KeyType>::value )
+        {
+            return static_cast<Types::real>( key );
+        } else {
+            return key.SusceptanceNorm();
+        }
+    }
+};
+} // namespace internal
+
+/**
+ * @brief      Class for a monotone radix heap, in which elements are sorted
+ *     by non-negative floating point radices of their keys.
+ * @details    A radix heap is a monotone priority queue, i.e., no key that
+ *     is inserted or decreased is smaller than the last key deleted by
+ *     #DeleteTop. This holds for label-setting algorithms with non-negative
+ *     edge weights such as DominatingThetaPath with SusceptanceNormLabel,
+ *     whose queue keys are ordered by their susceptance norm.
+ *
+ *     The bit patterns of non-negative IEEE 754 floating point numbers are
+ *     ordered like the numbers. An element is kept in the bucket of the
+ *     highest bit, in which its radix differs from the radix of the last
+ *     deleted element. #DeleteTop redistributes the first non-empty bucket
+ *     into smaller buckets, which moves each element at most 64 times.
+ *     There are no comparisons of keys besides finding the minimum of a
+ *     bucket, and the radix function is a template parameter, i.e., it is
+ *     resolved at compile time.
+ *
+ *     The heap has the interface of MappingBinaryHeap that is used as @p
+ *     QueueType of DominatingThetaPath. The elements are identifiers that
+ *     index a vector of positions. Elements with the same radix are
+ *     returned in an arbitrary order. A key whose radix is smaller than the
+ *     last deleted radix violates the monotonicity and is treated as if it
+ *     was equal, i.e., it is deleted next.
+ *
+ * @note       The heap orders the keys only by their radix and ignores the
+ *     order of the keys themselves. Thus, the radix has to order the keys
+ *     like the queue of the algorithm and has to be monotone. The default
+ *     radix only accepts numbers and additive labels, see
+ *     internal::SusceptanceNormRadix. For the VoltageAngleDifferenceLabel
+ *     use MappingBinaryHeap, MappingDaryHeap, or PairingHeap.
+ *
+ *     The methods have the following time complexities:
+ *     Function                      | Time Complexity
+ *     ------------------------------|---------------------
+ *     KeyOf, HasKeyOf               | @f$\Theta(1)@f$
+ *     Insert, Emplace               | @f$\Theta(1)@f$
+ *     ChangeKey (decreasing)        | @f$\Theta(1)@f$
+ *     DeleteTop, Pop                | @f$O(1)@f$ amortized over the 64 bucket moves per element
+ *     Delete                        | @f$\Theta(1)@f$
+ *     Clear                         | @f$\Theta(n)@f$
+ *
+ * @code{.cpp}
+ *      using TLabel = SusceptanceNormLabel<TGraph::TEdge>;
+ *      using TQueue = RadixHeap< Types::vertexId, TLabel >;
+ *      DominatingThetaPath< TGraph, TLabel, TQueue > dtp ( graph );
+ * @endcode
+ *
+ * @pre        All radices are non-negative, and no key that is inserted or
+ *     decreased has a smaller radix than the last deleted key.
+ *
+ * @tparam     ElementType  The type of the elements, which has to be an
+ *     unsigned integral type such as Types::vertexId.
+ * @tparam     KeyType      The type of the keys.
+ * @tparam     RadixType    The function object mapping a key to its
+ *     non-negative radix of type Types::real.
+ *
+ * @see        MappingBinaryHeap
+ */
+template< typename ElementType
+        , typename KeyType
+        , typename RadixType = internal::SusceptanceNormRadix >
+class RadixHeap {
+    static_assert ( std::is_integral<ElementType>::value && std::is_unsigned<ElementType>::value
+                  , "The elements of a RadixHeap have to be identifiers." );
+    static_assert ( sizeof(Types::real) == sizeof(std::uint64_t)
+                  , "The radices of a RadixHeap have to be 64 bit floating point numbers." );
+
+    public:
+        // Type aliasing
+        using TElement  = ElementType;
+        using TKey      = KeyType;
+        using TRadix    = RadixType;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs an empty heap.
+             *
+             * @param[in]  radix  The function object mapping keys to radices.
+             */
+            RadixHeap ( TRadix radix = TRadix() )
+            : buckets_()
+            , positions_()
+            , last_( 0 )
+            , size_( 0 )
+            , radix_( std::move(radix) )
+            {}
+        ///@}
+
+        ///@name Element Access
+        ///@{
+#pragma mark ELEMENT_ACCESS
+
+            /**
+             * @brief      The key of an element.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     The key of the element.
+             */
+            inline TKey const & KeyOf ( TElement element ) const
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+                Position const & position = positions_[element];
+                return buckets_[position.bucket][position.index].key;
+            }
+
+            /**
+             * @brief      Determines if the element is in the heap.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     @p true if the element is in the heap, @p false
+             *     otherwise.
+             */
+            inline bool HasKeyOf ( TElement element ) const
+            {
+                return element < positions_.size()
+                    && positions_[element].index != Const::NONE;
+            }
+        ///@}
+
+        ///@name Add Elements
+        ///@{
+#pragma mark ADD_ELEMENTS
+
+            /**
+             * @brief      Inserts an element with a key.
+             *
+             * @pre        The heap does not contain the element.
+             *
+             * @param[in]  element  The element.
+             * @param[in]  key      The key.
+             */
+            inline void Insert ( TElement element, TKey key )
+            {
+                USAGE_ASSERT ( !HasKeyOf ( element ) );
+
+                if ( element >= positions_.size() )
+                {
+                    positions_.resize ( element + 1 );
+                }
+                std::uint64_t const bits = BitsOf ( key );
+                Push ( Entry { element, bits, std::move(key) } );
+                ++size_;
+            }
+
+            /**
+             * @brief      Inserts an element-key-pair.
+             *
+             * @pre        See #Insert(TElement, TKey).
+             *
+             * @param[in]  pair  The element and the key.
+             */
+            inline void Insert ( std::pair<TElement, TKey> pair )
+            {
+                Insert ( pair.first, std::move(pair.second) );
+            }
+
+            /**
+             * @brief      Constructs the key of an element.
+             *
+             * @pre        See #Insert(TElement, TKey).
+             *
+             * @param[in]  element  The element.
+             * @param      args     The arguments of the constructor of the key.
+             *
+             * @tparam     Args     The types of the arguments.
+             */
+            template<typename... Args>
+            inline void Emplace ( TElement element, Args && ... args )
+            {
+                Insert ( element, TKey ( std::forward<Args>(args)... ) );
+            }
+        ///@}
+
+        ///@name Remove Elements
+        ///@{
+#pragma mark REMOVE_ELEMENTS
+
+            /**
+             * @brief      Deletes an element with the smallest radix and
+             *     returns it with its key.
+             *
+             * @pre        The heap is not empty.
+             *
+             * @return     The former top element and its key.
+             */
+            inline std::pair<TElement, TKey> DeleteTop ()
+            {
+                USAGE_ASSERT ( !Empty() );
+
+                if ( buckets_[0].empty() ) Redistribute();
+
+                ESSENTIAL_ASSERT ( !buckets_[0].empty() );
+                Entry entry = std::move ( buckets_[0].back() );
+                buckets_[0].pop_back();
+                positions_[entry.element].index = Const::NONE;
+                --size_;
+                return std::make_pair ( entry.element, std::move ( entry.key ) );
+            }
+
+            /**
+             * @brief      Deletes an element with the smallest radix.
+             *
+             * @pre        The heap is not empty.
+             */
+            inline void Pop ()
+            {
+                DeleteTop();
+            }
+
+            /**
+             * @brief      Deletes an element from the heap.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             *
+             * @return     The deleted element and its key.
+             */
+            inline std::pair<TElement, TKey> Delete ( TElement element )
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+
+                Entry entry = Erase ( element );
+                --size_;
+                return std::make_pair ( entry.element, std::move ( entry.key ) );
+            }
+
+            /**
+             * @brief      Removes all elements from the heap.
+             * @details    The radix of the last deleted key is reset, i.e.,
+             *     the heap can be used for another monotone sequence.
+             */
+            inline void Clear ()
+            {
+                for ( std::vector<Entry> & bucket : buckets_ )
+                {
+                    for ( Entry const & entry : bucket )
+                    {
+                        positions_[entry.element].index = Const::NONE;
+                    }
+                    bucket.clear();
+                }
+                last_ = 0;
+                size_ = 0;
+            }
+        ///@}
+
+        ///@name Update Elements
+        ///@{
+#pragma mark UPDATE_ELEMENTS
+
+            /**
+             * @brief      Changes the key of an element.
+             *
+             * @pre        The heap contains the element.
+             *
+             * @param[in]  element  The element.
+             * @param[in]  newKey   The new key.
+             */
+            inline void ChangeKey ( TElement element, TKey newKey )
+            {
+                USAGE_ASSERT ( HasKeyOf ( element ) );
+
+                Erase ( element );
+                std::uint64_t const bits = BitsOf ( newKey );
+                Push ( Entry { element, bits, std::move(newKey) } );
+            }
+        ///@}
+
+        ///@name Capacity
+        ///@{
+#pragma mark CAPACITY
+
+            /**
+             * @brief      Whether the heap is empty.
+             *
+             * @return     @p true if the heap is empty, @p false otherwise.
+             */
+            inline bool Empty () const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             * @brief      The number of elements in the heap.
+             *
+             * @return     The number of elements.
+             */
+            inline Types::count Size () const
+            {
+                return size_;
+            }
+        ///@}
+
+    private:
+        /**
+         * @brief      An element with its key and the bit pattern of the
+         *     key's radix.
+         */
+        struct Entry {
+            TElement        element;    /**< The element. */
+            std::uint64_t   bits;       /**< The bit pattern of the radix. */
+            TKey            key;        /**< The key. */
+        };
+
+        /**
+         * @brief      The position of an element in the buckets.
+         */
+        struct Position {
+            Types::index    bucket = 0;             /**< The bucket. */
+            Types::index    index  = Const::NONE;   /**< The index in the bucket, or Const::NONE. */
+        };
+
+        static constexpr Types::count NumberOfBuckets = 65;
+
+#pragma mark BUCKET_OPERATIONS
+        /**
+         * @brief      The bit pattern of the radix of a key.
+         *
+         * @param[in]  key   The key.
+         *
+         * @return     The bits of the radix, which are ordered like the
+         *     radix, but at least the bits of the last deleted radix.
+         */
+        inline std::uint64_t BitsOf ( TKey const & key ) const
+        {
+            Types::real radix = radix_ ( key );
+            USAGE_ASSERT ( radix >= 0 );
+            radix += 0.0; // Maps -0.0 to +0.0
+
+            std::uint64_t bits;
+            std::memcpy ( &bits, &radix, sizeof(bits) );
+            return std::max ( bits, last_ );
+        }
+
+        /**
+         * @brief      The bucket of a bit pattern.
+         * @details    Bucket 0 contains the radices equal to the last
+         *     deleted radix, and bucket @f$i > 0@f$ the radices whose highest
+         *     bit that differs from the last deleted radix is bit @f$i-1@f$.
+         *
+         * @param[in]  bits  The bits.
+         *
+         * @return     The bucket.
+         */
+        inline Types::index BucketOf ( std::uint64_t bits ) const
+        {
+            if ( bits == last_ ) return 0;
+            return 64 - __builtin_clzll ( bits ^ last_ );
+        }
+
+        inline void Push ( Entry && entry )
+        {
+            Types::index const bucket = BucketOf ( entry.bits );
+            positions_[entry.element] = Position { bucket, buckets_[bucket].size() };
+            buckets_[bucket].push_back ( std::move(entry) );
+        }
+
+        /**
+         * @brief      Removes an element from its bucket by moving the last
+         *     entry of the bucket into its place.
+         *
+         * @param[in]  element  The element.
+         *
+         * @return     The removed entry.
+         */
+        inline Entry Erase ( TElement element )
+        {
+            Position const position     = positions_[element];
+            std::vector<Entry> & bucket = buckets_[position.bucket];
+
+            Entry entry = std::move ( bucket[position.index] );
+            if ( position.index + 1 < bucket.size() )
+            {
+                bucket[position.index] = std::move ( bucket.back() );
+                positions_[bucket[position.index].element].index = position.index;
+            }
+            bucket.pop_back();
+            positions_[element].index = Const::NONE;
+            return entry;
+        }
+
+        /**
+         * @brief      Moves the entries of the first non-empty bucket to
+         *     smaller buckets.
+         * @details    The smallest radix of the bucket becomes the last
+         *     deleted radix. Since all radices in bucket @f$i@f$ agree with
+         *     the new radix above bit @f$i-1@f$, each entry moves to a
+         *     smaller bucket.
+         */
+        inline void Redistribute ()
+        {
+            Types::index bucket = 1;
+            while ( buckets_[bucket].empty() ) ++bucket;
+
+            std::vector<Entry> entries;
+            entries.swap ( buckets_[bucket] );
+
+            last_ = std::numeric_limits<std::uint64_t>::max();
+            for ( Entry const & entry : entries )
+            {
+                last_ = std::min ( last_, entry.bits );
+            }
+            for ( Entry & entry : entries )
+            {
+                Push ( std::move(entry) );
+            }
+            // Keep the memory of the bucket
+            entries.clear();
+            buckets_[bucket].swap ( entries );
+        }
+
+#pragma mark MEMBERS
+        std::array<std::vector<Entry>, NumberOfBuckets> buckets_;   /**< The buckets of the entries. */
+        std::vector<Position>                           positions_; /**< The position of each element. */
+        std::uint64_t                                   last_;      /**< The bits of the last deleted radix. */
+        Types::count                                    size_;      /**< The number of elements in the heap. */
+        TRadix                                          radix_;     /**< The function object mapping keys to radices. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__RADIX_HEAP_HPP
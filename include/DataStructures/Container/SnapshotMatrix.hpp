@@ -0,0 +1,515 @@
+/*
+ * SnapshotMatrix.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__SNAPSHOT_MATRIX_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__SNAPSHOT_MATRIX_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A non-owning view of equally spaced elements in memory.
+ * @details    A span with stride 1 is a contiguous range, e.g., all
+ *     generator snapshots at one timestamp. A span with a larger stride
+ *     walks through a column of a row-major matrix, e.g., all snapshots of
+ *     one generator. The view is invalidated if the underlying matrix
+ *     grows.
+ *
+ * @tparam     ElementType  The type of the elements, which is @p const for
+ *     read-only views.
+ *
+ * @see        SnapshotMatrix
+ */
+template<typename ElementType>
+class SnapshotSpan {
+    public:
+        // Type aliasing
+        using value_type    = std::remove_const_t<ElementType>;
+        using reference     = ElementType &;
+        using pointer       = ElementType *;
+        using size_type     = Types::count;
+
+        /**
+         * @brief      Random access iterator over the elements of a span.
+         */
+        class Iterator {
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type        = std::remove_const_t<ElementType>;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = ElementType *;
+                using reference         = ElementType &;
+
+                Iterator ( ElementType * data
+                         , Types::index  index
+                         , Types::count  stride )
+                : data_( data )
+                , index_( static_cast<difference_type>( index ) )
+                , stride_( static_cast<difference_type>( stride ) )
+                {}
+
+                inline reference operator*  () const { return data_[index_ * stride_]; }
+                inline pointer   operator-> () const { return data_ + index_ * stride_; }
+                inline reference operator[] ( difference_type offset ) const { return data_[( index_ + offset ) * stride_]; }
+
+                inline Iterator & operator++ ()      { ++index_; return *this; }
+                inline Iterator   operator++ ( int ) { Iterator old = *this; ++index_; return old; }
+                inline Iterator & operator-- ()      { --index_; return *this; }
+                inline Iterator   operator-- ( int ) { Iterator old = *this; --index_; return old; }
+
+                inline Iterator & operator+= ( difference_type offset )       { index_ += offset; return *this; }
+                inline Iterator & operator-= ( difference_type offset )       { index_ -= offset; return *this; }
+                inline Iterator   operator+  ( difference_type offset ) const { return Iterator ( *this ) += offset; }
+                inline Iterator   operator-  ( difference_type offset ) const { return Iterator ( *this ) -= offset; }
+
+                inline difference_type operator- ( Iterator const & rhs ) const { return index_ - rhs.index_; }
+
+                inline bool operator== ( Iterator const & rhs ) const { return index_ == rhs.index_; }
+                inline bool operator!= ( Iterator const & rhs ) const { return index_ != rhs.index_; }
+                inline bool operator<  ( Iterator const & rhs ) const { return index_ <  rhs.index_; }
+                inline bool operator>  ( Iterator const & rhs ) const { return index_ >  rhs.index_; }
+                inline bool operator<= ( Iterator const & rhs ) const { return index_ <= rhs.index_; }
+                inline bool operator>= ( Iterator const & rhs ) const { return index_ >= rhs.index_; }
+
+            private:
+                ElementType *   data_;      /**< The first element of the span. */
+                difference_type index_;     /**< The index of the current element. */
+                difference_type stride_;    /**< The distance between two elements. */
+        };
+
+        using iterator = Iterator;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            SnapshotSpan ()
+            : data_( nullptr )
+            , size_( 0 )
+            , stride_( 1 )
+            {}
+
+            /**
+             * @brief      Constructs a view of @p size elements.
+             *
+             * @param      data    The first element.
+             * @param[in]  size    The number of elements.
+             * @param[in]  stride  The distance between two consecutive
+             *     elements.
+             */
+            SnapshotSpan ( ElementType * data
+                         , Types::count  size
+                         , Types::count  stride = 1 )
+            : data_( data )
+            , size_( size )
+            , stride_( stride )
+            {}
+        ///@}
+
+        ///@name Element Access
+        ///@{
+#pragma mark ELEMENT_ACCESS
+
+            inline reference operator[] ( Types::index index ) const
+            {
+                USAGE_ASSERT ( index < size_ );
+                return data_[index * stride_];
+            }
+
+            /**
+             * @brief      The first element.
+             *
+             * @return     The pointer to the first element, which is only
+             *     valid for @p size() many elements if the span is
+             *     contiguous.
+             */
+            inline pointer      Data ()   const { return data_; }
+            inline Types::count Size ()   const { return size_; }
+            inline Types::count Stride () const { return stride_; }
+            inline bool         Empty ()  const { return size_ == 0; }
+
+            /**
+             * @brief      Whether the elements are consecutive in memory.
+             *
+             * @return     @p true if the elements can be processed as an
+             *     array, @p false otherwise.
+             */
+            inline bool IsContiguous () const { return stride_ == 1 || size_ <= 1; }
+
+            inline Iterator begin () const { return Iterator ( data_, 0,     stride_ ); }
+            inline Iterator end   () const { return Iterator ( data_, size_, stride_ ); }
+        ///@}
+
+    private:
+#pragma mark MEMBERS
+        ElementType * data_;        /**< The first element. */
+        Types::count  size_;        /**< The number of elements. */
+        Types::count  stride_;      /**< The distance between two consecutive elements. */
+};
+
+/**
+ * @brief      A contiguous matrix of time series, e.g., the real power
+ *     snapshots of all generators.
+ * @details    The values are stored timestamp-major, i.e., all values of
+ *     one timestamp are consecutive in memory. Thus, a multi-period
+ *     computation that iterates timestamp by timestamp over all entities,
+ *     e.g., over 8760 hours of a year, reads the memory sequentially.
+ *     The time series of a single entity is available as a strided view
+ *     without copying.
+ *
+ *     Each entity has its own number of snapshots, since not every
+ *     generator or load has a time series. Cells behind the last
+ *     snapshot of an entity hold the fill value, which is
+ *     @p Const::NONE by default.
+ *
+ *     Operation                                               | Effect
+ *     --------------------------------------------------------|----------------------------------------------------
+ *     @code{.cpp} matrix.Append ( entity, value );   @endcode | Adds @p value to the time series of @p entity.
+ *     @code{.cpp} matrix ( entity, snapshot );       @endcode | The value of @p entity at @p snapshot.
+ *     @code{.cpp} matrix.SnapshotsAt ( snapshot );   @endcode | The contiguous values of all entities at @p snapshot.
+ *     @code{.cpp} matrix.SnapshotsOf ( entity );     @endcode | The strided time series of @p entity.
+ *
+ *     The number of entities and snapshots grow geometrically, so that
+ *     appending is amortized constant.
+ *
+ * @tparam     ValueType  The type of the values, e.g.,
+ *     Types::generatorSnapshot.
+ *
+ * @see        PowerGrid
+ */
+template<typename ValueType = Types::real>
+class SnapshotMatrix {
+    public:
+        // Type aliasing
+        using value_type    = ValueType;
+        using TSpan         = SnapshotSpan<ValueType>;
+        using TConstSpan    = SnapshotSpan<ValueType const>;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Constructs an empty matrix.
+             *
+             * @param[in]  fill  The value of cells without a snapshot.
+             */
+            explicit SnapshotMatrix ( ValueType fill = static_cast<ValueType>( Const::NONE ) )
+            : values_()
+            , lengths_()
+            , stride_( 0 )
+            , fill_( fill )
+            {}
+        ///@}
+
+        ///@name Capacity
+        ///@{
+#pragma mark CAPACITY
+
+            /**
+             * @brief      The number of entities, e.g., generators.
+             *
+             * @return     The number of time series.
+             */
+            inline Types::count NumberOfEntities () const { return lengths_.size(); }
+
+            /**
+             * @brief      The number of snapshots of the longest time series.
+             * @details    The length is computed in @f$\Theta(n)@f$ time,
+             *     where @f$n@f$ is the number of entities, since the
+             *     entities are appended independently of each other.
+             *
+             * @return     The number of rows that are in use.
+             */
+            inline Types::count NumberOfSnapshots () const
+            {
+                return lengths_.empty()
+                     ? 0
+                     : *std::max_element ( lengths_.begin(), lengths_.end() );
+            }
+
+            /**
+             * @brief      The number of snapshots of an entity.
+             *
+             * @param[in]  entity  The entity, e.g., a generator identifier.
+             *
+             * @return     The length of the time series of @p entity.
+             */
+            inline Types::count NumberOfSnapshotsOf ( Types::index entity ) const
+            {
+                USAGE_ASSERT ( entity < NumberOfEntities() );
+                return lengths_[entity];
+            }
+
+            /**
+             * @brief      Whether there are no snapshots at all.
+             *
+             * @return     @p true if no entity has a snapshot, @p false
+             *     otherwise.
+             */
+            inline bool Empty () const { return NumberOfSnapshots() == 0; }
+        ///@}
+
+        ///@name Modifiers
+        ///@{
+#pragma mark MODIFIERS
+
+            /**
+             * @brief      Sets the number of entities and reserves rows.
+             * @details    Entities that are removed lose their snapshots.
+             *     Reserving the rows beforehand guarantees that appending
+             *     to distinct entities does not reallocate, i.e., the
+             *     columns of a snapshot file can be appended in parallel.
+             *
+             * @param[in]  numberOfEntities   The number of entities.
+             * @param[in]  minimumSnapshots   The number of rows that are
+             *     allocated at least.
+             */
+            inline void Resize ( Types::count numberOfEntities
+                               , Types::count minimumSnapshots = 0 )
+            {
+                for ( Types::index entity = numberOfEntities
+                    ; entity < lengths_.size()
+                    ; ++entity )
+                {
+                    for ( Types::index snapshot = 0; snapshot < lengths_[entity]; ++snapshot )
+                    {
+                        values_[Position ( entity, snapshot )] = fill_;
+                    }
+                }
+                lengths_.resize ( numberOfEntities, 0 );
+
+                if ( numberOfEntities > stride_ )
+                {
+                    Reshape ( numberOfEntities, std::max ( Rows(), minimumSnapshots ) );
+                } else if ( minimumSnapshots > Rows() )
+                {
+                    Reshape ( stride_, minimumSnapshots );
+                }
+            }
+
+            /**
+             * @brief      Appends a snapshot to the time series of an
+             *     entity.
+             *
+             * @param[in]  entity  The entity, e.g., a generator identifier.
+             * @param[in]  value   The value at the next snapshot.
+             */
+            inline void Append ( Types::index entity
+                               , ValueType    value )
+            {
+                USAGE_ASSERT ( entity < NumberOfEntities() );
+
+                Types::index snapshot = lengths_[entity];
+                if ( snapshot >= Rows() )
+                {
+                    Reshape ( stride_, std::max<Types::count> ( 2 * Rows(), snapshot + 1 ) );
+                }
+                values_[Position ( entity, snapshot )] = value;
+                lengths_[entity] = snapshot + 1;
+            }
+
+            /**
+             * @brief      Sets the number of snapshots of an entity, e.g.,
+             *     after writing the values via SnapshotsAt directly.
+             * @details    Snapshots behind the new length are reset to the
+             *     fill value.
+             *
+             * @param[in]  entity             The entity.
+             * @param[in]  numberOfSnapshots  The length of the time series.
+             */
+            inline void SetNumberOfSnapshotsOf ( Types::index entity
+                                               , Types::count numberOfSnapshots )
+            {
+                USAGE_ASSERT ( entity < NumberOfEntities() );
+
+                if ( numberOfSnapshots > Rows() )
+                {
+                    Reshape ( stride_, numberOfSnapshots );
+                }
+                for ( Types::index snapshot = numberOfSnapshots
+                    ; snapshot < lengths_[entity]
+                    ; ++snapshot )
+                {
+                    values_[Position ( entity, snapshot )] = fill_;
+                }
+                lengths_[entity] = numberOfSnapshots;
+            }
+
+            /**
+             * @brief      Replaces the content by @p numberOfEntities time
+             *     series with @p numberOfSnapshots values each.
+             * @details    The rows are not padded, i.e., each row is exactly
+             *     NumberOfEntities() values long. This is used for result
+             *     matrices that are written row by row.
+             *
+             * @param[in]  numberOfEntities   The number of entities.
+             * @param[in]  numberOfSnapshots  The number of snapshots.
+             * @param[in]  value              The initial value.
+             */
+            inline void Assign ( Types::count numberOfEntities
+                               , Types::count numberOfSnapshots
+                               , ValueType    value )
+            {
+                values_.assign ( numberOfEntities * numberOfSnapshots, value );
+                lengths_.assign ( numberOfEntities, numberOfSnapshots );
+                stride_ = numberOfEntities;
+            }
+
+            /**
+             * @brief      Removes all entities and snapshots.
+             */
+            inline void Clear ()
+            {
+                values_.clear();
+                lengths_.clear();
+                stride_ = 0;
+            }
+        ///@}
+
+        ///@name Element Access
+        ///@{
+#pragma mark ELEMENT_ACCESS
+
+            /**
+             * @brief      The value of an entity at a snapshot.
+             *
+             * @param[in]  entity    The entity.
+             * @param[in]  snapshot  The snapshot position, which has to be
+             *     less than NumberOfSnapshotsOf ( entity ).
+             *
+             * @return     The value.
+             */
+            inline ValueType & operator() ( Types::index entity
+                                          , Types::index snapshot )
+            {
+                USAGE_ASSERT ( entity   < NumberOfEntities()  );
+                USAGE_ASSERT ( snapshot < lengths_[entity]    );
+                return values_[Position ( entity, snapshot )];
+            }
+
+            inline ValueType operator() ( Types::index entity
+                                        , Types::index snapshot ) const
+            {
+                USAGE_ASSERT ( entity   < NumberOfEntities()  );
+                USAGE_ASSERT ( snapshot < lengths_[entity]    );
+                return values_[Position ( entity, snapshot )];
+            }
+
+            /**
+             * @brief      The values of all entities at a snapshot.
+             * @details    The span is contiguous and has one value per
+             *     entity. Entities without a value at @p snapshot have the
+             *     fill value.
+             *
+             * @param[in]  snapshot  The snapshot position.
+             *
+             * @return     The contiguous view of the row.
+             */
+            inline TSpan SnapshotsAt ( Types::index snapshot )
+            {
+                USAGE_ASSERT ( snapshot < Rows() );
+                return TSpan ( values_.data() + snapshot * stride_, NumberOfEntities() );
+            }
+
+            inline TConstSpan SnapshotsAt ( Types::index snapshot ) const
+            {
+                USAGE_ASSERT ( snapshot < Rows() );
+                return TConstSpan ( values_.data() + snapshot * stride_, NumberOfEntities() );
+            }
+
+            /**
+             * @brief      The time series of an entity.
+             *
+             * @param[in]  entity  The entity.
+             *
+             * @return     The strided view of the column with
+             *     NumberOfSnapshotsOf ( entity ) many values.
+             */
+            inline TSpan SnapshotsOf ( Types::index entity )
+            {
+                USAGE_ASSERT ( entity < NumberOfEntities() );
+                return TSpan ( values_.data() + entity, lengths_[entity], stride_ );
+            }
+
+            inline TConstSpan SnapshotsOf ( Types::index entity ) const
+            {
+                USAGE_ASSERT ( entity < NumberOfEntities() );
+                return TConstSpan ( values_.data() + entity, lengths_[entity], stride_ );
+            }
+        ///@}
+
+    private:
+#pragma mark AUXILIARY
+        /**
+         * @brief      The number of allocated rows.
+         */
+        inline Types::count Rows () const
+        {
+            return stride_ == 0 ? 0 : values_.size() / stride_;
+        }
+
+        inline Types::index Position ( Types::index entity
+                                     , Types::index snapshot ) const
+        {
+            return snapshot * stride_ + entity;
+        }
+
+        /**
+         * @brief      Moves the values into a matrix with at least @p
+         *     numberOfEntities columns and @p numberOfRows rows.
+         * @details    If only the number of rows grows, the values keep
+         *     their position and the vector is extended.
+         */
+        inline void Reshape ( Types::count numberOfEntities
+                            , Types::count numberOfRows )
+        {
+            Types::count stride = stride_;
+            if ( numberOfEntities > stride_ )
+            {
+                stride = std::max<Types::count> ( numberOfEntities, 2 * stride_ );
+            }
+
+            if ( stride == stride_ )
+            {
+                values_.resize ( std::max ( Rows(), numberOfRows ) * stride_, fill_ );
+                return;
+            }
+
+            Types::count rows = std::max ( Rows(), numberOfRows );
+            std::vector<ValueType> values ( rows * stride, fill_ );
+            for ( Types::index snapshot = 0; snapshot < Rows(); ++snapshot )
+            {
+                std::copy ( values_.begin() + snapshot * stride_
+                          , values_.begin() + ( snapshot + 1 ) * stride_
+                          , values.begin()  + snapshot * stride );
+            }
+            values_.swap ( values );
+            stride_ = stride;
+        }
+
+#pragma mark MEMBERS
+        std::vector<ValueType>      values_;            /**< The values, where row @p t holds all entities at snapshot @p t. */
+        std::vector<Types::count>   lengths_;           /**< The number of snapshots of each entity. */
+        Types::count                stride_;            /**< The number of allocated columns per row. */
+        ValueType                   fill_;              /**< The value of cells without a snapshot. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__SNAPSHOT_MATRIX_HPP
@@ -0,0 +1,274 @@
+/*
+ * TimestampIndex.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__TIMESTAMP_INDEX_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__TIMESTAMP_INDEX_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      An index from snapshot timestamps to their positions.
+ * @details    A timestamp of the format "<year>-<month>-<day>
+ *     <hour>:<minute>:<second>", where the time or its seconds may be
+ *     omitted, is parsed into an integral key that preserves the
+ *     chronological order. Thus, the position of a timestamp is found by
+ *     hashing in expected @f$\Theta(1)@f$ time, and the positions of all
+ *     timestamps in an interval are found by binary search in
+ *     @f$\Theta(\log n + k)@f$ time, where @f$k@f$ is the number of
+ *     positions in the interval. Timestamps that cannot be parsed, e.g.,
+ *     "now", can be looked up, but are not part of any interval.
+ *
+ *     Different strings may have the same key, e.g., "2013-01-01" and
+ *     "2013-01-01 00:00:00". A lookup only finds the string that was
+ *     added. If a second string with an existing key is added, it can be
+ *     looked up, but is not part of any interval.
+ *
+ *     If a timestamp is added twice, its first position is kept.
+ *
+ * @code{.cpp}
+ *      TimestampIndex index;
+ *      index.Add ( "2013-01-01 00:00:00", 0 );
+ *      index.Add ( "2013-01-01 01:00:00", 1 );
+ *
+ *      Types::index position = index.PositionOf ( "2013-01-01 01:00:00" );
+ *
+ *      std::vector<Types::index> positions;
+ *      index.PositionsBetween ( "2013-01-01 00:30:00", "2013-01-02", positions );
+ * @endcode
+ *
+ * @see        PowerGrid::PositionOf
+ * @see        PowerGrid::PositionsBetween
+ */
+class TimestampIndex {
+    public:
+        using TKey = std::int64_t;
+
+        static constexpr TKey NoKey = -1;   /**< The key of a timestamp that cannot be parsed. */
+
+    public:
+        ///@name Modifiers
+        ///@{
+#pragma mark MODIFIERS
+
+            /**
+             * @brief      Adds a timestamp at a position.
+             * @details    Timestamps are usually added in chronological
+             *     order, in which case adding takes amortized constant
+             *     time.
+             *
+             * @param[in]  timestamp  The timestamp, e.g., "2019-09-19 19:19:19".
+             * @param[in]  position   The position of the timestamp.
+             */
+            inline void Add ( Types::timestampSnapshot const & timestamp
+                            , Types::index                     position )
+            {
+                TKey key = Parse ( timestamp );
+                if ( key == NoKey )
+                {
+                    unparsedPositions_.emplace ( timestamp, position );
+                    return;
+                }
+                auto result = positions_.emplace ( key, std::make_pair ( timestamp, position ) );
+                if ( !result.second )
+                { // The first position of a duplicate is kept
+                    if ( result.first->second.first != timestamp )
+                    { // Another string with the same key
+                        unparsedPositions_.emplace ( timestamp, position );
+                    }
+                    return;
+                }
+
+                std::pair<TKey, Types::index> entry ( key, position );
+                if ( chronological_.empty() || chronological_.back() < entry )
+                {
+                    chronological_.emplace_back ( entry );
+                } else
+                {
+                    chronological_.insert ( std::upper_bound ( chronological_.begin()
+                                                             , chronological_.end()
+                                                             , entry )
+                                          , entry );
+                }
+            }
+
+            /**
+             * @brief      Replaces the index by the index of a sequence of
+             *     timestamps, where each timestamp is at its position in
+             *     the sequence.
+             *
+             * @param[in]  timestamps  The timestamps.
+             */
+            inline void Build ( std::vector<Types::timestampSnapshot> const & timestamps )
+            {
+                Clear();
+                positions_.reserve ( timestamps.size() );
+                chronological_.reserve ( timestamps.size() );
+                for ( Types::index position = 0; position < timestamps.size(); ++position )
+                {
+                    Add ( timestamps[position], position );
+                }
+            }
+
+            /**
+             * @brief      Removes all timestamps.
+             */
+            inline void Clear ()
+            {
+                positions_.clear();
+                unparsedPositions_.clear();
+                chronological_.clear();
+            }
+        ///@}
+
+        ///@name Lookup
+        ///@{
+#pragma mark LOOKUP
+
+            /**
+             * @brief      The position of a timestamp.
+             * @details    The key of @p timestamp is looked up and the
+             *     string that was added with this key is compared to @p
+             *     timestamp, since different strings may have the same key.
+             *
+             * @param[in]  timestamp  The timestamp.
+             *
+             * @return     The position of @p timestamp, or @p Const::NONE
+             *     if it was not added.
+             */
+            inline Types::index PositionOf ( Types::timestampSnapshot const & timestamp ) const
+            {
+                TKey key = Parse ( timestamp );
+                if ( key != NoKey )
+                {
+                    auto result = positions_.find ( key );
+                    if ( result == positions_.end() ) return Const::NONE;
+                    if ( result->second.first == timestamp ) return result->second.second;
+                }
+                auto result = unparsedPositions_.find ( timestamp );
+                return result == unparsedPositions_.end() ? Const::NONE : result->second;
+            }
+
+            /**
+             * @brief      The positions of all timestamps in the interval
+             *     from @p from to @p to, where both ends are included.
+             *
+             * @pre        Both ends have to be parsable timestamps and the
+             *     vector @p positions has to be empty.
+             *
+             * @param[in]  from       The earliest timestamp.
+             * @param[in]  to         The latest timestamp.
+             * @param      positions  The positions in chronological order.
+             */
+            inline void PositionsBetween ( Types::timestampSnapshot const & from
+                                         , Types::timestampSnapshot const & to
+                                         , std::vector<Types::index>      & positions ) const
+            {
+                USAGE_ASSERT ( Parse ( from ) != NoKey );
+                USAGE_ASSERT ( Parse ( to )   != NoKey );
+                USAGE_ASSERT ( positions.empty()       );
+
+                auto first = std::lower_bound ( chronological_.begin()
+                                              , chronological_.end()
+                                              , std::make_pair ( Parse ( from ), Types::index ( 0 ) ) );
+                auto last  = std::upper_bound ( first
+                                              , chronological_.end()
+                                              , std::make_pair ( Parse ( to ), Const::NONE ) );
+                if ( first >= last ) return;
+
+                positions.reserve ( last - first );
+                for ( ; first != last; ++first )
+                {
+                    positions.emplace_back ( first->second );
+                }
+            }
+
+            /**
+             * @brief      The number of timestamps in the index.
+             *
+             * @return     The number of distinct timestamps.
+             */
+            inline Types::count Size () const
+            {
+                return positions_.size() + unparsedPositions_.size();
+            }
+        ///@}
+
+        ///@name Parser
+        ///@{
+#pragma mark PARSER
+
+            /**
+             * @brief      Parses a timestamp into a key that preserves the
+             *     chronological order.
+             * @details    The fields are separated by arbitrary non-digit
+             *     characters, e.g., "2019-09-19 19:19:19" or
+             *     "2019-09-19T19:19". Missing time fields are zero.
+             *
+             * @param[in]  timestamp  The timestamp.
+             *
+             * @return     The key, or #NoKey if @p timestamp does not start
+             *     with a date or has more than six fields.
+             */
+            static inline TKey Parse ( Types::timestampSnapshot const & timestamp )
+            {
+                // Year, month, day, hour, minute, and second
+                TKey         fields[6]          = { 0, 0, 0, 0, 0, 0 };
+                TKey const   bases[6]           = { 0, 13, 32, 24, 60, 60 };
+                Types::count numberOfFields     = 0;
+                bool         isInField          = false;
+
+                for ( char character : timestamp )
+                {
+                    if ( character >= '0' && character <= '9' )
+                    {
+                        if ( !isInField )
+                        {
+                            if ( numberOfFields == 6 ) return NoKey;
+                            ++numberOfFields;
+                            isInField = true;
+                        }
+                        TKey & field = fields[numberOfFields - 1];
+                        field = 10 * field + ( character - '0' );
+                        if ( field > 9999 ) return NoKey;
+                    } else
+                    {
+                        isInField = false;
+                    }
+                }
+                if ( numberOfFields < 3 ) return NoKey;
+
+                TKey key = fields[0];
+                for ( Types::index index = 1; index < 6; ++index )
+                {
+                    if ( fields[index] >= bases[index] ) return NoKey;
+                    key = key * bases[index] + fields[index];
+                }
+                return key;
+            }
+        ///@}
+
+    private:
+#pragma mark MEMBERS
+        std::unordered_map<TKey, std::pair<Types::timestampSnapshot, Types::index>> positions_;         /**< The first timestamp and its position of each key. */
+        std::unordered_map<Types::timestampSnapshot, Types::index>                  unparsedPositions_; /**< The position of each timestamp that cannot be parsed or whose key belongs to another timestamp. */
+        std::vector<std::pair<TKey, Types::index>>                  chronological_;     /**< The parsed timestamps in chronological order. */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__TIMESTAMP_INDEX_HPP
@@ -0,0 +1,211 @@
+/*
+ * DynamicBitsetVertexSet.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__DYNAMIC_BITSET_VERTEX_SET_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__DYNAMIC_BITSET_VERTEX_SET_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A vertex set represented by a dense dynamic bitset.
+ * @details    The set stores one bit per vertex identifier in a contiguous
+ *     vector of 64-bit words. The bitset grows on demand, i.e., it only
+ *     covers the identifiers up to the largest inserted one. Membership
+ *     tests and insertions take constant time, and copying the set costs
+ *     @f$\Theta(\max\{v\}/64)@f$ word copies without any hashing.
+ *
+ *     This is a drop-in replacement for the @p VertexSetContainer of the
+ *     labels, e.g.,
+ * @code{.cpp}
+ *      using TLabel = VoltageAngleDifferenceLabel< TEdge, DynamicBitsetVertexSet >;
+ * @endcode
+ *
+ * @see        Label
+ * @see        SmallVectorVertexSet
+ * @see        ParentChainVertexSet
+ */
+class DynamicBitsetVertexSet {
+    public:
+        // Type aliasing
+        using TVertexId = Types::vertexId;
+        using TWord     = std::uint64_t;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            DynamicBitsetVertexSet()
+            : words_()
+            , size_(0)
+            {}
+
+            /**
+             * @brief      Constructs the set containing the given vertices.
+             *
+             * @param[in]  vertexIds  The vertex identifiers.
+             */
+            DynamicBitsetVertexSet ( std::initializer_list<TVertexId> vertexIds )
+            : DynamicBitsetVertexSet()
+            {
+                for ( TVertexId vertexId : vertexIds )
+                {
+                    emplace ( vertexId );
+                }
+            }
+        ///@}
+
+        ///@name Modifier
+        ///@{
+#pragma mark MODIFIER
+
+            /**
+             * @brief      Inserts a vertex identifier.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     A pair of the vertex identifier and a boolean that
+             *     is @p true if the vertex was not yet contained in the set,
+             *     @p false otherwise.
+             */
+            inline std::pair<TVertexId, bool> emplace ( TVertexId vertexId )
+            {
+                USAGE_ASSERT ( vertexId != Const::NONE );
+
+                Types::index const word = WordOf ( vertexId );
+                if ( word >= words_.size() )
+                {
+                    words_.resize ( word + 1, 0 );
+                }
+
+                TWord const mask = MaskOf ( vertexId );
+                if ( words_[word] & mask )
+                {
+                    return std::make_pair ( vertexId, false );
+                }
+                words_[word] |= mask;
+                ++size_;
+                return std::make_pair ( vertexId, true );
+            }
+
+            /**
+             * @brief      Removes all vertices from the set.
+             * @details    The allocated words are kept for reuse.
+             */
+            inline void clear()
+            {
+                std::fill ( words_.begin(), words_.end(), 0 );
+                size_ = 0;
+            }
+        ///@}
+
+        ///@name Capacity and Lookup
+        ///@{
+#pragma mark CAPACITY_AND_LOOKUP
+
+            /**
+             * @brief      Number of occurrences of a vertex identifier.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     1 if the vertex is in the set, 0 otherwise.
+             */
+            inline Types::count count ( TVertexId vertexId ) const
+            {
+                Types::index const word = WordOf ( vertexId );
+                if ( word >= words_.size() ) return 0;
+                return ( words_[word] & MaskOf ( vertexId ) ) ? 1 : 0;
+            }
+
+            /**
+             * @brief      Number of vertices in the set.
+             *
+             * @return     The number of vertices.
+             */
+            inline Types::count size() const
+            {
+                return size_;
+            }
+
+            /**
+             * @brief      Whether the set is empty.
+             *
+             * @return     @p true if the set is empty, @p false otherwise.
+             */
+            inline bool empty() const
+            {
+                return size_ == 0;
+            }
+        ///@}
+
+        ///@name Loops
+        ///@{
+#pragma mark LOOPS
+
+            /**
+             * @brief      The @p for loop over all vertices in the set.
+             * @details    The vertices are visited in increasing order of
+             *     their identifiers.
+             *
+             * @param[in]  function  The function object, e.g.,
+             * @code{.cpp}
+             *      []( Types::vertexId vertexId )
+             *      {
+             *          // Do something with the vertex identifier.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void for_all_elements ( FUNCTION function ) const
+            {
+                for ( Types::index word = 0; word < words_.size(); ++word )
+                {
+                    TWord bits = words_[word];
+                    for ( Types::index bit = 0; bits != 0; ++bit, bits >>= 1 )
+                    {
+                        if ( bits & 1 )
+                        {
+                            function ( static_cast<TVertexId>( word * 64 + bit ) );
+                        }
+                    }
+                }
+            }
+        ///@}
+
+    private:
+#pragma mark AUXILIARY
+        static inline Types::index WordOf ( TVertexId vertexId )
+        {
+            return vertexId >> 6;
+        }
+
+        static inline TWord MaskOf ( TVertexId vertexId )
+        {
+            return TWord(1) << ( vertexId & 63 );
+        }
+
+#pragma mark MEMBERS
+        std::vector<TWord>  words_;     /**< The bits, one per vertex identifier */
+        Types::count        size_;      /**< The number of set bits */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__DYNAMIC_BITSET_VERTEX_SET_HPP
@@ -0,0 +1,262 @@
+/*
+ * ParentChainVertexSet.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__PARENT_CHAIN_VERTEX_SET_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__PARENT_CHAIN_VERTEX_SET_HPP
+
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A persistent vertex set represented by a parent chain.
+ * @details    The set is the chain of vertices from the head of the path
+ *     back to the source. Each node stores a vertex identifier and a shared
+ *     pointer to its parent node. Nodes are never modified after their
+ *     construction, so all labels that extend a common path prefix share
+ *     its nodes.
+ *
+ *     Copying the set is a pointer copy, i.e., @f$\Theta(1)@f$ time and no
+ *     allocation except for the reference count. Inserting a vertex
+ *     allocates one node. The cycle check walks the parent chain, which
+ *     takes time linear in the length of the path. This trades the copy
+ *     costs of the other containers against a walk that is proportional to
+ *     the path length, which is short in most power grids.
+ *
+ *     Destroying a set releases the nodes that are not shared with other
+ *     sets in a loop instead of recursively. Thus, long radial paths do not
+ *     exhaust the call stack.
+ *
+ *     This is a drop-in replacement for the @p VertexSetContainer of the
+ *     labels, e.g.,
+ * @code{.cpp}
+ *      using TLabel = VoltageAngleDifferenceLabel< TEdge, ParentChainVertexSet >;
+ * @endcode
+ *
+ * @see        Label
+ * @see        DynamicBitsetVertexSet
+ * @see        SmallVectorVertexSet
+ */
+class ParentChainVertexSet {
+    public:
+        // Type aliasing
+        using TVertexId = Types::vertexId;
+
+    private:
+        /**
+         * @brief      A node of the parent chain.
+         */
+        struct Node {
+            Node ( TVertexId              vertexId
+                 , std::shared_ptr<Node>  parent )
+            : vertexId_ ( vertexId )
+            , size_ ( parent ? parent->size_ + 1 : 1 )
+            , parent_ ( std::move ( parent ) )
+            {}
+
+            TVertexId                   vertexId_;  /**< The vertex of this node */
+            Types::count                size_;      /**< The length of the chain up to the source */
+            std::shared_ptr<Node>       parent_;    /**< The parent node, or nullptr at the source */
+        };
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            ParentChainVertexSet()
+            : head_()
+            {}
+
+            /**
+             * @brief      Constructs the chain containing the given vertices.
+             * @details    The last vertex becomes the head of the chain.
+             *
+             * @param[in]  vertexIds  The vertex identifiers.
+             */
+            ParentChainVertexSet ( std::initializer_list<TVertexId> vertexIds )
+            : ParentChainVertexSet()
+            {
+                for ( TVertexId vertexId : vertexIds )
+                {
+                    emplace ( vertexId );
+                }
+            }
+
+            ParentChainVertexSet ( ParentChainVertexSet const & other )  = default;
+            ParentChainVertexSet ( ParentChainVertexSet && other )       = default;
+
+            ParentChainVertexSet & operator= ( ParentChainVertexSet const & rhs )
+            {
+                if ( this != &rhs )
+                {
+                    Release();
+                    head_ = rhs.head_;
+                }
+                return *this;
+            }
+
+            ParentChainVertexSet & operator= ( ParentChainVertexSet && rhs )
+            {
+                if ( this != &rhs )
+                {
+                    Release();
+                    head_ = std::move ( rhs.head_ );
+                }
+                return *this;
+            }
+
+            ~ParentChainVertexSet()
+            {
+                Release();
+            }
+        ///@}
+
+        ///@name Modifier
+        ///@{
+#pragma mark MODIFIER
+
+            /**
+             * @brief      Appends a vertex identifier to the chain.
+             * @details    The vertex is only appended if it is not yet on the
+             *     chain. Copies of this set are not affected.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     A pair of the vertex identifier and a boolean that
+             *     is @p true if the vertex was not yet contained in the set,
+             *     @p false otherwise.
+             */
+            inline std::pair<TVertexId, bool> emplace ( TVertexId vertexId )
+            {
+                USAGE_ASSERT ( vertexId != Const::NONE );
+
+                if ( count ( vertexId ) > 0 )
+                {
+                    return std::make_pair ( vertexId, false );
+                }
+                head_ = std::make_shared<Node> ( vertexId, std::move ( head_ ) );
+                return std::make_pair ( vertexId, true );
+            }
+
+            /**
+             * @brief      Removes all vertices from the set.
+             * @details    Nodes that are shared with other sets stay alive.
+             */
+            inline void clear()
+            {
+                Release();
+            }
+        ///@}
+
+        ///@name Capacity and Lookup
+        ///@{
+#pragma mark CAPACITY_AND_LOOKUP
+
+            /**
+             * @brief      Number of occurrences of a vertex identifier.
+             * @details    Walks the chain from the head to the source.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     1 if the vertex is in the set, 0 otherwise.
+             */
+            inline Types::count count ( TVertexId vertexId ) const
+            {
+                for ( Node const * node = head_.get()
+                    ; node != nullptr
+                    ; node = node->parent_.get() )
+                {
+                    if ( node->vertexId_ == vertexId ) return 1;
+                }
+                return 0;
+            }
+
+            /**
+             * @brief      Number of vertices in the set.
+             *
+             * @return     The number of vertices.
+             */
+            inline Types::count size() const
+            {
+                return head_ ? head_->size_ : 0;
+            }
+
+            /**
+             * @brief      Whether the set is empty.
+             *
+             * @return     @p true if the set is empty, @p false otherwise.
+             */
+            inline bool empty() const
+            {
+                return !head_;
+            }
+        ///@}
+
+        ///@name Loops
+        ///@{
+#pragma mark LOOPS
+
+            /**
+             * @brief      The @p for loop over all vertices in the set.
+             * @details    The vertices are visited from the head of the path
+             *     back to the source.
+             *
+             * @param[in]  function  The function object, e.g.,
+             * @code{.cpp}
+             *      []( Types::vertexId vertexId )
+             *      {
+             *          // Do something with the vertex identifier.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void for_all_elements ( FUNCTION function ) const
+            {
+                for ( Node const * node = head_.get()
+                    ; node != nullptr
+                    ; node = node->parent_.get() )
+                {
+                    function ( node->vertexId_ );
+                }
+            }
+        ///@}
+
+    private:
+        /**
+         * @brief      Releases the chain iteratively.
+         * @details    The nodes are unlinked from the head as long as this
+         *     set is their only owner. The first shared node stays alive
+         *     together with its parents.
+         */
+        inline void Release()
+        {
+            std::shared_ptr<Node> node = std::move ( head_ );
+            while ( node && node.use_count() == 1 )
+            {
+                std::shared_ptr<Node> parent = std::move ( node->parent_ );
+                node = std::move ( parent );
+            }
+        }
+
+#pragma mark MEMBERS
+    private:
+        std::shared_ptr<Node>       head_;  /**< The last vertex of the path, or nullptr if the set is empty */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__PARENT_CHAIN_VERTEX_SET_HPP
@@ -0,0 +1,277 @@
+/*
+ * SmallVectorVertexSet.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__SMALL_VECTOR_VERTEX_SET_HPP
+#define EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__SMALL_VECTOR_VERTEX_SET_HPP
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A vertex set represented by a sorted small vector.
+ * @details    Up to @p InlineCapacity vertex identifiers are stored inside
+ *     the object itself, i.e., copying a short path does not allocate any
+ *     memory. If the set grows beyond @p InlineCapacity, all identifiers are
+ *     moved to a heap allocated vector. The identifiers are kept sorted, so
+ *     a membership test is a binary search and an insertion costs
+ *     @f$\Theta(k)@f$ for @f$k@f$ elements.
+ *
+ *     This is a drop-in replacement for the @p VertexSetContainer of the
+ *     labels, e.g.,
+ * @code{.cpp}
+ *      using TLabel = VoltageAngleDifferenceLabel< TEdge, SmallVectorVertexSet<32> >;
+ * @endcode
+ *
+ * @tparam     InlineCapacity  The number of identifiers stored without
+ *     allocation.
+ *
+ * @see        Label
+ * @see        DynamicBitsetVertexSet
+ * @see        ParentChainVertexSet
+ */
+template<Types::count InlineCapacity = 16>
+class SmallVectorVertexSet {
+    public:
+        // Type aliasing
+        using TVertexId = Types::vertexId;
+
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            SmallVectorVertexSet()
+            : inline_()
+            , heap_()
+            , size_(0)
+            {}
+
+            /**
+             * @brief      Constructs the set containing the given vertices.
+             *
+             * @param[in]  vertexIds  The vertex identifiers.
+             */
+            SmallVectorVertexSet ( std::initializer_list<TVertexId> vertexIds )
+            : SmallVectorVertexSet()
+            {
+                for ( TVertexId vertexId : vertexIds )
+                {
+                    emplace ( vertexId );
+                }
+            }
+
+            /**
+             * @brief      Copy constructor.
+             * @details    Only the used part of the inline storage is copied.
+             *
+             * @param      other  The other set.
+             */
+            SmallVectorVertexSet ( SmallVectorVertexSet const & other )
+            : heap_ ( other.heap_ )
+            , size_ ( other.size_ )
+            {
+                if ( !IsOnHeap() )
+                {
+                    std::copy_n ( other.inline_.begin(), size_, inline_.begin() );
+                }
+            }
+
+            SmallVectorVertexSet & operator= ( SmallVectorVertexSet const & other )
+            {
+                if ( this == &other ) return *this;
+                heap_ = other.heap_;
+                size_ = other.size_;
+                if ( !IsOnHeap() )
+                {
+                    std::copy_n ( other.inline_.begin(), size_, inline_.begin() );
+                }
+                return *this;
+            }
+
+            SmallVectorVertexSet ( SmallVectorVertexSet && other )
+            : heap_ ( std::move ( other.heap_ ) )
+            , size_ ( other.size_ )
+            {
+                if ( !IsOnHeap() )
+                {
+                    std::copy_n ( other.inline_.begin(), size_, inline_.begin() );
+                }
+                other.clear();
+            }
+
+            SmallVectorVertexSet & operator= ( SmallVectorVertexSet && other )
+            {
+                if ( this == &other ) return *this;
+                heap_ = std::move ( other.heap_ );
+                size_ = other.size_;
+                if ( !IsOnHeap() )
+                {
+                    std::copy_n ( other.inline_.begin(), size_, inline_.begin() );
+                }
+                other.clear();
+                return *this;
+            }
+        ///@}
+
+        ///@name Modifier
+        ///@{
+#pragma mark MODIFIER
+
+            /**
+             * @brief      Inserts a vertex identifier.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     A pair of the vertex identifier and a boolean that
+             *     is @p true if the vertex was not yet contained in the set,
+             *     @p false otherwise.
+             */
+            inline std::pair<TVertexId, bool> emplace ( TVertexId vertexId )
+            {
+                USAGE_ASSERT ( vertexId != Const::NONE );
+
+                TVertexId * first    = Data();
+                TVertexId * last     = first + size_;
+                TVertexId * position = std::lower_bound ( first, last, vertexId );
+
+                if ( position != last && *position == vertexId )
+                {
+                    return std::make_pair ( vertexId, false );
+                }
+
+                if ( size_ < InlineCapacity )
+                { // Shift the larger identifiers within the inline storage
+                    std::move_backward ( position, last, last + 1 );
+                    *position = vertexId;
+                } else if ( size_ == InlineCapacity )
+                { // Move everything to the heap
+                    heap_.reserve ( 2 * InlineCapacity );
+                    heap_.assign ( first, position );
+                    heap_.emplace_back ( vertexId );
+                    heap_.insert ( heap_.end(), position, last );
+                } else {
+                    heap_.insert ( heap_.begin() + ( position - first ), vertexId );
+                }
+                ++size_;
+
+                ESSENTIAL_ASSERT ( !IsOnHeap() || heap_.size() == size_ );
+                return std::make_pair ( vertexId, true );
+            }
+
+            /**
+             * @brief      Removes all vertices from the set.
+             */
+            inline void clear()
+            {
+                heap_.clear();
+                size_ = 0;
+            }
+        ///@}
+
+        ///@name Capacity and Lookup
+        ///@{
+#pragma mark CAPACITY_AND_LOOKUP
+
+            /**
+             * @brief      Number of occurrences of a vertex identifier.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     1 if the vertex is in the set, 0 otherwise.
+             */
+            inline Types::count count ( TVertexId vertexId ) const
+            {
+                return std::binary_search ( Data(), Data() + size_, vertexId ) ? 1 : 0;
+            }
+
+            /**
+             * @brief      Number of vertices in the set.
+             *
+             * @return     The number of vertices.
+             */
+            inline Types::count size() const
+            {
+                return size_;
+            }
+
+            /**
+             * @brief      Whether the set is empty.
+             *
+             * @return     @p true if the set is empty, @p false otherwise.
+             */
+            inline bool empty() const
+            {
+                return size_ == 0;
+            }
+        ///@}
+
+        ///@name Loops
+        ///@{
+#pragma mark LOOPS
+
+            /**
+             * @brief      The @p for loop over all vertices in the set.
+             * @details    The vertices are visited in increasing order of
+             *     their identifiers.
+             *
+             * @param[in]  function  The function object, e.g.,
+             * @code{.cpp}
+             *      []( Types::vertexId vertexId )
+             *      {
+             *          // Do something with the vertex identifier.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void for_all_elements ( FUNCTION function ) const
+            {
+                TVertexId const * first = Data();
+                for ( Types::index index = 0; index < size_; ++index )
+                {
+                    function ( first[index] );
+                }
+            }
+        ///@}
+
+    private:
+#pragma mark AUXILIARY
+        inline bool IsOnHeap() const
+        {
+            return size_ > InlineCapacity;
+        }
+
+        inline TVertexId * Data()
+        {
+            return IsOnHeap() ? heap_.data() : inline_.data();
+        }
+
+        inline TVertexId const * Data() const
+        {
+            return IsOnHeap() ? heap_.data() : inline_.data();
+        }
+
+#pragma mark MEMBERS
+        std::array<TVertexId, InlineCapacity>   inline_;    /**< The sorted identifiers if there are at most InlineCapacity many */
+        std::vector<TVertexId>                  heap_;      /**< The sorted identifiers if there are more than InlineCapacity many */
+        Types::count                            size_;      /**< The number of identifiers */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__CONTAINER__VERTEX_SETS__SMALL_VECTOR_VERTEX_SET_HPP
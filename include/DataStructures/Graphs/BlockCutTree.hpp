@@ -7,17 +7,17 @@
 #ifndef EGOA__DATA_STRUCTURES__GRAPHS__BLOCK_CUT_TREE__HPP
 #define EGOA__DATA_STRUCTURES__GRAPHS__BLOCK_CUT_TREE__HPP
 
+#include <algorithm>
 #include <functional>
 #include <stack>
 #include <utility>
 #include <vector>
 
-#include "Algorithms/GraphTraversal/ArticulationVertexDetection.hpp"
-#include "Algorithms/GraphTraversal/DepthFirstSearch.hpp"
-
 #include "Auxiliary/Constants.hpp"
 #include "Auxiliary/Types.hpp"
 
+#include "DataStructures/Container/UnionFind.hpp"
+#include "DataStructures/Graphs/CsrGraph.hpp"
 #include "DataStructures/Graphs/Subgraph.hpp"
 
 #include "Exceptions/Assertions.hpp"
@@ -31,10 +31,15 @@ namespace egoa {
 ///             To build a block-cut tree the functions
 ///             buildBlockCutTree(GraphType const &) or
 ///             BlockCutTree<GraphType>::Build(GraphType const &) can be used.
+///             For large graphs, buildBlockCutTreeInParallel(GraphType const &)
+///             or BlockCutTree<GraphType>::BuildInParallel(GraphType const &)
+///             compute the same blocks using all available threads.
 
 namespace internal {
     template<typename GraphType>
     class BlockCutTreeBuilder;
+    template<typename GraphType>
+    class ParallelBlockCutTreeBuilder;
 } // namespace internal
 
 /**
@@ -80,6 +85,24 @@ public:
         return builder.Build();
     }
 
+    /**
+     * @brief      Builds a @c BlockCutTree for a given graph using the
+     *             algorithm by Tarjan and Vishkin.
+     *
+     * @details    The blocks and cut-vertices are the same as the ones of
+     *             Build(TGraph const &), but the blocks may be numbered
+     *             differently. If OpenMP is available, the passes over the
+     *             vertices and edges run in parallel.
+     *
+     * @param      graph  The graph.
+     *
+     * @return     The @c BlockCutTree.
+     */
+    static BlockCutTree BuildInParallel(TGraph const & graph) {
+        internal::ParallelBlockCutTreeBuilder builder(graph);
+        return builder.Build();
+    }
+
     /// @name Basic Properties
     /// @{
 #pragma mark BASIC_PROPERTIES
@@ -238,6 +261,7 @@ public:
 
     private:
         friend class egoa::internal::BlockCutTreeBuilder<TGraph>;
+        friend class egoa::internal::ParallelBlockCutTreeBuilder<TGraph>;
 
         Types::blockId identifier_;
         egoa::Subgraph<TGraph const> subgraph_;
@@ -285,12 +309,14 @@ public:
 
     private:
         friend class egoa::internal::BlockCutTreeBuilder<TGraph>;
+        friend class egoa::internal::ParallelBlockCutTreeBuilder<TGraph>;
 
         Types::vertexId identifier_;
         std::vector<Types::blockId> blocks_;
     };
 
     friend class egoa::internal::BlockCutTreeBuilder<TGraph>;
+    friend class egoa::internal::ParallelBlockCutTreeBuilder<TGraph>;
 
 #pragma mark MEMBERS
     /// @name Members
@@ -364,28 +390,84 @@ BlockCutTree<GraphType> buildBlockCutTree(GraphType const & graph) {
     return BlockCutTree<GraphType>::Build(graph);
 }
 
+/**
+ * @brief      Builds a block-cut tree using the algorithm by Tarjan and Vishkin
+ *
+ * @details    Convenience function for
+ *             @c BlockCutTree<GraphType>::BuildInParallel().
+ *
+ * @param      graph      The graph for which the block-cut tree shall be built.
+ *
+ * @tparam     GraphType  The type of the graph.
+ *
+ * @return     The block-cut tree.
+ *
+ * @ingroup    bctree
+ */
+template<typename GraphType>
+BlockCutTree<GraphType> buildBlockCutTreeInParallel(GraphType const & graph) {
+    return BlockCutTree<GraphType>::BuildInParallel(graph);
+}
+
 namespace internal {
 
 /**
- * @brief      A class to build BlockCutTree objects for a graph.
+ * @brief      A block of a BlockCutTree that is still under construction.
  *
  * @tparam     GraphType  The type of the graph.
  *
  * @ingroup    bctree
  */
 template<typename GraphType>
-class BlockCutTreeBuilder final : private ArticulationVertexDetection<GraphType, false> {
-    class BlockUnderConstruction;
+struct BlockUnderConstruction {
+    using TGraph    = GraphType;
+    using TVertexId = typename TGraph::TVertexId;
+    using TEdgeId   = typename TGraph::TEdgeId;
+    using TBlock    = typename BlockCutTree<TGraph>::Block;
+
+    BlockUnderConstruction(Types::blockId id)
+    : identifier(id)
+    {}
 
+    Types::blockId         identifier;
+    std::vector<TVertexId> vertices;
+    std::vector<TEdgeId>   edges;
+    std::vector<TVertexId> cutVertices;
+
+    TBlock ToBlock(TGraph const & graph) && {
+        return TBlock(identifier,
+                      Subgraph(&graph, std::move(vertices), std::move(edges)),
+                      std::move(cutVertices));
+    }
+};
+
+/**
+ * @brief      A class to build BlockCutTree objects for a graph.
+ *
+ * @details    The edges are collected on a stack during the depth-first
+ *             search. When a tree edge @f$(u,v)@f$ is backtracked and no
+ *             vertex in the subtree of @f$v@f$ reaches a vertex older than
+ *             @f$u@f$, the edges on the stack above the entry of @f$v@f$
+ *             form a block. Parallel edges belong to the block of their
+ *             tree edge.
+ *
+ *             The depth-first search keeps its own stack of vertices and
+ *             the position of the next incident edge of each vertex. Thus,
+ *             long paths such as radial feeders do not exhaust the call
+ *             stack. The search starts at the first vertex of the graph.
+ *
+ * @tparam     GraphType  The type of the graph.
+ *
+ * @see        ParallelBlockCutTreeBuilder
+ *
+ * @ingroup    bctree
+ */
+template<typename GraphType>
+class BlockCutTreeBuilder final {
     using TGraph     = GraphType;
     using TVertexId  = typename TGraph::TVertexId;
     using TEdgeId    = typename TGraph::TEdgeId;
-    using TDetection = ::egoa::ArticulationVertexDetection<TGraph, false>;
-    using TTime      = typename DepthFirstSearch<GraphType, false>::TTime;
-
-    template<typename T>
-    using VectorStack = std::stack<T, std::vector<T>>;
-
+    using TBlock     = BlockUnderConstruction<TGraph>;
 
 public:
     /**
@@ -394,9 +476,17 @@ public:
      * @param      graph  The graph for which a block-cut tree shall be built.
      */
     BlockCutTreeBuilder(TGraph const & graph)
-    : TDetection(graph, graph.Vertices()[0].Identifier()),
-      graph_(graph),
-      bcTree_(graph)
+    : graph_(graph),
+      csr_(graph),
+      bcTree_(graph),
+      root_(graph.Vertices()[0].Identifier()),
+      entryTime_(graph.NumberOfVertices(), Const::NONE),
+      oldestReachable_(graph.NumberOfVertices(), Const::NONE),
+      parent_(graph.NumberOfVertices(), Const::NONE),
+      parentEdge_(graph.NumberOfVertices(), Const::NONE),
+      isArticulationVertex_(graph.NumberOfVertices(), false),
+      edgeStackSizeAtEntry_(graph.NumberOfVertices(), 0),
+      isInBlock_(graph.NumberOfVertices(), false)
     {}
 
     /**
@@ -405,13 +495,15 @@ public:
      * @return     The BlockCutTree-object.
      */
     BlockCutTree<TGraph> && Build() {
-        this->Run();
+        Search();
 
-        ESSENTIAL_ASSERT(blockStack_.empty());
+        ESSENTIAL_ASSERT(edgeStack_.empty());
         ESSENTIAL_ASSERT(bcTree_.cutVertices_.size() == graph_.NumberOfVertices());
-        ESSENTIAL_ASSERT(bcTree_.blocks_.size() == nextBlockId_);
 
-        SortBlocks();
+        AddCutVertices();
+        for (auto & block : blocks_) {
+            bcTree_.blocks_.push_back(std::move(block).ToBlock(graph_));
+        }
         return std::move(bcTree_);
     }
 
@@ -421,173 +513,652 @@ private:
     /// @{
 #pragma mark ALGORITHM_STEPS
     /**
-     * @brief      Sort all blocks in @c bcTree_.blocks_.
+     * @brief      The depth-first search from the root.
+     *
+     * @details    Each entry of the stack is a vertex together with the
+     *             position of its next incident edge in the packed
+     *             adjacency. A vertex is backtracked when all its incident
+     *             edges have been scanned.
      */
-    void SortBlocks() {
-         auto compareById = [](auto const & lhs, auto const & rhs) {
-            return lhs.Identifier() < rhs.Identifier();
+    void Search() {
+        struct Frame {
+            TVertexId    vertex;
+            Types::index next;
         };
-        using std::begin, std::end;
-        std::sort(begin(bcTree_.blocks_), end(bcTree_.blocks_), compareById);
+
+        std::vector<Frame> stack;
+        Types::count time = 0;
+
+        EnterVertex(root_, Const::NONE, Const::NONE, time++);
+        stack.push_back({root_, csr_.BeginAt(root_)});
+
+        while (!stack.empty()) {
+            TVertexId const source = stack.back().vertex;
+            Types::index const index = stack.back().next;
+
+            if (index == csr_.EndAt(source)) {
+                stack.pop_back();
+                if (source != root_) {
+                    BacktrackTreeEdge(parent_[source], source);
+                }
+                continue;
+            }
+            ++stack.back().next;
+
+            TVertexId const target = csr_.NeighborAt(index);
+            TEdgeId   const edgeId = csr_.EdgeIdAt(index);
+
+            if (target == source) {
+                // Self-loops do not belong to any block.
+                continue;
+            }
+
+            if (entryTime_[target] == Const::NONE) {
+                EnterVertex(target, source, edgeId, time++);
+                stack.push_back({target, csr_.BeginAt(target)});
+                continue;
+            }
+
+            ScanNonTreeEdge(source, target, edgeId);
+        }
+    }
+
+    /**
+     * @brief      Adds the cut-vertices to their blocks.
+     *
+     * @details    The articulation vertices are only known after the
+     *             search, since the root is an articulation vertex if it
+     *             has more than one child. For each non-root vertex the
+     *             block of the tree edge from its parent comes first.
+     */
+    void AddCutVertices() {
+        for (TVertexId vertex = 0; vertex < graph_.NumberOfVertices(); ++vertex) {
+            if (parentEdge_[vertex] == Const::NONE) continue;
+            bcTree_.blocksOfVertex_[vertex].push_back(bcTree_.blockOfEdge_[parentEdge_[vertex]]);
+        }
+
+        for (auto & block : blocks_) {
+            for (TVertexId vertex : block.vertices) {
+                auto & blocksOfVertex = bcTree_.blocksOfVertex_[vertex];
+                if (blocksOfVertex.empty() || blocksOfVertex.front() != block.identifier) {
+                    blocksOfVertex.push_back(block.identifier);
+                }
+                if (isArticulationVertex_[vertex]) {
+                    block.cutVertices.push_back(vertex);
+                }
+            }
+        }
+
+        for (TVertexId vertex = 0; vertex < graph_.NumberOfVertices(); ++vertex) {
+            if (!isArticulationVertex_[vertex]) continue;
+            ESSENTIAL_ASSERT(bcTree_.blocksOfVertex_[vertex].size() > 1);
+            bcTree_.cutVertices_[vertex].identifier_ = vertex;
+            bcTree_.cutVertices_[vertex].blocks_     = bcTree_.blocksOfVertex_[vertex];
+            ++bcTree_.numberOfCutVertices_;
+        }
     }
     /// @}
 
-protected:
     /// @name Traversal
     /// @{
 #pragma mark TRAVERSAL
-    virtual void PostprocessingEdgeWith(TVertexId source,
-                                        TVertexId target,
-                                        TEdgeId edgeId) override {
-        TDetection::PostprocessingEdgeWith(source, target, edgeId);
+    /**
+     * @brief      Enters a vertex via a tree edge.
+     *
+     * @param[in]  vertex  The vertex that is entered.
+     * @param[in]  parent  The parent of the vertex or @c Const::NONE for the root.
+     * @param[in]  edgeId  The tree edge or @c Const::NONE for the root.
+     * @param[in]  time    The entry time.
+     */
+    void EnterVertex(TVertexId vertex, TVertexId parent, TEdgeId edgeId, Types::count time) {
+        entryTime_[vertex]            = time;
+        oldestReachable_[vertex]      = time;
+        parent_[vertex]               = parent;
+        parentEdge_[vertex]           = edgeId;
+        edgeStackSizeAtEntry_[vertex] = edgeStack_.size();
+    }
+
+    /**
+     * @brief      Handles an edge to a vertex that has already been entered.
+     *
+     * @param[in]  source  The vertex whose incident edges are scanned.
+     * @param[in]  target  The other endpoint.
+     * @param[in]  edgeId  The edge.
+     */
+    void ScanNonTreeEdge(TVertexId source, TVertexId target, TEdgeId edgeId) {
+        if (target == parent_[source]) {
+            // Edges to the parent are considered at the parent.
+            return;
+        }
 
-        if (this->ParentOf(source) == target) {
-            // Ignore edges that directly return to the parent.
+        if (entryTime_[target] < entryTime_[source]) {
+            // A back edge to an ancestor.
+            oldestReachable_[source] = std::min(oldestReachable_[source], entryTime_[target]);
+            edgeStack_.push_back(edgeId);
             return;
         }
 
-        auto type = this->TypifyEdge(source, target);
-        if (type == DfsEdgeType::forward) {
+        if (parent_[target] != source) {
             // The edge has already been considered in the other direction.
             return;
         }
 
-        auto targetTime = this->TimeOfOldestReachableAncestor(target);
+        // A parallel edge belongs to the block of the tree edge.
+        Types::blockId blockId = bcTree_.blockOfEdge_[parentEdge_[target]];
+        if (blockId != Const::NONE) {
+            AddEdgeToBlock(edgeId, blockId);
+        } else {
+            edgeStack_.push_back(edgeId);
+        }
+    }
 
-        ESSENTIAL_ASSERT(blockStack_.empty()
-                         || CurrentBlock().timeOfOldestVertex <= targetTime);
+    /**
+     * @brief      Backtracks the tree edge from @p parent to @p child.
+     *
+     * @param[in]  parent  The parent.
+     * @param[in]  child   The child whose subtree is finished.
+     */
+    void BacktrackTreeEdge(TVertexId parent, TVertexId child) {
+        edgeStack_.push_back(parentEdge_[child]);
+        oldestReachable_[parent] = std::min(oldestReachable_[parent], oldestReachable_[child]);
+
+        if (oldestReachable_[child] < entryTime_[parent]) return;
 
-        if (blockStack_.empty() || CurrentBlock().timeOfOldestVertex < targetTime) {
-            // We reached a new block
-            PushNextBlock(targetTime);
+        // No vertex below the child reaches a vertex older than the parent.
+        if (parent != root_ || numberOfChildrenOfRoot_++ > 0) {
+            isArticulationVertex_[parent] = true;
         }
+        PopBlock(edgeStackSizeAtEntry_[child]);
+    }
+    /// @}
+
+    /// @name Adding Blocks
+    /// @{
+#pragma mark ADDING_BLOCKS
+    /**
+     * @brief      Pops the edges of a block from the stack.
+     *
+     * @param[in]  size  The size of the stack without the edges of the block.
+     */
+    void PopBlock(Types::count size) {
+        ESSENTIAL_ASSERT(size < edgeStack_.size());
 
-        ESSENTIAL_ASSERT(CurrentBlock().timeOfOldestVertex == targetTime);
+        Types::blockId blockId = blocks_.size();
+        blocks_.emplace_back(blockId);
 
-        AddEdgeToCurrentBlock(edgeId);
+        while (edgeStack_.size() > size) {
+            TEdgeId edgeId = edgeStack_.back();
+            edgeStack_.pop_back();
 
-        // Vertices are added as the targets of the tree edges in the block.
-        // All vertex except the one via which a block is reached are reached
-        // exactly once via a tree edge.
-        // The remaining vertex is added is added when the last tree
-        // edge of the block is backtracked.
-        if (type == DfsEdgeType::tree) {
-            AddVertexToCurrentBlock(target);
-            if (this->IsArticulationVertexAt(target)) {
-                AddCutVertexToBlock(target);
-            }
+            AddEdgeToBlock(edgeId, blockId);
+            AddVertexToBlock(graph_.EdgeAt(edgeId).Source(), blockId);
+            AddVertexToBlock(graph_.EdgeAt(edgeId).Target(), blockId);
         }
 
-        // If the source of the block was reached at or before
-        // CurrentBlock().timeOfOldestVertex, it is the oldest vertex of the block
-        // and all edges of the block have been collected.
-        if (this->EntryTimeAt(source) <= CurrentBlock().timeOfOldestVertex) {
-            AddVertexToCurrentBlock(source);
-            if (this->IsArticulationVertexAt(source)) {
-                AddCutVertexToBlock(source);
-            }
-            PopBlock();
+        for (TVertexId vertex : blocks_[blockId].vertices) {
+            isInBlock_[vertex] = false;
         }
     }
 
-    virtual void PostprocessingVertexWith(Types::vertexId vertex) override {
-        TDetection::PostprocessingVertexWith(vertex);
+    /**
+     * @brief      Adds an edge to a block.
+     *
+     * @param[in]  edge     The identifier of the edge to add.
+     * @param[in]  blockId  The identifier of the block.
+     */
+    void AddEdgeToBlock(TEdgeId edge, Types::blockId blockId) {
+        bcTree_.blockOfEdge_[edge] = blockId;
+        blocks_[blockId].edges.push_back(edge);
+    }
 
-        if (this->IsArticulationVertexAt(vertex)) {
-            ++bcTree_.numberOfCutVertices_;
-        }
+    /**
+     * @brief      Adds a vertex to a block unless it is already part of it.
+     *
+     * @param[in]  vertex   The identifier of the vertex to add.
+     * @param[in]  blockId  The identifier of the block.
+     */
+    void AddVertexToBlock(TVertexId vertex, Types::blockId blockId) {
+        if (isInBlock_[vertex]) return;
+        isInBlock_[vertex] = true;
+        blocks_[blockId].vertices.push_back(vertex);
     }
     /// @}
 
+#pragma mark MEMBERS
+
+    TGraph const & graph_;
+    CsrGraph csr_;                                      /**< The packed adjacency of the graph. */
+    egoa::BlockCutTree<TGraph> bcTree_;
+    TVertexId root_;                                    /**< The vertex at which the search starts. */
+    Types::count numberOfChildrenOfRoot_ = 0;           /**< The number of children of the root that have been backtracked. */
+    std::vector<Types::count> entryTime_;               /**< The entry time of each vertex. */
+    std::vector<Types::count> oldestReachable_;         /**< The oldest entry time reachable from the subtree of each vertex. */
+    std::vector<TVertexId> parent_;                     /**< The parent of each vertex in the search tree. */
+    std::vector<TEdgeId> parentEdge_;                   /**< The tree edge from the parent of each vertex. */
+    std::vector<bool> isArticulationVertex_;            /**< Whether a vertex is an articulation vertex. */
+    std::vector<TBlock> blocks_;                        /**< The blocks in the order of their identifiers. */
+    std::vector<TEdgeId> edgeStack_;                    /**< The edges that are not yet part of a block. */
+    std::vector<Types::count> edgeStackSizeAtEntry_;    /**< The size of the edge stack when a vertex was entered. */
+    std::vector<bool> isInBlock_;                       /**< Whether a vertex is part of the block that is popped. */
+};
+
+/**
+ * @brief      A class to build BlockCutTree objects following Tarjan and
+ *             Vishkin.
+ *
+ * @details    Instead of a depth-first search, an arbitrary spanning tree is
+ *             used. Here, it is the breadth-first search tree from the first
+ *             vertex. Each tree edge is identified by its child @f$v@f$.
+ *             After numbering the vertices in preorder, the lowest and
+ *             highest preorder numbers @f$\mathrm{low}(v)@f$ and
+ *             @f$\mathrm{high}(v)@f$ that are reachable from the subtree of
+ *             @f$v@f$ by at most one non-tree edge are computed. Two tree
+ *             edges are in the same block if and only if they are connected
+ *             in the auxiliary graph with the edges
+ *             - @f$\{v,w\}@f$ for each non-tree edge @f$\{v,w\}@f$ where
+ *               neither endpoint is an ancestor of the other, and
+ *             - @f$\{u,v\}@f$ for each tree edge @f$(u,v)@f$ where @f$u@f$
+ *               is not the root and the subtree of @f$v@f$ reaches a vertex
+ *               outside the subtree of @f$u@f$.
+ *             A non-tree edge belongs to the block of the tree edge of its
+ *             endpoint with the higher preorder number.
+ *
+ *             The passes over the levels of the spanning tree, the vertices,
+ *             and the edges run in parallel if OpenMP is available. Only the
+ *             search for the spanning tree, the union-find on the auxiliary
+ *             graph, and the assembly of the blocks are sequential.
+ *
+ *             The result has the same blocks and cut-vertices as the one of
+ *             BlockCutTreeBuilder, but the blocks may be numbered
+ *             differently.
+ *
+ * @tparam     GraphType  The type of the graph.
+ *
+ * @see        BlockCutTreeBuilder
+ *
+ * @ingroup    bctree
+ */
+template<typename GraphType>
+class ParallelBlockCutTreeBuilder final {
+    using TGraph     = GraphType;
+    using TVertexId  = typename TGraph::TVertexId;
+    using TEdgeId    = typename TGraph::TEdgeId;
+    using TBlock     = BlockUnderConstruction<TGraph>;
+
+public:
+    /**
+     * @brief      The constructor.
+     *
+     * @param      graph  The graph for which a block-cut tree shall be built.
+     */
+    ParallelBlockCutTreeBuilder(TGraph const & graph)
+    : graph_(graph),
+      csr_(graph),
+      bcTree_(graph),
+      root_(graph.Vertices()[0].Identifier()),
+      parent_(graph.NumberOfVertices(), Const::NONE),
+      parentEdge_(graph.NumberOfVertices(), Const::NONE),
+      preorder_(graph.NumberOfVertices(), Const::NONE),
+      subtreeSize_(graph.NumberOfVertices(), 0),
+      low_(graph.NumberOfVertices(), Const::NONE),
+      high_(graph.NumberOfVertices(), Const::NONE),
+      blockOfTreeEdge_(graph.NumberOfVertices(), Const::NONE)
+    {}
+
+    /**
+     * @brief      Builds the block-cut tree.
+     *
+     * @return     The BlockCutTree-object.
+     */
+    BlockCutTree<TGraph> && Build() {
+        SpanningTree();
+        NumberVertices();
+        ReachablePreorderNumbers();
+        ConnectTreeEdges();
+        AssignEdges();
+        AddVertices();
+
+        for (auto & block : blocks_) {
+            bcTree_.blocks_.push_back(std::move(block).ToBlock(graph_));
+        }
+        return std::move(bcTree_);
+    }
+
 private:
-    /// @name Adding Blocks
+
+    /// @name Steps of the Algorithm
     /// @{
-#pragma mark ADDING_BLOCKS
+#pragma mark ALGORITHM_STEPS
     /**
-     * @brief      Initializes the next block.
+     * @brief      Computes the breadth-first search tree from the root.
+     *
+     * @details    The vertices are stored level by level. Vertices that are
+     *             not reachable from the root are not part of any block.
+     */
+    void SpanningTree() {
+        order_.reserve(graph_.NumberOfVertices());
+        order_.push_back(root_);
+        parent_[root_] = root_;
+        levelBegin_.push_back(0);
+
+        while (levelBegin_.back() < order_.size()) {
+            Types::index const begin = levelBegin_.back();
+            Types::index const end   = order_.size();
+            levelBegin_.push_back(end);
+
+            for (Types::index position = begin; position < end; ++position) {
+                TVertexId const source = order_[position];
+                csr_.for_all_incident_edges_at(source,
+                    [this, source](TEdgeId edgeId, TVertexId target) {
+                        if (parent_[target] != Const::NONE) return;
+                        parent_[target]     = source;
+                        parentEdge_[target] = edgeId;
+                        order_.push_back(target);
+                    });
+            }
+        }
+    }
+
+    /**
+     * @brief      Numbers the vertices in preorder of the spanning tree.
+     *
+     * @details    The subtree sizes are accumulated from the deepest level
+     *             upwards. Afterwards, each vertex hands consecutive ranges
+     *             of preorder numbers to its children. Within a level the
+     *             vertices are independent.
      */
-    void PushNextBlock(TTime time) {
-        blockStack_.emplace(nextBlockId_++, time);
+    void NumberVertices() {
+        for_all_levels_bottom_up([this](TVertexId vertex) {
+            Types::count size = 1;
+            for_all_children_at(vertex, [this, &size](TVertexId child) {
+                size += subtreeSize_[child];
+            });
+            subtreeSize_[vertex] = size;
+        });
+
+        preorder_[root_] = 0;
+        for_all_levels_top_down([this](TVertexId vertex) {
+            Types::index next = preorder_[vertex] + 1;
+            for_all_children_at(vertex, [this, &next](TVertexId child) {
+                preorder_[child] = next;
+                next += subtreeSize_[child];
+            });
+        });
     }
 
     /**
-     * @brief      Pops a block and adds it to the block-cut tree.
+     * @brief      Computes @f$\mathrm{low}(v)@f$ and @f$\mathrm{high}(v)@f$
+     *             for all vertices.
      */
-    void PopBlock() {
-        bcTree_.blocks_.push_back(std::move(blockStack_.top()).ToBlock(graph_));
-        blockStack_.pop();
+    void ReachablePreorderNumbers() {
+        for_all_levels_bottom_up([this](TVertexId vertex) {
+            Types::index low  = preorder_[vertex];
+            Types::index high = preorder_[vertex];
+            csr_.for_all_incident_edges_at(vertex,
+                [this, vertex, &low, &high](TEdgeId edgeId, TVertexId other) {
+                    if (edgeId == parentEdge_[vertex]) return;
+                    if (edgeId == parentEdge_[other]) {
+                        low  = std::min(low,  low_[other]);
+                        high = std::max(high, high_[other]);
+                    } else {
+                        low  = std::min(low,  preorder_[other]);
+                        high = std::max(high, preorder_[other]);
+                    }
+                });
+            low_[vertex]  = low;
+            high_[vertex] = high;
+        });
     }
 
     /**
-     * @brief      Adds an edge to the current block.
+     * @brief      Computes the connected components of the auxiliary graph.
      *
-     * @param[in]  edge  The identifier of the edge to add.
+     * @details    The edges of the auxiliary graph are collected in
+     *             parallel, one list per vertex, and merged by a union-find
+     *             afterwards. Each component is a block, and the blocks are
+     *             numbered in the order of their topmost tree edges.
      */
-    void AddEdgeToCurrentBlock(TEdgeId edge) {
-        bcTree_.blockOfEdge_[edge] = CurrentBlockId();
-        CurrentBlock().edges.push_back(edge);
+    void ConnectTreeEdges() {
+        Types::count const numberOfVertices = graph_.NumberOfVertices();
+        std::vector<std::vector<TVertexId>> auxiliaryEdges(numberOfVertices);
+
+#ifdef OPENMP_AVAILABLE
+        #pragma omp parallel for schedule ( dynamic, 64 )
+#endif // OPENMP_AVAILABLE
+        for (TVertexId vertex = 0; vertex < numberOfVertices; ++vertex) {
+            if (!IsTreeEdgeAt(vertex)) continue;
+
+            TVertexId const parent = parent_[vertex];
+            if (parent != root_
+                && (low_[vertex] < preorder_[parent]
+                    || high_[vertex] >= preorder_[parent] + subtreeSize_[parent])) {
+                auxiliaryEdges[vertex].push_back(parent);
+            }
+
+            csr_.for_all_incident_edges_at(vertex,
+                [this, vertex, &auxiliaryEdges](TEdgeId edgeId, TVertexId other) {
+                    if (!IsNonTreeEdge(edgeId, vertex, other)) return;
+                    if (preorder_[vertex] < preorder_[other]) return;
+                    if (IsAncestor(other, vertex)) return;
+                    auxiliaryEdges[vertex].push_back(other);
+                });
+        }
+
+        UnionFind components(numberOfVertices);
+        for (TVertexId vertex = 0; vertex < numberOfVertices; ++vertex) {
+            for (TVertexId other : auxiliaryEdges[vertex]) {
+                components.Union(vertex, other);
+            }
+        }
+
+        std::vector<Types::blockId> blockOfComponent(numberOfVertices, Const::NONE);
+        for (TVertexId vertex : order_) {
+            if (!IsTreeEdgeAt(vertex)) continue;
+            Types::vertexId const component = components.Find(vertex);
+            if (blockOfComponent[component] == Const::NONE) {
+                blockOfComponent[component] = blocks_.size();
+                blocks_.emplace_back(blocks_.size());
+            }
+            blockOfTreeEdge_[vertex] = blockOfComponent[component];
+        }
+    }
+
+    /**
+     * @brief      Assigns the edges to the blocks.
+     */
+    void AssignEdges() {
+        Types::count const numberOfEdges = graph_.NumberOfEdges();
+
+#ifdef OPENMP_AVAILABLE
+        #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+        for (TEdgeId edgeId = 0; edgeId < numberOfEdges; ++edgeId) {
+            TVertexId const source = graph_.EdgeAt(edgeId).Source();
+            TVertexId const target = graph_.EdgeAt(edgeId).Target();
+            if (source == target || preorder_[source] == Const::NONE) continue;
+
+            TVertexId const deeper = preorder_[source] < preorder_[target] ? target : source;
+            bcTree_.blockOfEdge_[edgeId] = blockOfTreeEdge_[deeper];
+        }
+
+        for (TEdgeId edgeId = 0; edgeId < numberOfEdges; ++edgeId) {
+            Types::blockId const blockId = bcTree_.blockOfEdge_[edgeId];
+            if (blockId == Const::NONE) continue;
+            blocks_[blockId].edges.push_back(edgeId);
+        }
     }
 
     /**
-     * @brief      Adds a vertex to the current block.
+     * @brief      Adds the vertices and cut-vertices to their blocks.
      *
-     * @param[in]  vertex  The identifier of the vertex to add.
+     * @details    Each vertex of a block is an endpoint of one of the tree
+     *             edges of the block. Thus, a vertex belongs to the block of
+     *             the tree edge from its parent, which comes first, and to
+     *             the blocks of the tree edges to its children.
      */
-    void AddVertexToCurrentBlock(TVertexId vertex) {
-        bcTree_.blocksOfVertex_[vertex].push_back(CurrentBlockId());
-        CurrentBlock().vertices.push_back(vertex);
+    void AddVertices() {
+        std::vector<TVertexId> lastVertexOfBlock(blocks_.size(), Const::NONE);
+
+        for (TVertexId vertex : order_) {
+            auto & blocksOfVertex = bcTree_.blocksOfVertex_[vertex];
+            auto addBlock = [&](Types::blockId blockId) {
+                if (lastVertexOfBlock[blockId] == vertex) return;
+                lastVertexOfBlock[blockId] = vertex;
+                blocksOfVertex.push_back(blockId);
+                blocks_[blockId].vertices.push_back(vertex);
+            };
+
+            if (IsTreeEdgeAt(vertex)) {
+                addBlock(blockOfTreeEdge_[vertex]);
+            }
+            for_all_children_at(vertex, [this, &addBlock](TVertexId child) {
+                addBlock(blockOfTreeEdge_[child]);
+            });
+
+            if (blocksOfVertex.size() < 2) continue;
+
+            for (Types::blockId blockId : blocksOfVertex) {
+                blocks_[blockId].cutVertices.push_back(vertex);
+            }
+            bcTree_.cutVertices_[vertex].identifier_ = vertex;
+            bcTree_.cutVertices_[vertex].blocks_     = blocksOfVertex;
+            ++bcTree_.numberOfCutVertices_;
+        }
     }
+    /// @}
 
-    void AddCutVertexToBlock(TVertexId vertex) {
-        ESSENTIAL_ASSERT(this->IsArticulationVertexAt(vertex));
-        bcTree_.cutVertices_[vertex].blocks_.push_back(CurrentBlockId());
-        bcTree_.cutVertices_[vertex].identifier_ = vertex;
-        CurrentBlock().cutVertices.push_back(vertex);
+    /// @name Spanning Tree
+    /// @{
+#pragma mark SPANNING_TREE
+    /**
+     * @brief      Whether the tree edge from the parent of @p vertex exists.
+     *
+     * @param[in]  vertex  The vertex.
+     *
+     * @return     @c true if @p vertex is reachable and not the root.
+     */
+    bool IsTreeEdgeAt(TVertexId vertex) const {
+        return parentEdge_[vertex] != Const::NONE;
     }
 
     /**
-     * @brief      The identifier of the current block.
+     * @brief      Whether an edge is a non-tree edge between reachable
+     *             vertices.
+     *
+     * @param[in]  edgeId  The edge.
+     * @param[in]  vertex  One endpoint.
+     * @param[in]  other   The other endpoint.
      *
-     * @return     The identifier of the current block.
+     * @return     @c true if the edge is a non-tree edge, @c false otherwise.
      */
-    Types::index CurrentBlockId() const {
-        ESSENTIAL_ASSERT(!blockStack_.empty());
-        return blockStack_.top().identifier;
+    bool IsNonTreeEdge(TEdgeId edgeId, TVertexId vertex, TVertexId other) const {
+        return vertex != other
+            && edgeId != parentEdge_[vertex]
+            && edgeId != parentEdge_[other];
     }
 
-    BlockUnderConstruction & CurrentBlock() {
-        ESSENTIAL_ASSERT(!blockStack_.empty());
-        return blockStack_.top();
+    /**
+     * @brief      Whether @p ancestor is an ancestor of @p vertex in the
+     *             spanning tree.
+     *
+     * @param[in]  ancestor  The potential ancestor.
+     * @param[in]  vertex    The vertex.
+     *
+     * @return     @c true if @p vertex is in the subtree of @p ancestor.
+     */
+    bool IsAncestor(TVertexId ancestor, TVertexId vertex) const {
+        return preorder_[ancestor] <= preorder_[vertex]
+            && preorder_[vertex] < preorder_[ancestor] + subtreeSize_[ancestor];
     }
-    /// @}
 
-    struct BlockUnderConstruction {
-        using TBlock = typename BlockCutTree<TGraph>::Block;
+    /**
+     * @brief      The @c for loop over all children of a vertex.
+     *
+     * @param[in]  vertex    The vertex.
+     * @param[in]  function  The function that is called for each child.
+     *
+     * @tparam     FUNCTION  The type of the function object.
+     */
+    template<typename FUNCTION>
+    void for_all_children_at(TVertexId vertex, FUNCTION function) const {
+        csr_.for_all_incident_edges_at(vertex,
+            [this, &function](TEdgeId edgeId, TVertexId other) {
+                if (edgeId == parentEdge_[other]) function(other);
+            });
+    }
 
-        BlockUnderConstruction(Types::blockId id, TTime time)
-        : identifier(id),
-          timeOfOldestVertex(time)
-        {}
+    /**
+     * @brief      Calls @p function for all vertices, level by level from
+     *             the root.
+     *
+     * @details    The vertices of a level are processed in parallel.
+     *
+     * @param[in]  function  The function that is called for each vertex.
+     *
+     * @tparam     FUNCTION  The type of the function object.
+     */
+    template<typename FUNCTION>
+    void for_all_levels_top_down(FUNCTION function) const {
+        for (Types::index level = 0; level + 1 < levelBegin_.size(); ++level) {
+            for_all_vertices_on_level(level, function);
+        }
+    }
 
-        Types::blockId         identifier;
-        TTime                  timeOfOldestVertex;
-        std::vector<TVertexId> vertices;
-        std::vector<TEdgeId>   edges;
-        std::vector<TVertexId> cutVertices;
+    /**
+     * @brief      Calls @p function for all vertices, level by level from
+     *             the deepest level.
+     *
+     * @details    The vertices of a level are processed in parallel.
+     *
+     * @param[in]  function  The function that is called for each vertex.
+     *
+     * @tparam     FUNCTION  The type of the function object.
+     */
+    template<typename FUNCTION>
+    void for_all_levels_bottom_up(FUNCTION function) const {
+        for (Types::index level = levelBegin_.size() - 1; level-- > 0;) {
+            for_all_vertices_on_level(level, function);
+        }
+    }
 
-        TBlock ToBlock(TGraph const & graph) && {
-            return TBlock(identifier,
-                          Subgraph(&graph, std::move(vertices), std::move(edges)),
-                          std::move(cutVertices));
+    /**
+     * @brief      Calls @p function for all vertices on a level in parallel.
+     *
+     * @param[in]  level     The level.
+     * @param[in]  function  The function that is called for each vertex.
+     *
+     * @tparam     FUNCTION  The type of the function object.
+     */
+    template<typename FUNCTION>
+    void for_all_vertices_on_level(Types::index level, FUNCTION & function) const {
+        Types::index const begin = levelBegin_[level];
+        Types::index const end   = levelBegin_[level + 1];
+
+#ifdef OPENMP_AVAILABLE
+        #pragma omp parallel for schedule ( static ) if ( end - begin > 1024 )
+#endif // OPENMP_AVAILABLE
+        for (Types::index position = begin; position < end; ++position) {
+            function(order_[position]);
         }
-    };
+    }
+    /// @}
 
 #pragma mark MEMBERS
 
     TGraph const & graph_;
+    CsrGraph csr_;                                  /**< The packed adjacency of the graph. */
     egoa::BlockCutTree<TGraph> bcTree_;
-    Types::index nextBlockId_ = 0;
-    VectorStack<BlockUnderConstruction> blockStack_;
+    TVertexId root_;                                /**< The root of the spanning tree. */
+    std::vector<TVertexId> order_;                  /**< The reachable vertices in breadth-first order. */
+    std::vector<Types::index> levelBegin_;          /**< The first position of each level in order_ and a sentinel. */
+    std::vector<TVertexId> parent_;                 /**< The parent of each vertex, the root is its own parent. */
+    std::vector<TEdgeId> parentEdge_;               /**< The tree edge from the parent of each vertex. */
+    std::vector<Types::index> preorder_;            /**< The preorder number of each vertex. */
+    std::vector<Types::count> subtreeSize_;         /**< The number of vertices in the subtree of each vertex. */
+    std::vector<Types::index> low_;                 /**< The lowest preorder number reachable from the subtree. */
+    std::vector<Types::index> high_;                /**< The highest preorder number reachable from the subtree. */
+    std::vector<Types::blockId> blockOfTreeEdge_;   /**< The block of the tree edge from the parent of each vertex. */
+    std::vector<TBlock> blocks_;                    /**< The blocks in the order of their identifiers. */
 };
 
 } // namespace internal
@@ -0,0 +1,310 @@
+/*
+ * CsrGraph.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__GRAPHS__CSR_GRAPH_HPP
+#define EGOA__DATA_STRUCTURES__GRAPHS__CSR_GRAPH_HPP
+
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      A frozen adjacency structure in compressed sparse row (CSR)
+ *     format.
+ * @details    The incident edges of all vertices are packed into three
+ *     contiguous arrays. For a vertex @f$\vertex\in\vertices@f$ the entries
+ *     @f$[\text{offset}(\vertex), \text{offset}(\vertex+1))@f$ contain the
+ *     identifiers of the incident edges and the identifiers of the
+ *     respective other endpoints. The incoming edges are stored before the
+ *     outgoing edges, i.e., the order of the entries is the same as the one
+ *     of @p for_all_edges_at on the graph the structure was built from.
+ *
+ *     Since the other endpoint is stored next to the edge identifier, a
+ *     neighborhood scan does not need to touch the edge objects to call
+ *     @p edge.Other(vertexId).
+ *
+ *     The structure stores identifiers only. Thus, it stays valid as long as
+ *     no vertex or edge is added to or removed from the graph.
+ *
+ * @code{.cpp}
+ *      CsrGraph csr ( graph );
+ *      csr.for_all_incident_edges_at ( vertexId,
+ *          []( Types::edgeId edgeId, Types::vertexId other )
+ *          {
+ *              // Do something with the edge identifier and the neighbor.
+ *          }
+ *      );
+ * @endcode
+ *
+ * @see        StaticGraph#Freeze
+ */
+class CsrGraph {
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            CsrGraph()
+            : offsets_( 1, 0 )
+            , inEnds_()
+            , neighbors_()
+            , edgeIds_()
+            {}
+
+            /**
+             * @brief      Constructs the CSR representation of @p graph.
+             *
+             * @param      graph      The graph @f$\graph = (\vertices, \edges)@f$.
+             *
+             * @tparam     GraphType  The graph type that provides @p
+             *     InEdgeIdsAt, @p OutEdgeIdsAt, and @p EdgeAt, e.g., @p
+             *     StaticGraph.
+             */
+            template<typename GraphType>
+            explicit CsrGraph ( GraphType const & graph )
+            : CsrGraph()
+            {
+                Build ( graph );
+            }
+        ///@}
+
+        ///@name Build
+        ///@{
+#pragma mark BUILD
+
+            /**
+             * @brief      Packs the adjacency of @p graph.
+             * @details    Any previous content is discarded. The
+             *     construction takes @f$\Theta(n + m)@f$ time.
+             *
+             * @param      graph      The graph @f$\graph = (\vertices, \edges)@f$.
+             *
+             * @tparam     GraphType  The graph type.
+             */
+            template<typename GraphType>
+            inline void Build ( GraphType const & graph )
+            {
+                Types::count const numberOfVertices = graph.NumberOfVertices();
+
+                offsets_.assign ( numberOfVertices + 1, 0 );
+                inEnds_.assign  ( numberOfVertices,     0 );
+                neighbors_.clear();
+                edgeIds_.clear();
+                neighbors_.reserve ( 2 * graph.NumberOfEdges() );
+                edgeIds_.reserve   ( 2 * graph.NumberOfEdges() );
+
+                for ( Types::vertexId vertexId = 0
+                    ; vertexId < numberOfVertices
+                    ; ++vertexId )
+                {
+                    for ( Types::edgeId edgeId : graph.InEdgeIdsAt ( vertexId ) )
+                    {
+                        neighbors_.emplace_back ( graph.EdgeAt ( edgeId ).Source() );
+                        edgeIds_.emplace_back   ( edgeId );
+                    }
+                    inEnds_[vertexId] = edgeIds_.size();
+                    for ( Types::edgeId edgeId : graph.OutEdgeIdsAt ( vertexId ) )
+                    {
+                        neighbors_.emplace_back ( graph.EdgeAt ( edgeId ).Target() );
+                        edgeIds_.emplace_back   ( edgeId );
+                    }
+                    offsets_[vertexId + 1] = edgeIds_.size();
+                }
+
+                ESSENTIAL_ASSERT ( neighbors_.size() == edgeIds_.size() );
+            }
+
+            /**
+             * @brief      Removes all entries.
+             */
+            inline void Clear()
+            {
+                offsets_.assign ( 1, 0 );
+                inEnds_.clear();
+                neighbors_.clear();
+                edgeIds_.clear();
+            }
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            /**
+             * @brief      Number of vertices @f$n = |\vertices|@f$.
+             *
+             * @return     The number of vertices.
+             */
+            inline Types::count NumberOfVertices() const
+            {
+                return offsets_.size() - 1;
+            }
+
+            /**
+             * @brief      Number of entries, i.e., @f$2m@f$ for @f$m =
+             *     |\edges|@f$.
+             *
+             * @return     The number of entries.
+             */
+            inline Types::count NumberOfEntries() const
+            {
+                return edgeIds_.size();
+            }
+
+            /**
+             * @brief      Whether the structure contains no vertex.
+             *
+             * @return     @p true if there is no vertex, @p false otherwise.
+             */
+            inline bool Empty() const
+            {
+                return NumberOfVertices() == 0;
+            }
+
+            /**
+             * @brief      The number of edges incident to a vertex.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     The degree of the vertex.
+             */
+            inline Types::count DegreeAt ( Types::vertexId vertexId ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfVertices() );
+                return offsets_[vertexId + 1] - offsets_[vertexId];
+            }
+
+            /**
+             * @brief      The number of incoming edges of a vertex.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     The indegree of the vertex.
+             */
+            inline Types::count InDegreeAt ( Types::vertexId vertexId ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfVertices() );
+                return inEnds_[vertexId] - offsets_[vertexId];
+            }
+
+            /**
+             * @brief      The number of outgoing edges of a vertex.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     The outdegree of the vertex.
+             */
+            inline Types::count OutDegreeAt ( Types::vertexId vertexId ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfVertices() );
+                return offsets_[vertexId + 1] - inEnds_[vertexId];
+            }
+
+            /**
+             * @brief      The first entry of a vertex.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     The index of the first entry of @p vertexId.
+             */
+            inline Types::index BeginAt ( Types::vertexId vertexId ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfVertices() );
+                return offsets_[vertexId];
+            }
+
+            /**
+             * @brief      The entry behind the last entry of a vertex.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             *
+             * @return     The index behind the last entry of @p vertexId.
+             */
+            inline Types::index EndAt ( Types::vertexId vertexId ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfVertices() );
+                return offsets_[vertexId + 1];
+            }
+
+            /**
+             * @brief      The other endpoint stored at an entry.
+             *
+             * @param[in]  index  The index of the entry.
+             *
+             * @return     The identifier of the neighbor.
+             */
+            inline Types::vertexId NeighborAt ( Types::index index ) const
+            {
+                USAGE_ASSERT ( index < NumberOfEntries() );
+                return neighbors_[index];
+            }
+
+            /**
+             * @brief      The edge identifier stored at an entry.
+             *
+             * @param[in]  index  The index of the entry.
+             *
+             * @return     The identifier of the edge.
+             */
+            inline Types::edgeId EdgeIdAt ( Types::index index ) const
+            {
+                USAGE_ASSERT ( index < NumberOfEntries() );
+                return edgeIds_[index];
+            }
+        ///@}
+
+        ///@name Neighborhood Loops
+        ///@{
+#pragma mark NEIGHBORHOOD_LOOPS
+
+            /**
+             * @brief      The @p for loop over all edges at a vertex.
+             * @details    This is a loop over incoming and outgoing edges.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             * @param[in]  function  The function object that is called for
+             *     all incident edges. It must accept two arguments of types
+             *     @p Types::edgeId and @p Types::vertexId, e.g.,
+             * @code{.cpp}
+             *      []( Types::edgeId edgeId, Types::vertexId other )
+             *      {
+             *          // Do something with the edge and the other endpoint.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline void for_all_incident_edges_at ( Types::vertexId vertexId
+                                                  , FUNCTION        function ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfVertices() );
+                Types::index const end = offsets_[vertexId + 1];
+                for ( Types::index index = offsets_[vertexId]
+                    ; index < end
+                    ; ++index )
+                {
+                    function ( edgeIds_[index], neighbors_[index] );
+                }
+            }
+        ///@}
+
+#pragma mark MEMBERS
+    private:
+        std::vector<Types::index>       offsets_;       /**< The first entry per vertex and a sentinel, size n + 1 */
+        std::vector<Types::index>       inEnds_;        /**< The first entry of the outgoing edges per vertex */
+        std::vector<Types::vertexId>    neighbors_;     /**< The other endpoint per entry */
+        std::vector<Types::edgeId>      edgeIds_;       /**< The edge identifier per entry */
+};
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__GRAPHS__CSR_GRAPH_HPP
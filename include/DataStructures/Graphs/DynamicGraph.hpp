@@ -1454,6 +1454,38 @@ public:
                 ::for_all_edges_at ( *this, vertexId, function );
         }
 
+        /**
+         * @brief      The @p for loop over all edges at a vertex together with
+         *     the other endpoint of the edge.
+         * @details    This is a loop over incoming and outgoing edges in the
+         *     same order as @p for_all_edges_at.
+         *
+         * @pre        There is a vertex with identifier @p vertexId.
+         *
+         * @param[in]  vertexId  The vertex identifier.
+         * @param[in]  function  The function object that is called for all edges at
+         *                       the vertex. It must accept two arguments of types
+         *                       @p TEdge and @p Types::vertexId, e.g.,
+         * @code{.cpp}
+         *      []( TEdge const & edge, Types::vertexId other )
+         *      {
+         *          // Do something with the edge object and the neighbor.
+         *      }
+         * @endcode
+         *
+         * @tparam     Policy   The execution policy.
+         * @tparam     FUNCTION The type of the function object.
+         */
+        template<ExecutionPolicy Policy = ExecutionPolicy::sequential, typename FUNCTION>
+        inline
+        void for_all_incident_edges_at ( Types::vertexId vertexId
+                                       , FUNCTION        function ) const
+        {
+            USAGE_ASSERT( VertexExists(vertexId) );
+            internal::DynamicGraphLoopDifferentiation<TGraph const, Policy>
+                ::for_all_incident_edges_at ( *this, vertexId, function );
+        }
+
         /**
          * @brief      The @p for loop over all incoming edges of a vertex.
          *
@@ -0,0 +1,448 @@
+/*
+ * ElectricalPropertyColumns.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__DATA_STRUCTURES__GRAPHS__ELECTRICAL_PROPERTY_COLUMNS_HPP
+#define EGOA__DATA_STRUCTURES__GRAPHS__ELECTRICAL_PROPERTY_COLUMNS_HPP
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "DataStructures/Graphs/Edges/Type.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      The branch attributes that are stored as columns.
+ * @details    The susceptances are precomputed for both carriers, i.e.,
+ *     @f$-1/x@f$ for the DC approximation and @f$-x/(r^2+x^2)@f$ for AC,
+ *     and are 0 if the denominator is 0. The susceptance norm is
+ *     @f$|b^{-1}|@f$ of the DC susceptance @f$b@f$, which is the length of
+ *     the branch in SusceptanceNormLabel.
+ */
+enum class BranchColumn : Types::index {
+    resistance          = 0
+  , reactance           = 1
+  , dcSusceptance       = 2
+  , acSusceptance       = 3
+  , susceptanceNorm     = 4
+  , thermalLimit        = 5
+  , thetaBoundMinimum   = 6
+  , thetaBoundMaximum   = 7
+};
+
+/**
+ * @brief      The bus attributes that are stored as columns.
+ */
+enum class BusColumn : Types::index {
+    shuntConductance    = 0
+  , shuntSusceptance    = 1
+  , nominalVoltage      = 2
+  , minimumVoltage      = 3
+  , maximumVoltage      = 4
+};
+
+/**
+ * @brief      A structure-of-arrays copy of the electrical properties of
+ *     the buses and branches of a graph.
+ * @details    Each attribute is stored in its own contiguous column that is
+ *     indexed by the vertex or edge identifier. Thus, a scan over one
+ *     attribute, e.g., the susceptance of the incident edges in the label
+ *     relaxation of DominatingThetaPath, loads only this attribute instead
+ *     of whole Vertices::ElectricalProperties or Edges::ElectricalProperties
+ *     objects. The column is selected at compile time.
+ *
+ *     Since the susceptances are computed once, reading them does neither
+ *     branch on the carrier nor divide, in contrast to
+ *     Edges::CarrierDifferentiation.
+ *
+ *     The columns are a copy, i.e., they are not updated if the properties
+ *     of the graph change and have to be rebuilt by calling @p Build again.
+ *
+ * @code{.cpp}
+ *      ElectricalPropertyColumns columns ( graph );
+ *      Types::real susceptance = columns.Susceptance<Edges::CarrierDifferentiationType::DC>( edgeId );
+ *
+ *      Types::real const * reactances = columns.BranchData<BranchColumn::reactance>();
+ * @endcode
+ *
+ * @see        StaticGraph#BuildPropertyColumns
+ */
+class ElectricalPropertyColumns {
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            ElectricalPropertyColumns()
+            : busColumns_()
+            , branchColumns_()
+            , branchStatus_()
+            {}
+
+            /**
+             * @brief      Constructs the columns of @p graph.
+             *
+             * @param      graph      The graph @f$\graph = (\vertices, \edges)@f$.
+             *
+             * @tparam     GraphType  The graph type with electrical vertex and
+             *     edge properties, e.g., @p StaticGraph.
+             */
+            template<typename GraphType>
+            explicit ElectricalPropertyColumns ( GraphType const & graph )
+            : ElectricalPropertyColumns()
+            {
+                Build ( graph );
+            }
+        ///@}
+
+        ///@name Build
+        ///@{
+#pragma mark BUILD
+
+            /**
+             * @brief      Copies the electrical properties of @p graph into
+             *     the columns.
+             * @details    Any previous content is discarded. The
+             *     construction takes @f$\Theta(n + m)@f$ time.
+             *
+             * @pre        The vertex and edge identifiers of @p graph are
+             *     @f$0,\ldots,n-1@f$ and @f$0,\ldots,m-1@f$, respectively.
+             *
+             * @param      graph      The graph @f$\graph = (\vertices, \edges)@f$.
+             *
+             * @tparam     GraphType  The graph type.
+             */
+            template<typename GraphType>
+            inline void Build ( GraphType const & graph )
+            {
+                Types::count const numberOfVertices = graph.NumberOfVertices();
+                Types::count const numberOfEdges    = graph.NumberOfEdges();
+
+                for ( auto & column : busColumns_ )    column.assign ( numberOfVertices, 0.0 );
+                for ( auto & column : branchColumns_ ) column.assign ( numberOfEdges,    0.0 );
+                branchStatus_.assign ( numberOfEdges, false );
+
+                for ( Types::vertexId vertexId = 0; vertexId < numberOfVertices; ++vertexId )
+                {
+                    auto const & properties = graph.VertexAt ( vertexId ).Properties();
+                    BusEntry<BusColumn::shuntConductance>( vertexId ) = properties.ShuntConductance();
+                    BusEntry<BusColumn::shuntSusceptance>( vertexId ) = properties.ShuntSusceptance();
+                    BusEntry<BusColumn::nominalVoltage>  ( vertexId ) = properties.NominalVoltage();
+                    BusEntry<BusColumn::minimumVoltage>  ( vertexId ) = properties.MinimumVoltage();
+                    BusEntry<BusColumn::maximumVoltage>  ( vertexId ) = properties.MaximumVoltage();
+                }
+
+                for ( Types::edgeId edgeId = 0; edgeId < numberOfEdges; ++edgeId )
+                {
+                    UpdateBranch ( graph, edgeId );
+                }
+            }
+
+            /**
+             * @brief      Copies the electrical properties of an edge of
+             *     @p graph into the branch columns.
+             *
+             * @pre        The columns were built for @p graph, i.e., @p
+             *     edgeId is smaller than #NumberOfBranches.
+             *
+             * @param      graph      The graph @f$\graph = (\vertices, \edges)@f$.
+             * @param[in]  edgeId     The identifier of the edge.
+             *
+             * @tparam     GraphType  The graph type.
+             */
+            template<typename GraphType>
+            inline void UpdateBranch ( GraphType const & graph
+                                     , Types::edgeId     edgeId )
+            {
+                USAGE_ASSERT ( edgeId < NumberOfBranches() );
+
+                auto const & properties = graph.EdgeAt ( edgeId ).Properties();
+                Types::real const resistance = properties.Resistance();
+                Types::real const reactance  = properties.Reactance();
+                Types::real const squareImpedanceMagnitude = resistance * resistance + reactance * reactance;
+                // Avoid the program exit of the carrier differentiation for r = x = 0
+                Types::real const dcSusceptance = ( reactance != 0 ) ? -1 / reactance : 0.0;
+                Types::real const acSusceptance = ( squareImpedanceMagnitude != 0 ) ? -reactance / squareImpedanceMagnitude : 0.0;
+
+                BranchEntry<BranchColumn::resistance>       ( edgeId ) = resistance;
+                BranchEntry<BranchColumn::reactance>        ( edgeId ) = reactance;
+                BranchEntry<BranchColumn::dcSusceptance>    ( edgeId ) = dcSusceptance;
+                BranchEntry<BranchColumn::acSusceptance>    ( edgeId ) = acSusceptance;
+                BranchEntry<BranchColumn::susceptanceNorm>  ( edgeId ) = std::fabs ( 1 / dcSusceptance );
+                BranchEntry<BranchColumn::thermalLimit>     ( edgeId ) = properties.ThermalLimit();
+                BranchEntry<BranchColumn::thetaBoundMinimum>( edgeId ) = properties.ThetaBound().Minimum();
+                BranchEntry<BranchColumn::thetaBoundMaximum>( edgeId ) = properties.ThetaBound().Maximum();
+                branchStatus_[edgeId] = properties.Status();
+            }
+
+            /**
+             * @brief      Removes all entries.
+             */
+            inline void Clear()
+            {
+                for ( auto & column : busColumns_ )    column.clear();
+                for ( auto & column : branchColumns_ ) column.clear();
+                branchStatus_.clear();
+            }
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            /**
+             * @brief      Number of buses @f$n = |\vertices|@f$.
+             *
+             * @return     The number of buses.
+             */
+            inline Types::count NumberOfBuses() const
+            {
+                return busColumns_[0].size();
+            }
+
+            /**
+             * @brief      Number of branches @f$m = |\edges|@f$.
+             *
+             * @return     The number of branches.
+             */
+            inline Types::count NumberOfBranches() const
+            {
+                return branchColumns_[0].size();
+            }
+        ///@}
+
+        ///@name Column Access
+        ///@{
+#pragma mark COLUMN_ACCESS
+
+            /**
+             * @brief      The attribute @p Column of a bus.
+             *
+             * @param[in]  vertexId  The identifier of the bus.
+             *
+             * @tparam     Column    The attribute.
+             *
+             * @return     The value of the attribute.
+             */
+            template<BusColumn Column>
+            inline Types::real Bus ( Types::vertexId vertexId ) const
+            {
+                USAGE_ASSERT ( vertexId < NumberOfBuses() );
+                return std::get<static_cast<Types::index>( Column )>( busColumns_ )[vertexId];
+            }
+
+            /**
+             * @brief      The attribute @p Column of a branch.
+             *
+             * @param[in]  edgeId  The identifier of the branch.
+             *
+             * @tparam     Column  The attribute.
+             *
+             * @return     The value of the attribute.
+             */
+            template<BranchColumn Column>
+            inline Types::real Branch ( Types::edgeId edgeId ) const
+            {
+                USAGE_ASSERT ( edgeId < NumberOfBranches() );
+                return std::get<static_cast<Types::index>( Column )>( branchColumns_ )[edgeId];
+            }
+
+            /**
+             * @brief      The precomputed susceptance of a branch.
+             *
+             * @param[in]  edgeId       The identifier of the branch.
+             *
+             * @tparam     CarrierType  The carrier, i.e., AC or DC.
+             *
+             * @return     The susceptance @f$b@f$ of the branch.
+             */
+            template<Edges::CarrierDifferentiationType CarrierType>
+            inline Types::real Susceptance ( Types::edgeId edgeId ) const
+            {
+                static_assert ( CarrierType == Edges::CarrierDifferentiationType::AC
+                             || CarrierType == Edges::CarrierDifferentiationType::DC
+                              , "Only the AC and DC susceptances are precomputed." );
+                if constexpr ( CarrierType == Edges::CarrierDifferentiationType::AC )
+                {
+                    return Branch<BranchColumn::acSusceptance> ( edgeId );
+                } else {
+                    return Branch<BranchColumn::dcSusceptance> ( edgeId );
+                }
+            }
+
+            /**
+             * @brief      Whether a branch is switched on.
+             *
+             * @param[in]  edgeId  The identifier of the branch.
+             *
+             * @return     The status of the branch.
+             */
+            inline bool IsActive ( Types::edgeId edgeId ) const
+            {
+                USAGE_ASSERT ( edgeId < NumberOfBranches() );
+                return branchStatus_[edgeId];
+            }
+
+            /**
+             * @brief      The column of the attribute @p Column of all buses.
+             *
+             * @tparam     Column  The attribute.
+             *
+             * @return     The pointer to the value of bus 0, where the value
+             *     of bus @f$i@f$ is at offset @f$i@f$.
+             */
+            template<BusColumn Column>
+            inline Types::real const * BusData () const
+            {
+                return std::get<static_cast<Types::index>( Column )>( busColumns_ ).data();
+            }
+
+            /**
+             * @brief      The column of the attribute @p Column of all
+             *     branches.
+             *
+             * @tparam     Column  The attribute.
+             *
+             * @return     The pointer to the value of branch 0, where the
+             *     value of branch @f$i@f$ is at offset @f$i@f$.
+             */
+            template<BranchColumn Column>
+            inline Types::real const * BranchData () const
+            {
+                return std::get<static_cast<Types::index>( Column )>( branchColumns_ ).data();
+            }
+        ///@}
+
+    private:
+        template<BusColumn Column>
+        inline Types::real & BusEntry ( Types::vertexId vertexId )
+        {
+            return std::get<static_cast<Types::index>( Column )>( busColumns_ )[vertexId];
+        }
+
+        template<BranchColumn Column>
+        inline Types::real & BranchEntry ( Types::edgeId edgeId )
+        {
+            return std::get<static_cast<Types::index>( Column )>( branchColumns_ )[edgeId];
+        }
+
+#pragma mark MEMBERS
+        std::array<std::vector<Types::real>, 5> busColumns_;       /**< One column per bus attribute, see BusColumn */
+        std::array<std::vector<Types::real>, 8> branchColumns_;    /**< One column per branch attribute, see BranchColumn */
+        std::vector<bool>                       branchStatus_;     /**< The status of each branch */
+};
+
+/**
+ * @brief      An edge together with the property columns of its graph.
+ * @details    The view is passed to the labels instead of the edge, e.g.,
+ *     in the relaxation of DominatingThetaPath. A label reads the
+ *     precomputed attributes of the edge from the columns instead of
+ *     computing them from the edge properties.
+ *
+ * @code{.cpp}
+ *      EdgeColumnView<TEdge> view ( edge, graph.PropertyColumns() );
+ *      std::pair<TLabel, bool> result = label + view;
+ * @endcode
+ *
+ * @tparam     EdgeType  The edge type, e.g., Edges::Edge<Edges::ElectricalProperties>.
+ *
+ * @see        SusceptanceNormLabel
+ * @see        VoltageAngleDifferenceLabel
+ */
+template<typename EdgeType>
+class EdgeColumnView {
+    public:
+        using TEdge = EdgeType;
+
+        EdgeColumnView ( TEdge                     const & edge
+                       , ElectricalPropertyColumns const & columns )
+        : edge_( edge )
+        , columns_( columns )
+        {
+            USAGE_ASSERT ( edge.Identifier() < columns.NumberOfBranches() );
+        }
+
+        /**
+         * @brief      The identifier of the edge.
+         *
+         * @return     The edge identifier.
+         */
+        inline Types::edgeId Identifier () const
+        {
+            return edge_.Identifier();
+        }
+
+        /**
+         * @brief      The other endpoint of the edge.
+         *
+         * @param[in]  vertexId  One endpoint of the edge.
+         *
+         * @return     The other endpoint.
+         */
+        inline Types::vertexId Other ( Types::vertexId vertexId ) const
+        {
+            return edge_.Other ( vertexId );
+        }
+
+        /**
+         * @brief      The attribute @p Column of the edge.
+         *
+         * @tparam     Column  The attribute.
+         *
+         * @return     The value of the attribute.
+         */
+        template<BranchColumn Column>
+        inline Types::real Branch () const
+        {
+            return columns_.template Branch<Column> ( edge_.Identifier() );
+        }
+
+        /**
+         * @brief      The edge.
+         *
+         * @return     The edge.
+         */
+        inline TEdge const & Edge () const
+        {
+            return edge_;
+        }
+
+    private:
+#pragma mark MEMBERS
+        TEdge                     const & edge_;      /**< The edge */
+        ElectricalPropertyColumns const & columns_;   /**< The property columns of the graph of the edge */
+};
+
+namespace internal {
+
+/**
+ * @brief      Whether a graph of type @p GraphType can hold property
+ *     columns, e.g., StaticGraph.
+ *
+ * @tparam     GraphType  The graph type.
+ */
+template<typename GraphType, typename = void>
+struct HasPropertyColumns : std::false_type {};
+
+template<typename GraphType>
+struct HasPropertyColumns< GraphType
+                         , std::void_t< decltype ( std::declval<GraphType &>().BuildPropertyColumns() )
+                                      , decltype ( std::declval<GraphType &>().PropertiesChanged() ) > >
+    : std::true_type {};
+
+} // namespace internal
+
+} // namespace egoa
+
+#endif // EGOA__DATA_STRUCTURES__GRAPHS__ELECTRICAL_PROPERTY_COLUMNS_HPP
@@ -19,6 +19,8 @@
 
 #include "Exceptions/Assertions.hpp"
 
+#include "DataStructures/Graphs/CsrGraph.hpp"
+#include "DataStructures/Graphs/ElectricalPropertyColumns.hpp"
 #include "DataStructures/Graphs/Edges/Edge.hpp"
 #include "DataStructures/Graphs/Vertices/Vertex.hpp"
 
@@ -74,10 +76,16 @@ class StaticGraph {
 
             StaticGraph()
             : name_("")
+            , isFrozen_(false)
+            , hasPropertyColumns_(false)
+            , arePropertiesChanged_(false)
             {}
 
             explicit StaticGraph ( Types::name name )
             : name_(std::move(name))
+            , isFrozen_(false)
+            , hasPropertyColumns_(false)
+            , arePropertiesChanged_(false)
             {}
         ///@}
 
@@ -240,6 +248,9 @@ class StaticGraph {
              */
             inline Types::vertexId AddVertex ( TVertexProperties && properties )
             {
+                Thaw();
+                DropPropertyColumns();
+
                 Types::vertexId id  = vertices_.size();
                 vertices_.emplace_back( id, std::move(properties) );
                 inEdgeIds_.emplace_back( std::vector<Types::edgeId>() );
@@ -676,6 +687,9 @@ class StaticGraph {
                 USAGE_ASSERT ( VertexExists(source) );
                 USAGE_ASSERT ( VertexExists(target) );
 
+                Thaw();
+                DropPropertyColumns();
+
                 Types::edgeId id = edges_.size();
 
                 edges_.emplace_back ( id, source, target, std::move(properties) );
@@ -740,6 +754,165 @@ class StaticGraph {
             inline TEdge const & Edge   ( char source, int  target ) const = delete;
         ///@}
 
+        ///@name Frozen Adjacency
+        ///@{
+#pragma mark FROZEN_ADJACENCY
+
+            /**
+             * @brief      Packs the adjacency into a contiguous CSR
+             *     representation.
+             * @details    After freezing, the neighborhood loops
+             *     @p for_all_edges_at and @p for_all_incident_edges_at scan
+             *     contiguous arrays instead of one vector per vertex, and the
+             *     other endpoint of an edge is read from the packed array.
+             *     The order of the incident edges does not change.
+             *
+             *     Adding a vertex or an edge thaws the graph, i.e., the CSR
+             *     representation is dropped and has to be rebuilt by calling
+             *     @p Freeze again.
+             *
+             * @see        CsrGraph
+             */
+            inline void Freeze()
+            {
+                csr_.Build ( *this );
+                isFrozen_ = true;
+            }
+
+            /**
+             * @brief      Drops the CSR representation.
+             */
+            inline void Thaw()
+            {
+                if ( !isFrozen_ ) return;
+                csr_.Clear();
+                isFrozen_ = false;
+            }
+
+            /**
+             * @brief      Whether the adjacency is packed in CSR format.
+             *
+             * @return     @p true if the graph is frozen, @p false otherwise.
+             */
+            inline bool IsFrozen() const
+            {
+                return isFrozen_;
+            }
+
+            /**
+             * @brief      The CSR representation of the adjacency.
+             *
+             * @pre        The graph is frozen.
+             *
+             * @return     The CSR representation.
+             */
+            inline CsrGraph const & Csr() const
+            {
+                USAGE_ASSERT ( IsFrozen() );
+                return csr_;
+            }
+        ///@}
+
+        ///@name Property Columns
+        ///@{
+#pragma mark PROPERTY_COLUMNS
+
+            /**
+             * @brief      Copies the electrical properties of the vertices
+             *     and edges into contiguous columns.
+             * @details    The columns are optional and only available for
+             *     graphs with electrical vertex and edge properties. They
+             *     are a copy that is dropped if a vertex or an edge is
+             *     added. The accessors do not track changes of the
+             *     properties, thus, the code that changes properties, e.g.,
+             *     via the non-const @p EdgeAt or @p for_all_edges, either
+             *     refreshes the columns of the changed edges, see
+             *     @p RefreshPropertyColumns, or announces the changes by
+             *     @p PropertiesChanged.
+             *
+             * @see        ElectricalPropertyColumns
+             * @see        RefreshPropertyColumns
+             */
+            inline void BuildPropertyColumns()
+            {
+                propertyColumns_.Build ( *this );
+                hasPropertyColumns_   = true;
+                arePropertiesChanged_ = false;
+            }
+
+            /**
+             * @brief      Copies the electrical properties of some edges
+             *     into the property columns.
+             * @details    The columns stay current if @p edgeIds contains
+             *     every edge whose properties changed since the columns
+             *     were built or refreshed. Columns that are outdated as a
+             *     whole, see @p PropertiesChanged, have to be rebuilt. If
+             *     the columns were not built, nothing happens. The refresh
+             *     takes @f$\Theta(k)@f$ time for @f$k@f$ edges and must not
+             *     run concurrently with algorithms that read the columns.
+             *
+             * @param[in]  edgeIds  The identifiers of the changed edges.
+             */
+            inline void RefreshPropertyColumns ( std::vector<Types::edgeId> const & edgeIds )
+            {
+                if ( !hasPropertyColumns_ ) return;
+                USAGE_ASSERT ( propertyColumns_.NumberOfBranches() == NumberOfEdges() );
+
+                for ( Types::edgeId edgeId : edgeIds )
+                {
+                    USAGE_ASSERT ( EdgeExists ( edgeId ) );
+                    propertyColumns_.UpdateBranch ( *this, edgeId );
+                }
+            }
+
+            /**
+             * @brief      Drops the property columns.
+             */
+            inline void DropPropertyColumns()
+            {
+                if ( !hasPropertyColumns_ ) return;
+                propertyColumns_.Clear();
+                hasPropertyColumns_   = false;
+                arePropertiesChanged_ = false;
+            }
+
+            /**
+             * @brief      Announces that vertex or edge properties changed.
+             * @details    The property columns become outdated, i.e.,
+             *     @p HasPropertyColumns returns @p false until they are
+             *     rebuilt by @p BuildPropertyColumns.
+             */
+            inline void PropertiesChanged()
+            {
+                arePropertiesChanged_ = hasPropertyColumns_;
+            }
+
+            /**
+             * @brief      Whether the property columns are available.
+             *
+             * @return     @p true if the columns were built and are up to
+             *     date with the properties, @p false otherwise.
+             */
+            inline bool HasPropertyColumns() const
+            {
+                return hasPropertyColumns_
+                    && !arePropertiesChanged_;
+            }
+
+            /**
+             * @brief      The electrical properties in column format.
+             *
+             * @pre        The property columns are available.
+             *
+             * @return     The property columns.
+             */
+            inline ElectricalPropertyColumns const & PropertyColumns() const
+            {
+                USAGE_ASSERT ( HasPropertyColumns() );
+                return propertyColumns_;
+            }
+        ///@}
+
         /// @name Graph Properties
         /// @{
 #pragma mark GRAPH_PROPERTIES
@@ -1303,6 +1476,45 @@ class StaticGraph {
                     ::for_all_edges_at ( *this, vertexId, function );
             }
 
+            /**
+             * @brief      The @p for loop over all edges at a vertex together
+             *     with the other endpoint of the edge.
+             * @details    This is a loop over incoming and outgoing edges in
+             *     the same order as @p for_all_edges_at. If the graph is
+             *     frozen, the other endpoint is read from the CSR
+             *     representation and no call of @p edge.Other(vertexId) is
+             *     necessary.
+             *
+             * @pre        There is a vertex with identifier @p vertexId.
+             *
+             * @param[in]  vertexId  The vertex identifier.
+             * @param[in]  function  The function object that is called for
+             *                       all edges at the vertex. It must accept
+             *                       two arguments of types @p TEdge and @p
+             *                       Types::vertexId, e.g.,
+             * @code{.cpp}
+             *      for_all_incident_edges_at ( vertexId
+             *          , []( TEdge const & edge, Types::vertexId other )
+             *          {
+             *              // Do something with the edge and its other endpoint.
+             *          }
+             *      );
+             * @endcode
+             *
+             * @tparam     Policy    The execution policy.
+             * @tparam     FUNCTION  The function object that is called for
+             *     all incident edges at @p vertexId.
+             */
+            template<ExecutionPolicy Policy = ExecutionPolicy::sequential, typename FUNCTION>
+            inline
+            void for_all_incident_edges_at ( Types::vertexId const vertexId
+                                           , FUNCTION              function ) const
+            {
+                USAGE_ASSERT( VertexExists(vertexId) );
+                internal::StaticGraphLoopDifferentiation<TGraph const, Policy>
+                    ::for_all_incident_edges_at ( *this, vertexId, function );
+            }
+
             /**
              * @brief      The @p for loop over all incoming edges of a vertex.
              *
@@ -1556,6 +1768,13 @@ class StaticGraph {
 
         std::vector< std::vector<Types::edgeId> >       inEdgeIds_;         /**< Ids of the incoming edges per vertex */
         std::vector< std::vector<Types::edgeId> >       outEdgeIds_;        /**< Ids of the outgoing edges per vertex */
+
+        bool                                            isFrozen_;          /**< Whether the CSR representation is up to date */
+        CsrGraph                                        csr_;               /**< Packed adjacency, valid if the graph is frozen */
+
+        bool                                            hasPropertyColumns_;/**< Whether the property columns are built */
+        bool                                            arePropertiesChanged_; /**< Whether all columns are outdated, see PropertiesChanged */
+        ElectricalPropertyColumns                       propertyColumns_;   /**< Electrical properties in column format, a cache of the properties */
 };
 
 } // namespace egoa
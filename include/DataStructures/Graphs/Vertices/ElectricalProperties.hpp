@@ -146,6 +146,7 @@ class ElectricalProperties {
                 if ( Control()              != rhs.Control()            ) return false;
                 if ( Carrier()              != rhs.Carrier()            ) return false;
                 if ( Status()               != rhs.Status()             ) return false;
+                return true;
             }
         ///@}
 
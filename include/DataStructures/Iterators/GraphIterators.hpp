@@ -410,6 +410,44 @@ class GraphLoopDifferentiation<GraphType, ExecutionPolicy::sequential> {
                     function( graph.EdgeAt( edgeId ) );
                 }
             }
+
+            /**
+             * @brief      The @p for loop over all edges at a vertex
+             *     @f$\vertex\in\vertices@f$ together with the other
+             *     endpoint of each edge.
+             * @details    This is a loop over incoming and outgoing edges.
+             *
+             * @param      graph     The graph @f$\graph = (\vertices, \edges)@f$.
+             * @param[in]  vertexId  The identifier of the vertex @f$\vertex\in\vertices@f$.
+             * @param[in]  function  The function object that is called for all edges at
+             *                       @f$\vertex@f$. It must accept two arguments of types
+             *                       @p TGraph::TEdge and @p TGraph::TVertexId, e.g.,
+             * @code{.cpp}
+             *      []( TEdge & edge, Types::vertexId other )
+             *      {
+             *          // Do something with the edge object and the neighbor.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline static
+            void for_all_incident_edges_at ( TGraph  & graph
+                                           , TVertexId vertexId
+                                           , FUNCTION  function )
+            {
+                for ( auto edgeId : graph.InEdgeIdsAt(vertexId) )
+                {
+                    auto & edge = graph.EdgeAt( edgeId );
+                    function( edge, edge.Source() );
+                }
+                for ( auto edgeId : graph.OutEdgeIdsAt(vertexId) )
+                {
+                    auto & edge = graph.EdgeAt( edgeId );
+                    function( edge, edge.Target() );
+                }
+            }
         /// @}
 };
 
@@ -551,7 +551,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                                                         , FUNCTION   function )
             {
                 for ( Types::index generatorId = 0
-                    ; generatorId < network.generatorRealPowerSnapshots_.size()
+                    ; generatorId < network.generatorRealPowerSnapshots_.NumberOfEntities()
                     ; ++generatorId )
                 {
                     for_all_real_power_generator_snapshots_of ( network, generatorId, function );
@@ -564,7 +564,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                                                         , FUNCTION         function )
             {
                 for ( Types::index generatorId = 0
-                    ; generatorId < network.generatorRealPowerSnapshots_.size()
+                    ; generatorId < network.generatorRealPowerSnapshots_.NumberOfEntities()
                     ; ++generatorId )
                 {
                     for_all_real_power_generator_snapshots_of ( network, generatorId, function );
@@ -612,10 +612,10 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                 USAGE_ASSERT ( network.HasGenerator ( generatorId ) );
 
                 for ( Types::index snapshotId = 0
-                    ; snapshotId < network.generatorRealPowerSnapshots_[generatorId].size()
+                    ; snapshotId < network.GeneratorRealPowerSnapshotsOf ( generatorId ).Size()
                     ; ++snapshotId )
                 {
-                    function( snapshotId, network.generatorRealPowerSnapshots_[generatorId][snapshotId] );
+                    function( snapshotId, network.generatorRealPowerSnapshots_ ( generatorId, snapshotId ) );
                 }
             }
 
@@ -628,10 +628,10 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                 USAGE_ASSERT ( network.HasGenerator ( generatorId ) );
 
                 for ( Types::index snapshotId = 0
-                    ; snapshotId < network.generatorRealPowerSnapshots_[generatorId].size()
+                    ; snapshotId < network.GeneratorRealPowerSnapshotsOf ( generatorId ).Size()
                     ; ++snapshotId )
                 {
-                    function( snapshotId, network.generatorRealPowerSnapshots_[generatorId][snapshotId] );
+                    function( snapshotId, network.generatorRealPowerSnapshots_ ( generatorId, snapshotId ) );
                 }
             }
         ///@}
@@ -1425,7 +1425,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                                                    , FUNCTION   function )
             {
                 for ( Types::loadId loadId = 0
-                    ; loadId < network.loadSnapshots_.size()
+                    ; loadId < network.loadSnapshots_.NumberOfEntities()
                     ; ++loadId )
                 {
                     for_all_real_power_load_snapshots_of ( network
@@ -1440,7 +1440,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                                                    , FUNCTION         function )
             {
                 for ( Types::loadId loadId = 0
-                    ; loadId < network.loadSnapshots_.size()
+                    ; loadId < network.loadSnapshots_.NumberOfEntities()
                     ; ++loadId )
                 {
                     for_all_real_power_load_snapshots_of ( network
@@ -1489,7 +1489,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                 USAGE_ASSERT ( network.HasLoad ( loadId ) );
 
                 for ( Types::index timestampPosition = 0
-                    ; timestampPosition < network.loadSnapshots_.size()
+                    ; timestampPosition < network.LoadSnapshotsOf ( loadId ).Size()
                     ; ++timestampPosition )
                 {
                     function ( timestampPosition
@@ -1506,7 +1506,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::sequential> {
                 USAGE_ASSERT ( network.HasLoad ( loadId ) );
 
                 for ( Types::index timestampPosition = 0
-                    ; timestampPosition < network.loadSnapshots_.size()
+                    ; timestampPosition < network.LoadSnapshotsOf ( loadId ).Size()
                     ; ++timestampPosition )
                 {
                     function ( timestampPosition
@@ -2411,7 +2411,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
             {
                 #pragma omp parallel for
                     for ( Types::index generatorId = 0
-                        ; generatorId < network.generatorRealPowerSnapshots_.size()
+                        ; generatorId < network.generatorRealPowerSnapshots_.NumberOfEntities()
                         ; ++generatorId )
                     {
                         for_all_real_power_generator_snapshots_of ( network, generatorId, function );
@@ -2425,7 +2425,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
             {
                 #pragma omp parallel for
                     for ( Types::index generatorId = 0
-                        ; generatorId < network.generatorRealPowerSnapshots_.size()
+                        ; generatorId < network.generatorRealPowerSnapshots_.NumberOfEntities()
                         ; ++generatorId )
                     {
                         for_all_real_power_generator_snapshots_of ( network, generatorId, function );
@@ -2474,10 +2474,10 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
 
                 #pragma omp parallel for
                     for ( Types::index snapshotId = 0
-                        ; snapshotId < network.generatorRealPowerSnapshots_[generatorId].size()
+                        ; snapshotId < network.GeneratorRealPowerSnapshotsOf ( generatorId ).Size()
                         ; ++snapshotId )
                     { // snapshotId corresponds to row
-                        function( snapshotId, network.generatorRealPowerSnapshots_[generatorId][snapshotId] );
+                        function( snapshotId, network.generatorRealPowerSnapshots_ ( generatorId, snapshotId ) );
                     }
             }
 
@@ -2491,10 +2491,10 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
 
                 #pragma omp parallel for
                     for ( Types::index snapshotId = 0
-                        ; snapshotId < network.generatorRealPowerSnapshots_[generatorId].size()
+                        ; snapshotId < network.GeneratorRealPowerSnapshotsOf ( generatorId ).Size()
                         ; ++snapshotId )
                     { // snapshotId corresponds to row
-                        function( snapshotId, network.generatorRealPowerSnapshots_[generatorId][snapshotId] );
+                        function( snapshotId, network.generatorRealPowerSnapshots_ ( generatorId, snapshotId ) );
                     }
             }
         ///@}
@@ -3308,7 +3308,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
             {
                 #pragma omp parallel for
                     for ( Types::loadId loadId = 0
-                        ; loadId < network.loadSnapshots_.size()
+                        ; loadId < network.loadSnapshots_.NumberOfEntities()
                         ; ++loadId )
                     {
                         for_all_real_power_load_snapshots_of ( network
@@ -3324,7 +3324,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
             {
                 #pragma omp parallel for
                     for ( Types::loadId loadId = 0
-                        ; loadId < network.loadSnapshots_.size()
+                        ; loadId < network.loadSnapshots_.NumberOfEntities()
                         ; ++loadId )
                     {
                         for_all_real_power_load_snapshots_of ( network
@@ -3374,7 +3374,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
 
                 #pragma omp parallel for
                     for ( Types::index timestampPosition = 0
-                        ; timestampPosition < network.loadSnapshots_.size()
+                        ; timestampPosition < network.LoadSnapshotsOf ( loadId ).Size()
                         ; ++timestampPosition )
                     {
                         function ( timestampPosition
@@ -3390,7 +3390,7 @@ class PowerGridLoopDifferentiation<PowerGridType, ExecutionPolicy::parallel> {
             {
                 #pragma omp parallel for
                     for ( Types::index timestampPosition = 0
-                        ; timestampPosition < network.loadSnapshots_.size()
+                        ; timestampPosition < network.LoadSnapshotsOf ( loadId ).Size()
                         ; ++timestampPosition )
                     {
                         function ( timestampPosition
@@ -15,6 +15,7 @@
 #include "Auxiliary/ExecutionPolicy.hpp"
 
 #include "DataStructures/Iterators/GraphIterators.hpp"
+#include "DataStructures/Graphs/CsrGraph.hpp"
 
 namespace egoa::internal {
 
@@ -189,6 +190,102 @@ class StaticGraphLoopDifferentiation<GraphType, ExecutionPolicy::sequential>
                 }
             }
         /// @}
+
+        ///@name Sequential Neighborhood Loops
+        ///@{
+#pragma mark SEQUENTIAL_NEIGHBORHOOD_LOOPS
+
+            using GraphLoopDifferentiation<GraphType, ExecutionPolicy::sequential>::for_all_edges_at;
+
+            /**
+             * @brief      The @p for loop over all edges at a vertex
+             *     @f$\vertex\in\vertices@f$.
+             * @details    This is a loop over incoming and outgoing edges. If
+             *     the graph is frozen, the packed CSR representation is
+             *     scanned instead of the per vertex vectors.
+             *
+             * @param      graph     The graph @f$\graph = (\vertices, \edges)@f$.
+             * @param[in]  vertexId  The identifier of the vertex @f$\vertex\in\vertices@f$.
+             * @param[in]  function  The function object that is called for all edges at
+             *                       @f$\vertex@f$. It must accept one argument of type
+             *                       @p TGraph::TEdge, e.g.,
+             * @code{.cpp}
+             *      []( TEdge & edge )
+             *      {
+             *          // Do something with the edge object.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline static
+            void for_all_edges_at ( TGraph  & graph
+                                  , TVertexId vertexId
+                                  , FUNCTION  function )
+            {
+                if ( !graph.IsFrozen() )
+                {
+                    GraphLoopDifferentiation<GraphType, ExecutionPolicy::sequential>
+                        ::for_all_edges_at ( graph, vertexId, function );
+                    return;
+                }
+
+                CsrGraph const & csr = graph.Csr();
+                Types::index const end = csr.EndAt ( vertexId );
+                for ( Types::index index = csr.BeginAt ( vertexId )
+                    ; index < end
+                    ; ++index )
+                {
+                    function( graph.EdgeAt( csr.EdgeIdAt ( index ) ) );
+                }
+            }
+
+            /**
+             * @brief      The @p for loop over all edges at a vertex
+             *     @f$\vertex\in\vertices@f$ together with the other
+             *     endpoint.
+             * @details    If the graph is frozen, the other endpoint is read
+             *     from the packed CSR representation.
+             *
+             * @param      graph     The graph @f$\graph = (\vertices, \edges)@f$.
+             * @param[in]  vertexId  The identifier of the vertex @f$\vertex\in\vertices@f$.
+             * @param[in]  function  The function object that is called for all edges at
+             *                       @f$\vertex@f$. It must accept two arguments of types
+             *                       @p TGraph::TEdge and @p TGraph::TVertexId, e.g.,
+             * @code{.cpp}
+             *      []( TEdge & edge, Types::vertexId other )
+             *      {
+             *          // Do something with the edge object and the neighbor.
+             *      }
+             * @endcode
+             *
+             * @tparam     FUNCTION  The type of the function object.
+             */
+            template<typename FUNCTION>
+            inline static
+            void for_all_incident_edges_at ( TGraph  & graph
+                                           , TVertexId vertexId
+                                           , FUNCTION  function )
+            {
+                if ( !graph.IsFrozen() )
+                {
+                    GraphLoopDifferentiation<GraphType, ExecutionPolicy::sequential>
+                        ::for_all_incident_edges_at ( graph, vertexId, function );
+                    return;
+                }
+
+                CsrGraph const & csr = graph.Csr();
+                Types::index const end = csr.EndAt ( vertexId );
+                for ( Types::index index = csr.BeginAt ( vertexId )
+                    ; index < end
+                    ; ++index )
+                {
+                    function( graph.EdgeAt( csr.EdgeIdAt ( index ) )
+                            , csr.NeighborAt ( index ) );
+                }
+            }
+        ///@}
 };
 
 /**
@@ -8,6 +8,7 @@
 #ifndef EGOA__DATA_STRUCTURES__LABELS__LABEL_HPP
 #define EGOA__DATA_STRUCTURES__LABELS__LABEL_HPP
 
+#include <type_traits>
 #include <unordered_set>
 
 #include "Auxiliary/Auxiliary.hpp"
@@ -291,6 +292,22 @@ class Label {
 
 };
 
+namespace internal {
+
+/**
+ * @brief      Whether the value of a label of type @p LabelType is the sum
+ *     of the values of the edges on its path.
+ * @details    For an additive label the optimal paths through a vertex
+ *     consist of the optimal paths to and from this vertex. Labels are not
+ *     additive unless they specialize this trait.
+ *
+ * @tparam     LabelType  The label type.
+ */
+template<typename LabelType>
+struct IsAdditiveLabel : std::false_type {};
+
+} // namespace internal
+
 } // namespace egoa
 
 #endif // EGOA__DATA_STRUCTURES__LABELS__LABEL_HPP
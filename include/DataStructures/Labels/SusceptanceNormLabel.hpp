@@ -10,6 +10,8 @@
 
 #include "Label.hpp"
 
+#include "DataStructures/Graphs/ElectricalPropertyColumns.hpp"
+
 namespace egoa {
 
 /**
@@ -24,6 +26,11 @@ namespace egoa {
  *             href="https://doi.org/10.1145/3208903.3208910">The Maximum
  *             Transmission Switching Flow Problem</a>.
  *
+ *             An edge can also be added as EdgeColumnView, in which case
+ *             the susceptance norm is read from the precomputed property
+ *             columns of the graph instead of being computed from the
+ *             edge properties.
+ *
  * @tparam     ElementType  An edge providing access to the susceptance, e.g., an electrical edge.
  * @todo       What are the formal requirements for @p ElementType? From what I can see below,
  *             the following expressions must be valid:
@@ -109,7 +116,7 @@ class SusceptanceNormLabel : public Label<ElementType, VertexSetContainer, Point
                                  , TVertexSet       vertexSet )
             : TLabel ( vertexId )
             , susceptanceNorm_ ( susceptanceNorm )
-            , vertexSet_ ( vertexSet )
+            , vertexSet_ ( std::move ( vertexSet ) )
             {}
 
             /**
@@ -319,7 +326,8 @@ class SusceptanceNormLabel : public Label<ElementType, VertexSetContainer, Point
 
                 ESSENTIAL_ASSERT ( vertexId == newLabel.Vertex() );
 
-                std::tie( newLabel.VertexSet(), isInsert )  = vertexId + rhs;
+                // Extend the vertex set that newLabel copied from rhs
+                std::tie( std::ignore, isInsert ) = newLabel.VertexSet().emplace( vertexId );
 
                 return std::make_pair( newLabel, isInsert );
             }
@@ -360,6 +368,72 @@ class SusceptanceNormLabel : public Label<ElementType, VertexSetContainer, Point
 
                 return *this;
             }
+
+            /**
+             * @brief      Addition operators testing for cycles.
+             * @details    The susceptance norm of the edge is read from the
+             *     property columns.
+             *
+             * @param      edge  The edge with the property columns of its graph.
+             * @param      rhs   The susceptance norm label SusceptanceNormLabel.
+             *
+             * @return     A pair of a SusceptanceNormLabel and boolean. The boolean is
+             *     @p true if the element could be added without creating a cycle,
+             *     @p false otherwise.
+             */
+            friend inline std::pair<SusceptanceNormLabel, bool> operator+( EdgeColumnView<TElement> const & edge
+                                                                         , SusceptanceNormLabel     const & rhs )
+            {
+                USAGE_ASSERT ( rhs.SusceptanceNorm()    != Const::NONE );
+
+                bool                 isInsert  = false;
+                SusceptanceNormLabel newLabel  = rhs;
+
+                newLabel           += edge;
+                TVertexId vertexId  = newLabel.Vertex();
+
+                std::tie( std::ignore, isInsert ) = newLabel.VertexSet().emplace( vertexId );
+
+                return std::make_pair( newLabel, isInsert );
+            }
+
+            /**
+             * @brief      Addition operators testing for cycles.
+             * @details    The susceptance norm of the edge is read from the
+             *     property columns.
+             *
+             * @param      lhs   The susceptance norm label SusceptanceNormLabel.
+             * @param      edge  The edge with the property columns of its graph.
+             *
+             * @return     A pair of a SusceptanceNormLabel and boolean. The boolean is
+             *     @p true if the element could be added without creating a cycle,
+             *     @p false otherwise.
+             */
+            friend inline std::pair<SusceptanceNormLabel, bool> operator+( SusceptanceNormLabel     const & lhs
+                                                                         , EdgeColumnView<TElement> const & edge )
+            {
+                return edge + lhs;
+            }
+
+            /**
+             * @brief      In place addition.
+             * @details    The precomputed susceptance norm is added, i.e.,
+             *     there is neither a division nor a branch on the carrier.
+             *
+             * @param      rhs   The edge with the property columns of its graph.
+             *
+             * @return     The susceptance norm label with added edge.
+             */
+            inline SusceptanceNormLabel & operator+= ( EdgeColumnView<TElement> const & rhs )
+            {
+                USAGE_ASSERT ( SusceptanceNorm()    != Const::NONE );
+                USAGE_ASSERT ( rhs.template Branch<BranchColumn::dcSusceptance>()  != 0 );
+
+                SusceptanceNorm()         += rhs.template Branch<BranchColumn::susceptanceNorm>();
+                TLabel::Vertex()           = rhs.Other( TLabel::Vertex() );
+
+                return *this;
+            }
         ///@}
 
         ///@name Getter and Setter
@@ -402,6 +476,30 @@ class SusceptanceNormLabel : public Label<ElementType, VertexSetContainer, Point
             {
                 return SusceptanceNorm();
             }
+
+            /**
+             * @brief      Lower bound on the value of all extensions of the
+             *     label.
+             * @details    The susceptance norm of an extension is at least
+             *     the susceptance norm of the label plus the remaining
+             *     susceptance norm.
+             *
+             * @param[in]  susceptanceNorm  A lower bound on the susceptance
+             *     norm of the remaining path.
+             * @param[in]  capacity         A lower bound on the thermal
+             *     limits of the remaining path, which is not used by this
+             *     label.
+             *
+             * @return     The lower bound on the value of an extension.
+             *
+             * @see        DominatingThetaPath#Target
+             */
+            inline Types::real ValueBound ( Types::real susceptanceNorm
+                                          , Types::real capacity ) const
+            {
+                static_cast<void>( capacity );
+                return SusceptanceNorm() + susceptanceNorm;
+            }
         ///@}
 
 #pragma mark OUTPUT
@@ -425,6 +523,20 @@ class SusceptanceNormLabel : public Label<ElementType, VertexSetContainer, Point
         TVertexSet      vertexSet_;         /**< The vertex set representing the set of visited vertices. */
 };
 
+namespace internal {
+
+/**
+ * @brief      The susceptance norm is additive. The specialization does not
+ *     cover derived labels such as the VoltageAngleDifferenceLabel.
+ */
+template< typename ElementType
+        , typename VertexSetContainer
+        , typename PointerType >
+struct IsAdditiveLabel<SusceptanceNormLabel<ElementType, VertexSetContainer, PointerType>>
+    : std::true_type {};
+
+} // namespace internal
+
 } // namespace egoa
 
 #endif // EGOA__DATA_STRUCTURES__LABELS__SUSCEPTANCE_NORM_LABEL_HPP
@@ -115,7 +115,7 @@ class VoltageAngleDifferenceLabel : public SusceptanceNormLabel<ElementType, Ver
                                         , Types::real       susceptanceNorm
                                         , Types::real       minimumCapacity
                                         , TVertexSet        vertexSet )
-            : TLabel ( vertexId, susceptanceNorm, vertexSet )
+            : TLabel ( vertexId, susceptanceNorm, std::move ( vertexSet ) )
             , minimumCapacity_ ( minimumCapacity )
             {}
 
@@ -329,7 +329,8 @@ class VoltageAngleDifferenceLabel : public SusceptanceNormLabel<ElementType, Ver
 
                 ESSENTIAL_ASSERT ( vertexId == newLabel.Vertex() );
 
-                std::tie( newLabel.VertexSet(), isInsert )  = vertexId + newLabel;
+                // The path closes a cycle if vertexId is already in the copied set
+                std::tie( std::ignore, isInsert ) = newLabel.VertexSet().emplace( vertexId );
 
                 return std::make_pair( newLabel, isInsert );
             }
@@ -372,6 +373,75 @@ class VoltageAngleDifferenceLabel : public SusceptanceNormLabel<ElementType, Ver
                 TLabel::Vertex()           = rhs.Other( TLabel::Vertex() );
                 return *this;
             }
+
+            /**
+             * @brief      Addition operators testing for cycles.
+             * @details    The susceptance norm and the thermal limit of the
+             *     edge are read from the property columns.
+             *
+             * @param      edge  The edge with the property columns of its graph.
+             * @param      rhs   The susceptance norm label VoltageAngleDifferenceLabel.
+             *
+             * @return     A pair of a VoltageAngleDifferenceLabel and boolean. The boolean is
+             *     @p true if the element could be added without creating a cycle,
+             *     @p false otherwise.
+             */
+            friend inline std::pair<VoltageAngleDifferenceLabel, bool> operator+( EdgeColumnView<TElement>    const & edge
+                                                                                , VoltageAngleDifferenceLabel const & rhs )
+            {
+                USAGE_ASSERT ( rhs.SusceptanceNorm()    != Const::NONE );
+                USAGE_ASSERT ( rhs.MinimumCapacity()    != Const::NONE );
+
+                bool                        isInsert  = false;
+                VoltageAngleDifferenceLabel newLabel  = rhs;
+
+                newLabel           += edge;
+                TVertexId vertexId  = newLabel.Vertex();
+
+                std::tie( std::ignore, isInsert ) = newLabel.VertexSet().emplace( vertexId );
+
+                return std::make_pair( newLabel, isInsert );
+            }
+
+            /**
+             * @brief      Addition operators testing for cycles.
+             * @details    The susceptance norm and the thermal limit of the
+             *     edge are read from the property columns.
+             *
+             * @param      lhs   The susceptance norm label VoltageAngleDifferenceLabel.
+             * @param      edge  The edge with the property columns of its graph.
+             *
+             * @return     A pair of a VoltageAngleDifferenceLabel and boolean. The boolean is
+             *     @p true if the element could be added without creating a cycle,
+             *     @p false otherwise.
+             */
+            friend inline std::pair<VoltageAngleDifferenceLabel, bool> operator+( VoltageAngleDifferenceLabel const & lhs
+                                                                                , EdgeColumnView<TElement>    const & edge )
+            {
+                return edge + lhs;
+            }
+
+            /**
+             * @brief      In place addition.
+             * @details    The precomputed susceptance norm and thermal limit
+             *     are used, i.e., there is neither a division nor a branch on
+             *     the carrier.
+             *
+             * @param      rhs   The edge with the property columns of its graph.
+             *
+             * @return     The voltage angle difference label with added edge.
+             */
+            inline VoltageAngleDifferenceLabel & operator+=( EdgeColumnView<TElement> const & rhs )
+            {
+                USAGE_ASSERT ( TLabel::SusceptanceNorm()    != Const::NONE );
+                USAGE_ASSERT (         MinimumCapacity()    != Const::NONE );
+                USAGE_ASSERT ( rhs.template Branch<BranchColumn::dcSusceptance>()  != 0 );
+
+                TLabel::SusceptanceNorm() += rhs.template Branch<BranchColumn::susceptanceNorm>();
+                MinimumCapacity()          = std::min( MinimumCapacity(), rhs.template Branch<BranchColumn::thermalLimit>() );
+                TLabel::Vertex()           = rhs.Other( TLabel::Vertex() );
+                return *this;
+            }
         ///@}
 
         ///@name Getter and Setter
@@ -417,6 +487,31 @@ class VoltageAngleDifferenceLabel : public SusceptanceNormLabel<ElementType, Ver
             {
                 return ( TLabel::SusceptanceNorm() * MinimumCapacity() );
             }
+
+            /**
+             * @brief      Lower bound on the value of all extensions of the
+             *     label.
+             * @details    Along a path the susceptance norm does not decrease
+             *     and the minimum capacity does not increase. Thus, the
+             *     value of an extension is at least
+             *     @f$(\bnorm{\fpath{}{\vertexa}{\vertexb}} + b) \cdot \min(c, \fmincapacity{}{\fpath{}{\vertexa}{\vertexb}})@f$,
+             *     where @f$b@f$ and @f$c@f$ are the lower bounds on the
+             *     remaining path.
+             *
+             * @param[in]  susceptanceNorm  A lower bound @f$b@f$ on the
+             *     susceptance norm of the remaining path.
+             * @param[in]  capacity         A lower bound @f$c@f$ on the
+             *     thermal limits of the remaining path.
+             *
+             * @return     The lower bound on the value of an extension.
+             *
+             * @see        DominatingThetaPath#Target
+             */
+            inline Types::real ValueBound ( Types::real susceptanceNorm
+                                          , Types::real capacity ) const
+            {
+                return ( TLabel::SusceptanceNorm() + susceptanceNorm ) * std::min ( MinimumCapacity(), capacity );
+            }
         ///@}
 
 #pragma mark OUTPUT
@@ -8,9 +8,14 @@
 #ifndef EGOA__DATASTRUCTURES__NETWORKS__GENERATION_STRATEGY_HPP
 #define EGOA__DATASTRUCTURES__NETWORKS__GENERATION_STRATEGY_HPP
 
+#include <vector>
+
+#include "Auxiliary/Constants.hpp"
 #include "Auxiliary/Types.hpp"
 #include "Exceptions/Assertions.hpp"
 
+#include "DataStructures/Container/SnapshotMatrix.hpp"
+
 namespace egoa::internal {
 
 /**
@@ -81,6 +86,95 @@ class GenerationStrategyDifferentiation<NetworkType, Vertices::GenerationStrateg
             }
             return pg;
         }
+
+        /**
+         * @brief      Total real power generation
+         *     @f$\realpowergeneration(\vertex)@f$ at all vertices
+         *     @f$\vertex\in\vertices@f$ for all timestamps.
+         * @details    The active generators are compacted once into a
+         *     contiguous array that is grouped by vertex. Then, each
+         *     timestamp sums the contiguous generator snapshots of its
+         *     row without calling a function per generator and without
+         *     checking the status. The timestamps are processed in
+         *     parallel if OpenMP is available. The values are the same
+         *     as the ones of TotalRealPowerGenerationAt, since the
+         *     generators of a vertex are summed in the same order.
+         *
+         * @pre        The vertex identifiers are consecutive, e.g., as in
+         *     StaticGraph.
+         *
+         * @param      network           The network @f$\network@f$.
+         * @param      generation        The vertex-by-timestamp matrix,
+         *     where @p generation ( vertexId, timestampPosition ) is the
+         *     total real power generation at the vertex.
+         * @param      systemGeneration  The total real power generation of
+         *     all vertices for each timestamp position.
+         */
+        inline static
+        void TotalRealPowerGenerationPerSnapshot ( TNetwork                    const & network
+                                                 , SnapshotMatrix<Types::real>       & generation
+                                                 , std::vector<Types::real>          & systemGeneration )
+        {
+            Types::count const numberOfVertices   = network.Graph().NumberOfVertices();
+            Types::count const numberOfTimestamps = network.NumberOfTimestamps();
+
+            // Active generators grouped by vertex in the order of for_all_generators_at
+            std::vector<Types::index>       offsets ( numberOfVertices + 1, 0 );
+            std::vector<Types::generatorId> activeGenerators;
+            std::vector<Types::generatorId> generatorIds;
+            activeGenerators.reserve ( network.NumberOfGenerators() );
+            for ( Types::vertexId vertexId = 0; vertexId < numberOfVertices; ++vertexId )
+            {
+                generatorIds.clear();
+                network.GeneratorIds ( vertexId, generatorIds );
+                for ( Types::generatorId generatorId : generatorIds )
+                {
+                    if ( network.GeneratorAt ( generatorId ).IsActive() )
+                    {
+                        activeGenerators.emplace_back ( generatorId );
+                    }
+                }
+                offsets[vertexId + 1] = activeGenerators.size();
+            }
+
+            generation.Assign ( numberOfVertices, numberOfTimestamps, 0.0 );
+            systemGeneration.assign ( numberOfTimestamps, 0.0 );
+            if ( numberOfVertices == 0 ) return;
+
+            auto const &       snapshots         = network.generatorRealPowerSnapshots_;
+            Types::count const numberOfSnapshots = snapshots.NumberOfSnapshots();
+
+#ifdef OPENMP_AVAILABLE
+            #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+            for ( Types::index timestampPosition = 0; timestampPosition < numberOfTimestamps; ++timestampPosition )
+            {
+                Types::generatorSnapshot const * row     = nullptr;
+                Types::count                     rowSize = 0;
+                if ( timestampPosition < numberOfSnapshots )
+                {
+                    auto snapshotsAtTimestamp = snapshots.SnapshotsAt ( timestampPosition );
+                    row     = snapshotsAtTimestamp.Data();
+                    rowSize = snapshotsAtTimestamp.Size();
+                }
+
+                Types::real * result = generation.SnapshotsAt ( timestampPosition ).Data();
+                Types::real   total  = 0.0;
+                for ( Types::vertexId vertexId = 0; vertexId < numberOfVertices; ++vertexId )
+                {
+                    Types::real pg ( 0.0 );
+                    for ( Types::index index = offsets[vertexId]; index < offsets[vertexId + 1]; ++index )
+                    { // Generators without snapshots contribute Const::NONE as in GeneratorRealPowerSnapshotAt
+                        Types::generatorId generatorId = activeGenerators[index];
+                        pg += generatorId < rowSize ? row[generatorId]
+                                                    : static_cast<Types::real>( Const::NONE );
+                    }
+                    result[vertexId] = pg;
+                    total           += pg;
+                }
+                systemGeneration[timestampPosition] = total;
+            }
+        }
     ///@}
 
     /// @name Total vertex reactive power generation per snapshot.
@@ -29,12 +29,18 @@
 
 #include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
 
+#include "DataStructures/Container/SnapshotMatrix.hpp"
+#include "DataStructures/Container/TimestampIndex.hpp"
+
 #include "DataStructures/Iterators/PowerGridIterators.hpp"
 
 #include "DataStructures/Networks/GenerationStrategy.hpp"
 
 namespace egoa {
 
+template<typename GraphType>
+class BinaryPowerGridParser;
+
 template <  typename GraphType           = StaticGraph < Vertices::ElectricalProperties<Vertices::IeeeBusType>,
                                                          Edges::ElectricalProperties>,
             typename GeneratorProperty   = Vertices::GeneratorProperties<Vertices::IeeeBusType>,
@@ -1072,6 +1078,40 @@ class PowerGrid {
             inline Types::real TotalRealPowerGenerationAt ( int  vertexId ) const = delete;
             inline Types::real TotalRealPowerGenerationAt ( char vertexId ) const = delete;
 
+            /**
+             * @brief      The total real power generation
+             *     @f$\realpowergeneration@f$ at all vertices for all
+             *     timestamps at once.
+             * @details    This is the batch version of
+             *     TotalRealPowerGenerationAt, e.g., to build the nodal
+             *     balance of every hour of a year.
+             *
+             * @code{.cpp}
+             *      SnapshotMatrix<Types::real> generation;
+             *      std::vector<Types::real>    systemGeneration;
+             *      network.template TotalRealPowerGenerationPerSnapshot<Vertices::GenerationStrategyDifferentiationType::totalVertexPowerGenerationPerSnapshot> (
+             *          generation, systemGeneration );
+             *      auto generationAtVertex = generation.SnapshotsOf ( vertexId );
+             * @endcode
+             *
+             * @pre        The vertex identifiers are consecutive, e.g., as
+             *     in StaticGraph.
+             *
+             * @param      generation        The vertex-by-timestamp matrix of
+             *     the total real power generation.
+             * @param      systemGeneration  The total real power generation
+             *     of the network for each timestamp position.
+             */
+            template<Vertices::GenerationStrategyDifferentiationType Strategy>
+            inline void TotalRealPowerGenerationPerSnapshot ( SnapshotMatrix<Types::real> & generation
+                                                            , std::vector<Types::real>    & systemGeneration ) const
+            {
+                internal::GenerationStrategyDifferentiation < TNetwork const, Strategy >
+                    ::TotalRealPowerGenerationPerSnapshot ( *this
+                                                          , generation
+                                                          , systemGeneration );
+            }
+
             /**
              * @brief      The total reactive power generation bound.
              * @details    Returns the minimum and maximum of all generators
@@ -1686,6 +1726,93 @@ class PowerGrid {
                 return total;
             }
 
+            /**
+             * @brief      The total real power load at all vertices for all
+             *     timestamps at once.
+             * @details    This is the batch version of TotalRealPowerLoadAt.
+             *     The loads are grouped by vertex into a contiguous array
+             *     once, and each timestamp sums the contiguous load
+             *     snapshots of its row. The timestamps are processed in
+             *     parallel if OpenMP is available. A vertex with a load of
+             *     at least @p Const::REAL_INFTY has the total load @p
+             *     Const::REAL_INFTY, and so has the network.
+             *
+             * @pre        The vertex identifiers are consecutive, e.g., as
+             *     in StaticGraph.
+             *
+             * @param      load        The vertex-by-timestamp matrix, where
+             *     @p load ( vertexId, timestampPosition ) is the total real
+             *     power load at the vertex.
+             * @param      systemLoad  The total real power load of the
+             *     network for each timestamp position.
+             */
+            inline void TotalRealPowerLoadPerSnapshot ( SnapshotMatrix<Types::real> & load
+                                                      , std::vector<Types::real>    & systemLoad ) const
+            {
+                Types::count const numberOfVertices   = Graph().NumberOfVertices();
+                Types::count const numberOfTimestamps = NumberOfTimestamps();
+
+                // Loads grouped by vertex in the order of for_all_load_identifiers_at
+                std::vector<Types::index>  offsets ( numberOfVertices + 1, 0 );
+                std::vector<Types::loadId> loadIds;
+                loadIds.reserve ( NumberOfLoads() );
+                for ( Types::vertexId vertexId = 0; vertexId < numberOfVertices; ++vertexId )
+                {
+                    if ( vertexId < loadsAtVertex_.size() )
+                    {
+                        loadIds.insert ( loadIds.end()
+                                       , loadsAtVertex_[vertexId].begin()
+                                       , loadsAtVertex_[vertexId].end() );
+                    }
+                    offsets[vertexId + 1] = loadIds.size();
+                }
+
+                load.Assign ( numberOfVertices, numberOfTimestamps, 0.0 );
+                systemLoad.assign ( numberOfTimestamps, 0.0 );
+                if ( numberOfVertices == 0 ) return;
+
+                Types::count const numberOfSnapshots = loadSnapshots_.NumberOfSnapshots();
+
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( static )
+#endif // OPENMP_AVAILABLE
+                for ( Types::index timestampPosition = 0; timestampPosition < numberOfTimestamps; ++timestampPosition )
+                {
+                    Types::loadSnapshot const * row     = nullptr;
+                    Types::count                rowSize = 0;
+                    if ( timestampPosition < numberOfSnapshots )
+                    {
+                        auto snapshotsAtTimestamp = loadSnapshots_.SnapshotsAt ( timestampPosition );
+                        row     = snapshotsAtTimestamp.Data();
+                        rowSize = snapshotsAtTimestamp.Size();
+                    }
+
+                    Types::real * result = load.SnapshotsAt ( timestampPosition ).Data();
+                    Types::real   total  = 0.0;
+                    for ( Types::vertexId vertexId = 0; vertexId < numberOfVertices; ++vertexId )
+                    {
+                        Types::real pd ( 0.0 );
+                        for ( Types::index index = offsets[vertexId]; index < offsets[vertexId + 1]; ++index )
+                        { // Loads without snapshots contribute Const::NONE as in LoadSnapshotOf
+                            Types::loadId       loadId   = loadIds[index];
+                            Types::loadSnapshot snapshot = loadId < rowSize ? row[loadId]
+                                                                            : static_cast<Types::real>( Const::NONE );
+                            if ( snapshot >= Const::REAL_INFTY )
+                            {
+                                pd = Const::REAL_INFTY;
+                                break;
+                            }
+                            pd += snapshot;
+                        }
+                        result[vertexId] = pd;
+                        total = ( pd >= Const::REAL_INFTY || total >= Const::REAL_INFTY )
+                              ? Const::REAL_INFTY
+                              : total + pd;
+                    }
+                    systemLoad[timestampPosition] = total;
+                }
+            }
+
             /**
              * @brief      Total reactive power load bound at a vertex.
              *
@@ -1745,30 +1872,39 @@ class PowerGrid {
                 USAGE_ASSERT ( HasGenerator ( generatorId ) );
                 // USAGE_ASSERT ( maximumRealPowerGenerationPu != Const::NONE );
 
-                if ( generatorRealPowerSnapshots_.size() <= generatorId )
+                if ( generatorRealPowerSnapshots_.NumberOfEntities() <= generatorId )
                 {
                     UpdateGeneratorSnapshotSize();
                 }
-                ESSENTIAL_ASSERT( generatorId < generatorRealPowerSnapshots_.size() );
-                generatorRealPowerSnapshots_[ generatorId ].emplace_back( maximumRealPowerGenerationPu );
+                ESSENTIAL_ASSERT( generatorId < generatorRealPowerSnapshots_.NumberOfEntities() );
+                generatorRealPowerSnapshots_.Append ( generatorId, maximumRealPowerGenerationPu );
             }
 
             /**
              * @brief      Update generator snapshot size.
-             * @details    There can be more generators than buses.
+             * @details    There can be more generators than buses. Reserving
+             *     the @p numberOfSnapshots beforehand guarantees that the
+             *     snapshots of different generators can be added in
+             *     parallel.
+             *
+             * @param[in]  numberOfSnapshots  The number of snapshots per
+             *     generator that is reserved.
              */
-            inline void UpdateGeneratorSnapshotSize ()
+            inline void UpdateGeneratorSnapshotSize ( Types::count numberOfSnapshots = 0 )
             {
-                generatorRealPowerSnapshots_.resize( generators_.size() );
+                generatorRealPowerSnapshots_.Resize ( generators_.size(), numberOfSnapshots );
             }
 
             /**
              * @brief      Update load snapshot
              * @details    Currently we assume that there is one load per bus
+             *
+             * @param[in]  numberOfSnapshots  The number of snapshots per load
+             *     that is reserved.
              */
-            inline void UpdateLoadSnapshotSize( )
+            inline void UpdateLoadSnapshotSize ( Types::count numberOfSnapshots = 0 )
             {
-                loadSnapshots_.resize( loads_.size() );
+                loadSnapshots_.Resize ( loads_.size(), numberOfSnapshots );
             }
 
             /**
@@ -1782,10 +1918,10 @@ class PowerGrid {
                 {
                     std::cout << std::setw(5) << timestamps_[counter];
                     for ( Types::vertexId generatorId = 0
-                        ; generatorId < generatorRealPowerSnapshots_.size()
+                        ; generatorId < generatorRealPowerSnapshots_.NumberOfEntities()
                         ; ++generatorId )
                     {
-                        if ( generatorRealPowerSnapshots_[generatorId].size() == 0
+                        if ( generatorRealPowerSnapshots_.NumberOfSnapshotsOf ( generatorId ) == 0
                           || GeneratorRealPowerSnapshotAt ( generatorId, counter ) == Const::NONE )
                         {
                             continue; // If the generator has no snapshot available
@@ -1807,10 +1943,10 @@ class PowerGrid {
                 {
                     std::cout << std::setw(5) << timestamps_[counter];
                     for ( Types::vertexId loadId = 0
-                        ; loadId < loadSnapshots_.size()
+                        ; loadId < loadSnapshots_.NumberOfEntities()
                         ; ++loadId )
                     {
-                        if ( loadSnapshots_[loadId].size() == 0 || LoadSnapshotOf ( loadId, counter ) == Const::NONE ) continue; // If the generator has no snapshot available
+                        if ( loadSnapshots_.NumberOfSnapshotsOf ( loadId ) == 0 || LoadSnapshotOf ( loadId, counter ) == Const::NONE ) continue; // If the generator has no snapshot available
                         std::cout << " - " << std::setw(5) << LoadSnapshotOf ( loadId, counter );
                     }
                     std::cout << std::endl;
@@ -1831,13 +1967,12 @@ class PowerGrid {
                 USAGE_ASSERT ( HasLoad ( loadId ) );
                 USAGE_ASSERT ( snapshot < Const::NONE   );
 
-                if ( loadSnapshots_.size() <= loadId
-                  || loadSnapshots_.empty() )
+                if ( loadSnapshots_.NumberOfEntities() <= loadId )
                 {
                     UpdateLoadSnapshotSize();
                 }
 
-                loadSnapshots_[loadId].emplace_back( snapshot );
+                loadSnapshots_.Append ( loadId, snapshot );
             }
 
             /**
@@ -1855,36 +1990,63 @@ class PowerGrid {
              * @brief      Adds a timestamp.
              * @details    The timestamp should have the format
              *     "0000-00-00 00:00:00" representing
-             *     "<year>-<month>-<day> <hour>:<minute>:<second>".
+             *     "<year>-<month>-<day> <hour>:<minute>:<second>". The
+             *     timestamp is added to the index that is used by
+             *     PositionOf and PositionsBetween.
              *
              * @param[in]  timestamp  The timestamp, e.g., "2019-09-19 19:19:19"
              */
             inline void AddSnapshotTimestamp( Types::timestampSnapshot timestamp )
             {
                 USAGE_ASSERT ( !timestamp.empty() );
+                timestampIndex_.Add ( timestamp, timestamps_.size() );
                 timestamps_.emplace_back( timestamp );
             }
 
             /**
              * @brief      Position of a @p timestamp.
+             * @details    The position is looked up in a hash index in
+             *     expected constant time.
              *
              * @param[in]  timestamp  The timestamp.
              *
-             * @return     The position of a @p timestamp.
-             *
-             * @note       Implementation is very inefficient.
+             * @return     The position of a @p timestamp, or @p Const::NONE
+             *     if the timestamp does not exist.
              */
             inline Types::index PositionOf ( Types::timestampSnapshot timestamp ) const
             {
-                auto result = std::find ( timestamps_.begin()
-                                        , timestamps_.end()
-                                        , timestamp );
-                if ( result != timestamps_.end() )
-                {
-                    return std::distance( timestamps_.begin(), result );
-                } else {
-                    return Const::NONE;
-                }
+                return timestampIndex_.PositionOf ( timestamp );
+            }
+
+            /**
+             * @brief      Positions of all timestamps between @p from and @p
+             *     to, where both ends are included.
+             *
+             * @code{.cpp}
+             *      std::vector<Types::index> positions;
+             *      network.PositionsBetween ( "2013-01-01 00:00:00"
+             *                               , "2013-01-01 23:59:59"
+             *                               , positions );
+             *      for ( Types::index position : positions )
+             *      {
+             *          auto snapshots = network.GeneratorRealPowerSnapshotsAt ( position );
+             *      }
+             * @endcode
+             *
+             * @pre        Both ends have to be timestamps of the format
+             *     "<year>-<month>-<day> <hour>:<minute>:<second>" and @p
+             *     positions has to be empty.
+             *
+             * @param[in]  from       The earliest timestamp.
+             * @param[in]  to         The latest timestamp.
+             * @param      positions  The positions in chronological order.
+             */
+            inline void PositionsBetween ( Types::timestampSnapshot const & from
+                                         , Types::timestampSnapshot const & to
+                                         , std::vector<Types::index>      & positions ) const
+            {
+                USAGE_ASSERT ( positions.empty() );
+                timestampIndex_.PositionsBetween ( from, to, positions );
             }
 
             /**
@@ -1979,15 +2141,15 @@ class PowerGrid {
                 USAGE_ASSERT ( generatorId < NumberOfGenerators() );
                 USAGE_ASSERT ( !timestamps_.empty()               );
 
-                if ( generatorId >= generatorRealPowerSnapshots_.size() )
+                if ( generatorId >= generatorRealPowerSnapshots_.NumberOfEntities() )
                 {
                     return Const::NONE;
                 }
-                if ( timestampPosition >= generatorRealPowerSnapshots_[generatorId].size() )
+                if ( timestampPosition >= generatorRealPowerSnapshots_.NumberOfSnapshotsOf ( generatorId ) )
                 {
                     return Const::NONE;
                 }
-                return generatorRealPowerSnapshots_[generatorId][timestampPosition];
+                return generatorRealPowerSnapshots_ ( generatorId, timestampPosition );
             }
 
             /**
@@ -2033,21 +2195,65 @@ class PowerGrid {
                 USAGE_ASSERT ( snapshotsAtTimestamp.empty() );
 
                 Types::index position = PositionOf( timestamp );
-                if ( position != Const::NONE )
-                {
-                    for ( Types::vertexId generatorId = 0
-                        ; generatorId < generatorRealPowerSnapshots_.size()
-                        ; ++generatorId )
-                    { // if there is a snapshot at a generator there should be at least position many
-                        ESSENTIAL_ASSERT ( generatorRealPowerSnapshots_[generatorId].size() > position );
-                        if ( generatorRealPowerSnapshots_[generatorId].size() == 0 )
-                        { // No snapshots available at the generator with generatorId
-                            snapshotsAtTimestamp.emplace_back( Const::NONE );
-                        }
-                        snapshotsAtTimestamp.emplace_back( GeneratorRealPowerSnapshotAt ( generatorId, position ) );
-                    } // for
+                if ( position != Const::NONE
+                  && position  < generatorRealPowerSnapshots_.NumberOfSnapshots() )
+                { // Generators without a snapshot at position hold Const::NONE
+                    auto snapshots = generatorRealPowerSnapshots_.SnapshotsAt ( position );
+                    snapshotsAtTimestamp.assign ( snapshots.begin(), snapshots.end() );
                 } // if position
             }
+
+            /**
+             * @brief      The real power snapshots of all generators at a
+             *     timestamp position.
+             * @details    The snapshots are contiguous in memory and are
+             *     not copied, i.e., a multi-period computation can iterate
+             *     over the timestamps and process all generators at once.
+             *     The entry of a generator that has no snapshot at the
+             *     position is @p Const::NONE.
+             *
+             * @code{.cpp}
+             *      for ( Types::index position = 0; position < network.NumberOfTimestamps(); ++position )
+             *      {
+             *          auto snapshots = network.GeneratorRealPowerSnapshotsAt ( position );
+             *          for ( Types::generatorSnapshot snapshot : snapshots )
+             *          {
+             *              // Do something with the snapshot.
+             *          }
+             *      }
+             * @endcode
+             *
+             * @param[in]  timestampPosition  The timestamp position.
+             *
+             * @return     The view with one snapshot per generator
+             *     identifier, which is invalidated if snapshots are added.
+             */
+            inline SnapshotSpan<Types::generatorSnapshot const> GeneratorRealPowerSnapshotsAt ( Types::index timestampPosition ) const
+            {
+                USAGE_ASSERT ( timestampPosition < generatorRealPowerSnapshots_.NumberOfSnapshots() );
+                return generatorRealPowerSnapshots_.SnapshotsAt ( timestampPosition );
+            }
+
+            /**
+             * @brief      The real power snapshots of a generator over all
+             *     timestamps.
+             * @details    The snapshots are not copied, but are accessed
+             *     with a stride of the number of generators.
+             *
+             * @param[in]  generatorId  The generator identifier.
+             *
+             * @return     The view with one snapshot per timestamp position,
+             *     which is invalidated if snapshots are added.
+             */
+            inline SnapshotSpan<Types::generatorSnapshot const> GeneratorRealPowerSnapshotsOf ( Types::generatorId generatorId ) const
+            {
+                USAGE_ASSERT ( HasGenerator ( generatorId ) );
+                if ( generatorId >= generatorRealPowerSnapshots_.NumberOfEntities() )
+                { // No snapshots available at the generator with generatorId
+                    return SnapshotSpan<Types::generatorSnapshot const>();
+                }
+                return generatorRealPowerSnapshots_.SnapshotsOf ( generatorId );
+            }
         ///@}
 
         ///@name Generator Reactive Power Snapshot
@@ -2224,13 +2430,11 @@ class PowerGrid {
                 USAGE_ASSERT ( loadId                         != Const::NONE       );
                 USAGE_ASSERT ( loadId                          < loads_.size()     );
                 USAGE_ASSERT ( timestampPosition              != Const::NONE       );
-                USAGE_ASSERT ( loadSnapshots_[loadId].size()  <= timestamps_.size());
-                USAGE_ASSERT ( timestampPosition              <= loadSnapshots_[loadId].size()
-                            || loadSnapshots_[loadId].size()  == 0  );
 
-                if ( loadSnapshots_[loadId].size() != 0 )
+                if ( loadId            < loadSnapshots_.NumberOfEntities()
+                  && timestampPosition < loadSnapshots_.NumberOfSnapshotsOf ( loadId ) )
                 {
-                    return loadSnapshots_[loadId][timestampPosition];
+                    return loadSnapshots_ ( loadId, timestampPosition );
                 } else
                 { // No snapshot available at the load with loadId
                     return Const::NONE;
@@ -2253,13 +2457,11 @@ class PowerGrid {
                 USAGE_ASSERT ( loadId                         != Const::NONE       );
                 USAGE_ASSERT ( loadId                          < loads_.size()     );
                 USAGE_ASSERT ( timestampPosition              != Const::NONE       );
-                USAGE_ASSERT ( loadSnapshots_[loadId].size()  <= timestamps_.size());
-                USAGE_ASSERT ( timestampPosition              <= loadSnapshots_[loadId].size()
-                            || loadSnapshots_[loadId].size()  == 0  );
 
-                if ( loadSnapshots_[loadId].size() != 0 )
+                if ( loadId            < loadSnapshots_.NumberOfEntities()
+                  && timestampPosition < loadSnapshots_.NumberOfSnapshotsOf ( loadId ) )
                 {
-                    return loadSnapshots_[loadId][timestampPosition];
+                    return loadSnapshots_ ( loadId, timestampPosition );
                 } else
                 { // No snapshot available at the load with loadId
                     return Const::NONE;
@@ -2291,7 +2493,7 @@ class PowerGrid {
                     ; index < loadIds.size()
                     ; ++index)
                 {
-                    loadSnapshots.emplace_back( loadSnapshots_[ loadIds[index] ][timestampPosition] );
+                    loadSnapshots.emplace_back( LoadSnapshotOf ( loadIds[index], timestampPosition ) );
                 }
             }
 
@@ -2332,20 +2534,52 @@ class PowerGrid {
                 USAGE_ASSERT ( loadSnapshotsAtTimestamp.empty() );
 
                 Types::index position = PositionOf( timestamp );
-                if ( position != Const::NONE )
-                {
-                    for ( Types::loadId loadId = 0
-                        ; loadId < loadSnapshots_.size()
-                        ; ++loadId )
-                    {
-                        if ( loadSnapshots_[loadId].size() == 0 )
-                        { // No snapshot available
-                            loadSnapshotsAtTimestamp.emplace_back( Const::NONE );
-                        }
-                        loadSnapshotsAtTimestamp.emplace_back( LoadSnapshotOf ( loadId, position ) );
-                    }
+                if ( position != Const::NONE
+                  && position  < loadSnapshots_.NumberOfSnapshots() )
+                { // Loads without a snapshot at position hold Const::NONE
+                    auto snapshots = loadSnapshots_.SnapshotsAt ( position );
+                    loadSnapshotsAtTimestamp.assign ( snapshots.begin(), snapshots.end() );
                 }
             }
+
+            /**
+             * @brief      The real power snapshots of all loads at a
+             *     timestamp position.
+             * @details    The snapshots are contiguous in memory and are
+             *     not copied. The entry of a load that has no snapshot at
+             *     the position is @p Const::NONE.
+             *
+             * @param[in]  timestampPosition  The timestamp position.
+             *
+             * @return     The view with one snapshot per load identifier,
+             *     which is invalidated if snapshots are added.
+             */
+            inline SnapshotSpan<Types::loadSnapshot const> LoadSnapshotsAt ( Types::index timestampPosition ) const
+            {
+                USAGE_ASSERT ( timestampPosition < loadSnapshots_.NumberOfSnapshots() );
+                return loadSnapshots_.SnapshotsAt ( timestampPosition );
+            }
+
+            /**
+             * @brief      The real power snapshots of a load over all
+             *     timestamps.
+             * @details    The snapshots are not copied, but are accessed
+             *     with a stride of the number of loads.
+             *
+             * @param[in]  loadId  The load identifier.
+             *
+             * @return     The view with one snapshot per timestamp position,
+             *     which is invalidated if snapshots are added.
+             */
+            inline SnapshotSpan<Types::loadSnapshot const> LoadSnapshotsOf ( Types::loadId loadId ) const
+            {
+                USAGE_ASSERT ( HasLoad ( loadId ) );
+                if ( loadId >= loadSnapshots_.NumberOfEntities() )
+                { // No snapshots available at the load with loadId
+                    return SnapshotSpan<Types::loadSnapshot const>();
+                }
+                return loadSnapshots_.SnapshotsOf ( loadId );
+            }
         ///@}
 
         ///@name Generator Loops
@@ -4321,6 +4555,8 @@ class PowerGrid {
         friend internal::PowerGridLoopDifferentiation<TNetwork, ExecutionPolicy::sequential>;
         friend internal::PowerGridLoopDifferentiation<TNetwork, ExecutionPolicy::breakable>;
         friend internal::PowerGridLoopDifferentiation<TNetwork, ExecutionPolicy::parallel>;
+        template<typename> friend class BinaryPowerGridParser;
+        template<typename, Vertices::GenerationStrategyDifferentiationType> friend class internal::GenerationStrategyDifferentiation;
 
 #pragma mark MEMBERS
         Types::real                                         baseMva_;                       /**< Base MVA for the power grid used for the p.u. system, e.g., 100 MW */
@@ -4338,9 +4574,10 @@ class PowerGrid {
         std::vector< TLoadProperties >                      loads_;                         /**< Vector of load vertices */
         std::vector< bool >                                 loadExists_;                    /**< Vector that describes which load vertices exist */
 
-        std::vector< std::vector<Types::generatorSnapshot>> generatorRealPowerSnapshots_;   /**< Generator snapshots */
-        std::vector< std::vector<Types::loadSnapshot>>      loadSnapshots_;                 /**< Load snapshots */
+        SnapshotMatrix<Types::generatorSnapshot>            generatorRealPowerSnapshots_;   /**< Generator snapshots, where all generators of a timestamp are contiguous */
+        SnapshotMatrix<Types::loadSnapshot>                 loadSnapshots_;                 /**< Load snapshots, where all loads of a timestamp are contiguous */
         std::vector< Types::timestampSnapshot >             timestamps_;                    /**< Timestamps of the snapshots */
+        TimestampIndex                                      timestampIndex_;                /**< Positions of the timestamps */
         std::vector< Types::weightSnapshot >                snapshotWeights_;               /**< Weights for each snapshot */
 
         Vertices::BoundType                                 generatorBoundType_;            /**< The generator bound type. */
@@ -4360,6 +4597,9 @@ class PowerGrid {
  *             <tt> edge.Properties().Status() = true </tt> and
  *             <tt> edge.Properties().Type() = Edges::ElectricalEdgeType::switched </tt>.
  *
+ *             If the graph has property columns, they are rebuilt, see
+ *             StaticGraph#BuildPropertyColumns.
+ *
  * @param      grid           The grid
  * @param[in]  remainingSubgraph    The subgraph whose edges are not switched.
  *
@@ -4385,6 +4625,16 @@ inline void SwitchEdges ( PowerGridType                          & grid
         properties.Status() = true;
         properties.Type()   = Edges::ElectricalEdgeType::standard;
     }
+
+    if constexpr ( internal::HasPropertyColumns<typename PowerGridType::TGraph>::value )
+    {
+        bool const hasPropertyColumns = grid.Graph().HasPropertyColumns();
+        grid.Graph().PropertiesChanged();
+        if ( hasPropertyColumns )
+        {
+            grid.Graph().BuildPropertyColumns();
+        }
+    }
 }
 
 } // namespace egoa
@@ -0,0 +1,507 @@
+/*
+ * MemoryMappedCsvReader.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__IO__HELPER__MEMORY_MAPPED_CSV_READER_HPP
+#define EGOA__IO__HELPER__MEMORY_MAPPED_CSV_READER_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+#include "IO/Helper/MemoryMappedFile.hpp"
+
+namespace egoa::IO::Helper {
+
+/**
+ * @brief      Converts the numeric prefix of a string to a real number.
+ * @details    In contrast to Types::String2double, the conversion uses
+ *     @p std::from_chars, i.e., it does not allocate memory, does not
+ *     depend on the locale, and supports exponents such as "1e-05".
+ *     Leading and trailing spaces and a leading "+" are ignored.
+ *
+ * @param[in]  str   The string, e.g., a field of a CSV file.
+ *
+ * @return     The real number, or 0 if the string does not start with a
+ *     number.
+ */
+inline Types::real StringToReal ( std::string_view str )
+{
+    while ( !str.empty() && ( str.front() == ' ' || str.front() == '\t' ) ) str.remove_prefix ( 1 );
+    if ( !str.empty() && str.front() == '+' ) str.remove_prefix ( 1 );
+
+    Types::real number ( 0 );
+    auto const result = std::from_chars ( str.data(), str.data() + str.size(), number );
+    if ( result.ec != std::errc() ) return 0;
+    return number;
+}
+
+/**
+ * @brief      Converts the integral prefix of a string to an integer.
+ * @details    A fractional part is ignored, e.g., "2.0" is converted to 2.
+ *
+ * @param[in]  str   The string, e.g., a field of a CSV file.
+ *
+ * @return     The integer, or 0 if the string does not start with a
+ *     number.
+ */
+inline Types::integer StringToInteger ( std::string_view str )
+{
+    while ( !str.empty() && ( str.front() == ' ' || str.front() == '\t' ) ) str.remove_prefix ( 1 );
+    if ( !str.empty() && str.front() == '+' ) str.remove_prefix ( 1 );
+
+    Types::integer number ( 0 );
+    auto const result = std::from_chars ( str.data(), str.data() + str.size(), number );
+    if ( result.ec != std::errc() ) return 0;
+    return number;
+}
+
+/**
+ * @brief      Class for the tokenized lines of a CSV file.
+ * @details    The fields of all lines are stored consecutively in one
+ *     vector, i.e., the table has no per-row allocations. The fields are
+ *     views into the content of a MemoryMappedCsvReader and thus, are
+ *     valid as long as the reader exists.
+ *
+ * @see        MemoryMappedCsvReader::ReadTable
+ */
+class CsvTable {
+    public:
+        /**
+         * @brief      A row of the table.
+         * @details    A row can be used like the field vector of
+         *     MemoryMappedCsvReader::ReadLine.
+         */
+        class Row {
+            public:
+                Row ( std::string_view const * fields
+                    , Types::count             size )
+                : fields_( fields )
+                , size_( size )
+                {}
+
+                inline Types::count size  () const { return size_; }
+                inline bool         empty () const { return size_ == 0; }
+
+                inline std::string_view operator[] ( Types::index column ) const
+                {
+                    USAGE_ASSERT ( column < size_ );
+                    return fields_[column];
+                }
+
+            private:
+                std::string_view const * fields_;   /**< The first field of the row. */
+                Types::count             size_;     /**< The number of fields of the row. */
+        };
+
+    public:
+        CsvTable ()
+        : fields_()
+        , rowBegins_( 1, 0 )
+        {}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            inline Types::count NumberOfRows   () const { return rowBegins_.size() - 1; }
+            inline Types::count NumberOfFields () const { return fields_.size(); }
+
+            /**
+             * @brief      The row at a position.
+             *
+             * @param[in]  row   The position of the row.
+             *
+             * @return     The row.
+             */
+            inline Row RowAt ( Types::index row ) const
+            {
+                USAGE_ASSERT ( row < NumberOfRows() );
+                return Row ( fields_.data() + rowBegins_[row]
+                           , rowBegins_[row + 1] - rowBegins_[row] );
+            }
+
+            /**
+             * @copydoc    RowAt
+             */
+            inline Row operator[] ( Types::index row ) const
+            {
+                return RowAt ( row );
+            }
+        ///@}
+
+        ///@name Modifiers
+        ///@{
+#pragma mark MODIFIERS
+
+            /**
+             * @brief      Removes all rows.
+             */
+            inline void Clear ()
+            {
+                fields_.clear();
+                rowBegins_.assign ( 1, 0 );
+            }
+
+            /**
+             * @brief      Appends the rows of another table.
+             *
+             * @param[in]  other  The other table.
+             */
+            inline void Append ( CsvTable const & other )
+            {
+                Types::count const offset = fields_.size();
+                fields_.insert ( fields_.end(), other.fields_.begin(), other.fields_.end() );
+                for ( Types::index row = 1; row < other.rowBegins_.size(); ++row )
+                {
+                    rowBegins_.push_back ( offset + other.rowBegins_[row] );
+                }
+            }
+        ///@}
+
+    private:
+        friend class MemoryMappedCsvReader;
+
+#pragma mark MEMBERS
+        std::vector<std::string_view>   fields_;    /**< The fields of all rows. */
+        std::vector<Types::index>       rowBegins_; /**< The position of the first field of each row in fields_, and the number of fields at the end. */
+};
+
+/**
+ * @brief      Class for reading CSV files that are mapped into memory.
+ * @details    The file is mapped read-only into the address space of the
+ *     process by a MemoryMappedFile, and each line is split
+ *     into fields that are @p std::string_view into the mapped memory.
+ *     Thus, reading a line neither copies nor allocates memory except for
+ *     the growth of the field vector. The fields are valid as long as the
+ *     reader exists. On systems without memory-mapped files, the file is
+ *     read into a buffer once.
+ *
+ *     The tokenizer follows the format written by PyPSA:
+ *       - fields are separated by the delimiter and lines by "\n" or
+ *         "\r\n",
+ *       - spaces, tabs and carriage returns around a field are removed,
+ *       - a field in double quotes may contain the delimiter and the quotes
+ *         are removed, and
+ *       - empty lines and a UTF-8 byte order mark are skipped.
+ *
+ *     Large files can be tokenized at once into a CsvTable by ReadTable,
+ *     which splits the file into byte ranges that are tokenized in
+ *     parallel.
+ *
+ * @code{.cpp}
+ *      IO::Helper::MemoryMappedCsvReader reader ( "buses.csv" );
+ *      std::vector<std::string_view> fields;
+ *      while ( reader.ReadLine ( fields ) )
+ *      {
+ *          Types::real x = IO::Helper::StringToReal ( fields[3] );
+ *      }
+ * @endcode
+ *
+ * @see        PyPsaParser
+ */
+class MemoryMappedCsvReader {
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Opens and maps a file.
+             * @details    Use IsOpen to check if the file could be opened.
+             *
+             * @param[in]  filename   The name of the file.
+             * @param[in]  delimiter  The delimiter of the fields.
+             */
+            explicit MemoryMappedCsvReader ( Types::string const & filename
+                                           , char                  delimiter = ',' )
+            : file_( filename )
+            , delimiter_( delimiter )
+            , data_( file_.Data() )
+            , size_( file_.Size() )
+            , position_( 0 )
+            , lineNumber_( 0 )
+            {
+                Rewind();
+            }
+
+            MemoryMappedCsvReader ( MemoryMappedCsvReader const & )             = delete;
+            MemoryMappedCsvReader & operator= ( MemoryMappedCsvReader const & ) = delete;
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            /**
+             * @brief      Whether the file could be opened.
+             *
+             * @return     @p true if the file is open, @p false otherwise.
+             */
+            inline bool IsOpen () const { return file_.IsOpen(); }
+
+            /**
+             * @brief      The name of the file.
+             *
+             * @return     The name of the file.
+             */
+            inline Types::string const & Filename () const { return file_.Filename(); }
+
+            /**
+             * @brief      The content of the file.
+             *
+             * @return     The whole file as view into the mapped memory.
+             */
+            inline std::string_view Content () const { return std::string_view ( data_, size_ ); }
+
+            /**
+             * @brief      The number of lines that were read, including
+             *     skipped empty lines.
+             *
+             * @return     The number of the last line that was read.
+             */
+            inline Types::count LineNumber () const { return lineNumber_; }
+        ///@}
+
+        ///@name Reading
+        ///@{
+#pragma mark READING
+
+            /**
+             * @brief      Reads the next non-empty line and splits it into
+             *     fields.
+             *
+             * @param      fields  The fields of the line, which are cleared
+             *     before. The views point into the mapped file.
+             *
+             * @return     @p true if a line was read, @p false if the end of
+             *     the file is reached.
+             */
+            inline bool ReadLine ( std::vector<std::string_view> & fields )
+            {
+                fields.clear();
+                std::string_view line;
+                do {
+                    if ( position_ >= size_ ) return false;
+                    line = NextLine ( position_, size_ );
+                    ++lineNumber_;
+                } while ( IsBlank ( line ) );
+
+                Split ( line, fields );
+                return true;
+            }
+
+            /**
+             * @brief      Reads all remaining non-empty lines into a table.
+             * @details    The remaining content is split into at most
+             *     @p numberOfChunks byte ranges that end at line breaks. If
+             *     OpenMP is available, the ranges are tokenized as tasks,
+             *     i.e., in parallel by the team of an enclosing parallel
+             *     region, e.g., while other files are read concurrently, or
+             *     sequentially otherwise.
+             *
+             * @param      table           The table, which is cleared
+             *     before.
+             * @param[in]  numberOfChunks  The number of byte ranges.
+             */
+            inline void ReadTable ( CsvTable     & table
+                                  , Types::count   numberOfChunks = 1 )
+            {
+                table.Clear();
+                std::vector<Types::index> const boundaries = ChunkBoundaries ( numberOfChunks );
+                Types::count const numberOfRanges = boundaries.size() - 1;
+
+                std::vector<CsvTable>     parts ( numberOfRanges );
+                std::vector<Types::count> numberOfLines ( numberOfRanges, 0 );
+#ifdef OPENMP_AVAILABLE
+                #pragma omp taskloop if ( numberOfRanges > 1 ) shared ( boundaries, parts, numberOfLines )
+#endif
+                for ( Types::index range = 0; range < numberOfRanges; ++range )
+                {
+                    numberOfLines[range] = Tokenize ( boundaries[range]
+                                                    , boundaries[range + 1]
+                                                    , parts[range] );
+                }
+
+                for ( Types::index range = 0; range < numberOfRanges; ++range )
+                {
+                    table.Append ( parts[range] );
+                    lineNumber_ += numberOfLines[range];
+                }
+                position_ = size_;
+            }
+
+            /**
+             * @brief      Restarts reading at the first line.
+             */
+            inline void Rewind ()
+            {
+                position_   = HasByteOrderMark() ? 3 : 0;
+                lineNumber_ = 0;
+            }
+        ///@}
+
+    private:
+#pragma mark FILE_HANDLING
+        inline bool HasByteOrderMark () const
+        {
+            return size_ >= 3
+                && static_cast<unsigned char>( data_[0] ) == 0xEF
+                && static_cast<unsigned char>( data_[1] ) == 0xBB
+                && static_cast<unsigned char>( data_[2] ) == 0xBF;
+        }
+
+#pragma mark TOKENIZER
+        /**
+         * @brief      The line at a position without the line break.
+         *
+         * @param      position  The position of the line, which is moved
+         *     to the next line.
+         * @param[in]  end       The end of the content that is considered.
+         *
+         * @return     The view of the line.
+         */
+        inline std::string_view NextLine ( Types::index & position
+                                         , Types::index   end ) const
+        {
+            ESSENTIAL_ASSERT ( position < end );
+
+            std::string_view const rest ( data_ + position, end - position );
+            Types::count length = rest.find ( '\n' );
+            if ( length == std::string_view::npos ) length = rest.size();
+
+            position += length + 1;
+            return rest.substr ( 0, length );
+        }
+
+        /**
+         * @brief      Splits the remaining content into byte ranges that
+         *     end at line breaks.
+         *
+         * @param[in]  numberOfChunks  The maximum number of ranges.
+         *
+         * @return     The boundaries of the ranges, where range @f$i@f$ is
+         *     given by the boundaries @f$i@f$ and @f$i+1@f$.
+         */
+        inline std::vector<Types::index> ChunkBoundaries ( Types::count numberOfChunks ) const
+        {
+            std::vector<Types::index> boundaries ( 1, std::min ( position_, size_ ) );
+            Types::count const length = size_ - boundaries.front();
+            for ( Types::index chunk = 1; chunk < numberOfChunks; ++chunk )
+            {
+                Types::index const nominal = boundaries.front() + chunk * length / numberOfChunks;
+                if ( nominal <= boundaries.back() ) continue;
+
+                Types::index const lineBreak = Content().find ( '\n', nominal - 1 );
+                if ( lineBreak == std::string_view::npos
+                  || lineBreak + 1 >= size_ ) break;
+                if ( lineBreak + 1 > boundaries.back() )
+                {
+                    boundaries.push_back ( lineBreak + 1 );
+                }
+            }
+            boundaries.push_back ( size_ );
+            return boundaries;
+        }
+
+        /**
+         * @brief      Tokenizes the non-empty lines of a byte range.
+         *
+         * @param[in]  begin  The beginning of the range at a line start.
+         * @param[in]  end    The end of the range after a line break.
+         * @param      table  The table to which the lines are added.
+         *
+         * @return     The number of lines in the range.
+         */
+        inline Types::count Tokenize ( Types::index   begin
+                                     , Types::index   end
+                                     , CsvTable     & table ) const
+        {
+            Types::count numberOfLines = 0;
+            while ( begin < end )
+            {
+                std::string_view const line = NextLine ( begin, end );
+                ++numberOfLines;
+                if ( IsBlank ( line ) ) continue;
+
+                Split ( line, table.fields_ );
+                table.rowBegins_.push_back ( table.fields_.size() );
+            }
+            return numberOfLines;
+        }
+
+        static inline bool IsSpace ( char character )
+        {
+            return character == ' ' || character == '\t' || character == '\r';
+        }
+
+        static inline bool IsBlank ( std::string_view line )
+        {
+            for ( char character : line )
+            {
+                if ( !IsSpace ( character ) ) return false;
+            }
+            return true;
+        }
+
+        static inline std::string_view Trim ( std::string_view field )
+        {
+            while ( !field.empty() && IsSpace ( field.front() ) ) field.remove_prefix ( 1 );
+            while ( !field.empty() && IsSpace ( field.back()  ) ) field.remove_suffix ( 1 );
+            return field;
+        }
+
+        /**
+         * @brief      Splits a line into its fields.
+         *
+         * @param[in]  line    The line.
+         * @param      fields  The fields.
+         */
+        inline void Split ( std::string_view line, std::vector<std::string_view> & fields ) const
+        {
+            Types::count begin = 0;
+            while ( true )
+            {
+                Types::count end = begin;
+                bool isQuoted    = false;
+                while ( end < line.size() && ( isQuoted || line[end] != delimiter_ ) )
+                {
+                    if ( line[end] == '"' ) isQuoted = !isQuoted;
+                    ++end;
+                }
+
+                std::string_view field = Trim ( line.substr ( begin, end - begin ) );
+                if ( field.size() >= 2 && field.front() == '"' && field.back() == '"' )
+                {
+                    field = field.substr ( 1, field.size() - 2 );
+                }
+                fields.push_back ( field );
+
+                if ( end >= line.size() ) break;
+                begin = end + 1;
+            }
+        }
+
+#pragma mark MEMBERS
+        MemoryMappedFile    file_;          /**< The file mapped into memory. */
+        char                delimiter_;     /**< The delimiter of the fields. */
+        char const *        data_;          /**< The beginning of the file content. */
+        Types::count        size_;          /**< The size of the file in bytes. */
+        Types::count        position_;      /**< The position of the next line in the file content. */
+        Types::count        lineNumber_;    /**< The number of lines that were read. */
+};
+
+} // namespace egoa::IO::Helper
+
+#endif // EGOA__IO__HELPER__MEMORY_MAPPED_CSV_READER_HPP
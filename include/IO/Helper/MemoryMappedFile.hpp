@@ -0,0 +1,192 @@
+/*
+ * MemoryMappedFile.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__IO__HELPER__MEMORY_MAPPED_FILE_HPP
+#define EGOA__IO__HELPER__MEMORY_MAPPED_FILE_HPP
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define EGOA_MEMORY_MAPPED_FILES_AVAILABLE
+#endif
+
+#include "Auxiliary/Types.hpp"
+
+namespace egoa::IO::Helper {
+
+/**
+ * @brief      Class for a file that is mapped read-only into memory.
+ * @details    On POSIX systems the file is mapped via @p mmap, i.e., the
+ *     content is paged in by the operating system on access and is not
+ *     copied. On systems without memory-mapped files, the file is read into
+ *     a buffer once. The mapping is released by the destructor.
+ *
+ * @code{.cpp}
+ *      IO::Helper::MemoryMappedFile file ( "network.egoa" );
+ *      if ( file.IsOpen() )
+ *      {
+ *          std::string_view content = file.Content();
+ *      }
+ * @endcode
+ *
+ * @see        MemoryMappedCsvReader
+ * @see        BinaryPowerGridParser
+ */
+class MemoryMappedFile {
+    public:
+        ///@name Constructors and Destructor
+        ///@{
+#pragma mark CONSTRUCTORS_AND_DESTRUCTOR
+
+            /**
+             * @brief      Opens and maps a file.
+             * @details    Use IsOpen to check if the file could be opened.
+             *
+             * @param[in]  filename  The name of the file.
+             */
+            explicit MemoryMappedFile ( Types::string const & filename )
+            : filename_( filename )
+            , data_( nullptr )
+            , size_( 0 )
+            , isOpen_( false )
+            , isMapped_( false )
+            , buffer_()
+            {
+                Open();
+            }
+
+            ~MemoryMappedFile ()
+            {
+                Close();
+            }
+
+            MemoryMappedFile ( MemoryMappedFile const & )             = delete;
+            MemoryMappedFile & operator= ( MemoryMappedFile const & ) = delete;
+        ///@}
+
+        ///@name Getter
+        ///@{
+#pragma mark GETTER
+
+            /**
+             * @brief      Whether the file could be opened.
+             *
+             * @return     @p true if the file is open, @p false otherwise.
+             */
+            inline bool IsOpen () const { return isOpen_; }
+
+            /**
+             * @brief      The name of the file.
+             *
+             * @return     The name of the file.
+             */
+            inline Types::string const & Filename () const { return filename_; }
+
+            /**
+             * @brief      The beginning of the file content.
+             *
+             * @return     The pointer to the first byte, or @p nullptr if the
+             *     file is empty or could not be opened.
+             */
+            inline char const * Data () const { return data_; }
+
+            /**
+             * @brief      The size of the file.
+             *
+             * @return     The number of bytes.
+             */
+            inline Types::count Size () const { return size_; }
+
+            /**
+             * @brief      The content of the file.
+             *
+             * @return     The whole file as view into the mapped memory.
+             */
+            inline std::string_view Content () const { return std::string_view ( data_, size_ ); }
+        ///@}
+
+    private:
+#pragma mark FILE_HANDLING
+        /**
+         * @brief      Maps the file into memory, or reads it into a buffer if
+         *     memory-mapped files are not available.
+         */
+        inline void Open ()
+        {
+#ifdef EGOA_MEMORY_MAPPED_FILES_AVAILABLE
+            int const fileDescriptor = ::open ( filename_.c_str(), O_RDONLY );
+            if ( fileDescriptor < 0 ) return;
+
+            struct stat status;
+            if ( ::fstat ( fileDescriptor, &status ) != 0 )
+            {
+                ::close ( fileDescriptor );
+                return;
+            }
+            size_ = static_cast<Types::count>( status.st_size );
+            if ( size_ > 0 )
+            {
+                void * address = ::mmap ( nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+                if ( address == MAP_FAILED )
+                {
+                    ::close ( fileDescriptor );
+                    size_ = 0;
+                    return;
+                }
+                ::madvise ( address, size_, MADV_SEQUENTIAL );
+                data_     = static_cast<char const *>( address );
+                isMapped_ = true;
+            }
+            // The mapping stays valid after closing the file descriptor
+            ::close ( fileDescriptor );
+#else
+            std::ifstream file ( filename_, std::ios::binary );
+            if ( !file.good() ) return;
+            buffer_.assign ( std::istreambuf_iterator<char>( file )
+                           , std::istreambuf_iterator<char>() );
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+#endif
+            isOpen_ = true;
+        }
+
+        /**
+         * @brief      Unmaps the file.
+         */
+        inline void Close ()
+        {
+#ifdef EGOA_MEMORY_MAPPED_FILES_AVAILABLE
+            if ( isMapped_ )
+            {
+                ::munmap ( const_cast<char *>( data_ ), size_ );
+            }
+#endif
+            data_     = nullptr;
+            size_     = 0;
+            isOpen_   = false;
+            isMapped_ = false;
+        }
+
+#pragma mark MEMBERS
+        Types::string   filename_;      /**< The name of the file. */
+        char const *    data_;          /**< The beginning of the file content. */
+        Types::count    size_;          /**< The size of the file in bytes. */
+        bool            isOpen_;        /**< Whether the file could be opened. */
+        bool            isMapped_;      /**< Whether the file content is mapped into memory. */
+        Types::string   buffer_;        /**< The file content if memory-mapped files are not available. */
+};
+
+} // namespace egoa::IO::Helper
+
+#endif // EGOA__IO__HELPER__MEMORY_MAPPED_FILE_HPP
@@ -0,0 +1,772 @@
+/*
+ * BinaryPowerGridParser.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__IO__PARSER__BINARY_POWER_GRID_PARSER_HPP
+#define EGOA__IO__PARSER__BINARY_POWER_GRID_PARSER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Exceptions/Assertions.hpp"
+
+#include "DataStructures/Bound.hpp"
+#include "DataStructures/Container/SnapshotMatrix.hpp"
+#include "DataStructures/Networks/PowerGrid.hpp"
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Vertices/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Vertices/GeneratorProperties.hpp"
+#include "DataStructures/Graphs/Vertices/LoadProperties.hpp"
+
+#include "IO/Helper/MemoryMappedFile.hpp"
+
+namespace egoa {
+
+/**
+ * @brief      Reader and writer of a binary image of a power grid, e.g.,
+ *     to cache a network that was parsed from PyPSA or IEEE CDF files.
+ * @details    In contrast to the text formats, the values are stored in
+ *     their in-memory representation. Thus, reading does not convert any
+ *     numbers and the snapshot matrices are copied as a whole. A file can be
+ *     read from a MemoryMappedFile, i.e., without copying it into a stream
+ *     buffer first.
+ *
+ *     The file starts with a header of 32 bytes
+ *       - the magic number "EGOAGRID" (8 bytes),
+ *       - the format #Version (4 bytes),
+ *       - the size of Types::real, the size of Types::count, and a byte
+ *         order mark (4 bytes),
+ *       - the size of the payload in bytes (8 bytes), and
+ *       - the 64-bit FNV-1a checksum of the payload (8 bytes),
+ *
+ *     followed by the payload, which contains the network parameters, the
+ *     graph, the generators, the loads, the generator and load snapshots,
+ *     the timestamps, and the snapshot weights. Files with another magic
+ *     number, version, machine layout, or checksum are rejected and the
+ *     network is not changed. Thus, a cache written by another version of
+ *     this class is detected and can be rewritten.
+ *
+ * @code{.cpp}
+ *      PowerGrid<TGraph> network;
+ *      if ( !BinaryPowerGridParser<TGraph>::read ( network, "network.egoa" ) )
+ *      {
+ *          PowerGridIO<TGraph>::read ( network, "data/", PowerGridIO<TGraph>::ReadPyPsa );
+ *          BinaryPowerGridParser<TGraph>::write ( network, "network.egoa" );
+ *      }
+ * @endcode
+ *
+ * @pre        The vertex and edge identifiers of the graph are
+ *     consecutive, e.g., as in StaticGraph.
+ *
+ * @tparam     GraphType  The graph type, whose vertices and edges have
+ *     electrical properties.
+ *
+ * @see        PowerGridIO::ReadBinaryCache
+ * @see        PowerGridIO::WriteBinaryCache
+ */
+template<typename GraphType = StaticGraph< Vertices::ElectricalProperties<Vertices::IeeeBusType>
+                                         , Edges::ElectricalProperties > >
+class BinaryPowerGridParser final {
+
+#pragma mark TEMPLATE_TYPE_ALIASING
+    // Template type aliasing
+    using TGraph                = GraphType;
+    using TNetwork              = PowerGrid<GraphType>;
+    // Vertices
+    using TVertexProperties     = typename TGraph::TVertexProperties;
+    using TGeneratorProperties  = typename TNetwork::TGeneratorProperties;
+    using TLoadProperties       = typename TNetwork::TLoadProperties;
+    // Edges
+    using TEdgeProperties       = typename TGraph::TEdgeProperties;
+    // Bounds
+    using TBound                = Bound<>;
+
+    public:
+        static constexpr char           MagicNumber[8]  = { 'E', 'G', 'O', 'A', 'G', 'R', 'I', 'D' };
+        static constexpr std::uint32_t  Version         = 2;        /**< Has to be increased whenever the payload changes. */
+        static constexpr std::uint16_t  ByteOrderMark   = 0x0102;
+        static constexpr Types::count   HeaderSize      = 32;
+
+        ///@name Reader
+        ///@{
+#pragma mark READER
+
+            /**
+             * @brief      Reads a network from a file that is mapped into
+             *     memory.
+             *
+             * @param      network   The network, which is only changed if the
+             *     reading was successful.
+             * @param[in]  filename  The filename.
+             *
+             * @return     @p true if the reading was successful, @p false
+             *     otherwise, e.g., if the file does not exist or is not a
+             *     valid binary image of this version.
+             */
+            static inline bool read ( TNetwork            & network
+                                    , std::string   const & filename )
+            {
+                IO::Helper::MemoryMappedFile file ( filename );
+                return file.IsOpen()
+                    && read ( network, file.Data(), file.Size() );
+            }
+
+            /**
+             * @brief      Reads a network from a stream.
+             *
+             * @param      network      The network, which is only changed if
+             *     the reading was successful.
+             * @param      inputStream  The input stream, which is read until
+             *     its end.
+             *
+             * @return     @p true if the reading was successful, @p false
+             *     otherwise.
+             */
+            static inline bool read ( TNetwork     & network
+                                    , std::istream & inputStream )
+            {
+                if ( !inputStream.good() ) return false;
+
+                char header[HeaderSize];
+                if ( !inputStream.read ( header, HeaderSize ) ) return false;
+                if ( std::memcmp ( header, MagicNumber, sizeof(MagicNumber) ) != 0 ) return false;
+
+                std::string content ( header, HeaderSize );
+                content.append ( std::istreambuf_iterator<char>( inputStream )
+                               , std::istreambuf_iterator<char>() );
+                return read ( network, content.data(), content.size() );
+            }
+
+            /**
+             * @brief      Reads a network from a binary image in memory.
+             *
+             * @param      network  The network, which is only changed if the
+             *     reading was successful.
+             * @param[in]  data     The beginning of the image.
+             * @param[in]  size     The size of the image in bytes.
+             *
+             * @return     @p true if the header and the checksum are valid
+             *     and the payload is complete, @p false otherwise.
+             */
+            static inline bool read ( TNetwork           & network
+                                    , char         const * data
+                                    , Types::count         size )
+            {
+                if ( data == nullptr || size < HeaderSize ) return false;
+
+                InputBuffer header ( data, HeaderSize );
+                char          magicNumber[sizeof(MagicNumber)];
+                std::uint32_t version       = 0;
+                std::uint8_t  sizeOfReal    = 0;
+                std::uint8_t  sizeOfCount   = 0;
+                std::uint16_t byteOrderMark = 0;
+                std::uint64_t payloadSize   = 0;
+                std::uint64_t checksum      = 0;
+                header.Bytes ( magicNumber, sizeof(magicNumber) );
+                header ( version );
+                header ( sizeOfReal );
+                header ( sizeOfCount );
+                header ( byteOrderMark );
+                header ( payloadSize );
+                header ( checksum );
+
+                if ( std::memcmp ( magicNumber, MagicNumber, sizeof(MagicNumber) ) != 0
+                  || version       != Version
+                  || sizeOfReal    != sizeof(Types::real)
+                  || sizeOfCount   != sizeof(Types::count)
+                  || byteOrderMark != ByteOrderMark
+                  || payloadSize   != size - HeaderSize
+                  || checksum      != Checksum ( data + HeaderSize, payloadSize ) )
+                {
+                    return false;
+                }
+
+                TNetwork    result;
+                InputBuffer payload ( data + HeaderSize, payloadSize );
+                if ( !ReadPayload ( result, payload ) ) return false;
+
+                network = std::move ( result );
+                return true;
+            }
+        ///@}
+
+        ///@name Writer
+        ///@{
+#pragma mark WRITER
+
+            /**
+             * @brief      Writes a network to a file.
+             *
+             * @param[in]  network   The network.
+             * @param[in]  filename  The filename.
+             *
+             * @return     @p true if the writing was successful, @p false
+             *     otherwise.
+             */
+            static inline bool write ( TNetwork    const & network
+                                     , std::string const & filename )
+            {
+                std::ofstream outputStream ( filename, std::ios::binary | std::ios::trunc );
+                return write ( network, outputStream );
+            }
+
+            /**
+             * @brief      Writes a network to a stream.
+             *
+             * @param[in]  network       The network.
+             * @param      outputStream  The output stream, which should be
+             *     opened in binary mode.
+             *
+             * @return     @p true if the writing was successful, @p false
+             *     otherwise.
+             */
+            static inline bool write ( TNetwork const & network
+                                     , std::ostream   & outputStream )
+            {
+                if ( !outputStream.good() ) return false;
+
+                OutputBuffer payload;
+                WritePayload ( network, payload );
+
+                OutputBuffer header;
+                header.Bytes ( MagicNumber, sizeof(MagicNumber) );
+                header ( Version );
+                header ( static_cast<std::uint8_t>( sizeof(Types::real)  ) );
+                header ( static_cast<std::uint8_t>( sizeof(Types::count) ) );
+                header ( ByteOrderMark );
+                header ( static_cast<std::uint64_t>( payload.Content().size() ) );
+                header ( Checksum ( payload.Content().data(), payload.Content().size() ) );
+                ESSENTIAL_ASSERT ( header.Content().size() == HeaderSize );
+
+                outputStream.write ( header.Content().data(),  header.Content().size()  );
+                outputStream.write ( payload.Content().data(), payload.Content().size() );
+                outputStream.flush();
+                return outputStream.good();
+            }
+        ///@}
+
+    private:
+        ///@name Buffers
+        ///@{
+#pragma mark BUFFERS
+
+            /**
+             * @brief      Appends values in their in-memory representation
+             *     to a byte string.
+             */
+            class OutputBuffer {
+                public:
+                    template<typename T>
+                    inline void operator() ( T const & value )
+                    {
+                        if constexpr ( std::is_enum<T>::value )
+                        {
+                            (*this) ( static_cast<std::int64_t>( value ) );
+                        } else
+                        {
+                            static_assert ( std::is_arithmetic<T>::value
+                                          , "Only arithmetic values are written in their in-memory representation." );
+                            Bytes ( reinterpret_cast<char const *>( &value ), sizeof(T) );
+                        }
+                    }
+
+                    inline void operator() ( std::string const & value )
+                    {
+                        (*this) ( static_cast<std::uint64_t>( value.size() ) );
+                        Bytes ( value.data(), value.size() );
+                    }
+
+                    inline void operator() ( TBound const & bound )
+                    {
+                        (*this) ( bound.Minimum() );
+                        (*this) ( bound.Maximum() );
+                    }
+
+                    template<typename T>
+                    inline void operator() ( std::vector<T> const & values )
+                    {
+                        (*this) ( static_cast<std::uint64_t>( values.size() ) );
+                        if constexpr ( std::is_arithmetic<T>::value && !std::is_same<T, bool>::value )
+                        { // The whole vector is written at once
+                            Bytes ( reinterpret_cast<char const *>( values.data() ), values.size() * sizeof(T) );
+                        } else
+                        {
+                            for ( auto const & value : values )
+                            {
+                                (*this) ( static_cast<T const &>( value ) );
+                            }
+                        }
+                    }
+
+                    template<typename T>
+                    inline void operator() ( SnapshotMatrix<T> const & matrix )
+                    {
+                        (*this) ( static_cast<std::uint64_t>( matrix.NumberOfEntities() ) );
+                        (*this) ( static_cast<std::uint64_t>( matrix.NumberOfSnapshots() ) );
+                        for ( Types::index entity = 0; entity < matrix.NumberOfEntities(); ++entity )
+                        {
+                            (*this) ( static_cast<std::uint64_t>( matrix.NumberOfSnapshotsOf ( entity ) ) );
+                        }
+                        for ( Types::index snapshot = 0; snapshot < matrix.NumberOfSnapshots(); ++snapshot )
+                        { // Each row is contiguous and written at once
+                            auto row = matrix.SnapshotsAt ( snapshot );
+                            Bytes ( reinterpret_cast<char const *>( row.Data() ), row.Size() * sizeof(T) );
+                        }
+                    }
+
+                    inline void Bytes ( char const * data, Types::count size )
+                    {
+                        if ( size == 0 ) return;
+                        content_.append ( data, size );
+                    }
+
+                    inline std::string const & Content () const { return content_; }
+
+                private:
+                    std::string content_;   /**< The written bytes. */
+            };
+
+            /**
+             * @brief      Reads values in their in-memory representation from
+             *     a range of bytes.
+             * @details    A read beyond the end of the range fails, i.e., the
+             *     buffer is marked as failed and the value is not changed.
+             */
+            class InputBuffer {
+                public:
+                    InputBuffer ( char const * data, Types::count size )
+                    : data_( data )
+                    , size_( size )
+                    , position_( 0 )
+                    , failed_( false )
+                    {}
+
+                    template<typename T>
+                    inline void operator() ( T & value )
+                    {
+                        if constexpr ( std::is_enum<T>::value )
+                        {
+                            std::int64_t number = 0;
+                            (*this) ( number );
+                            if ( !failed_ ) value = static_cast<T>( number );
+                        } else
+                        {
+                            static_assert ( std::is_arithmetic<T>::value
+                                          , "Only arithmetic values are read in their in-memory representation." );
+                            Bytes ( reinterpret_cast<char *>( &value ), sizeof(T) );
+                        }
+                    }
+
+                    inline void operator() ( std::string & value )
+                    {
+                        std::uint64_t size = 0;
+                        (*this) ( size );
+                        if ( !Fits ( size, 1 ) ) return;
+                        value.assign ( data_ + position_, size );
+                        position_ += size;
+                    }
+
+                    inline void operator() ( TBound & bound )
+                    {
+                        (*this) ( bound.Minimum() );
+                        (*this) ( bound.Maximum() );
+                    }
+
+                    template<typename T>
+                    inline void operator() ( std::vector<T> & values )
+                    {
+                        std::uint64_t size = 0;
+                        (*this) ( size );
+                        if ( failed_ ) return;
+                        if constexpr ( std::is_arithmetic<T>::value && !std::is_same<T, bool>::value )
+                        { // The whole vector is copied at once
+                            if ( !Fits ( size, sizeof(T) ) ) return;
+                            values.resize ( size );
+                            Bytes ( reinterpret_cast<char *>( values.data() ), size * sizeof(T) );
+                        } else
+                        { // Each element needs at least one byte
+                            if ( !Fits ( size, 1 ) ) return;
+                            values.resize ( size );
+                            for ( Types::index index = 0; index < size && !failed_; ++index )
+                            {
+                                T value = T();
+                                (*this) ( value );
+                                values[index] = std::move ( value );
+                            }
+                        }
+                    }
+
+                    template<typename T>
+                    inline void operator() ( SnapshotMatrix<T> & matrix )
+                    {
+                        std::uint64_t numberOfEntities  = 0;
+                        std::uint64_t numberOfSnapshots = 0;
+                        (*this) ( numberOfEntities );
+                        (*this) ( numberOfSnapshots );
+                        if ( !Fits ( numberOfEntities, sizeof(std::uint64_t) ) ) return;
+
+                        std::vector<std::uint64_t> lengths ( numberOfEntities, 0 );
+                        for ( auto & length : lengths )
+                        {
+                            (*this) ( length );
+                            if ( length > numberOfSnapshots ) failed_ = true;
+                        }
+                        if ( failed_ ) return;
+                        if ( numberOfEntities == 0 )
+                        {
+                            matrix.Clear();
+                            return;
+                        }
+                        if ( !Fits ( numberOfSnapshots, numberOfEntities * sizeof(T) ) ) return;
+
+                        matrix.Clear();
+                        matrix.Resize ( numberOfEntities, numberOfSnapshots );
+                        for ( Types::index snapshot = 0; snapshot < numberOfSnapshots; ++snapshot )
+                        { // Each row is contiguous and copied at once
+                            Bytes ( reinterpret_cast<char *>( matrix.SnapshotsAt ( snapshot ).Data() )
+                                  , numberOfEntities * sizeof(T) );
+                        }
+                        for ( Types::index entity = 0; entity < numberOfEntities; ++entity )
+                        {
+                            matrix.SetNumberOfSnapshotsOf ( entity, lengths[entity] );
+                        }
+                    }
+
+                    inline void Bytes ( char * data, Types::count size )
+                    {
+                        if ( size == 0 || !Fits ( size, 1 ) ) return;
+                        std::memcpy ( data, data_ + position_, size );
+                        position_ += size;
+                    }
+
+                    inline bool Failed () const { return failed_; }
+                    inline bool AtEnd  () const { return position_ == size_; }
+
+                private:
+                    inline bool Fits ( std::uint64_t number, std::uint64_t size )
+                    {
+                        if ( failed_ || number > ( size_ - position_ ) / size )
+                        {
+                            failed_ = true;
+                        }
+                        return !failed_;
+                    }
+
+                    char const *    data_;      /**< The beginning of the bytes. */
+                    Types::count    size_;      /**< The number of bytes. */
+                    Types::count    position_;  /**< The position of the next value. */
+                    bool            failed_;    /**< Whether a read failed. */
+            };
+        ///@}
+
+        ///@name Payload
+        ///@{
+#pragma mark PAYLOAD
+
+            /**
+             * @brief      Writes the network.
+             *
+             * @param[in]  network  The network.
+             * @param      output   The output buffer.
+             */
+            static inline void WritePayload ( TNetwork const & network
+                                            , OutputBuffer   & output )
+            {
+                output ( network.baseMva_ );
+                output ( network.thetaBound_ );
+                output ( network.generatorBoundType_ );
+                output ( network.loadBoundType_ );
+
+                // Graph
+                TGraph const & graph = network.Graph();
+                output ( graph.Name() );
+                output ( static_cast<std::uint64_t>( graph.NumberOfVertices() ) );
+                for ( Types::vertexId vertexId = 0; vertexId < graph.NumberOfVertices(); ++vertexId )
+                {
+                    VertexFields ( graph.VertexAt ( vertexId ).Properties(), output );
+                }
+                output ( static_cast<std::uint64_t>( graph.NumberOfEdges() ) );
+                for ( Types::edgeId edgeId = 0; edgeId < graph.NumberOfEdges(); ++edgeId )
+                {
+                    auto const & edge = graph.EdgeAt ( edgeId );
+                    output ( edge.Source() );
+                    output ( edge.Target() );
+                    EdgeFields ( edge.Properties(), output );
+                    output ( edge.Properties().template Conductance<Edges::CarrierDifferentiationType::unknown>() );
+                    output ( edge.Properties().template Susceptance<Edges::CarrierDifferentiationType::unknown>() );
+                }
+
+                // Generators and loads
+                output ( network.verticesWithGeneratorCount_ );
+                output ( network.numberOfGenerators_ );
+                output ( network.numberOfLoads_ );
+                output ( network.generatorsAtVertex_ );
+                output ( static_cast<std::uint64_t>( network.generators_.size() ) );
+                for ( auto const & generator : network.generators_ )
+                {
+                    GeneratorFields ( generator, output );
+                }
+                output ( network.generatorExists_ );
+                output ( network.loadsAtVertex_ );
+                output ( static_cast<std::uint64_t>( network.loads_.size() ) );
+                for ( auto const & load : network.loads_ )
+                {
+                    LoadFields ( load, output );
+                }
+                output ( network.loadExists_ );
+
+                // Snapshots
+                output ( network.generatorRealPowerSnapshots_ );
+                output ( network.loadSnapshots_ );
+                output ( network.timestamps_ );
+                output ( network.snapshotWeights_ );
+            }
+
+            /**
+             * @brief      Reads the network.
+             *
+             * @param      network  The empty network.
+             * @param      input    The input buffer.
+             *
+             * @return     @p true if the payload was read completely, @p
+             *     false otherwise.
+             */
+            static inline bool ReadPayload ( TNetwork    & network
+                                           , InputBuffer & input )
+            {
+                input ( network.baseMva_ );
+                input ( network.thetaBound_ );
+                input ( network.generatorBoundType_ );
+                input ( network.loadBoundType_ );
+
+                // Graph
+                Types::name name;
+                input ( name );
+                TGraph graph ( name );
+                std::uint64_t numberOfVertices = 0;
+                input ( numberOfVertices );
+                for ( Types::vertexId vertexId = 0; vertexId < numberOfVertices && !input.Failed(); ++vertexId )
+                {
+                    TVertexProperties vertex;
+                    VertexFields ( vertex, input );
+                    graph.AddVertex ( std::move ( vertex ) );
+                }
+                std::uint64_t numberOfEdges = 0;
+                input ( numberOfEdges );
+                for ( Types::edgeId edgeId = 0; edgeId < numberOfEdges && !input.Failed(); ++edgeId )
+                {
+                    Types::vertexId source = Const::NONE;
+                    Types::vertexId target = Const::NONE;
+                    Types::real conductance = 0;
+                    Types::real susceptance = 0;
+                    TEdgeProperties edge;
+                    input ( source );
+                    input ( target );
+                    EdgeFields ( edge, input );
+                    input ( conductance );
+                    input ( susceptance );
+                    if ( input.Failed()
+                      || source >= graph.NumberOfVertices()
+                      || target >= graph.NumberOfVertices() ) return false;
+                    edge.Conductance ( conductance );
+                    edge.Susceptance ( susceptance );
+                    graph.AddEdge ( source, target, std::move ( edge ) );
+                }
+                network.Graph() = std::move ( graph );
+
+                // Generators and loads
+                input ( network.verticesWithGeneratorCount_ );
+                input ( network.numberOfGenerators_ );
+                input ( network.numberOfLoads_ );
+                input ( network.generatorsAtVertex_ );
+                std::uint64_t numberOfGenerators = 0;
+                input ( numberOfGenerators );
+                for ( Types::index index = 0; index < numberOfGenerators && !input.Failed(); ++index )
+                {
+                    TGeneratorProperties generator;
+                    GeneratorFields ( generator, input );
+                    network.generators_.emplace_back ( std::move ( generator ) );
+                }
+                input ( network.generatorExists_ );
+                input ( network.loadsAtVertex_ );
+                std::uint64_t numberOfLoads = 0;
+                input ( numberOfLoads );
+                for ( Types::index index = 0; index < numberOfLoads && !input.Failed(); ++index )
+                {
+                    TLoadProperties load;
+                    LoadFields ( load, input );
+                    network.loads_.emplace_back ( std::move ( load ) );
+                }
+                input ( network.loadExists_ );
+
+                // Snapshots
+                input ( network.generatorRealPowerSnapshots_ );
+                input ( network.loadSnapshots_ );
+                input ( network.timestamps_ );
+                network.timestampIndex_.Build ( network.timestamps_ );
+                input ( network.snapshotWeights_ );
+
+                return !input.Failed()
+                    && input.AtEnd()
+                    && network.generatorExists_.size() == network.generators_.size()
+                    && network.loadExists_.size()      == network.loads_.size();
+            }
+        ///@}
+
+        ///@name Fields
+        ///@details    The fields are visited in the same order for reading
+        ///    and writing, i.e., @p Properties is either constant and
+        ///    @p Buffer is an OutputBuffer, or @p Properties is mutable and
+        ///    @p Buffer is an InputBuffer.
+        ///@{
+#pragma mark FIELDS
+
+            template<typename Properties, typename Buffer>
+            static inline void VertexFields ( Properties & vertex
+                                            , Buffer     & buffer )
+            {
+                buffer ( vertex.Name() );
+                buffer ( vertex.Type() );
+                buffer ( vertex.X() );
+                buffer ( vertex.Y() );
+                buffer ( vertex.ShuntSusceptance() );
+                buffer ( vertex.ShuntConductance() );
+                buffer ( vertex.NominalVoltage() );
+                buffer ( vertex.VoltageAngle() );
+                buffer ( vertex.VoltageMagnitude() );
+                buffer ( vertex.MinimumVoltage() );
+                buffer ( vertex.MaximumVoltage() );
+                buffer ( vertex.Country() );
+                buffer ( vertex.Area() );
+                buffer ( vertex.Zone() );
+                buffer ( vertex.Control() );
+                buffer ( vertex.Carrier() );
+                buffer ( vertex.Status() );
+            }
+
+            template<typename Properties, typename Buffer>
+            static inline void EdgeFields ( Properties & edge
+                                          , Buffer     & buffer )
+            {
+                buffer ( edge.Name() );
+                buffer ( edge.Status() );
+                buffer ( edge.Type() );
+                buffer ( edge.ThetaBound() );
+                buffer ( edge.Resistance() );
+                buffer ( edge.Reactance() );
+                buffer ( edge.Charge() );
+                buffer ( edge.ThermalLimit() );
+                buffer ( edge.ThermalLimitB() );
+                buffer ( edge.ThermalLimitC() );
+                buffer ( edge.TapRatio() );
+                buffer ( edge.AngleShift() );
+                buffer ( edge.TapRatioCosThetaShift() );
+                buffer ( edge.TapRatioSinThetaShift() );
+                buffer ( edge.CapitalCost() );
+                buffer ( edge.Length() );
+                buffer ( edge.NumberOfParallelLines() );
+                buffer ( edge.NominalApparentPower() );
+                buffer ( edge.NominalVoltage() );
+                buffer ( edge.NominalApparentPowerBound() );
+                buffer ( edge.NominalApparentPowerExtendable() );
+                buffer ( edge.TerrainFactor() );
+            }
+
+            template<typename Properties, typename Buffer>
+            static inline void GeneratorFields ( Properties & generator
+                                               , Buffer     & buffer )
+            {
+                buffer ( generator.Name() );
+                buffer ( generator.Type() );
+                buffer ( generator.X() );
+                buffer ( generator.Y() );
+                buffer ( generator.VoltageMagnitude() );
+                buffer ( generator.IsExtendable() );
+                buffer ( generator.NominalPower() );
+                buffer ( generator.NominalRealPowerBound() );
+                buffer ( generator.PowerSign() );
+                buffer ( generator.RealPower() );
+                buffer ( generator.RealPowerBound() );
+                buffer ( generator.Pc1() );
+                buffer ( generator.Pc2() );
+                buffer ( generator.ReactivePower() );
+                buffer ( generator.ReactivePowerBound() );
+                buffer ( generator.Qc1Bound() );
+                buffer ( generator.Qc2Bound() );
+                buffer ( generator.Status() );
+                buffer ( generator.Committable() );
+                buffer ( generator.Control() );
+                buffer ( generator.GeneratorType() );
+                buffer ( generator.Efficiency() );
+                buffer ( generator.MarginalCost() );
+                buffer ( generator.CapitalCost() );
+                buffer ( generator.StartUpCost() );
+                buffer ( generator.ShutDownCost() );
+                buffer ( generator.MinimumUpTime() );
+                buffer ( generator.MinimumDownTime() );
+                buffer ( generator.RampAgc() );
+                buffer ( generator.Ramp10() );
+                buffer ( generator.Ramp30() );
+                buffer ( generator.RampQ() );
+                buffer ( generator.Apf() );
+                buffer ( generator.RampLimitUp() );
+                buffer ( generator.RampLimitDown() );
+                buffer ( generator.RampLimitStartUp() );
+                buffer ( generator.RampLimitShutDown() );
+            }
+
+            template<typename Properties, typename Buffer>
+            static inline void LoadFields ( Properties & load
+                                          , Buffer     & buffer )
+            {
+                buffer ( load.Name() );
+                buffer ( load.Type() );
+                buffer ( load.RealPowerLoad() );
+                buffer ( load.RealPowerLoadBound() );
+                buffer ( load.ReactivePowerLoad() );
+                buffer ( load.ReactivePowerLoadBound() );
+            }
+        ///@}
+
+        ///@name Auxiliary
+        ///@{
+#pragma mark AUXILIARY
+
+            /**
+             * @brief      The 64-bit FNV-1a hash of a range of bytes.
+             *
+             * @param[in]  data  The beginning of the bytes.
+             * @param[in]  size  The number of bytes.
+             *
+             * @return     The checksum.
+             */
+            static inline std::uint64_t Checksum ( char const * data
+                                                 , Types::count size )
+            {
+                std::uint64_t hash = 14695981039346656037ULL;
+                for ( Types::index index = 0; index < size; ++index )
+                {
+                    hash ^= static_cast<unsigned char>( data[index] );
+                    hash *= 1099511628211ULL;
+                }
+                return hash;
+            }
+        ///@}
+};
+
+} // namespace egoa
+
+#endif // EGOA__IO__PARSER__BINARY_POWER_GRID_PARSER_HPP
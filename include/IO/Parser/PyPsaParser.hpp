@@ -11,13 +11,17 @@
 #ifndef EGOA__IO__PARSER___PY_PSA_PARSER_HPP
 #define EGOA__IO__PARSER___PY_PSA_PARSER_HPP
 
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <string_view>
 #include <typeinfo>
-
-#include <QFile>
-#include <QStringList>
+#include <unordered_set>
+#include <vector>
 
 #include "IO/Wrapper/Edge.hpp"
 #include "IO/Helper/DataValidation.hpp"
+#include "IO/Helper/MemoryMappedCsvReader.hpp"
 
 #include "DataStructures/Networks/PowerGrid.hpp"
 #include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
@@ -53,6 +57,8 @@ class PyPsaParser {
     using TIoEdge               = io::Edge<TEdgeProperties>;
     // Bounds
     using TBound                = Bound<>;
+    // IO
+    using TCsvReader            = IO::Helper::MemoryMappedCsvReader;
 
     public:
 
@@ -229,32 +235,9 @@ class PyPsaParser {
             inline bool ReadBuses ( TNetwork          & network
                                   , std::string const & filename )
             {
-                QFile file( QString::fromStdString(filename + "/" + filenameBuses_) );
-                OpenFile(file);
-                QList<QByteArray> splitted = ReadLine( file );
-
-                dataMapperBuses_.clear();
-                ExtractBusHeader( splitted );
-                while( !file.atEnd() )
-                {
-                    TVertexProperties vertexProperties;
-                    std::string temp;
-
-                    splitted = ReadLine( file, false );
-
-                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperBuses_.size() );
-
-                    for ( Types::count counter = 0
-                        ; counter < static_cast<Types::count>( splitted.size() )
-                        ; ++counter )
-                    {
-                        temp = splitted[counter].toStdString();
-                        (this->*dataMapperBuses_[counter])( temp , vertexProperties);
-                    } // for
-                    Types::vertexId index                            = AddVertex<TNetwork>( network, vertexProperties );
-                    mapBusName2VertexId_[ vertexProperties.Name() ]  = index;
-                } // while
-                return true;
+                TokenizedCsvFile buses ( filename + "/" + filenameBuses_ );
+                return Tokenize ( buses )
+                    && BuildBuses ( network, buses );
             }
 
             /**
@@ -295,33 +278,9 @@ class PyPsaParser {
             inline bool ReadGeneratorsRealPowerMaxPu ( TNetwork          & network
                                                      , std::string const & filename )
             {
-                QFile file( QString::fromStdString(filename + "/" + filenameGeneratorsPMaxPu_) );
-                OpenFile(file);
-                QList<QByteArray> splitted = ReadLine( file, false );
-
-                dataMapperGeneratorsRealPowerMaxPu_.clear();
-                ExtractGeneratorMaximumRealPowerPuHeader( splitted );
-
-                while( !file.atEnd() )
-                {
-                    splitted = ReadLine( file, false );
-                    std::string generationValue;
-
-                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperGeneratorsRealPowerMaxPu_.size() );
-
-                    if ( !splitted[0].isEmpty() )
-                    {
-                        ++ generatorSnapshotsSize;
-                    }
-                    for ( Types::count counter = 0
-                        ; counter < static_cast<Types::count>( splitted.size() )
-                        ; ++counter )
-                    {
-                        generationValue = splitted[counter].toStdString();
-                        dataMapperGeneratorsRealPowerMaxPu_[counter]( generationValue, network );
-                    } // for
-                } // while
-                return true;
+                TokenizedCsvFile generatorsRealPowerMaxPu ( filename + "/" + filenameGeneratorsPMaxPu_, false, true );
+                return Tokenize ( generatorsRealPowerMaxPu )
+                    && BuildGeneratorsRealPowerMaxPu ( network, generatorsRealPowerMaxPu );
             }
 
             /**
@@ -385,50 +344,9 @@ class PyPsaParser {
             inline bool ReadGenerators ( TNetwork          & network
                                        , std::string const & filename )
             {
-                QFile file( QString::fromStdString(filename + "/" + filenameGenerators_) );
-                OpenFile(file);
-                QList<QByteArray> splitted = ReadLine( file );
-
-                dataMapperGenerators_.clear();
-                ExtractGeneratorHeader( splitted );
-
-                while( !file.atEnd() )
-                {
-                    splitted = ReadLine( file, false );
-                    TGeneratorProperties generator;
-                    std::string temp;
-
-                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperGenerators_.size() );
-
-                    for ( Types::count counter = 0;
-                          counter < static_cast<Types::count>( splitted.size() );
-                          ++counter
-                        )
-                    {
-                        temp = splitted[counter].toStdString();
-                        (this->*dataMapperGenerators_[counter])( temp , generator);
-                    } // for
-                    Types::vertexId generatorId = Const::NONE;
-                    if ( mapGeneratorName2BusName_.find(generator.Name()) != mapGeneratorName2BusName_.end() )
-                    {
-                        if ( mapBusName2VertexId_.find(mapGeneratorName2BusName_[generator.Name()]) != mapBusName2VertexId_.end() )
-                        {
-                            generatorId = network.AddGeneratorAt(mapBusName2VertexId_[mapGeneratorName2BusName_[generator.Name()]], generator);
-                        } else {
-                            ESSENTIAL_ASSERT( false && "Bus name does not exist" );
-                        }
-                    } else {
-                        ESSENTIAL_ASSERT( false && "Generator name does not exist" );
-                    }
-                    if ( mapGeneratorName2Identifier_.find(generator.Name()) == mapGeneratorName2Identifier_.end() )
-                    {
-                        mapGeneratorName2Identifier_[generator.Name()] = generatorId;
-                    } else {
-                        ESSENTIAL_ASSERT( false && "Generator name to identifier, Generator name duplicates" );
-                    }
-                } // while
-                network.UpdateGeneratorSnapshotSize();
-                return true;
+                TokenizedCsvFile generators ( filename + "/" + filenameGenerators_ );
+                return Tokenize ( generators )
+                    && BuildGenerators ( network, generators );
             }
 
             /**
@@ -553,32 +471,9 @@ class PyPsaParser {
             inline bool ReadLines ( Graph             & network
                                   , const std::string & filename )
             {
-                QFile file( QString::fromStdString ( filename + "/" + filenameLines_ ) );
-                OpenFile(file);
-                QList<QByteArray> splitted = ReadLine( file );
-
-                dataMapperLines_.clear();
-                ExtractLineHeader( splitted );
-
-                while( !file.atEnd() )
-                {
-                    splitted = ReadLine( file, false );
-                    TIoEdge edge;
-                    SetLineDefaultValues ( edge );
-                    std::string temp;
-
-                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperLines_.size() );
-
-                    for ( Types::count counter = 0
-                        ; counter < static_cast<Types::count>( splitted.size() )
-                        ; ++counter )
-                    {
-                        temp = splitted[counter].toStdString();
-                        (this->*dataMapperLines_[counter])( temp , edge );
-                    } // for
-                    AddEdge<Graph>( network, edge );
-                } // while
-                return true;
+                TokenizedCsvFile lines ( filename + "/" + filenameLines_ );
+                return Tokenize ( lines )
+                    && BuildLines<Graph> ( network, lines );
             }
 
             /**
@@ -676,33 +571,9 @@ class PyPsaParser {
             inline bool ReadLoadsPset ( TNetwork          & network
                                       , std::string const & filename )
             {
-                QFile file( QString::fromStdString(filename + "/" + filenameLoadsPSet_) );
-                OpenFile(file);
-                QList<QByteArray> splitted = ReadLine( file, false );
-
-                dataMapperLoadsRealPowerMaxPu_.clear();
-                ExtractLoadMaximumRealPowerPuHeader( splitted );
-
-                while( !file.atEnd() )
-                {
-                    splitted = ReadLine( file, false );
-                    std::string loadValue;
-
-                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperLoadsRealPowerMaxPu_.size() );
-                    if ( !splitted[0].isEmpty() )
-                    {
-                        ++ loadSnapshotsSize;
-                    }
-
-                    for ( Types::count counter = 0
-                        ; counter < static_cast<Types::count>( splitted.size() )
-                        ; ++counter )
-                    {
-                        loadValue = splitted[counter].toStdString();
-                        dataMapperLoadsRealPowerMaxPu_[counter]( loadValue, network );
-                    } // for
-                } // while
-                return true;
+                TokenizedCsvFile loadsRealPowerSet ( filename + "/" + filenameLoadsPSet_, false, true );
+                return Tokenize ( loadsRealPowerSet )
+                    && BuildLoadsPset ( network, loadsRealPowerSet );
             }
 
             /**
@@ -731,48 +602,9 @@ class PyPsaParser {
             inline bool ReadLoads ( TNetwork          & network
                                   , std::string const & filename )
             {
-                QFile file( QString::fromStdString(filename + "/" + filenameLoads_) );
-                OpenFile(file);
-                QList<QByteArray> splitted = ReadLine( file );
-                Types::index busColumn(0);
-
-                dataMapperLoads_.clear();
-                ExtractLoadHeader( splitted, busColumn );
-
-                while( !file.atEnd() )
-                {
-                    splitted = ReadLine( file, false );
-                    TLoadProperties vertex;
-                    SetLoadDefaultValues(vertex);
-                    Types::string temp;
-
-                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperLoads_.size() );
-
-                    // Read a row
-                    for ( Types::count counter = 0
-                        ; counter < static_cast<Types::count>( splitted.size() )
-                        ; ++counter )
-                    {
-                        temp = splitted[counter].toStdString();
-                        (this->*dataMapperLoads_[counter])( temp , vertex);
-                    } // for each column in a row
-
-                    Types::loadId loadId = Const::NONE;
-                    if (mapBusName2VertexId_.find( splitted[ busColumn ].toStdString() ) != mapBusName2VertexId_.end() )
-                    {
-                        loadId = network.AddLoadAt( mapBusName2VertexId_[ splitted[ busColumn ].toStdString() ], vertex );
-                    } else {
-                        ESSENTIAL_ASSERT( false && "Bus name does not exist" );
-                    }
-
-                    if ( mapLoadName2Identifier_.find( vertex.Name() ) == mapLoadName2Identifier_.end() ) {
-                        mapLoadName2Identifier_[vertex.Name()]  = loadId;
-                    } else {
-                        ESSENTIAL_ASSERT( false && "Load name duplicates" );
-                    }
-
-                } // while
-                return true;
+                TokenizedCsvFile loads ( filename + "/" + filenameLoads_ );
+                return Tokenize ( loads )
+                    && BuildLoads ( network, loads );
             }
 
             /**
@@ -845,6 +677,12 @@ class PyPsaParser {
 
             /**
              * @brief      Reads a complete network.
+             * @details    The CSV files are tokenized concurrently, where the
+             *     large snapshot files are additionally split into byte
+             *     ranges (see TokenizeConcurrently). Afterwards, the network
+             *     is built from the tokenized files in the order of their
+             *     dependencies, i.e., buses before generators, lines, and
+             *     loads, since these refer to the names of the buses.
              *
              * @param      network   The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
              * @param[in]  filename  The filename.
@@ -855,12 +693,21 @@ class PyPsaParser {
                                             , std::string const & filename )
             {
                 network.BaseMva() = 1.0;
-                return ReadBuses ( network, filename )
-                    && ReadGenerators ( network, filename )
-                    && ReadGeneratorsRealPowerMaxPu ( network, filename )
-                    && ReadLines ( network.Graph(), filename )
-                    && ReadLoads ( network, filename )
-                    && ReadLoadsPset ( network, filename )
+                TokenizedCsvFile buses                   ( filename + "/" + filenameBuses_ );
+                TokenizedCsvFile generators              ( filename + "/" + filenameGenerators_ );
+                TokenizedCsvFile generatorsRealPowerMaxPu( filename + "/" + filenameGeneratorsPMaxPu_, false, true );
+                TokenizedCsvFile lines                   ( filename + "/" + filenameLines_ );
+                TokenizedCsvFile loads                   ( filename + "/" + filenameLoads_ );
+                TokenizedCsvFile loadsRealPowerSet       ( filename + "/" + filenameLoadsPSet_, false, true );
+
+                return TokenizeConcurrently ( { &buses, &generators, &generatorsRealPowerMaxPu
+                                              , &lines, &loads, &loadsRealPowerSet } )
+                    && BuildBuses ( network, buses )
+                    && BuildGenerators ( network, generators )
+                    && BuildGeneratorsRealPowerMaxPu ( network, generatorsRealPowerMaxPu )
+                    && BuildLines ( network.Graph(), lines )
+                    && BuildLoads ( network, loads )
+                    && BuildLoadsPset ( network, loadsRealPowerSet )
                     && HasCorrectSnapshotSizes()
                     && IO::Helper::HasNetworkCorrectBounds<TNetwork> ( network );
             }
@@ -879,16 +726,29 @@ class PyPsaParser {
                                             , std::string const & filename )
             {
                 network.BaseMva() = 1.0;
-                bool booleanBuses = ReadBuses ( network, filename );
+                TokenizedCsvFile buses                   ( filename + "/" + filenameBuses_ );
+                TokenizedCsvFile generators              ( filename + "/" + filenameGenerators_ );
+                TokenizedCsvFile generatorsRealPowerMaxPu( filename + "/" + filenameGeneratorsPMaxPu_, false, true );
+                TokenizedCsvFile lines                   ( filename + "/" + filenameLines_ );
+                TokenizedCsvFile loads                   ( filename + "/" + filenameLoads_ );
+                TokenizedCsvFile loadsRealPowerSet       ( filename + "/" + filenameLoadsPSet_, false, true );
+
+                if ( !TokenizeConcurrently ( { &buses, &generators, &generatorsRealPowerMaxPu
+                                             , &lines, &loads, &loadsRealPowerSet } ) )
+                {
+                    return false;
+                }
+
+                bool booleanBuses = BuildBuses ( network, buses );
                 candidateNetwork  = network.Graph();
 
                 return booleanBuses
-                    && ReadGenerators ( network, filename )
-                    && ReadGeneratorsRealPowerMaxPu ( network, filename )
-                    && ReadLines ( network, filename )
-                    && ReadLines<TGraph> ( candidateNetwork, filename )
-                    && ReadLoads ( network, filename )
-                    && ReadLoadsPset ( network, filename )
+                    && BuildGenerators ( network, generators )
+                    && BuildGeneratorsRealPowerMaxPu ( network, generatorsRealPowerMaxPu )
+                    && BuildLines ( network, lines )
+                    && BuildLines<TGraph> ( candidateNetwork, lines )
+                    && BuildLoads ( network, loads )
+                    && BuildLoadsPset ( network, loadsRealPowerSet )
                     && HasCorrectSnapshotSizes()
                     && IO::Helper::HasNetworkCorrectBounds<TNetwork> ( network )
                     && IO::Helper::HasGraphCorrectBounds<TGraph> ( candidateNetwork );
@@ -932,6 +792,405 @@ class PyPsaParser {
         ///@}
 
     private:
+        ///@name Tokenization
+        ///@{
+#pragma mark TOKENIZATION
+
+            /**
+             * @brief      A CSV file with its header and its tokenized rows.
+             * @details    The fields of the rows are views into the mapped
+             *     file and thus, are valid as long as the object exists.
+             */
+            struct TokenizedCsvFile {
+                /**
+                 * @brief      Opens a CSV file.
+                 *
+                 * @param[in]  filename  The filename.
+                 * @param[in]  compress  Whether spaces in the column names
+                 *     are removed.
+                 * @param[in]  isLarge   Whether the file is tokenized
+                 *     in byte ranges, e.g., a snapshot matrix.
+                 */
+                explicit TokenizedCsvFile ( Types::string const & filename
+                                          , bool                  compress = true
+                                          , bool                  isLarge  = false )
+                : file( filename )
+                , header()
+                , table()
+                , compressHeader( compress )
+                , numberOfChunks( isLarge ? Auxiliary::MaximumNumberOfThreads() : 1 )
+                {}
+
+                TCsvReader                  file;           /**< The mapped file. */
+                std::vector<Types::name>    header;         /**< The column names. */
+                IO::Helper::CsvTable        table;          /**< The rows without the header. */
+                bool                        compressHeader; /**< Whether spaces in the column names are removed. */
+                Types::count                numberOfChunks; /**< The maximum number of byte ranges. */
+            };
+
+            /**
+             * @brief      Reads the header and tokenizes the rows of a file.
+             * @details    A file is split into at most one byte range per
+             *     MinimumChunkSize bytes.
+             *
+             * @param      csv   The CSV file.
+             *
+             * @return     @p true if the file could be opened, @p false
+             *     otherwise.
+             */
+            inline bool Tokenize ( TokenizedCsvFile & csv )
+            {
+                if ( !OpenFile ( csv.file ) ) return false;
+                csv.header = ReadHeader ( csv.file, csv.compressHeader );
+
+                Types::count const numberOfChunks = std::min ( csv.numberOfChunks
+                                                             , 1 + csv.file.Content().size() / MinimumChunkSize );
+                csv.file.ReadTable ( csv.table, numberOfChunks );
+                return true;
+            }
+
+            /**
+             * @brief      Tokenizes files concurrently.
+             * @details    If OpenMP is available, each file is tokenized in
+             *     a task and the byte ranges of large files in nested tasks,
+             *     i.e., all threads work on the files until the last one is
+             *     tokenized.
+             *
+             * @param[in]  files  The files.
+             *
+             * @return     @p true if all files could be opened, @p false
+             *     otherwise.
+             */
+            inline bool TokenizeConcurrently ( std::vector<TokenizedCsvFile*> const & files )
+            {
+                std::vector<Types::ubyte> isTokenized ( files.size(), false );
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel
+                #pragma omp single
+#endif // OPENMP_AVAILABLE
+                for ( Types::index index = 0; index < files.size(); ++index )
+                {
+#ifdef OPENMP_AVAILABLE
+                    #pragma omp task firstprivate ( index ) shared ( files, isTokenized )
+#endif // OPENMP_AVAILABLE
+                    isTokenized[index] = Tokenize ( *files[index] );
+                }
+                return std::all_of ( isTokenized.begin(), isTokenized.end()
+                                   , []( Types::ubyte tokenized ) { return tokenized != 0; } );
+            }
+        ///@}
+
+        ///@name Network Construction
+        ///@{
+#pragma mark NETWORK_CONSTRUCTION
+
+            /**
+             * @brief      Adds a vertex for each row of the bus file.
+             *
+             * @param      network  The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  buses    The tokenized bus file.
+             *
+             * @return     @p true if the construction was successful, @p false otherwise.
+             */
+            inline bool BuildBuses ( TNetwork               & network
+                                   , TokenizedCsvFile const & buses )
+            {
+                dataMapperBuses_.clear();
+                ExtractBusHeader( buses.header );
+
+                std::string temp;
+                for ( Types::index row = 0; row < buses.table.NumberOfRows(); ++row )
+                {
+                    IO::Helper::CsvTable::Row const splitted = buses.table[row];
+                    TVertexProperties vertexProperties;
+
+                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperBuses_.size() );
+
+                    for ( Types::count counter = 0
+                        ; counter < static_cast<Types::count>( splitted.size() )
+                        ; ++counter )
+                    {
+                        temp.assign( splitted[counter] );
+                        (this->*dataMapperBuses_[counter])( temp , vertexProperties);
+                    } // for
+                    Types::vertexId index                            = AddVertex<TNetwork>( network, vertexProperties );
+                    mapBusName2VertexId_[ vertexProperties.Name() ]  = index;
+                } // for each row
+                return true;
+            }
+
+            /**
+             * @brief      Adds a generator for each row of the generator file.
+             *
+             * @pre        The buses are added.
+             *
+             * @param      network     The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  generators  The tokenized generator file.
+             *
+             * @return     @p true if the construction was successful, @p false otherwise.
+             */
+            inline bool BuildGenerators ( TNetwork               & network
+                                        , TokenizedCsvFile const & generators )
+            {
+                dataMapperGenerators_.clear();
+                ExtractGeneratorHeader( generators.header );
+
+                std::string temp;
+                for ( Types::index row = 0; row < generators.table.NumberOfRows(); ++row )
+                {
+                    IO::Helper::CsvTable::Row const splitted = generators.table[row];
+                    TGeneratorProperties generator;
+
+                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperGenerators_.size() );
+
+                    for ( Types::count counter = 0;
+                          counter < static_cast<Types::count>( splitted.size() );
+                          ++counter
+                        )
+                    {
+                        temp.assign( splitted[counter] );
+                        (this->*dataMapperGenerators_[counter])( temp , generator);
+                    } // for
+                    Types::vertexId generatorId = Const::NONE;
+                    if ( mapGeneratorName2BusName_.find(generator.Name()) != mapGeneratorName2BusName_.end() )
+                    {
+                        if ( mapBusName2VertexId_.find(mapGeneratorName2BusName_[generator.Name()]) != mapBusName2VertexId_.end() )
+                        {
+                            generatorId = network.AddGeneratorAt(mapBusName2VertexId_[mapGeneratorName2BusName_[generator.Name()]], generator);
+                        } else {
+                            ESSENTIAL_ASSERT( false && "Bus name does not exist" );
+                        }
+                    } else {
+                        ESSENTIAL_ASSERT( false && "Generator name does not exist" );
+                    }
+                    if ( mapGeneratorName2Identifier_.find(generator.Name()) == mapGeneratorName2Identifier_.end() )
+                    {
+                        mapGeneratorName2Identifier_[generator.Name()] = generatorId;
+                    } else {
+                        ESSENTIAL_ASSERT( false && "Generator name to identifier, Generator name duplicates" );
+                    }
+                } // for each row
+                network.UpdateGeneratorSnapshotSize();
+                return true;
+            }
+
+            /**
+             * @brief      Adds the maximum real power snapshots in p.u. to the
+             *     generators.
+             *
+             * @pre        The generators are added.
+             *
+             * @param      network                   The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  generatorsRealPowerMaxPu  The tokenized snapshot file.
+             *
+             * @return     @p true if the construction was successful, @p false otherwise.
+             */
+            inline bool BuildGeneratorsRealPowerMaxPu ( TNetwork               & network
+                                                      , TokenizedCsvFile const & generatorsRealPowerMaxPu )
+            {
+                dataMapperGeneratorsRealPowerMaxPu_.clear();
+                ExtractGeneratorMaximumRealPowerPuHeader( generatorsRealPowerMaxPu.header );
+
+                IO::Helper::CsvTable const & table = generatorsRealPowerMaxPu.table;
+                for ( Types::index row = 0; row < table.NumberOfRows(); ++row )
+                {
+                    USAGE_ASSERT ( static_cast<Types::count>( table[row].size() ) == dataMapperGeneratorsRealPowerMaxPu_.size() );
+
+                    if ( !table[row][0].empty() )
+                    {
+                        ++ generatorSnapshotsSize;
+                    }
+                } // for each row
+
+                // Reserve all rows, since the columns are mapped in parallel
+                network.UpdateGeneratorSnapshotSize ( table.NumberOfRows() );
+                MapSnapshotColumns ( network, generatorsRealPowerMaxPu, dataMapperGeneratorsRealPowerMaxPu_ );
+                return true;
+            }
+
+            /**
+             * @brief      Adds an edge for each row of the line file.
+             *
+             * @pre        The buses are added.
+             *
+             * @param      network  The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  lines    The tokenized line file.
+             *
+             * @tparam     Graph    The graph type, e.g., PowerGrid.
+             *
+             * @return     @p true if the construction was successful, @p false otherwise.
+             */
+            template<typename Graph = TNetwork>
+            inline bool BuildLines ( Graph                  & network
+                                   , TokenizedCsvFile const & lines )
+            {
+                dataMapperLines_.clear();
+                ExtractLineHeader( lines.header );
+
+                std::string temp;
+                for ( Types::index row = 0; row < lines.table.NumberOfRows(); ++row )
+                {
+                    IO::Helper::CsvTable::Row const splitted = lines.table[row];
+                    TIoEdge edge;
+                    SetLineDefaultValues ( edge );
+
+                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperLines_.size() );
+
+                    for ( Types::count counter = 0
+                        ; counter < static_cast<Types::count>( splitted.size() )
+                        ; ++counter )
+                    {
+                        temp.assign( splitted[counter] );
+                        (this->*dataMapperLines_[counter])( temp , edge );
+                    } // for
+                    AddEdge<Graph>( network, edge );
+                } // for each row
+                return true;
+            }
+
+            /**
+             * @brief      Adds a load for each row of the load file.
+             *
+             * @pre        The buses are added.
+             *
+             * @param      network  The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  loads    The tokenized load file.
+             *
+             * @return     @p true if the construction was successful, @p false otherwise.
+             */
+            inline bool BuildLoads ( TNetwork               & network
+                                   , TokenizedCsvFile const & loads )
+            {
+                Types::index busColumn(0);
+
+                dataMapperLoads_.clear();
+                ExtractLoadHeader( loads.header, busColumn );
+
+                Types::string temp;
+                for ( Types::index row = 0; row < loads.table.NumberOfRows(); ++row )
+                {
+                    IO::Helper::CsvTable::Row const splitted = loads.table[row];
+                    TLoadProperties vertex;
+                    SetLoadDefaultValues(vertex);
+
+                    USAGE_ASSERT ( static_cast<Types::count>( splitted.size() ) == dataMapperLoads_.size() );
+
+                    // Read a row
+                    for ( Types::count counter = 0
+                        ; counter < static_cast<Types::count>( splitted.size() )
+                        ; ++counter )
+                    {
+                        temp.assign( splitted[counter] );
+                        (this->*dataMapperLoads_[counter])( temp , vertex);
+                    } // for each column in a row
+
+                    Types::loadId loadId = Const::NONE;
+                    temp.assign( splitted[ busColumn ] );
+                    if (mapBusName2VertexId_.find( temp ) != mapBusName2VertexId_.end() )
+                    {
+                        loadId = network.AddLoadAt( mapBusName2VertexId_[ temp ], vertex );
+                    } else {
+                        ESSENTIAL_ASSERT( false && "Bus name does not exist" );
+                    }
+
+                    if ( mapLoadName2Identifier_.find( vertex.Name() ) == mapLoadName2Identifier_.end() ) {
+                        mapLoadName2Identifier_[vertex.Name()]  = loadId;
+                    } else {
+                        ESSENTIAL_ASSERT( false && "Load name duplicates" );
+                    }
+                } // for each row
+                return true;
+            }
+
+            /**
+             * @brief      Adds the real power snapshots to the loads.
+             *
+             * @pre        The loads are added.
+             *
+             * @param      network            The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  loadsRealPowerSet  The tokenized snapshot file.
+             *
+             * @return     @p true if the construction was successful, @p false otherwise.
+             */
+            inline bool BuildLoadsPset ( TNetwork               & network
+                                       , TokenizedCsvFile const & loadsRealPowerSet )
+            {
+                dataMapperLoadsRealPowerMaxPu_.clear();
+                ExtractLoadMaximumRealPowerPuHeader( loadsRealPowerSet.header );
+
+                IO::Helper::CsvTable const & table = loadsRealPowerSet.table;
+                for ( Types::index row = 0; row < table.NumberOfRows(); ++row )
+                {
+                    USAGE_ASSERT ( static_cast<Types::count>( table[row].size() ) == dataMapperLoadsRealPowerMaxPu_.size() );
+
+                    if ( !table[row][0].empty() )
+                    {
+                        ++ loadSnapshotsSize;
+                    }
+                } // for each row
+
+                // Reserve all rows, since the columns are mapped in parallel
+                network.UpdateLoadSnapshotSize ( table.NumberOfRows() );
+                MapSnapshotColumns ( network, loadsRealPowerSet, dataMapperLoadsRealPowerMaxPu_ );
+                return true;
+            }
+
+            /**
+             * @brief      Applies the mapper of each column of a snapshot
+             *     file to all of its rows.
+             * @details    Each column except the timestamps belongs to a
+             *     different generator or load, whose snapshots are
+             *     already allocated for all rows. Thus, if the column names are distinct
+             *     and OpenMP is available, the columns are mapped in
+             *     parallel, where the numbers are parsed directly from the
+             *     mapped file. The snapshots of each generator or load are
+             *     added in the order of the rows.
+             *
+             * @param      network  The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
+             * @param[in]  csv      The tokenized snapshot file.
+             * @param[in]  mappers  The mapper of each column.
+             *
+             * @tparam     MapperType  The type of the mappers, e.g., GeneratorMaximumRealPowerPuFunc.
+             */
+            template<typename MapperType>
+            inline void MapSnapshotColumns ( TNetwork                      & network
+                                           , TokenizedCsvFile        const & csv
+                                           , std::vector<MapperType> const & mappers )
+            {
+                IO::Helper::CsvTable const & table = csv.table;
+                [[maybe_unused]] bool const isParallel = HasDistinctColumns ( csv.header );
+
+#ifdef OPENMP_AVAILABLE
+                #pragma omp parallel for schedule ( dynamic ) if ( isParallel )
+#endif // OPENMP_AVAILABLE
+                for ( Types::index column = 0; column < mappers.size(); ++column )
+                {
+                    for ( Types::index row = 0; row < table.NumberOfRows(); ++row )
+                    {
+                        IO::Helper::CsvTable::Row const splitted = table[row];
+                        if ( column < splitted.size() )
+                        {
+                            mappers[column]( splitted[column], network );
+                        }
+                    } // for each row
+                } // for each column
+            }
+
+            /**
+             * @brief      Determines if all column names are distinct.
+             *
+             * @param[in]  header  The column names.
+             *
+             * @return     @p true if no column name appears twice, @p false
+             *     otherwise.
+             */
+            inline bool HasDistinctColumns ( std::vector<Types::name> const & header ) const
+            {
+                std::unordered_set<Types::name> names ( header.begin(), header.end() );
+                return names.size() == header.size();
+            }
+        ///@}
+
         ///@name Auxiliary
         ///@{
 #pragma mark AUXILIARY
@@ -973,21 +1232,28 @@ class PyPsaParser {
             }
 
             /**
-             * @brief      Reads a line.
+             * @brief      Reads the header line.
              *
              * @param      file      The file.
-             * @param[in]  compress  The compress.
+             * @param[in]  compress  Whether spaces inside of the column
+             *     names are removed.
              *
-             * @return     The line as array, where each field represents a
-             *     column entry.
+             * @return     The column names, where each entry represents a
+             *     column.
              */
-            inline QList<QByteArray> ReadLine ( QFile & file
-                                              , bool    compress = true )
+            inline std::vector<Types::name> ReadHeader ( TCsvReader & file
+                                                       , bool         compress = true )
             {
-                QByteArray  line = file.readLine();
-                if ( compress ) CompressString( line);
-                line = line.trimmed();
-                return line.split(',');
+                std::vector<std::string_view> splitted;
+                std::vector<Types::name>      header;
+                file.ReadLine( splitted );
+                header.reserve( splitted.size() );
+                for ( auto const & column : splitted )
+                {
+                    header.emplace_back( column );
+                    if ( compress ) CompressString( header.back() );
+                }
+                return header;
             }
 
             /**
@@ -995,24 +1261,24 @@ class PyPsaParser {
              *
              * @param      list  The list.
              */
-            inline void CompressString ( QByteArray & list )
+            inline void CompressString ( Types::name & list )
             {
-                list = list.replace(" ","");
+                list.erase( std::remove( list.begin(), list.end(), ' ' ), list.end() );
             }
 
             /**
-             * @brief      Opens a file.
+             * @brief      Checks if a file could be opened.
              *
              * @param      file  The file.
              *
              * @return     @p true file could be opened, @p false otherwise.
              */
-            inline bool OpenFile ( QFile & file )
+            inline bool OpenFile ( TCsvReader const & file )
             {
-                if (!file.open(QIODevice::ReadOnly))
+                if ( !file.IsOpen() )
                 {
-                    qDebug() << file.errorString();
-                    return false; // TODO throw exception
+                    std::cerr << "Could not open " << file.Filename() << std::endl;
+                    return false;
                 }
                 return true;
             }
@@ -1043,7 +1309,7 @@ class PyPsaParser {
              *
              * @return     @p true if the extraction was successful, @p false otherwise.
              */
-            inline bool ExtractBusHeader( QList<QByteArray> const & splitted )
+            inline bool ExtractBusHeader( std::vector<Types::name> const & splitted )
             {
                 for ( Types::count counter = 0
                     ; counter < static_cast<Types::count>( splitted.size() )
@@ -1113,7 +1379,7 @@ class PyPsaParser {
              *
              * @return     @p true if the extraction was successful, @p false otherwise.
              */
-            inline bool ExtractLineHeader( QList<QByteArray> const & splitted )
+            inline bool ExtractLineHeader( std::vector<Types::name> const & splitted )
             {
                 for ( Types::count counter = 0
                     ; counter < static_cast<Types::count>( splitted.size() )
@@ -1238,7 +1504,7 @@ class PyPsaParser {
              *
              * @return     @p true if the extraction was successful, @p false otherwise.
              */
-            inline bool ExtractGeneratorHeader( QList<QByteArray> const & splitted )
+            inline bool ExtractGeneratorHeader( std::vector<Types::name> const & splitted )
             {
                 for ( Types::count counter = 0
                     ; counter < static_cast<Types::count>( splitted.size() )
@@ -1355,7 +1621,7 @@ class PyPsaParser {
              * @return     @p true if the header could be extracted, @p false
              *     otherwise.
              */
-            inline bool ExtractGeneratorMaximumRealPowerPuHeader( QList<QByteArray> const & splitted )
+            inline bool ExtractGeneratorMaximumRealPowerPuHeader( std::vector<Types::name> const & splitted )
             {
                 for ( Types::count counter = 0
                     ; counter < static_cast<Types::count>( splitted.size() )
@@ -1372,7 +1638,7 @@ class PyPsaParser {
                         );
                     } else
                     {
-                        std::string generatorName = splitted[counter].trimmed().toStdString();
+                        std::string generatorName = splitted[counter];
                         // dataMapperGeneratorsRealPowerMaxPu_.emplace_back( std::bind(&PyPsaParser::AddMaximumRealPowerSnapshotPuToGenerator, std::placeholders::_1, mapGeneratorName2Generator_[generatorName]) );
 
                         if ( mapGeneratorName2Identifier_.find(generatorName) == mapGeneratorName2Identifier_.end() )
@@ -1400,8 +1666,8 @@ class PyPsaParser {
              * @return     @p true if the header could be extracted, @p false
              *     otherwise.
              */
-            inline bool ExtractLoadHeader ( QList<QByteArray> const & splitted
-                                          , Types::index            & column )
+            inline bool ExtractLoadHeader ( std::vector<Types::name> const & splitted
+                                          , Types::index                   & column )
             {
                 for ( Types::count counter = 0
                     ; counter < static_cast<Types::count>( splitted.size() )
@@ -1444,7 +1710,7 @@ class PyPsaParser {
              *
              * @return     @p true if the header could be extracted, @p false otherwise.
              */
-            inline bool ExtractLoadMaximumRealPowerPuHeader( QList<QByteArray> const & splitted )
+            inline bool ExtractLoadMaximumRealPowerPuHeader( std::vector<Types::name> const & splitted )
             {
                 for ( Types::count counter = 0
                     ; counter < static_cast<Types::count>( splitted.size() )
@@ -1461,7 +1727,7 @@ class PyPsaParser {
                         );
                     } else
                     {
-                        std::string loadName = splitted[counter].toStdString();
+                        std::string loadName = splitted[counter];
 
                         if ( mapLoadName2Identifier_.find(loadName) == mapLoadName2Identifier_.end() )
                         {
@@ -1480,6 +1746,8 @@ class PyPsaParser {
             }
         ///@}
 
+        static constexpr Types::count MinimumChunkSize = 1 << 20;               /**< The minimum number of bytes per byte range of a tokenized file. */
+
 #pragma mark FUNCTION_POINTER_VECTOR_WITH_FUNCTION_POINTER
 
         std::vector<TGeneratorProperties*> headerGeneratorMaximumRealPowerPu_;   /**< */
@@ -1489,10 +1757,10 @@ class PyPsaParser {
             using ElectricalVertexFunc               = void (PyPsaParser::*)( Types::name const &, TVertexProperties& );
 
             using GeneratorVertexFunc                = void (PyPsaParser::*)( Types::name const &, TGeneratorProperties& );
-            using GeneratorMaximumRealPowerPuFunc    = std::function<void(Types::string const &, TNetwork&)>;
+            using GeneratorMaximumRealPowerPuFunc    = std::function<void(std::string_view, TNetwork&)>;
 
             using LoadVertexFunc                     = void (PyPsaParser::*)( Types::name const &, TLoadProperties& );
-            using LoadMaximumRealPowerPuFunc         = std::function<void(Types::string const &, TNetwork&)>;
+            using LoadMaximumRealPowerPuFunc         = std::function<void(std::string_view, TNetwork&)>;
 
             using ElectricalEdgeFunc                 = void (PyPsaParser::*)( Types::name const &, TIoEdge& );
         ///@}
@@ -1545,7 +1813,7 @@ class PyPsaParser {
                 {
                     if ( voltageNominal.compare("inf") != 0 )
                     { // not inf
-                        vertexProperty.NominalVoltage() = Types::String2double( voltageNominal );
+                        vertexProperty.NominalVoltage() = IO::Helper::StringToReal( voltageNominal );
                     } else { //inf
                         vertexProperty.NominalVoltage() = Const::REAL_INFTY;
                     }
@@ -1582,7 +1850,7 @@ class PyPsaParser {
             {
                 if ( !xCoordinate.empty() )
                 {
-                    vertexProperty.X()      = Types::String2double( xCoordinate );
+                    vertexProperty.X()      = IO::Helper::StringToReal( xCoordinate );
                 }
             }
 
@@ -1597,7 +1865,7 @@ class PyPsaParser {
             {
                 if ( !yCoordinate.empty() )
                 {
-                    vertexProperty.Y()      = Types::String2double( yCoordinate );
+                    vertexProperty.Y()      = IO::Helper::StringToReal( yCoordinate );
                 }
             }
 
@@ -1644,7 +1912,7 @@ class PyPsaParser {
                 {
                     if ( voltageMagnitudePuSetpoint.compare("inf") != 0 )
                     { // not inf
-                        vertexProperty.VoltageMagnitude() = Types::String2double( voltageMagnitudePuSetpoint );
+                        vertexProperty.VoltageMagnitude() = IO::Helper::StringToReal( voltageMagnitudePuSetpoint );
                     } else { //inf
                         vertexProperty.VoltageMagnitude() = Const::REAL_INFTY;
                     }
@@ -1664,7 +1932,7 @@ class PyPsaParser {
                 { /* vertex voltageMagnitudePuMinimum */
                     if ( voltageMagnitudePuMinimum.compare("inf") != 0 )
                     { // not inf
-                        vertexProperty.MinimumVoltage() = Types::String2double( voltageMagnitudePuMinimum );
+                        vertexProperty.MinimumVoltage() = IO::Helper::StringToReal( voltageMagnitudePuMinimum );
                     } else { //inf
                         vertexProperty.MinimumVoltage() = Const::REAL_INFTY;
                     }
@@ -1684,7 +1952,7 @@ class PyPsaParser {
                 { /* vertex voltageMagnitudePuMaximum */
                     if ( voltageMagnitudePuMaximum.compare("inf") != 0 )
                     { // not inf
-                        vertexProperty.MaximumVoltage() = Types::String2double( voltageMagnitudePuMaximum );
+                        vertexProperty.MaximumVoltage() = IO::Helper::StringToReal( voltageMagnitudePuMaximum );
                     } else { //inf
                         vertexProperty.MaximumVoltage() = Const::REAL_INFTY;
                     }
@@ -1750,9 +2018,9 @@ class PyPsaParser {
                 {
                     if ( realPower.compare("inf") != 0 )
                     { // not inf
-                        /* vertex.RealPowerLoad()        = Types::String2double( realPower ); */
+                        /* vertex.RealPowerLoad()        = IO::Helper::StringToReal( realPower ); */
                     } else { //inf
-                        /* vertex.RealPowerLoad()        = Types::String2double( realPower ); */
+                        /* vertex.RealPowerLoad()        = IO::Helper::StringToReal( realPower ); */
                     }
                 }
             }
@@ -1772,9 +2040,9 @@ class PyPsaParser {
                 {
                     if ( reactivePower.compare("inf") != 0 )
                     { // not inf
-                        /*vertex.ReactivePowerLoad()    = Types::String2double( reactivePower ); */
+                        /*vertex.ReactivePowerLoad()    = IO::Helper::StringToReal( reactivePower ); */
                     } else { //inf
-                        /*vertex.ReactivePowerLoad()    = Types::String2double( reactivePower ); */
+                        /*vertex.ReactivePowerLoad()    = IO::Helper::StringToReal( reactivePower ); */
                     }
                 }
             }
@@ -1816,7 +2084,7 @@ class PyPsaParser {
                 {
                     if ( voltageAngle.compare("inf") != 0 )
                     { // not inf
-                        vertexProperty.VoltageAngle()         = Types::String2double( voltageAngle );
+                        vertexProperty.VoltageAngle()         = IO::Helper::StringToReal( voltageAngle );
                     } else { //inf
                         vertexProperty.VoltageAngle()         = Const::REAL_INFTY;
                     }
@@ -1875,9 +2143,9 @@ class PyPsaParser {
             inline void AddNominalRealPowerToGenerator ( Types::string  const & pNom
                                                        , TGeneratorProperties & generatorProperty )
             {
-                if ( Types::String2double( pNom ) != 0 )
+                if ( IO::Helper::StringToReal( pNom ) != 0 )
                 {
-                    generatorProperty.NominalPower()  = Types::String2double( pNom );
+                    generatorProperty.NominalPower()  = IO::Helper::StringToReal( pNom );
                 } else {
                     generatorProperty.NominalPower()  = 1;
                 }
@@ -1970,7 +2238,7 @@ class PyPsaParser {
                 {
                     if ( efficiency.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.Efficiency() = Types::String2double( efficiency );
+                        generatorProperty.Efficiency() = IO::Helper::StringToReal( efficiency );
                     } else { //inf
                         generatorProperty.Efficiency() = Const::REAL_INFTY;
                     }
@@ -1990,7 +2258,7 @@ class PyPsaParser {
                 {
                     if ( pNomMin.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.NominalRealPowerBound().Minimum() = Types::String2double( pNomMin );
+                        generatorProperty.NominalRealPowerBound().Minimum() = IO::Helper::StringToReal( pNomMin );
                     } else { //inf
                         generatorProperty.NominalRealPowerBound().Minimum() = Const::REAL_INFTY;
                     }
@@ -2010,7 +2278,7 @@ class PyPsaParser {
                 {
                     if ( pNomMax.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.NominalRealPowerBound().Maximum() = Types::String2double( pNomMax );
+                        generatorProperty.NominalRealPowerBound().Maximum() = IO::Helper::StringToReal( pNomMax );
                     } else { //inf
                         generatorProperty.NominalRealPowerBound().Maximum() = Const::REAL_INFTY;
                     }
@@ -2030,7 +2298,7 @@ class PyPsaParser {
                 {
                     if ( pMinPu.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RealPowerBound().Minimum()   = Types::String2double( pMinPu  );
+                        generatorProperty.RealPowerBound().Minimum()   = IO::Helper::StringToReal( pMinPu  );
                     } else { //inf
                         generatorProperty.RealPowerBound().Minimum()   = Const::REAL_INFTY;
                     }
@@ -2050,7 +2318,7 @@ class PyPsaParser {
                 {
                     if ( pMaxPu.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RealPowerBound().Maximum()   = Types::String2double( pMaxPu  );
+                        generatorProperty.RealPowerBound().Maximum()   = IO::Helper::StringToReal( pMaxPu  );
                     } else { //inf
                         generatorProperty.RealPowerBound().Maximum()   = Const::REAL_INFTY;
                     }
@@ -2070,7 +2338,7 @@ class PyPsaParser {
                 {
                     if ( pSet.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RealPower() = Types::String2double( pSet );
+                        generatorProperty.RealPower() = IO::Helper::StringToReal( pSet );
                     } else { //inf
                         generatorProperty.RealPower() = Const::REAL_INFTY;
                     }
@@ -2090,7 +2358,7 @@ class PyPsaParser {
                 {
                     if ( qSet.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.ReactivePower() = Types::String2double( qSet );
+                        generatorProperty.ReactivePower() = IO::Helper::StringToReal( qSet );
                     } else { //inf
                         generatorProperty.ReactivePower() = Const::REAL_INFTY;
                     }
@@ -2108,7 +2376,7 @@ class PyPsaParser {
             {
                 if ( !sign.empty() )
                 {
-                    Types::integer powerSign    = Types::String2integer( sign );
+                    Types::integer powerSign    = IO::Helper::StringToInteger( sign );
                     if ( powerSign >= 0 )
                     {
                         generatorProperty.PowerSign()  = Vertices::PowerSign::positive;
@@ -2147,7 +2415,7 @@ class PyPsaParser {
                 {
                     if ( marginalCost.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.MarginalCost() = Types::String2double( marginalCost );
+                        generatorProperty.MarginalCost() = IO::Helper::StringToReal( marginalCost );
                     } else { //inf
                         generatorProperty.MarginalCost() = Const::REAL_INFTY;
                     }
@@ -2167,7 +2435,7 @@ class PyPsaParser {
                 {
                     if ( capitalCost.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.CapitalCost() = Types::String2double( capitalCost );
+                        generatorProperty.CapitalCost() = IO::Helper::StringToReal( capitalCost );
                     } else { //inf
                         generatorProperty.CapitalCost() = Const::REAL_INFTY;
                     }
@@ -2211,7 +2479,7 @@ class PyPsaParser {
                 {
                     if ( startUpCost.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.StartUpCost() = Types::String2double( startUpCost );
+                        generatorProperty.StartUpCost() = IO::Helper::StringToReal( startUpCost );
                     } else { //inf
                         generatorProperty.StartUpCost() = Const::REAL_INFTY;
                     }
@@ -2231,7 +2499,7 @@ class PyPsaParser {
                 {
                     if ( shutDownCost.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.ShutDownCost() = Types::String2double( shutDownCost );
+                        generatorProperty.ShutDownCost() = IO::Helper::StringToReal( shutDownCost );
                     } else { //inf
                         generatorProperty.ShutDownCost() = Const::REAL_INFTY;
                     }
@@ -2251,7 +2519,7 @@ class PyPsaParser {
                 {
                     if ( minUpTime.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.MinimumUpTime() = Types::String2double( minUpTime );
+                        generatorProperty.MinimumUpTime() = IO::Helper::StringToReal( minUpTime );
                     } else { //inf
                         generatorProperty.MinimumUpTime() = Const::REAL_INFTY;
                     }
@@ -2271,7 +2539,7 @@ class PyPsaParser {
                 {
                     if ( minDownTime.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.MinimumDownTime() = Types::String2double( minDownTime );
+                        generatorProperty.MinimumDownTime() = IO::Helper::StringToReal( minDownTime );
                     } else { //inf
                         generatorProperty.MinimumDownTime() = Const::REAL_INFTY;
                     }
@@ -2289,7 +2557,7 @@ class PyPsaParser {
             {
                 if ( !initialStatus.empty() )
                 {
-                    Types::index status     = Types::String2integer( initialStatus );
+                    Types::index status     = IO::Helper::StringToInteger( initialStatus );
                     if ( status )
                         generatorProperty.Status() = Vertices::BusStatus::active;
                     else
@@ -2310,7 +2578,7 @@ class PyPsaParser {
                 {
                     if ( rampLimitUp.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RampLimitUp() = Types::String2double( rampLimitUp );
+                        generatorProperty.RampLimitUp() = IO::Helper::StringToReal( rampLimitUp );
                     } else { //inf
                         generatorProperty.RampLimitUp() = Const::REAL_INFTY;
                     }
@@ -2330,7 +2598,7 @@ class PyPsaParser {
                 {
                     if ( rampLimitDown.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RampLimitDown() = Types::String2double( rampLimitDown );
+                        generatorProperty.RampLimitDown() = IO::Helper::StringToReal( rampLimitDown );
                     } else { //inf
                         generatorProperty.RampLimitDown() = Const::REAL_INFTY;
                     }
@@ -2350,7 +2618,7 @@ class PyPsaParser {
                 {
                     if ( rampLimitStartUp.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RampLimitStartUp()  = Types::String2double( rampLimitStartUp);
+                        generatorProperty.RampLimitStartUp()  = IO::Helper::StringToReal( rampLimitStartUp);
                     } else { //inf
                         generatorProperty.RampLimitStartUp()  = Const::REAL_INFTY;
                     }
@@ -2370,7 +2638,7 @@ class PyPsaParser {
                 {
                     if ( rampLimitShutDown.compare("inf") != 0 )
                     { // not inf
-                        generatorProperty.RampLimitShutDown() = Types::String2double( rampLimitShutDown );
+                        generatorProperty.RampLimitShutDown() = IO::Helper::StringToReal( rampLimitShutDown );
                     } else { //inf
                         generatorProperty.RampLimitShutDown() = Const::REAL_INFTY;
                     }
@@ -2496,8 +2764,8 @@ class PyPsaParser {
              * @todo       What happens if load timestamps does not exist?
              *
              */
-            void AddTimestampOfGenerator ( Types::name const & name
-                                         , TNetwork          & network )
+            void AddTimestampOfGenerator ( std::string_view   /*name*/
+                                         , TNetwork         & /*network*/ )
             { /*network.AddSnapshotTimestamp( name ); is already implemented at load equivalent*/
             }
 
@@ -2511,15 +2779,15 @@ class PyPsaParser {
              * @todo Check if the number of timestamps are correct
              *
              */
-            inline void AddMaximumRealPowerSnapshotPuToGenerator ( Types::name const & maximumRealPowerPu
-                                                                 , TNetwork          & network
-                                                                 , Types::vertexId     generatorId )
+            inline void AddMaximumRealPowerSnapshotPuToGenerator ( std::string_view   maximumRealPowerPu
+                                                                 , TNetwork         & network
+                                                                 , Types::vertexId    generatorId )
             {
                 if ( !maximumRealPowerPu.empty() )
                 {
                     if ( maximumRealPowerPu.compare("inf") != 0 )
                     { // not inf
-                        network.AddGeneratorRealPowerSnapshotAt ( generatorId, Types::String2double( maximumRealPowerPu ) );
+                        network.AddGeneratorRealPowerSnapshotAt ( generatorId, IO::Helper::StringToReal( maximumRealPowerPu ) );
                     } else { //inf
                         network.AddGeneratorRealPowerSnapshotAt ( generatorId, Const::REAL_INFTY );
                     }
@@ -2595,7 +2863,7 @@ class PyPsaParser {
                 {
                     if ( capitalCost.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().CapitalCost() = Types::String2double( capitalCost );
+                        edge.Properties().CapitalCost() = IO::Helper::StringToReal( capitalCost );
                     } else { //inf
                         edge.Properties().CapitalCost() = Const::REAL_INFTY;
                     }
@@ -2615,7 +2883,7 @@ class PyPsaParser {
                 {
                     if ( length.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().Length() = Types::String2double( length );
+                        edge.Properties().Length() = IO::Helper::StringToReal( length );
                     } else {
                         ESSENTIAL_ASSERT( false && "Infinity line length");
                     }
@@ -2635,7 +2903,7 @@ class PyPsaParser {
                 {
                     if ( numberParallelLines.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().NumberOfParallelLines() = Types::String2integer( numberParallelLines );
+                        edge.Properties().NumberOfParallelLines() = IO::Helper::StringToInteger( numberParallelLines );
                     } else {
                         ESSENTIAL_ASSERT( false && "Infinity parallel lines");
                     }
@@ -2655,7 +2923,7 @@ class PyPsaParser {
                 {
                     if ( apparentPowerMaximumPu.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().ThermalLimit() = Types::String2double( apparentPowerMaximumPu );
+                        edge.Properties().ThermalLimit() = IO::Helper::StringToReal( apparentPowerMaximumPu );
                     } else { //inf
                         edge.Properties().ThermalLimit() = Const::REAL_INFTY;
                     }
@@ -2675,7 +2943,7 @@ class PyPsaParser {
                 {
                     if ( apparentPowerNominal.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().NominalApparentPower() = Types::String2double( apparentPowerNominal );
+                        edge.Properties().NominalApparentPower() = IO::Helper::StringToReal( apparentPowerNominal );
                     } else { //inf
                         edge.Properties().NominalApparentPower() = Const::REAL_INFTY;
                     }
@@ -2710,7 +2978,7 @@ class PyPsaParser {
                 {
                     if ( voltageNominal.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().NominalVoltage() = Types::String2double( voltageNominal );
+                        edge.Properties().NominalVoltage() = IO::Helper::StringToReal( voltageNominal );
                     } else { //inf
                         edge.Properties().NominalVoltage() = Const::REAL_INFTY;
                     }
@@ -2730,7 +2998,7 @@ class PyPsaParser {
                 {
                     if ( apparentPowerNominalMinimum.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().NominalApparentPowerBound().Minimum() = Types::String2double( apparentPowerNominalMinimum );
+                        edge.Properties().NominalApparentPowerBound().Minimum() = IO::Helper::StringToReal( apparentPowerNominalMinimum );
                     } else { //inf
                         edge.Properties().NominalApparentPowerBound().Minimum() = Const::REAL_INFTY;
                     }
@@ -2750,7 +3018,7 @@ class PyPsaParser {
                 {
                     if ( apparentPowerNominalMaximum.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().NominalApparentPowerBound().Maximum() = Types::String2double( apparentPowerNominalMaximum );
+                        edge.Properties().NominalApparentPowerBound().Maximum() = IO::Helper::StringToReal( apparentPowerNominalMaximum );
                     } else { //inf
                         edge.Properties().NominalApparentPowerBound().Maximum() = Const::REAL_INFTY;
                     }
@@ -2770,7 +3038,7 @@ class PyPsaParser {
                 {
                     if ( resistance.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().Resistance() = Types::String2double( resistance );
+                        edge.Properties().Resistance() = IO::Helper::StringToReal( resistance );
                     } else { //inf
                         edge.Properties().Resistance() = Const::REAL_INFTY;
                     }
@@ -2790,7 +3058,7 @@ class PyPsaParser {
                 {
                     if ( reactance.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().Reactance() = Types::String2double( reactance );
+                        edge.Properties().Reactance() = IO::Helper::StringToReal( reactance );
                     } else { //inf
                         edge.Properties().Reactance() = Const::REAL_INFTY;
                     }
@@ -2810,7 +3078,7 @@ class PyPsaParser {
                 {
                     if ( conductance.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().Conductance( Types::String2double( conductance ) );
+                        edge.Properties().Conductance( IO::Helper::StringToReal( conductance ) );
                     } else { //inf
                         edge.Properties().Conductance( Const::REAL_INFTY );
                     }
@@ -2830,7 +3098,7 @@ class PyPsaParser {
                 {
                     if ( susceptance.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().Susceptance( Types::String2double( susceptance ) );
+                        edge.Properties().Susceptance( IO::Helper::StringToReal( susceptance ) );
                     } else { //inf
                         edge.Properties().Susceptance( Const::REAL_INFTY );
                     }
@@ -2848,7 +3116,7 @@ class PyPsaParser {
             {
                 if ( !apparentPowerNominalExtendable.empty() )
                 {
-                    edge.Properties().NominalApparentPowerExtendable() = Types::String2double( apparentPowerNominalExtendable );
+                    edge.Properties().NominalApparentPowerExtendable() = IO::Helper::StringToReal( apparentPowerNominalExtendable );
                 }
             }
 
@@ -2865,7 +3133,7 @@ class PyPsaParser {
                 {
                     if ( terrainFactor.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().TerrainFactor() = Types::String2double( terrainFactor );
+                        edge.Properties().TerrainFactor() = IO::Helper::StringToReal( terrainFactor );
                     } else { //inf
                         edge.Properties().TerrainFactor() = Const::REAL_INFTY;
                     }
@@ -2885,7 +3153,7 @@ class PyPsaParser {
                 {
                     if ( voltageAngleMin.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().ThetaBound().Minimum() = Types::String2double( voltageAngleMin );
+                        edge.Properties().ThetaBound().Minimum() = IO::Helper::StringToReal( voltageAngleMin );
                     } else { //inf
                         edge.Properties().ThetaBound().Minimum()  = Const::REAL_INFTY;
                     }
@@ -2905,7 +3173,7 @@ class PyPsaParser {
                 {
                     if ( voltageAngleMax.compare("inf") != 0 )
                     { // not inf
-                        edge.Properties().ThetaBound().Maximum() = Types::String2double( voltageAngleMax );
+                        edge.Properties().ThetaBound().Maximum() = IO::Helper::StringToReal( voltageAngleMax );
                     } else { //inf
                         edge.Properties().ThetaBound().Maximum() = Const::REAL_INFTY;
                     }
@@ -3405,10 +3673,10 @@ class PyPsaParser {
              * @param      name     The real power load time stamp in p.u.
              * @param      network  The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
              */
-            inline void AddLoadTimestampName ( Types::name const & name
-                                             , TNetwork          & network )
+            inline void AddLoadTimestampName ( std::string_view   name
+                                             , TNetwork         & network )
             {
-                network.AddSnapshotTimestamp( name );
+                network.AddSnapshotTimestamp( Types::timestampSnapshot ( name ) );
             }
 
             /**
@@ -3418,15 +3686,15 @@ class PyPsaParser {
              * @param      network             The network @f$\network = ( \graph, \generators, \consumers, \capacity, \susceptance, \dots )@f$.
              * @param[in]  loadId              The load identifier.
              */
-            inline void AddMaximumRealPowerSnapshotPuToLoad ( Types::name const & maximumRealPowerPu
-                                                            , TNetwork          & network
-                                                            , Types::vertexId     loadId )
+            inline void AddMaximumRealPowerSnapshotPuToLoad ( std::string_view   maximumRealPowerPu
+                                                            , TNetwork         & network
+                                                            , Types::vertexId    loadId )
             {
                 if ( !maximumRealPowerPu.empty() )
                 {
                     if ( maximumRealPowerPu.compare("inf") != 0 )
                     { // not inf
-                        network.AddLoadSnapshotAt ( loadId, Types::String2double( maximumRealPowerPu ) );
+                        network.AddLoadSnapshotAt ( loadId, IO::Helper::StringToReal( maximumRealPowerPu ) );
                     } else { //inf
                         network.AddLoadSnapshotAt ( loadId, Const::REAL_INFTY );
                     }
@@ -18,6 +18,7 @@
 #endif // OGDF_AVAILABLE
 
 #include "DataStructures/Networks/PowerGrid.hpp"
+#include "IO/Parser/BinaryPowerGridParser.hpp"
 #include "IO/Parser/IeeeCdfMatlabParser.hpp"
 #include "IO/Parser/PyPsaParser.hpp"
 #include "IO/Writer/GeojsonWriter.hpp"
@@ -319,6 +320,86 @@ class PowerGridIO {
             }
         ///@}
 
+        ///@name       BINARY CACHE
+        ///@details    A binary image of the network, which can be read
+        ///    without parsing, e.g., to cache a network that was read from
+        ///    text files. For more information see BinaryPowerGridParser.
+        ///@{
+#pragma mark BINARY CACHE
+
+            /**
+             * @brief      Reads a binary cache.
+             *
+             * @param      network       The network @f$\network = ( \graph,
+             *     \generators, \consumers, \capacity, \susceptance, \dots
+             *     )@f$.
+             * @param      input_stream  The input stream to read data from,
+             *     e.g., a file.
+             *
+             * @return     @p true if the reading was successful, @p false
+             *     otherwise, e.g., if the stream is not a valid cache.
+             */
+            static
+            inline bool ReadBinaryCache ( PowerGrid<GraphType> & network
+                                        , std::istream         & input_stream )
+            {
+                return BinaryPowerGridParser<GraphType>::read ( network, input_stream );
+            }
+
+            /**
+             * @brief      Reads a binary cache from a memory-mapped file.
+             *
+             * @param      network   The network @f$\network = ( \graph,
+             *     \generators, \consumers, \capacity, \susceptance, \dots
+             *     )@f$.
+             * @param      filename  The filename.
+             *
+             * @return     @p true if the reading was successful, @p false
+             *     otherwise, e.g., if the file is not a valid cache.
+             */
+            static
+            inline bool ReadBinaryCacheFile ( PowerGrid<GraphType>  & network
+                                            , std::string     const & filename )
+            {
+                return BinaryPowerGridParser<GraphType>::read ( network, filename );
+            }
+
+            /**
+             * @brief      Writes a binary cache.
+             *
+             * @param      network        The network @f$\network = ( \graph,
+             *     \generators, \consumers, \capacity, \susceptance, \dots
+             *     )@f$.
+             * @param      output_stream  The output stream to write data to,
+             *     which should be opened in binary mode.
+             *
+             * @return     @p true if the writing was successful, @p false otherwise.
+             */
+            static
+            inline bool WriteBinaryCache ( PowerGrid<GraphType> const & network
+                                         , std::ostream               & output_stream )
+            {
+                return BinaryPowerGridParser<GraphType>::write ( network, output_stream );
+            }
+
+            /**
+             * @brief      Writes a binary cache.
+             *
+             * @param      network   The network @f$\network = ( \graph,
+             *     \generators, \consumers, \capacity, \susceptance, \dots
+             *     )@f$.
+             * @param      filename  The file to which the data is written.
+             *
+             * @return     @p true if the writing was successful, @p false otherwise.
+             */
+            static
+            inline bool WriteBinaryCache ( PowerGrid<GraphType> const & network
+                                         , std::string          const & filename )
+            {
+                return BinaryPowerGridParser<GraphType>::write ( network, filename );
+            }
+        ///@}
+
         ///@name       GeoJson
         ///@details    For more information on GeoJson see <a
         ///    href="https://geojson.org">GeoJson</a> and <a
@@ -6,6 +6,7 @@
  */
 
 #include "IO/PowerGridIO.hpp"
+#include "IO/Parser/BinaryPowerGridParser.hpp"
 #include "IO/Parser/IeeeCdfMatlabParser.hpp"
 #include "IO/Parser/PyPsaParser.hpp"
 
@@ -13,13 +14,15 @@ namespace egoa {
 
 template<typename GraphType>
 const std::vector<typename PowerGridIO<GraphType>::ReaderFunctionStreamBased> PowerGridIO<GraphType>::streamReaders = {
-    PowerGridIO<GraphType>::readIeeeCdfMatlab
+    PowerGridIO<GraphType>::ReadBinaryCache
+    , PowerGridIO<GraphType>::readIeeeCdfMatlab
     //@todo PowerGridIO::readIeeePti
 };
 
 template<typename GraphType>
 const std::vector<typename PowerGridIO<GraphType>::ReaderFunctionStringBased> PowerGridIO<GraphType>::fileReaders = {
-    PowerGridIO<GraphType>::ReadPyPsa
+    PowerGridIO<GraphType>::ReadBinaryCacheFile
+    , PowerGridIO<GraphType>::ReadPyPsa
     //@todo PowerGridIO::readIeeePti
 };
 //
@@ -34,6 +37,7 @@ const std::vector<typename PowerGridIO<GraphType>::WriterFunctionStreamBased> Po
     PowerGridIO<GraphType>::writeIeeeCdfMatlab
     , PowerGridIO<GraphType>::WriteGraphDot
     , PowerGridIO<GraphType>::WriteGeoJson
+    , PowerGridIO<GraphType>::WriteBinaryCache
     //@todo PowerGridIO::readIeeePti
 };
 
@@ -42,6 +46,7 @@ const std::vector<typename PowerGridIO<GraphType>::WriterFunctionStreamBasedtion
     PowerGridIO<GraphType>::WriteGraphGml
     , PowerGridIO<GraphType>::WriteGraphDot
     , PowerGridIO<GraphType>::WriteGeoJson
+    , PowerGridIO<GraphType>::WriteBinaryCache
     //@todo PowerGridIO::readIeeePti
 };
 
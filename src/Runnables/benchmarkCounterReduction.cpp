@@ -0,0 +1,165 @@
+/*
+ * benchmarkCounterReduction.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifdef OPENMP_AVAILABLE
+    #include <omp.h>
+#endif // OPENMP_AVAILABLE
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include "Algorithms/Centralities/BetweennessCentrality.hpp"
+
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Networks/PowerGrid.hpp"
+
+#include "IO/PowerGridIO.hpp"
+
+#include "Auxiliary/Auxiliary.hpp"
+#include "Auxiliary/Timer.hpp"
+
+using TGraph = egoa::StaticGraph< egoa::Vertices::ElectricalProperties<>
+                                , egoa::Edges::ElectricalProperties >;
+
+/**
+ * @brief      The memory of the path counters during a run.
+ *
+ * @param      graph      The graph.
+ * @param[in]  reduction  The counter reduction.
+ *
+ * @return     The memory in megabytes.
+ */
+egoa::Types::real CounterMemory ( TGraph const & graph, egoa::CounterReduction reduction )
+{
+    egoa::Types::count numberOfCopies = 1;
+#ifdef OPENMP_AVAILABLE
+    if ( reduction != egoa::CounterReduction::atomic )
+    {
+        numberOfCopies += omp_get_max_threads();
+    }
+#else
+    if ( reduction != egoa::CounterReduction::atomic )
+    {
+        numberOfCopies += 1;
+    }
+#endif // OPENMP_AVAILABLE
+    egoa::Types::count const bytes = numberOfCopies
+                                   * graph.NumberOfEdges()
+                                   * ( sizeof(egoa::Types::count) + sizeof(egoa::Types::real) );
+    return static_cast<egoa::Types::real>( bytes ) / ( 1024 * 1024 );
+}
+
+/**
+ * @brief      Runs the betweenness centrality with the counter reduction @p
+ *     reduction.
+ *
+ * @param      gridName   The name of the grid for the output.
+ * @param      graph      The graph.
+ * @param      name       The name of the reduction for the output.
+ * @param[in]  reduction  The counter reduction.
+ * @param      reference  The relative number of paths of the first run. If
+ *     it is empty, it is set to the result of this run.
+ */
+void Benchmark ( std::string const                & gridName
+               , TGraph const                     & graph
+               , std::string const                & name
+               , egoa::CounterReduction             reduction
+               , std::vector<egoa::Types::real>   & reference )
+{
+    egoa::BetweennessCentrality<TGraph> betweennessCentrality ( graph );
+    betweennessCentrality.Scheduling() = egoa::SourceScheduling::largestFirst;
+    betweennessCentrality.Reduction()  = reduction;
+
+    egoa::Auxiliary::Timer timer;
+    betweennessCentrality.Run();
+    egoa::Types::largeReal elapsed = timer.ElapsedMilliseconds();
+
+    std::vector<egoa::Types::real> const & result = betweennessCentrality.TotalRelativeNumberOfPaths();
+    if ( reference.empty() )
+    {
+        reference = result;
+    }
+
+    bool equal = ( result.size() == reference.size() );
+    for ( egoa::Types::index index = 0; equal && index < result.size(); ++index )
+    { // The order of the additions depends on the reduction
+        equal = egoa::Auxiliary::EQ ( result[index], reference[index] );
+    }
+
+    std::cout   << std::setw(24) << gridName
+                << std::setw(14) << name
+                << std::setw(16) << std::fixed << std::setprecision(2) << CounterMemory ( graph, reduction )
+                << std::setw(14) << std::fixed << std::setprecision(2) << elapsed
+                << std::setw(10) << ( equal ? "yes" : "NO" )
+                << std::endl;
+}
+
+/**
+ * @brief      Compares the counter reductions of the betweenness centrality.
+ * @details    Each argument is either an IEEE CDF Matlab file (*.m) or a
+ *     PyPSA directory, e.g.,
+ * @code{.sh}
+ *      OMP_NUM_THREADS=16 benchmarkCounterReduction tests/Data/PowerGrids/ieee_2018_acm_eEnergy_MTSF_Figure4a.m tests/Data/PowerGrids/PyPSAExample
+ * @endcode
+ */
+auto main ( int argc, char * argv [] ) -> int
+{
+    if ( argc < 2 )
+    {
+        std::cerr << "Usage: " << argv[0] << " <file.m|pypsa-directory> ..." << std::endl;
+        return 1;
+    }
+
+    std::cout   << std::setw(24) << "Grid"
+                << std::setw(14) << "Reduction"
+                << std::setw(16) << "Counters [MB]"
+                << std::setw(14) << "Time [ms]"
+                << std::setw(10) << "Equal"
+                << std::endl;
+
+    for ( int index = 1; index < argc; ++index )
+    {
+        std::string const filename = argv[index];
+
+        struct stat status;
+        bool const isDirectory = ( stat ( filename.c_str(), &status ) == 0 )
+                              && S_ISDIR ( status.st_mode );
+
+        egoa::PowerGrid<TGraph> network;
+        bool success = false;
+        if ( isDirectory )
+        {
+            TGraph candidateNetwork;
+            success = egoa::PowerGridIO<TGraph>::read ( network
+                                                      , candidateNetwork
+                                                      , filename
+                                                      , egoa::PowerGridIO<TGraph>::ReadPyPsa );
+        } else {
+            success = egoa::PowerGridIO<TGraph>::read ( network
+                                                      , filename
+                                                      , egoa::PowerGridIO<TGraph>::readIeeeCdfMatlab );
+        }
+        if ( !success )
+        {
+            std::cerr << "Expected file " << filename << " does not exist!" << std::endl;
+            continue;
+        }
+
+        network.Graph().Freeze();
+        std::string const gridName = filename.substr ( filename.find_last_of ( '/' ) + 1 );
+
+        std::vector<egoa::Types::real> reference;
+        Benchmark ( gridName, network.Graph(), "replicated", egoa::CounterReduction::replicated, reference );
+        Benchmark ( gridName, network.Graph(), "treeMerge",  egoa::CounterReduction::treeMerge,  reference );
+        Benchmark ( gridName, network.Graph(), "atomic",     egoa::CounterReduction::atomic,     reference );
+    }
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * benchmarkVertexSets.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "Algorithms/Centralities/BetweennessCentrality.hpp"
+#include "Algorithms/PathFinding/DominatingThetaPath.hpp"
+
+#include "DataStructures/Container/Allocators/ArenaAllocator.hpp"
+#include "DataStructures/Container/VertexSets/DynamicBitsetVertexSet.hpp"
+#include "DataStructures/Container/VertexSets/ParentChainVertexSet.hpp"
+#include "DataStructures/Container/VertexSets/SmallVectorVertexSet.hpp"
+
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Networks/PowerGrid.hpp"
+
+#include "IO/PowerGridIO.hpp"
+
+#include "Auxiliary/Auxiliary.hpp"
+#include "Auxiliary/Timer.hpp"
+
+using TGraph = egoa::StaticGraph< egoa::Vertices::ElectricalProperties<>
+                                , egoa::Edges::ElectricalProperties >;
+using TEdge  = TGraph::TEdge;
+
+using TArenaUnorderedSet = std::unordered_set< egoa::Types::vertexId
+                                             , std::hash<egoa::Types::vertexId>
+                                             , std::equal_to<egoa::Types::vertexId>
+                                             , egoa::ArenaAllocator<egoa::Types::vertexId> >;
+
+/**
+ * @brief      Runs the betweenness centrality with DTP and the vertex set
+ *     container @p VertexSetType.
+ *
+ * @param      gridName       The name of the grid for the output.
+ * @param      graph          The graph.
+ * @param      name           The name of the container for the output.
+ * @param      reference      The relative number of paths of the first run.
+ *     If it is empty, it is set to the result of this run.
+ *
+ * @tparam     VertexSetType  The vertex set container of the labels.
+ * @tparam     UseArena       Whether the label sets draw from the arena of
+ *     the DTP.
+ */
+template<typename VertexSetType, bool UseArena = false>
+void Benchmark ( std::string const                & gridName
+               , TGraph const                     & graph
+               , std::string const                & name
+               , std::vector<egoa::Types::real>   & reference )
+{
+    using TLabel    = egoa::VoltageAngleDifferenceLabel<TEdge, VertexSetType>;
+    using TLabelSet = std::conditional_t< UseArena
+                                        , egoa::Bucket< egoa::BinaryHeap<TLabel, egoa::ArenaAllocator<TLabel>>
+                                                      , egoa::ArenaAllocator<TLabel> >
+                                        , egoa::Bucket< egoa::BinaryHeap<TLabel> > >;
+    using TDtp      = egoa::DominatingThetaPath< TGraph
+                                               , TLabel
+                                               , egoa::MappingBinaryHeap<egoa::Types::vertexId, TLabel>
+                                               , TLabelSet >;
+
+    egoa::BetweennessCentrality<TGraph, TDtp> betweennessCentrality ( graph );
+
+    egoa::Auxiliary::Timer timer;
+    betweennessCentrality.Run();
+    egoa::Types::largeReal elapsed = timer.ElapsedMilliseconds();
+
+    std::vector<egoa::Types::real> const & result = betweennessCentrality.TotalRelativeNumberOfPaths();
+    if ( reference.empty() )
+    {
+        reference = result;
+    }
+
+    // The relative numbers of paths are sums, which may differ by rounding between the runs
+    bool const isEqual = std::equal ( result.begin(), result.end()
+                                    , reference.begin(), reference.end()
+                                    , [] ( egoa::Types::real lhs, egoa::Types::real rhs )
+                                      {
+                                          return egoa::Auxiliary::EQ ( lhs, rhs, 1e-9, 1e-9 );
+                                      } );
+
+    std::cout   << std::setw(24) << gridName
+                << std::setw(28) << name
+                << std::setw(14) << std::fixed << std::setprecision(2) << elapsed
+                << std::setw(10) << ( isEqual ? "yes" : "NO" )
+                << std::endl;
+}
+
+/**
+ * @brief      Compares the vertex set containers of the DTP labels.
+ * @details    Each argument is either an IEEE CDF Matlab file (*.m) or a
+ *     PyPSA directory, e.g.,
+ * @code{.sh}
+ *      benchmarkVertexSets tests/Data/PowerGrids/ieee_2018_acm_eEnergy_MTSF_Figure4a.m tests/Data/PowerGrids/PyPSAExample
+ * @endcode
+ */
+auto main ( int argc, char * argv [] ) -> int
+{
+    if ( argc < 2 )
+    {
+        std::cerr << "Usage: " << argv[0] << " <file.m|pypsa-directory> ..." << std::endl;
+        return 1;
+    }
+
+    std::cout   << std::setw(24) << "Grid"
+                << std::setw(28) << "VertexSetContainer"
+                << std::setw(14) << "Time [ms]"
+                << std::setw(10) << "Equal"
+                << std::endl;
+
+    for ( int index = 1; index < argc; ++index )
+    {
+        std::string const filename = argv[index];
+
+        struct stat status;
+        bool const isDirectory = ( stat ( filename.c_str(), &status ) == 0 )
+                              && S_ISDIR ( status.st_mode );
+
+        egoa::PowerGrid<TGraph> network;
+        bool success = false;
+        if ( isDirectory )
+        {
+            TGraph candidateNetwork;
+            success = egoa::PowerGridIO<TGraph>::read ( network
+                                                      , candidateNetwork
+                                                      , filename
+                                                      , egoa::PowerGridIO<TGraph>::ReadPyPsa );
+        } else {
+            success = egoa::PowerGridIO<TGraph>::read ( network
+                                                      , filename
+                                                      , egoa::PowerGridIO<TGraph>::readIeeeCdfMatlab );
+        }
+        if ( !success )
+        {
+            std::cerr << "Expected file " << filename << " does not exist!" << std::endl;
+            continue;
+        }
+
+        network.Graph().Freeze();
+        std::string const gridName = filename.substr ( filename.find_last_of ( '/' ) + 1 );
+
+        std::vector<egoa::Types::real> reference;
+        Benchmark<std::unordered_set<egoa::Types::vertexId>> ( gridName, network.Graph(), "std::unordered_set",      reference );
+        Benchmark<egoa::DynamicBitsetVertexSet>              ( gridName, network.Graph(), "DynamicBitsetVertexSet",  reference );
+        Benchmark<egoa::SmallVectorVertexSet<16>>            ( gridName, network.Graph(), "SmallVectorVertexSet<16>", reference );
+        Benchmark<egoa::SmallVectorVertexSet<64>>            ( gridName, network.Graph(), "SmallVectorVertexSet<64>", reference );
+        Benchmark<egoa::ParentChainVertexSet>                ( gridName, network.Graph(), "ParentChainVertexSet",    reference );
+        Benchmark<TArenaUnorderedSet, true>                  ( gridName, network.Graph(), "std::unordered_set+arena", reference );
+        Benchmark<egoa::SmallVectorVertexSet<16>, true>      ( gridName, network.Graph(), "SmallVectorVertexSet+arena", reference );
+    }
+
+    return 0;
+}
@@ -16,6 +16,7 @@
 #include <tuple>
 
 #include <QFile>
+#include <QFileInfo>
 #include <QStringList>
 
 #include "DataStructures/Labels/Label.hpp"
@@ -129,6 +130,13 @@ void addCommandLineOptions ( const QCoreApplication &application,
     );
     parser.addOption(outputTypeOption);
 
+    QCommandLineOption cacheOption(
+            "cache",
+            QCoreApplication::translate("main", "--cache <file>  -- Binary cache of the input file. The cache is read instead of the input file if it is valid and not older than the input file, otherwise it is written after reading the input file. (default: none)."),
+            QCoreApplication::translate("main", "cache"), ""
+    );
+    parser.addOption(cacheOption);
+
 
 #pragma mark COMMANDLINE_POSITIONAL_ARGUMENTS
     parser.addPositionalArgument(
@@ -228,6 +236,7 @@ auto main(int argc, char * argv []) -> int {
     auto networkSetting     = parser.value("networkSetting").toUpper();
     auto variant            = parser.value("variant").toUpper();
     auto outputType         = parser.value("outputType").toUpper();
+    auto cacheFile          = parser.value("cache");
 
 #ifndef NDEBUG
     qDebug() << Qt::endl;
@@ -241,6 +250,7 @@ auto main(int argc, char * argv []) -> int {
     qDebug() << "\tTrace Sol.:"   << QString::number(traceSolution);
     qDebug() << "\tVerbose   :"   << QString::number(verbose);
     qDebug() << "\tOutput Type:"  << outputType;
+    qDebug() << "\tCache     :"   << cacheFile;
     qDebug() << "---- OpenMP-Info ----------------------------------";
     qDebug() << "\tNumber of Processors:               " << egoa::Auxiliary::NumberOfProcessors();
     qDebug() << "\tMaximum number of possible Threads: " << egoa::Auxiliary::MaximumNumberOfThreads();
@@ -254,8 +264,20 @@ auto main(int argc, char * argv []) -> int {
     std::string filename = egoa::Auxiliary::Basename( inputFile.toStdString() );
                 filename = egoa::Auxiliary::RemoveExtension( filename );
 
-    if (!egoa::PowerGridIO<TGraph>::read ( network, inputFile.toStdString(), egoa::PowerGridIO<TGraph>::readIeeeCdfMatlab ))
-        std::cerr << "Expected file " << inputFile.toStdString() << " does not exist!";
+    bool isCacheValid = !cacheFile.isEmpty()
+                     && QFileInfo::exists(cacheFile)
+                     && QFileInfo(cacheFile).lastModified() >= QFileInfo(inputFile).lastModified();
+    if ( isCacheValid ) {
+        isCacheValid = egoa::PowerGridIO<TGraph>::read ( network, cacheFile.toStdString(), egoa::PowerGridIO<TGraph>::ReadBinaryCacheFile );
+    }
+
+    if ( !isCacheValid ) {
+        if (!egoa::PowerGridIO<TGraph>::read ( network, inputFile.toStdString(), egoa::PowerGridIO<TGraph>::readIeeeCdfMatlab ))
+            std::cerr << "Expected file " << inputFile.toStdString() << " does not exist!";
+        else if ( !cacheFile.isEmpty()
+               && !egoa::PowerGridIO<TGraph>::write ( network, cacheFile.toStdString(), egoa::PowerGridIO<TGraph>::WriteBinaryCache ) )
+            std::cerr << "Cache file " << cacheFile.toStdString() << " could not be written!";
+    }
 
 // Output network
     if (verbose) {
@@ -216,6 +216,75 @@ TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aVertexCounter
     TestTotalNumberOfPaths ( totalNumberOfPathsPerVertex, check );
 }
 
+TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aEdgeCounter
+       , LargestSourcesFirst )
+{
+    betweennessAlgorithm_.Scheduling() = SourceScheduling::largestFirst;
+    betweennessAlgorithm_.ChunkSize()  = 2;
+
+    for ( Types::count round = 0; round < 2; ++round )
+    { // The second round uses the running times of the first round
+        betweennessAlgorithm_.Run();
+        EXPECT_EQ ( betweennessAlgorithm_.Collection().Collection().size(), graph_.NumberOfVertices() );
+
+        std::vector<Types::count> checkNumberOfPaths = { 6, 2, 4, 6, 8 };
+        TestTotalNumberOfPaths ( betweennessAlgorithm_.TotalNumberOfPaths(), checkNumberOfPaths );
+
+        std::vector<Types::real> checkRelativeNumberOfPaths = { 0.333333, 0.16667, 0.166667, 0.333333, 0.5 };
+        TestTotalRelativeNumberOfPaths ( betweennessAlgorithm_.TotalRelativeNumberOfPaths(), checkRelativeNumberOfPaths );
+    }
+}
+
+TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aVertexCounter
+       , LargestSourcesFirst )
+{
+    betweennessAlgorithm_.Scheduling() = SourceScheduling::largestFirst;
+    betweennessAlgorithm_.Run();
+
+    std::vector<Types::count> check = { 11, 11, 13, 11 };
+    TestTotalNumberOfPaths ( betweennessAlgorithm_.TotalNumberOfPaths(), check );
+}
+
+TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aEdgeCounter
+       , CounterReductions )
+{
+    std::vector<Types::count> checkNumberOfPaths         = { 6, 2, 4, 6, 8 };
+    std::vector<Types::real>  checkRelativeNumberOfPaths = { 0.333333, 0.16667, 0.166667, 0.333333, 0.5 };
+
+    for ( CounterReduction reduction : { CounterReduction::replicated
+                                       , CounterReduction::treeMerge
+                                       , CounterReduction::atomic } )
+    {
+        for ( SourceScheduling scheduling : { SourceScheduling::standard
+                                            , SourceScheduling::largestFirst } )
+        {
+            betweennessAlgorithm_.Reduction()  = reduction;
+            betweennessAlgorithm_.Scheduling() = scheduling;
+            betweennessAlgorithm_.Run();
+
+            TestTotalNumberOfPaths         ( betweennessAlgorithm_.TotalNumberOfPaths(),         checkNumberOfPaths         );
+            TestTotalRelativeNumberOfPaths ( betweennessAlgorithm_.TotalRelativeNumberOfPaths(), checkRelativeNumberOfPaths );
+        }
+    }
+}
+
+TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aVertexCounter
+       , CounterReductions )
+{
+    std::vector<Types::count> check = { 11, 11, 13, 11 };
+
+    for ( CounterReduction reduction : { CounterReduction::replicated
+                                       , CounterReduction::treeMerge
+                                       , CounterReduction::atomic } )
+    {
+        betweennessAlgorithm_.Reduction()  = reduction;
+        betweennessAlgorithm_.Scheduling() = SourceScheduling::largestFirst;
+        betweennessAlgorithm_.Run();
+
+        TestTotalNumberOfPaths ( betweennessAlgorithm_.TotalNumberOfPaths(), check );
+    }
+}
+
 #pragma mark TEST_BETWEENNESS_CENTRALITY_USING_VOLTAGE_ANGLE_DIFFERENCE_WITH_GRAPH_ACM_FIGURE_4B
 
 TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4bEdgeCounter
@@ -282,6 +351,307 @@ TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4bVertexCounter
     TestTotalNumberOfPaths ( totalNumberOfPathsPerVertex, check );
 }
 
+#pragma mark TEST_BETWEENNESS_CENTRALITY_UPDATE
+
+TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aEdgeCounter
+       , UpdateAfterSwitchingEdge )
+{
+    betweennessAlgorithm_.IgnoreSwitchedEdges ( true );
+    betweennessAlgorithm_.Run();
+
+    // The graph is one block, thus all pairs are recomputed
+    Types::edgeId const edgeId = 4;
+    EXPECT_FALSE ( betweennessAlgorithm_.Update ( { edgeId }, [ this, edgeId ]()
+    {
+        graph_.EdgeAt ( edgeId ).Properties().Status() = false;
+    }) );
+
+    TBcDtpVangle betweennessCheck ( graphConst_ );
+    betweennessCheck.IgnoreSwitchedEdges ( true );
+    betweennessCheck.Run();
+
+    TestTotalNumberOfPaths         ( betweennessAlgorithm_.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessAlgorithm_.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpVoltageAngleDifferenceEdgeCounter
+       , UpdateAfterSwitchingEdgesInTriangleStar )
+{
+    AddTriangleStar ( 12 );
+
+    TBcDtpVangle betweennessAlgorithm ( graphConst_ );
+    betweennessAlgorithm.IgnoreSwitchedEdges ( true );
+    betweennessAlgorithm.Run();
+
+    // Switch off one edge of the first triangle
+    Types::edgeId const firstEdgeId = 1;
+    EXPECT_TRUE ( betweennessAlgorithm.Update ( { firstEdgeId }, [ this, firstEdgeId ]()
+    {
+        graph_.EdgeAt ( firstEdgeId ).Properties().Status() = false;
+    }) );
+
+    TBcDtpVangle betweennessCheck ( graphConst_ );
+    betweennessCheck.IgnoreSwitchedEdges ( true );
+    betweennessCheck.Run();
+
+    TestTotalNumberOfPaths         ( betweennessAlgorithm.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessAlgorithm.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+
+    // Switch the edge on again and change an edge of the last triangle
+    Types::edgeId const lastEdgeId = 34;
+    EXPECT_TRUE ( betweennessAlgorithm.Update ( { firstEdgeId, lastEdgeId }, [ this, firstEdgeId, lastEdgeId ]()
+    {
+        graph_.EdgeAt ( firstEdgeId ).Properties().Status()      = true;
+        graph_.EdgeAt ( lastEdgeId ).Properties().ThermalLimit() = 10.0;
+    }) );
+
+    betweennessCheck.Run();
+
+    TestTotalNumberOfPaths         ( betweennessAlgorithm.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessAlgorithm.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpVoltageAngleDifferenceVertexCounter
+       , UpdateAfterSwitchingEdgesInTriangleStar )
+{
+    AddTriangleStar ( 12 );
+
+    TBcDtpVangle betweennessAlgorithm ( graphConst_ );
+    betweennessAlgorithm.IgnoreSwitchedEdges ( true );
+    betweennessAlgorithm.Run();
+
+    Types::edgeId const edgeId = 4;
+    EXPECT_TRUE ( betweennessAlgorithm.Update ( { edgeId }, [ this, edgeId ]()
+    {
+        graph_.EdgeAt ( edgeId ).Properties().Status() = false;
+    }) );
+
+    TBcDtpVangle betweennessCheck ( graphConst_ );
+    betweennessCheck.IgnoreSwitchedEdges ( true );
+    betweennessCheck.Run();
+
+    TestTotalNumberOfPaths         ( betweennessAlgorithm.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessAlgorithm.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpVoltageAngleDifferenceVertexCounter
+       , UpdateAfterSwitchingEdgeInTriangleStarWithPropertyColumns )
+{
+    AddTriangleStar ( 12 );
+    TGraph unpackedGraph = graph_;
+    graph_.BuildPropertyColumns();
+
+    TBcDtpVangle betweennessAlgorithm ( graphConst_ );
+    betweennessAlgorithm.IgnoreSwitchedEdges ( true );
+    betweennessAlgorithm.Run();
+
+    Types::edgeId const edgeId = 4;
+    EXPECT_TRUE ( betweennessAlgorithm.Update ( { edgeId }, [ this, edgeId ]()
+    {
+        graph_.EdgeAt ( edgeId ).Properties().Status() = false;
+        graph_.RefreshPropertyColumns ( { edgeId } );
+    }) );
+    ASSERT_TRUE  ( graph_.HasPropertyColumns() );
+    EXPECT_FALSE ( graph_.PropertyColumns().IsActive ( edgeId ) );
+
+    unpackedGraph.EdgeAt ( edgeId ).Properties().Status() = false;
+    TBcDtpVangle betweennessCheck ( unpackedGraph );
+    betweennessCheck.IgnoreSwitchedEdges ( true );
+    betweennessCheck.Run();
+
+    TestTotalNumberOfPaths         ( betweennessAlgorithm.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessAlgorithm.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpVoltageAngleDifferenceVertexCounter
+       , UpdateAfterSwitchingEdgesInTriangleStarWithCounterReductions )
+{
+    AddTriangleStar ( 12 );
+
+    TBcDtpVangle betweennessCheck ( graphConst_ );
+    betweennessCheck.IgnoreSwitchedEdges ( true );
+
+    Types::edgeId const edgeId = 4;
+    for ( CounterReduction reduction : { CounterReduction::replicated
+                                       , CounterReduction::treeMerge
+                                       , CounterReduction::atomic } )
+    {
+        graph_.EdgeAt ( edgeId ).Properties().Status() = true;
+
+        TBcDtpVangle betweennessAlgorithm ( graphConst_ );
+        betweennessAlgorithm.IgnoreSwitchedEdges ( true );
+        betweennessAlgorithm.Reduction() = reduction;
+        betweennessAlgorithm.Run();
+
+        EXPECT_TRUE ( betweennessAlgorithm.Update ( { edgeId }, [ this, edgeId ]()
+        {
+            graph_.EdgeAt ( edgeId ).Properties().Status() = false;
+        }) );
+
+        betweennessCheck.Run();
+
+        TestTotalNumberOfPaths         ( betweennessAlgorithm.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+        TestTotalRelativeNumberOfPaths ( betweennessAlgorithm.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+    }
+}
+
+#pragma mark TEST_BETWEENNESS_CENTRALITY_SAMPLING
+
+TEST_F ( TestBcDtpVangleUsingAcm2018MtsfFigure4aEdgeCounter
+       , SamplingAllSourcesIsExact )
+{
+    std::vector<Types::count> checkNumberOfPaths         = { 6, 2, 4, 6, 8 };
+    std::vector<Types::real>  checkRelativeNumberOfPaths = { 0.333333, 0.16667, 0.166667, 0.333333, 0.5 };
+
+    for ( SourceSampling sampling : { SourceSampling::uniform
+                                    , SourceSampling::stratified } )
+    {
+        betweennessAlgorithm_.Sampling().Method     = sampling;
+        betweennessAlgorithm_.Sampling().ErrorBound = 0.0;
+        betweennessAlgorithm_.Sampling().BatchSize  = 1;
+        betweennessAlgorithm_.Run();
+
+        EXPECT_EQ ( 4, betweennessAlgorithm_.NumberOfSamples() );
+        TestTotalNumberOfPaths         ( betweennessAlgorithm_.TotalNumberOfPaths(),         checkNumberOfPaths         );
+        TestTotalRelativeNumberOfPaths ( betweennessAlgorithm_.TotalRelativeNumberOfPaths(), checkRelativeNumberOfPaths );
+        for ( Types::real halfWidth : betweennessAlgorithm_.TotalRelativeNumberOfPathsHalfWidth() )
+        {
+            EXPECT_EQ ( 0.0, halfWidth );
+        }
+    }
+}
+
+TEST_F ( TestBetweennessCentralityDtpVoltageAngleDifferenceEdgeCounter
+       , SamplingIsReproducibleAndStopsEarly )
+{
+    AddTriangleStar ( 30 );
+
+    TBcDtpVangle betweennessCheck ( graphConst_ );
+    betweennessCheck.Run();
+
+    for ( SourceSampling sampling : { SourceSampling::uniform
+                                    , SourceSampling::stratified } )
+    {
+        TBcDtpVangle betweennessAlgorithm ( graphConst_ );
+        betweennessAlgorithm.Sampling().Method     = sampling;
+        betweennessAlgorithm.Sampling().Seed       = 42;
+        betweennessAlgorithm.Sampling().ErrorBound = 0.05;
+        betweennessAlgorithm.Sampling().BatchSize  = 4;
+        betweennessAlgorithm.Run();
+
+        EXPECT_LT ( betweennessAlgorithm.NumberOfSamples(), graphConst_.NumberOfVertices() );
+        for ( Types::index counter = 0; counter < graphConst_.NumberOfEdges(); ++counter )
+        {
+            EXPECT_NEAR ( betweennessCheck.TotalRelativeNumberOfPaths()[counter]
+                        , betweennessAlgorithm.TotalRelativeNumberOfPaths()[counter]
+                        , 2 * betweennessAlgorithm.Sampling().ErrorBound );
+            EXPECT_LE ( betweennessAlgorithm.TotalRelativeNumberOfPathsHalfWidth()[counter]
+                      , betweennessAlgorithm.Sampling().ErrorBound );
+        }
+
+        TBcDtpVangle betweennessRepetition ( graphConst_ );
+        betweennessRepetition.Sampling() = betweennessAlgorithm.Sampling();
+        betweennessRepetition.Run();
+
+        EXPECT_EQ ( betweennessAlgorithm.NumberOfSamples(),    betweennessRepetition.NumberOfSamples()    );
+        EXPECT_EQ ( betweennessAlgorithm.TotalNumberOfPaths(), betweennessRepetition.TotalNumberOfPaths() );
+        TestTotalRelativeNumberOfPaths ( betweennessAlgorithm.TotalRelativeNumberOfPaths(), betweennessRepetition.TotalRelativeNumberOfPaths() );
+    }
+}
+
+#pragma mark TEST_BLOCK_DECOMPOSED_BETWEENNESS_CENTRALITY
+
+TEST_F ( TestBcDtpBnormUsingAcm2018MtsfFigure4bEdgeCounter
+       , BlockDecomposedMatchesRun )
+{
+    betweennessAlgorithm_.Run();
+
+    BlockDecomposedBetweennessCentrality<TGraph, TFindPathAlgo> betweennessDecomposed ( graphConst_ );
+    betweennessDecomposed.Run();
+
+    TestTotalNumberOfPaths         ( betweennessDecomposed.TotalNumberOfPaths(),         betweennessAlgorithm_.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessDecomposed.TotalRelativeNumberOfPaths(), betweennessAlgorithm_.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpSusceptanceNormEdgeCounter
+       , BlockDecomposedMatchesRunInTriangleStarWithSquareChains )
+{
+    AddTriangleStar ( 3 );
+    AddSquareChain  ( 0, 1 );
+    AddSquareChain  ( 2, 3 );
+    AddSquareChain  ( 6, 2 );
+
+    TBcDtpBnorm betweennessCheck ( graphConst_ );
+    betweennessCheck.Run();
+
+    BlockDecomposedBetweennessCentrality<TGraph, TFindPathAlgo> betweennessDecomposed ( graphConst_ );
+    betweennessDecomposed.Run();
+
+    TestTotalNumberOfPaths         ( betweennessDecomposed.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessDecomposed.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpSusceptanceNormEdgeCounter
+       , BlockDecomposedMatchesRunInAdjacentBlocks )
+{
+    AddTriangleStar ( 3 );
+    // Squares that share the cut vertices 8 and 15 with the previous square
+    AddSquareChain  ( 2, 2 );
+    AddSquareChain  ( 8, 1 );
+    AddSquareChain  ( 15, 1 );
+
+    // A triangle at the cut vertex 18 with a tie between the paths to first
+    TEdgeProperties edge;
+    edge.Reactance()    = 2.0;
+    edge.ThermalLimit() = 1.0;
+    Types::vertexId first  = graph_.AddVertex ( TVertexProperties() );
+    Types::vertexId second = graph_.AddVertex ( TVertexProperties() );
+    graph_.AddEdge ( 18,     first,  edge );
+    edge.Reactance()    = 1.0;
+    graph_.AddEdge ( first,  second, edge );
+    graph_.AddEdge ( second, 18,     edge );
+
+    TBcDtpBnorm betweennessCheck ( graphConst_ );
+    betweennessCheck.Run();
+
+    BlockDecomposedBetweennessCentrality<TGraph, TFindPathAlgo> betweennessDecomposed ( graphConst_ );
+    betweennessDecomposed.Run();
+
+    TestTotalNumberOfPaths         ( betweennessDecomposed.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessDecomposed.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+}
+
+TEST_F ( TestBetweennessCentralityDtpSusceptanceNormEdgeCounter
+       , BlockDecomposedAcceptsOnlyAdditiveLabels )
+{
+    EXPECT_TRUE  ( internal::IsAdditiveLabel<SusceptanceNormLabel<TGraph::TEdge>>::value        );
+    EXPECT_FALSE ( internal::IsAdditiveLabel<VoltageAngleDifferenceLabel<TGraph::TEdge>>::value );
+}
+
+TEST_F ( TestBetweennessCentralityDtpSusceptanceNormEdgeCounter
+       , BlockDecomposedMatchesRunWithSwitchedEdges )
+{
+    AddTriangleStar ( 3 );
+    AddSquareChain  ( 2, 3 );
+
+    // Switch off one edge of the first square and the bridge behind it
+    Types::edgeId const squareEdgeId = 9;
+    Types::edgeId const bridgeId     = 13;
+    graph_.EdgeAt ( squareEdgeId ).Properties().Status() = false;
+    graph_.EdgeAt ( bridgeId ).Properties().Status()     = false;
+
+    TBcDtpBnorm betweennessCheck ( graphConst_ );
+    betweennessCheck.IgnoreSwitchedEdges ( true );
+    betweennessCheck.Run();
+
+    BlockDecomposedBetweennessCentrality<TGraph, TFindPathAlgo> betweennessDecomposed ( graphConst_ );
+    betweennessDecomposed.IgnoreSwitchedEdges ( true );
+    betweennessDecomposed.Run();
+
+    TestTotalNumberOfPaths         ( betweennessDecomposed.TotalNumberOfPaths(),         betweennessCheck.TotalNumberOfPaths()         );
+    TestTotalRelativeNumberOfPaths ( betweennessDecomposed.TotalRelativeNumberOfPaths(), betweennessCheck.TotalRelativeNumberOfPaths() );
+    EXPECT_EQ ( 0, betweennessDecomposed.TotalNumberOfPaths()[bridgeId] );
+}
 
 #pragma mark TEST_MULTIPLE_CASES
 // ---------
@@ -294,11 +664,8 @@ TEST_F ( TestBcDtpVangleUsingMultipleCases
     if (!TPowerGridIO::read ( network_
                             , TestCaseExample
                             , TPowerGridIO::readIeeeCdfMatlab ) )
-    {
-        std::cerr   << "Expected file "
-                    << TestCaseExample
-                    << " does not exist!";
-        exit(1);
+    { // The data repository is optional
+        GTEST_SKIP() << "Expected file " << TestCaseExample << " does not exist!";
     }
     graph_ = network.Graph();
     TGraph & graph = network.Graph();
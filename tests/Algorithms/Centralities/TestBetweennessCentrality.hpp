@@ -29,6 +29,7 @@
 #include "DataStructures/Container/DominationCriterion.hpp"
 
 #include "Algorithms/Centralities/BetweennessCentrality.hpp"
+#include "Algorithms/Centralities/BlockDecomposedBetweennessCentrality.hpp"
 #include "IO/Statistics/DtpRuntimeCollection.hpp"
 
 namespace egoa::test {
@@ -158,6 +159,78 @@ class TestBetweennessCentralityGraph : public ::testing::Test {
             }
         }
 
+        /**
+         * @brief      Adds triangles that share the vertex 0 to the graph.
+         * @details    Each triangle is a block of the graph and the vertex 0
+         *     is the only cut vertex. The thermal limits differ such that
+         *     the labels of the two ways around a triangle differ.
+         *
+         * @param[in]  numberOfTriangles  The number of triangles.
+         */
+        inline void AddTriangleStar ( Types::count numberOfTriangles )
+        {
+            TEdgeProperties edge;
+            edge.Reactance()    = 1.0;
+            edge.ThermalLimit() = 1.0;
+
+            Types::vertexId center = graph_.AddVertex ( TVertexProperties() );
+            for ( Types::count counter = 0
+                ; counter < numberOfTriangles
+                ; ++counter )
+            {
+                Types::vertexId first  = graph_.AddVertex ( TVertexProperties() );
+                Types::vertexId second = graph_.AddVertex ( TVertexProperties() );
+
+                edge.ThermalLimit() = 1.0 + counter;
+                graph_.AddEdge ( center, first,  edge );
+                edge.ThermalLimit() = 2.0;
+                graph_.AddEdge ( first,  second, edge );
+                edge.ThermalLimit() = 3.0;
+                graph_.AddEdge ( second, center, edge );
+            }
+        }
+
+        /**
+         * @brief      Adds squares that are connected by bridges to the
+         *     graph.
+         * @details    The two paths between opposite vertices of a square
+         *     have the same susceptance norm. The first square contains the
+         *     vertex @p attachment and each further square is connected by a
+         *     bridge to the vertex of the previous square opposite to its
+         *     first vertex.
+         *
+         * @param[in]  attachment       The vertex of the first square.
+         * @param[in]  numberOfSquares  The number of squares.
+         */
+        inline void AddSquareChain ( Types::vertexId attachment
+                                   , Types::count    numberOfSquares )
+        {
+            TEdgeProperties edge;
+            edge.Reactance()    = 1.0;
+            edge.ThermalLimit() = 1.0;
+
+            Types::vertexId first = attachment;
+            for ( Types::count counter = 0
+                ; counter < numberOfSquares
+                ; ++counter )
+            {
+                Types::vertexId second   = graph_.AddVertex ( TVertexProperties() );
+                Types::vertexId opposite = graph_.AddVertex ( TVertexProperties() );
+                Types::vertexId third    = graph_.AddVertex ( TVertexProperties() );
+
+                graph_.AddEdge ( first,    second,   edge );
+                graph_.AddEdge ( second,   opposite, edge );
+                graph_.AddEdge ( opposite, third,    edge );
+                graph_.AddEdge ( third,    first,    edge );
+
+                if ( counter + 1 < numberOfSquares )
+                {
+                    first = graph_.AddVertex ( TVertexProperties() );
+                    graph_.AddEdge ( opposite, first, edge );
+                }
+            }
+        }
+
 #pragma mark BC_GRAPH_MEMBERS
         TGraph                  graph_;
         TGraph          const & graphConst_;
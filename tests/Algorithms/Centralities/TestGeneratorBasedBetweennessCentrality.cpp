@@ -6,6 +6,7 @@
  */
 
 #include "TestGeneratorBasedBetweennessCentrality.hpp"
+#include "Helper/TestHelper.hpp"
 
 #ifdef OPENMP_AVAILABLE
     #include <omp.h>
@@ -28,7 +29,7 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aEdgeCounter
     for ( TMeasurementRow const & row : betweennessAlgorithm_.Collection().Collection() )
     {
         EXPECT_EQ ( row.SourceId, 0 );
-        TestCollectionValues ( row, "DTP", "", 4, 1, 4, 5, 10, 7, 3, 4 );
+        TestCollectionValues ( row, "DTP", "", 4, 1, 1, 5, 10, 7, 3, 4 );
     }
 }
 
@@ -39,7 +40,8 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aEdgeCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerEdge = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerEdge.size(), network_.Graph().NumberOfEdges() );
 
-    std::vector<Types::real> check = { 0.25, 0.25, 0.25, 0, 0 };
+    // One generator and one load, i.e., the normalization factor is 1
+    std::vector<Types::real> check = { 1, 1, 1, 0, 0 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerEdge, check );
 }
 
@@ -50,7 +52,7 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerVertex = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerVertex.size(), network_.Graph().NumberOfVertices() );
 
-    std::vector<Types::real> check = { 1, 0.25, 0.25, 0.25 };
+    std::vector<Types::real> check = { 4, 1, 1, 1 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerVertex, check );
 }
 
@@ -76,6 +78,60 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounter
     TestTotalNumberOfPaths ( totalNumberOfPathsPerVertex, check );
 }
 
+TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounter
+       , LargestSourcesFirst )
+{
+    betweennessAlgorithm_.Scheduling() = SourceScheduling::largestFirst;
+    betweennessAlgorithm_.Run();
+    EXPECT_EQ ( betweennessAlgorithm_.Collection().Collection().size(), 1 );
+
+    for ( TMeasurementRow const & row : betweennessAlgorithm_.Collection().Collection() )
+    {
+        EXPECT_EQ ( row.NumberOfGenerators, network_.NumberOfGenerators() );
+        EXPECT_EQ ( row.NumberOfLoads,      network_.NumberOfLoads() );
+    }
+
+    std::vector<Types::count> check = { 4, 1, 1, 1 };
+    TestTotalNumberOfPaths ( betweennessAlgorithm_.TotalNumberOfPaths(), check );
+}
+
+TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounter
+       , GenerationWeightedSampling )
+{
+    betweennessAlgorithm_.Sampling().Method = SourceSampling::uniform;
+    betweennessAlgorithm_.Run();
+
+    // The only generator vertex is drawn repeatedly, but run once
+    EXPECT_EQ ( betweennessAlgorithm_.Collection().Collection().size(), 1 );
+    for ( TMeasurementRow const & row : betweennessAlgorithm_.Collection().Collection() )
+    {
+        EXPECT_EQ ( row.NumberOfGenerators, network_.NumberOfGenerators() );
+        EXPECT_EQ ( row.NumberOfLoads,      network_.NumberOfLoads() );
+    }
+
+    std::vector<Types::count> check = { 4, 1, 1, 1 };
+    TestTotalNumberOfPaths ( betweennessAlgorithm_.TotalNumberOfPaths(), check );
+    for ( Types::real halfWidth : betweennessAlgorithm_.TotalRelativeNumberOfPathsHalfWidth() )
+    {
+        EXPECT_EQ ( 0.0, halfWidth );
+    }
+}
+
+#ifdef EGOA_ENABLE_ASSERTION
+    TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounterDeathTest
+           , GenerationWeightedSamplingWithoutStoppingRule )
+    {
+        betweennessAlgorithm_.Sampling().Method     = SourceSampling::uniform;
+        betweennessAlgorithm_.Sampling().ErrorBound = 0;
+
+        auto assertionString = buildAssertionString ( "BetweennessCentrality.hpp"
+                                                    , "BetweennessCentrality"
+                                                    , "RunSampled"
+                                                    , R"(weights.empty\(\) .*)");
+        ASSERT_DEATH ( { betweennessAlgorithm_.Run(); }, assertionString );
+    }
+#endif // EGOA_ENABLE_ASSERTION
+
 #pragma mark TEST_BETWEENNESS_CENTRALITY_WITH_GRAPH_ACM_FIGURE_4B_B_NORM
 
 TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4bEdgeCounter
@@ -88,7 +144,7 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4bEdgeCounter
     for ( TMeasurementRow const & row : betweennessAlgorithm_.Collection().Collection() )
     {
         EXPECT_EQ ( row.SourceId, 0 );
-        TestCollectionValues ( row, "DTP", "", 4, 1, 4, 5, 10, 7, 3, 4 );
+        TestCollectionValues ( row, "DTP", "", 4, 1, 1, 5, 10, 7, 3, 4 );
     }
 }
 
@@ -99,7 +155,7 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4bEdgeCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerEdge = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerEdge.size(), network_.Graph().NumberOfEdges() );
 
-    std::vector<Types::real> check = { 0.25, 0.25, 0.25, 0, 0 };
+    std::vector<Types::real> check = { 1, 1, 1, 0, 0 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerEdge, check );
 }
 
@@ -110,7 +166,7 @@ TEST_F ( TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4bVertexCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerVertex = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerVertex.size(), network_.Graph().NumberOfVertices() );
 
-    std::vector<Types::real> check = { 1, 0.25, 0.25, 0.25 };
+    std::vector<Types::real> check = { 4, 1, 1, 1 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerVertex, check );
 }
 
@@ -149,7 +205,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4aEdgeCounter
     for ( TMeasurementRow const & row : betweennessAlgorithm_.Collection().Collection() )
     {
         EXPECT_EQ ( row.SourceId, 0 );
-        TestCollectionValues ( row, "DTP", "", 4, 1, 4, 5, 18, 9, 6, 7 );
+        TestCollectionValues ( row, "DTP", "", 4, 1, 1, 5, 18, 9, 6, 7 );
     }
 }
 
@@ -160,7 +216,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4aEdgeCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerEdge = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerEdge.size(), network_.Graph().NumberOfEdges() );
 
-    std::vector<Types::real> check = { 0.375, 0.25, 0.125, 0.125, 0.375 };
+    std::vector<Types::real> check = { 1.5, 1, 0.5, 0.5, 1.5 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerEdge, check );
 }
 
@@ -171,7 +227,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4aVertexCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerVertex = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerVertex.size(), network_.Graph().NumberOfVertices() );
 
-    std::vector<Types::real> check = { 1, 0.375, 0.5, 0.375 };
+    std::vector<Types::real> check = { 4, 1.5, 2, 1.5 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerVertex, check );
 }
 
@@ -209,7 +265,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4bEdgeCounter
     for ( TMeasurementRow const & row : betweennessAlgorithm_.Collection().Collection() )
     {
         EXPECT_EQ ( row.SourceId, 0 );
-        TestCollectionValues ( row, "DTP", "", 4, 1, 4, 5, 12, 7, 4, 5 );
+        TestCollectionValues ( row, "DTP", "", 4, 1, 1, 5, 12, 7, 4, 5 );
     }
 }
 
@@ -220,7 +276,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4bEdgeCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerEdge = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerEdge.size(), network_.Graph().NumberOfEdges() );
 
-    std::vector<Types::real> check = { 0.25, 0.375, 0.125, 0, 0.125 };
+    std::vector<Types::real> check = { 1, 1.5, 0.5, 0, 0.5 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerEdge, check );
 }
 
@@ -231,7 +287,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4bVertexCounter
     std::vector<Types::real>  totalRelativeNumberOfPathsPerVertex = betweennessAlgorithm_.TotalRelativeNumberOfPaths();
     EXPECT_EQ ( totalRelativeNumberOfPathsPerVertex.size(), network_.Graph().NumberOfVertices() );
 
-    std::vector<Types::real> check = { 1, 0.25, 0.375, 0.25 };
+    std::vector<Types::real> check = { 4, 1, 1.5, 1 };
     TestTotalRelativeNumberOfPaths ( totalRelativeNumberOfPathsPerVertex, check );
 }
 
@@ -253,7 +309,7 @@ TEST_F ( TestGeneratorBasedBcDtpVangleUsingAcm2018MtsfFigure4bVertexCounter
     std::vector<Types::count> totalNumberOfPathsPerVertex = betweennessAlgorithm_.TotalNumberOfPaths();
     EXPECT_EQ ( totalNumberOfPathsPerVertex.size(), network_.Graph().NumberOfVertices() );
 
-    std::vector<Types::count> check = { 5, 2, 3, 2 };
+    std::vector<Types::count> check = { 5, 1, 2, 2 };
     TestTotalNumberOfPaths ( totalNumberOfPathsPerVertex, check );
 }
 
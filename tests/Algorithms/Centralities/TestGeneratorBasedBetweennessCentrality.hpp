@@ -354,6 +354,8 @@ class TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounter
         }
 };
 
+using TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounterDeathTest = TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4aVertexCounter;
+
 class TestGeneratorBasedBcDtpBnormUsingAcm2018MtsfFigure4bEdgeCounter
         : public TestGeneratorBasedBetweennessCentralityDtpSusceptanceNormEdgeCounter
 {
@@ -0,0 +1,123 @@
+/*
+ * TestBreadthFirstSearch.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestBreadthFirstSearch.hpp"
+
+namespace egoa::test {
+
+#pragma mark GRID
+
+TEST_F(TestBreadthFirstSearchGrid, Run) {
+    ParallelBFS<TGraph> bfs(graph_, 0);
+    bfs.Run();
+
+    ExpectDistancesFromCorner(bfs);
+}
+
+TEST_F(TestBreadthFirstSearchGrid, TopDownOnly) {
+    ParallelBFS<TGraph> bfs(graph_, 0);
+    bfs.Alpha() = 0;
+    bfs.Run();
+
+    ExpectDistancesFromCorner(bfs);
+    EXPECT_EQ(numberOfRows_ + numberOfColumns_ - 1, bfs.NumberOfTopDownSteps());
+    EXPECT_EQ(0, bfs.NumberOfBottomUpSteps());
+}
+
+TEST_F(TestBreadthFirstSearchGrid, BottomUpOnly) {
+    ParallelBFS<TGraph> bfs(graph_, 0);
+    bfs.Alpha() = std::numeric_limits<Types::real>::infinity();
+    bfs.Beta()  = std::numeric_limits<Types::real>::infinity();
+    bfs.Run();
+
+    ExpectDistancesFromCorner(bfs);
+    EXPECT_EQ(0, bfs.NumberOfTopDownSteps());
+    EXPECT_EQ(numberOfRows_ + numberOfColumns_ - 1, bfs.NumberOfBottomUpSteps());
+}
+
+TEST_F(TestBreadthFirstSearchGrid, Result) {
+    ParallelBFS<TGraph> bfs(graph_, 0);
+    bfs.Run();
+
+    std::vector<Types::vertexId> parent;
+    bfs.Result(parent);
+    ASSERT_EQ(graph_.NumberOfVertices(), parent.size());
+    for (auto const & vertex : graph_.Vertices()) {
+        EXPECT_EQ(bfs.ParentOf(vertex.Identifier()), parent[vertex.Identifier()]);
+    }
+}
+
+TEST_F(TestBreadthFirstSearchGrid, SameLevelsAsSequentialBfs) {
+    BFS<TGraph> sequentialBfs(graph_, VertexAt(7, 11));
+    sequentialBfs.Run();
+    std::vector<Types::vertexId> parent;
+    sequentialBfs.Result(parent);
+
+    ParallelBFS<TGraph> bfs(graph_, VertexAt(7, 11));
+    bfs.Run();
+
+    for (auto const & vertex : graph_.Vertices()) {
+        Types::count distance = 0;
+        Types::vertexId current = vertex.Identifier();
+        if (current != bfs.Source() && parent[current] == Const::NONE) {
+            EXPECT_FALSE(bfs.VisitedVertexAt(current));
+            continue;
+        }
+        for (; parent[current] != Const::NONE; current = parent[current]) {
+            ++distance;
+        }
+        EXPECT_EQ(distance, bfs.DistanceAt(vertex.Identifier()));
+    }
+}
+
+TEST_F(TestBreadthFirstSearchGrid, Island) {
+    ParallelBFS<TGraph> bfs(graph_, 0);
+    bfs.Run();
+    EXPECT_EQ(numberOfRows_ * numberOfColumns_, bfs.NumberOfVisitedVertices());
+
+    bfs.Source() = islandVertex_;
+    bfs.Run();
+    EXPECT_EQ(2, bfs.NumberOfVisitedVertices());
+    EXPECT_EQ(1, bfs.DistanceAt(islandVertex_ + 1));
+    EXPECT_EQ(islandVertex_, bfs.ParentOf(islandVertex_ + 1));
+    EXPECT_FALSE(bfs.VisitedVertexAt(0));
+}
+
+#pragma mark WHEEL
+
+TEST_F(TestBreadthFirstSearchWheel, SwitchesToBottomUp) {
+    ParallelBFS<TGraph> bfs(graph_, center_);
+    bfs.Run();
+
+    EXPECT_EQ(1, bfs.NumberOfBottomUpSteps());
+    EXPECT_EQ(numberOfLeaves_ + 1, bfs.NumberOfVisitedVertices());
+    for (Types::vertexId leaf = 1; leaf <= numberOfLeaves_; ++leaf) {
+        EXPECT_EQ(1, bfs.DistanceAt(leaf));
+        EXPECT_EQ(center_, bfs.ParentOf(leaf));
+    }
+}
+
+#pragma mark DIRECTED
+
+TEST_F(TestBreadthFirstSearchDirected, Run) {
+    for (bool isBottomUp : {false, true}) {
+        ParallelBFS<TGraph, true> bfs(graph_, 0);
+        bfs.Alpha() = isBottomUp ? std::numeric_limits<Types::real>::infinity() : 0;
+        bfs.Beta()  = std::numeric_limits<Types::real>::infinity();
+        bfs.Run();
+
+        std::vector<Types::count> expectedDistances{0, 1, 2, Const::NONE, 1};
+        for (Types::vertexId vertex = 0; vertex < graph_.NumberOfVertices(); ++vertex) {
+            EXPECT_EQ(expectedDistances[vertex], bfs.DistanceAt(vertex));
+        }
+        EXPECT_EQ(1, bfs.ParentOf(2));
+        EXPECT_EQ(0, bfs.ParentOf(4));
+        EXPECT_EQ(4, bfs.NumberOfVisitedVertices());
+    }
+}
+
+} // namespace egoa::test
@@ -0,0 +1,134 @@
+/*
+ * TestBreadthFirstSearch.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA___TESTS___ALGORITHMS___GRAPH_TRAVERSAL__TEST_BREADTH_FIRST_SEARCH_HPP
+#define EGOA___TESTS___ALGORITHMS___GRAPH_TRAVERSAL__TEST_BREADTH_FIRST_SEARCH_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <limits>
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Algorithms/GraphTraversal/BreadthFirstSearch.hpp"
+#include "Algorithms/GraphTraversal/ParallelBreadthFirstSearch.hpp"
+
+#include "DataStructures/Graphs/StaticGraph.hpp"
+
+#include "Helper/TestHelper.hpp"
+
+namespace egoa::test {
+
+using TGraph = egoa::StaticGraph<MinimalProperties, MinimalProperties>;
+
+/**
+ * @brief      A grid of buses and an island with two buses.
+ */
+class TestBreadthFirstSearchGrid : public ::testing::Test {
+protected:
+    TestBreadthFirstSearchGrid() {
+        for (Types::count counter = 0; counter < numberOfRows_ * numberOfColumns_ + 2; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        for (Types::index row = 0; row < numberOfRows_; ++row) {
+            for (Types::index column = 0; column < numberOfColumns_; ++column) {
+                Types::vertexId const vertex = VertexAt(row, column);
+                if (column + 1 < numberOfColumns_) {
+                    graph_.AddEdge(vertex, VertexAt(row, column + 1), MinimalProperties(0));
+                }
+                if (row + 1 < numberOfRows_) {
+                    graph_.AddEdge(VertexAt(row + 1, column), vertex, MinimalProperties(0));
+                }
+            }
+        }
+        graph_.AddEdge(islandVertex_, islandVertex_ + 1, MinimalProperties(0));
+    }
+
+    Types::vertexId VertexAt(Types::index row, Types::index column) const {
+        return row * numberOfColumns_ + column;
+    }
+
+    /**
+     * @brief      Expects the hop distances from the corner and a valid BFS
+     *             tree.
+     */
+    void ExpectDistancesFromCorner(ParallelBFS<TGraph> const & bfs) const {
+        EXPECT_EQ(numberOfRows_ * numberOfColumns_, bfs.NumberOfVisitedVertices());
+        for (Types::index row = 0; row < numberOfRows_; ++row) {
+            for (Types::index column = 0; column < numberOfColumns_; ++column) {
+                Types::vertexId const vertex = VertexAt(row, column);
+                EXPECT_EQ(row + column, bfs.DistanceAt(vertex));
+                if (vertex == 0) {
+                    EXPECT_EQ(Const::NONE, bfs.ParentOf(vertex));
+                    continue;
+                }
+                Types::vertexId const parent = bfs.ParentOf(vertex);
+                ASSERT_NE(Const::NONE, parent);
+                EXPECT_EQ(bfs.DistanceAt(vertex), bfs.DistanceAt(parent) + 1);
+                EXPECT_TRUE(graph_.EdgeId(parent, vertex) != Const::NONE
+                         || graph_.EdgeId(vertex, parent) != Const::NONE);
+            }
+        }
+        EXPECT_FALSE(bfs.VisitedVertexAt(islandVertex_));
+        EXPECT_EQ(Const::NONE, bfs.DistanceAt(islandVertex_ + 1));
+        EXPECT_EQ(Const::NONE, bfs.ParentOf(islandVertex_ + 1));
+    }
+
+    TGraph graph_;
+    Types::count const numberOfRows_ = 20;
+    Types::count const numberOfColumns_ = 30;
+    Types::vertexId const islandVertex_ = numberOfRows_ * numberOfColumns_;
+};
+
+/**
+ * @brief      A star whose leaves form a cycle.
+ *
+ * @details    The frontier after the center contains almost all edges.
+ */
+class TestBreadthFirstSearchWheel : public ::testing::Test {
+protected:
+    TestBreadthFirstSearchWheel() {
+        center_ = graph_.AddVertex(MinimalProperties(0));
+        for (Types::count counter = 1; counter <= numberOfLeaves_; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+            graph_.AddEdge(center_, counter, MinimalProperties(counter));
+        }
+        for (Types::vertexId leaf = 1; leaf <= numberOfLeaves_; ++leaf) {
+            graph_.AddEdge(leaf, leaf % numberOfLeaves_ + 1, MinimalProperties(0));
+        }
+    }
+
+    TGraph graph_;
+    Types::vertexId center_;
+    Types::count const numberOfLeaves_ = 1000;
+};
+
+/**
+ * @brief      A small directed graph, in which the vertex 3 is not reachable
+ *             from the vertex 0.
+ */
+class TestBreadthFirstSearchDirected : public ::testing::Test {
+protected:
+    TestBreadthFirstSearchDirected() {
+        for (Types::count counter = 0; counter < 5; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        graph_.AddEdge(0, 1, MinimalProperties(1));
+        graph_.AddEdge(1, 2, MinimalProperties(12));
+        graph_.AddEdge(3, 2, MinimalProperties(32));
+        graph_.AddEdge(2, 4, MinimalProperties(24));
+        graph_.AddEdge(0, 4, MinimalProperties(4));
+    }
+
+    TGraph graph_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA___TESTS___ALGORITHMS___GRAPH_TRAVERSAL__TEST_BREADTH_FIRST_SEARCH_HPP
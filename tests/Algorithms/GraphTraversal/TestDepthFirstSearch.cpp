@@ -0,0 +1,199 @@
+/*
+ * TestDepthFirstSearch.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestDepthFirstSearch.hpp"
+
+namespace egoa::test {
+
+#pragma mark LONG_FEEDER
+
+TEST_F(TestDepthFirstSearchLongFeeder, EntryAndExitTimes) {
+    CountingDepthFirstSearch dfs(graph_, 0);
+    dfs.Run();
+
+    for (Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex) {
+        ASSERT_EQ(vertex, dfs.EntryTimeAt(vertex));
+        ASSERT_EQ(2 * numberOfVertices_ - 1 - vertex, dfs.ExitTimeAt(vertex));
+    }
+    EXPECT_EQ(numberOfVertices_, dfs.numberOfPreprocessedVertices);
+    EXPECT_EQ(numberOfVertices_, dfs.numberOfPostprocessedVertices);
+    EXPECT_EQ(numberOfVertices_ - 1, dfs.numberOfPostprocessedTreeEdges);
+    EXPECT_EQ(0, dfs.numberOfProcessedEdges);
+}
+
+TEST_F(TestDepthFirstSearchLongFeeder, FromTheMiddle) {
+    Types::vertexId const source = numberOfVertices_ / 2;
+    DepthFirstSearch<TGraph> dfs(graph_, source);
+    dfs.Run();
+
+    std::vector<Types::vertexId> parent;
+    dfs.Result(parent);
+    ASSERT_EQ(numberOfVertices_, parent.size());
+    EXPECT_EQ(Const::NONE, parent[source]);
+    for (Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex) {
+        if (vertex == source) continue;
+        ASSERT_EQ(vertex < source ? vertex + 1 : vertex - 1, parent[vertex]);
+    }
+}
+
+TEST_F(TestDepthFirstSearchLongFeeder, ArticulationVertices) {
+    ArticulationVertexDetection<TGraph> detection(graph_, 0);
+    detection.Run();
+
+    EXPECT_FALSE(detection.IsArticulationVertexAt(0));
+    EXPECT_FALSE(detection.IsArticulationVertexAt(numberOfVertices_ - 1));
+    for (Types::vertexId vertex = 1; vertex + 1 < numberOfVertices_; ++vertex) {
+        ASSERT_TRUE(detection.IsArticulationVertexAt(vertex));
+    }
+}
+
+TEST_F(TestDepthFirstSearchLongFeeder, CycleDetection) {
+    CycleDetection<TGraph> detection(graph_, 0);
+    detection.Run();
+    EXPECT_FALSE(detection.HasCycle());
+
+    graph_.AddEdge(numberOfVertices_ - 1, 0, MinimalProperties(0));
+    CycleDetection<TGraph> closedDetection(graph_, 0);
+    closedDetection.Run();
+    ASSERT_TRUE(closedDetection.HasCycle());
+    EXPECT_EQ(numberOfVertices_, closedDetection.Cycle().size());
+}
+
+TEST_F(TestDepthFirstSearchLongFeeder, Clear) {
+    CountingDepthFirstSearch dfs(graph_, 0);
+    dfs.Run();
+    dfs.Clear();
+    EXPECT_FALSE(dfs.VisitedVertexAt(0));
+    EXPECT_EQ(Const::NONE, dfs.ParentOf(1));
+
+    dfs.Source() = numberOfVertices_ - 1;
+    dfs.Run();
+    EXPECT_EQ(0, dfs.EntryTimeAt(numberOfVertices_ - 1));
+    EXPECT_EQ(numberOfVertices_ - 1, dfs.EntryTimeAt(0));
+}
+
+#pragma mark ARTICULATION_VERTICES
+
+TEST_F(TestDepthFirstSearchArticulationVertices, FromEachVertex) {
+    for (Types::vertexId source = 0; source < graph_.NumberOfVertices(); ++source) {
+        ArticulationVertexDetection<TGraph> detection(graph_, source);
+        detection.Run();
+        ExpectArticulationVertices(detection);
+    }
+}
+
+TEST_F(TestDepthFirstSearchArticulationVertices, NonTreeEdges) {
+    CountingDepthFirstSearch dfs(graph_, 0);
+    dfs.Run();
+
+    // Each of the three non-tree edges is scanned from both of its ends.
+    EXPECT_EQ(3, graph_.NumberOfEdges() - (graph_.NumberOfVertices() - 1));
+    EXPECT_EQ(6, dfs.numberOfProcessedEdges);
+    EXPECT_EQ(graph_.NumberOfVertices() - 1, dfs.numberOfPostprocessedTreeEdges);
+}
+
+TEST_F(TestDepthFirstSearchArticulationVertices, TypifyEdge) {
+    DepthFirstSearch<TGraph> dfs(graph_, 0);
+    dfs.Run();
+
+    for (auto const & edge : graph_.Edges()) {
+        Types::vertexId source = edge.Source();
+        Types::vertexId target = edge.Target();
+        if (dfs.EntryTimeAt(source) > dfs.EntryTimeAt(target)) {
+            std::swap(source, target);
+        }
+        DfsEdgeType const type = dfs.TypifyEdge(source, target);
+        EXPECT_TRUE(type == DfsEdgeType::tree || type == DfsEdgeType::forward);
+        EXPECT_EQ(type == DfsEdgeType::tree, dfs.ParentOf(target) == source);
+    }
+}
+
+#pragma mark CYCLE_DETECTION
+
+TEST_F(TestDepthFirstSearchCycleDetection, Tree) {
+    graph_.AddEdge(0, 1, MinimalProperties(0));
+    graph_.AddEdge(0, 2, MinimalProperties(0));
+    graph_.AddEdge(2, 3, MinimalProperties(0));
+    graph_.AddEdge(4, 2, MinimalProperties(0));
+
+    CycleDetection<TGraph> detection(graph_, 3);
+    detection.Run();
+    EXPECT_FALSE(detection.HasCycle());
+    EXPECT_TRUE(detection.Cycle().empty());
+    EXPECT_TRUE(detection.CycleEdges().empty());
+}
+
+TEST_F(TestDepthFirstSearchCycleDetection, Triangle) {
+    graph_.AddEdge(0, 1, MinimalProperties(0));
+    graph_.AddEdge(1, 2, MinimalProperties(0));
+    graph_.AddEdge(2, 3, MinimalProperties(0));
+    graph_.AddEdge(3, 1, MinimalProperties(0));
+    graph_.AddEdge(3, 4, MinimalProperties(0));
+
+    CycleDetection<TGraph> detection(graph_, 0);
+    detection.Run();
+    ASSERT_TRUE(detection.HasCycle());
+    EXPECT_THAT(detection.Cycle(), testing::UnorderedElementsAre(1, 2, 3));
+    EXPECT_THAT(detection.CycleEdges(), testing::UnorderedElementsAre(1, 2, 3));
+    ExpectValidCycle(detection);
+    EXPECT_TRUE(detection.Terminate());
+}
+
+TEST_F(TestDepthFirstSearchCycleDetection, ParallelEdges) {
+    graph_.AddEdge(0, 1, MinimalProperties(0));
+    graph_.AddEdge(1, 2, MinimalProperties(0));
+    graph_.AddEdge(2, 1, MinimalProperties(0));
+
+    CycleDetection<TGraph> detection(graph_, 0);
+    detection.Run();
+    ASSERT_TRUE(detection.HasCycle());
+    EXPECT_THAT(detection.Cycle(), testing::UnorderedElementsAre(1, 2));
+    EXPECT_THAT(detection.CycleEdges(), testing::UnorderedElementsAre(1, 2));
+    ExpectValidCycle(detection);
+}
+
+TEST_F(TestDepthFirstSearchCycleDetection, SelfLoop) {
+    graph_.AddEdge(0, 1, MinimalProperties(0));
+    graph_.AddEdge(1, 1, MinimalProperties(0));
+
+    CycleDetection<TGraph> detection(graph_, 0);
+    detection.Run();
+    ASSERT_TRUE(detection.HasCycle());
+    EXPECT_THAT(detection.Cycle(), testing::ElementsAre(1));
+    EXPECT_THAT(detection.CycleEdges(), testing::ElementsAre(1));
+}
+
+TEST_F(TestDepthFirstSearchCycleDetection, DirectedAcyclic) {
+    graph_.AddEdge(0, 1, MinimalProperties(0));
+    graph_.AddEdge(0, 2, MinimalProperties(0));
+    graph_.AddEdge(1, 3, MinimalProperties(0));
+    graph_.AddEdge(2, 3, MinimalProperties(0));
+    graph_.AddEdge(4, 0, MinimalProperties(0));
+
+    CycleDetection<TGraph, true> detection(graph_, 0);
+    detection.Run();
+    EXPECT_FALSE(detection.HasCycle());
+    EXPECT_FALSE(detection.VisitedVertexAt(4));
+}
+
+TEST_F(TestDepthFirstSearchCycleDetection, DirectedCycle) {
+    graph_.AddEdge(0, 1, MinimalProperties(0));
+    graph_.AddEdge(1, 2, MinimalProperties(0));
+    graph_.AddEdge(0, 2, MinimalProperties(0));
+    graph_.AddEdge(2, 3, MinimalProperties(0));
+    graph_.AddEdge(3, 4, MinimalProperties(0));
+    graph_.AddEdge(4, 2, MinimalProperties(0));
+
+    CycleDetection<TGraph, true> detection(graph_, 0);
+    detection.Run();
+    ASSERT_TRUE(detection.HasCycle());
+    EXPECT_THAT(detection.Cycle(), testing::ElementsAre(2, 3, 4));
+    EXPECT_THAT(detection.CycleEdges(), testing::ElementsAre(3, 4, 5));
+    ExpectValidCycle(detection);
+}
+
+} // namespace egoa::test
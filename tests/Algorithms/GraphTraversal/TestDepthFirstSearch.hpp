@@ -0,0 +1,164 @@
+/*
+ * TestDepthFirstSearch.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA___TESTS___ALGORITHMS___GRAPH_TRAVERSAL__TEST_DEPTH_FIRST_SEARCH_HPP
+#define EGOA___TESTS___ALGORITHMS___GRAPH_TRAVERSAL__TEST_DEPTH_FIRST_SEARCH_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <vector>
+
+#include "Auxiliary/Types.hpp"
+
+#include "Algorithms/GraphTraversal/ArticulationVertexDetection.hpp"
+#include "Algorithms/GraphTraversal/CycleDetection.hpp"
+#include "Algorithms/GraphTraversal/DepthFirstSearch.hpp"
+
+#include "DataStructures/Graphs/StaticGraph.hpp"
+
+#include "Helper/TestHelper.hpp"
+
+namespace egoa::test {
+
+using TGraph = egoa::StaticGraph<MinimalProperties, MinimalProperties>;
+
+/**
+ * @brief      A DFS that counts the calls of its virtual hooks.
+ */
+class CountingDepthFirstSearch final : public DepthFirstSearch<TGraph> {
+public:
+    CountingDepthFirstSearch(TGraph const & graph, Types::vertexId source)
+    : DepthFirstSearch<TGraph>(graph, source) {}
+
+    void PreprocessingVertexWith(Types::vertexId vertexId) override {
+        EXPECT_TRUE(VisitedVertexAt(vertexId));
+        EXPECT_FALSE(ProcessedVertexAt(vertexId));
+        ++numberOfPreprocessedVertices;
+    }
+
+    void PostprocessingVertexWith(Types::vertexId vertexId) override {
+        EXPECT_TRUE(ProcessedVertexAt(vertexId));
+        ++numberOfPostprocessedVertices;
+    }
+
+    void ProcessingEdgeWith(Types::vertexId /*source*/,
+                            Types::vertexId target,
+                            Types::edgeId edgeId) override {
+        EXPECT_NE(edgeId, ParentEdgeOf(target));
+        ++numberOfProcessedEdges;
+    }
+
+    void PostprocessingEdgeWith(Types::vertexId source,
+                                Types::vertexId target,
+                                Types::edgeId edgeId) override {
+        if (edgeId == ParentEdgeOf(target)) {
+            EXPECT_EQ(source, ParentOf(target));
+            EXPECT_TRUE(ProcessedVertexAt(target));
+            ++numberOfPostprocessedTreeEdges;
+        }
+    }
+
+    Types::count numberOfPreprocessedVertices = 0;
+    Types::count numberOfPostprocessedVertices = 0;
+    Types::count numberOfProcessedEdges = 0;
+    Types::count numberOfPostprocessedTreeEdges = 0;
+};
+
+/**
+ * @brief      A radial feeder with many buses in series.
+ */
+class TestDepthFirstSearchLongFeeder : public ::testing::Test {
+protected:
+    TestDepthFirstSearchLongFeeder() {
+        for (Types::count counter = 0; counter < numberOfVertices_; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        for (Types::vertexId vertex = 0; vertex + 1 < numberOfVertices_; ++vertex) {
+            graph_.AddEdge(vertex, vertex + 1, MinimalProperties(vertex));
+        }
+    }
+
+    TGraph graph_;
+    Types::count const numberOfVertices_ = 200000;
+};
+
+/**
+ * @brief      Two triangles sharing the vertex 2, a vertex 5 that is
+ *             connected to the vertex 4 by two parallel edges, and a leaf 6
+ *             at the vertex 0.
+ *
+ * @details    The articulation vertices are 0, 2, and 4.
+ */
+class TestDepthFirstSearchArticulationVertices : public ::testing::Test {
+protected:
+    TestDepthFirstSearchArticulationVertices() {
+        for (Types::count counter = 0; counter < 7; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        graph_.AddEdge(0, 1, MinimalProperties(1));
+        graph_.AddEdge(1, 2, MinimalProperties(12));
+        graph_.AddEdge(2, 0, MinimalProperties(20));
+        graph_.AddEdge(2, 3, MinimalProperties(23));
+        graph_.AddEdge(3, 4, MinimalProperties(34));
+        graph_.AddEdge(4, 2, MinimalProperties(42));
+        graph_.AddEdge(4, 5, MinimalProperties(45));
+        graph_.AddEdge(5, 4, MinimalProperties(54));
+        graph_.AddEdge(0, 6, MinimalProperties(6));
+    }
+
+    void ExpectArticulationVertices(ArticulationVertexDetection<TGraph> const & detection) const {
+        std::vector<bool> const expected = { true, false, true, false, true, false, false };
+        for (Types::vertexId vertex = 0; vertex < expected.size(); ++vertex) {
+            EXPECT_EQ(expected[vertex], detection.IsArticulationVertexAt(vertex))
+                << "vertex " << vertex;
+        }
+    }
+
+    TGraph graph_;
+};
+
+/**
+ * @brief      An empty graph with five vertices, to which the tests add
+ *             edges.
+ */
+class TestDepthFirstSearchCycleDetection : public ::testing::Test {
+protected:
+    TestDepthFirstSearchCycleDetection() {
+        for (Types::count counter = 0; counter < 5; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+    }
+
+    /**
+     * @brief      Expects that the edges of the cycle connect consecutive
+     *             vertices of the cycle.
+     */
+    template<bool IsDirected>
+    void ExpectValidCycle(CycleDetection<TGraph, IsDirected> const & detection) const {
+        auto const & cycle = detection.Cycle();
+        auto const & edges = detection.CycleEdges();
+        ASSERT_EQ(cycle.size(), edges.size());
+        for (Types::index index = 0; index < cycle.size(); ++index) {
+            Types::vertexId const next = cycle[(index + 1) % cycle.size()];
+            auto const & edge = graph_.EdgeAt(edges[index]);
+            if (IsDirected) {
+                EXPECT_EQ(cycle[index], edge.Source());
+                EXPECT_EQ(next, edge.Target());
+            } else {
+                EXPECT_TRUE((edge.Source() == cycle[index] && edge.Target() == next)
+                         || (edge.Source() == next && edge.Target() == cycle[index]));
+            }
+        }
+    }
+
+    TGraph graph_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA___TESTS___ALGORITHMS___GRAPH_TRAVERSAL__TEST_DEPTH_FIRST_SEARCH_HPP
@@ -8,6 +8,8 @@
 #include "TestDominatingThetaPath.hpp"
 #include "Helper/TestHelper.hpp"
 
+#include <algorithm>
+
 #ifdef OPENMP_AVAILABLE
     #include <omp.h>
 #endif
@@ -217,6 +219,317 @@ TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
     EXPECT_EQ ( result, 2 );
 }
 
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunDTPthetaArenaForAllSources )
+{
+    for ( Types::vertexId source = 0
+        ; source < graph_.NumberOfVertices()
+        ; ++source )
+    { // The arena is reset between the sources
+        dtpTheta_.Source ( source );
+        dtpTheta_.Run();
+        dtpThetaArena_.Source ( source );
+        dtpThetaArena_.Run();
+        EXPECT_EQ ( dtpTheta_.NumberOfLabels(), dtpThetaArena_.NumberOfLabels() );
+
+        for ( Types::vertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , dtpThetaArena_.Result ( resultPaths, target ) );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+        }
+    }
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4aDynamicGraph
+        , RunDTPForAllSourcesMatchesStaticGraph )
+{
+    TDynamicDtp      dynamicDtp      ( dynamicGraph_ );
+    TDynamicDtpTheta dynamicDtpTheta ( dynamicGraph_ );
+
+    for ( Types::vertexId source = 0
+        ; source < graph_.NumberOfVertices()
+        ; ++source )
+    {
+        dtp_.Clear();
+        dtp_.Source ( source );
+        dtp_.Run();
+        dynamicDtp.Clear();
+        dynamicDtp.Source ( source );
+        dynamicDtp.Run();
+        EXPECT_EQ ( dtp_.NumberOfLabels(), dynamicDtp.NumberOfLabels() );
+
+        dtpTheta_.Clear();
+        dtpTheta_.Source ( source );
+        dtpTheta_.Run();
+        dynamicDtpTheta.Clear();
+        dynamicDtpTheta.Source ( source );
+        dynamicDtpTheta.Run();
+        EXPECT_EQ ( dtpTheta_.NumberOfLabels(), dynamicDtpTheta.NumberOfLabels() );
+
+        for ( Types::vertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , dynamicDtpTheta.Result ( resultPaths, target ) );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+        }
+    }
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunDTPthetaPointToPoint )
+{
+    TDtpTheta pointToPoint ( graphConst_ );
+    for ( Types::vertexId target = 0
+        ; target < graph_.NumberOfVertices()
+        ; ++target )
+    {
+        pointToPoint.Target ( target );
+        EXPECT_EQ ( pointToPoint.Target(), target );
+
+        for ( Types::vertexId source = 0
+            ; source < graph_.NumberOfVertices()
+            ; ++source )
+        {
+            dtpTheta_.Source ( source );
+            dtpTheta_.Run();
+            pointToPoint.Source ( source );
+            pointToPoint.Run();
+            EXPECT_LE ( pointToPoint.NumberOfLabels(), dtpTheta_.NumberOfLabels() );
+
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , pointToPoint.Result ( resultPaths, target ) );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , pointToPoint.UpperBound() );
+        }
+    }
+
+    // Labels at the target are not extended
+    pointToPoint.Target ( source_ );
+    pointToPoint.Source ( source_ );
+    pointToPoint.Run();
+    EXPECT_EQ ( 1, pointToPoint.NumberOfLabels() );
+
+    // Without target all labels are computed again
+    pointToPoint.Target ( Const::NONE );
+    pointToPoint.Source ( source_ );
+    pointToPoint.Run();
+    EXPECT_EQ ( 7, pointToPoint.NumberOfLabels() );
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunDTPthetaPointToPointWithPropertyColumns )
+{
+    graph_.Edge ( static_cast<Types::vertexId>(0)
+                , static_cast<Types::vertexId>(1) ).Properties().Status() = false;
+
+    TGraph packedGraph = graph_;
+    packedGraph.BuildPropertyColumns();
+    ASSERT_TRUE ( packedGraph.HasPropertyColumns() );
+
+    TDtpTheta unpacked ( graphConst_ );
+    TDtpTheta packed   ( packedGraph );
+    unpacked.IgnoreSwitchedEdges() = true;
+    packed.IgnoreSwitchedEdges()   = true;
+
+    for ( Types::vertexId target = 0
+        ; target < graph_.NumberOfVertices()
+        ; ++target )
+    {
+        unpacked.Target ( target );
+        packed.Target   ( target );
+
+        for ( Types::vertexId source = 0
+            ; source < graph_.NumberOfVertices()
+            ; ++source )
+        {
+            unpacked.Source ( source );
+            unpacked.Run();
+            packed.Source ( source );
+            packed.Run();
+            EXPECT_EQ ( unpacked.NumberOfLabels(), packed.NumberOfLabels() );
+
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( unpacked.Result ( expectedPaths, target )
+                      , packed.Result ( resultPaths, target ) );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+        }
+    }
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunDTPthetaAfterSwitchingEdgeWithPropertyColumns )
+{
+    TGraph packedGraph = graph_;
+    packedGraph.BuildPropertyColumns();
+
+    TDtpTheta unpacked ( graphConst_ );
+    TDtpTheta packed   ( packedGraph );
+    unpacked.IgnoreSwitchedEdges() = true;
+    packed.IgnoreSwitchedEdges()   = true;
+
+    auto expectEqualResults = [ & ]()
+    {
+        for ( Types::vertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            unpacked.Target ( target );
+            packed.Target   ( target );
+
+            for ( Types::vertexId source = 0
+                ; source < graph_.NumberOfVertices()
+                ; ++source )
+            {
+                unpacked.Source ( source );
+                unpacked.Run();
+                packed.Source ( source );
+                packed.Run();
+                EXPECT_EQ ( unpacked.NumberOfLabels(), packed.NumberOfLabels() );
+
+                std::vector<std::vector<Types::vertexId>> expectedPaths;
+                std::vector<std::vector<Types::vertexId>> resultPaths;
+                EXPECT_EQ ( unpacked.Result ( expectedPaths, target )
+                          , packed.Result ( resultPaths, target ) );
+                EXPECT_EQ ( expectedPaths, resultPaths );
+            }
+        }
+    };
+
+    // The switched edge is not in the columns, thus they are not used
+    Types::edgeId const edgeId = graph_.Edge ( static_cast<Types::vertexId>(0)
+                                             , static_cast<Types::vertexId>(1) ).Identifier();
+    graph_.EdgeAt ( edgeId ).Properties().Status()      = false;
+    packedGraph.EdgeAt ( edgeId ).Properties().Status() = false;
+    packedGraph.PropertiesChanged();
+    EXPECT_FALSE ( packedGraph.HasPropertyColumns() );
+    expectEqualResults();
+
+    packedGraph.BuildPropertyColumns();
+    ASSERT_TRUE  ( packedGraph.HasPropertyColumns() );
+    EXPECT_FALSE ( packedGraph.PropertyColumns().IsActive ( edgeId ) );
+    expectEqualResults();
+
+    // Refreshing the changed edge keeps the columns in use
+    graph_.EdgeAt ( edgeId ).Properties().Status()      = true;
+    packedGraph.EdgeAt ( edgeId ).Properties().Status() = true;
+    packedGraph.RefreshPropertyColumns ( { edgeId } );
+    ASSERT_TRUE ( packedGraph.HasPropertyColumns() );
+    EXPECT_TRUE ( packedGraph.PropertyColumns().IsActive ( edgeId ) );
+    expectEqualResults();
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunBidirectionalDTPtheta )
+{
+    BidirectionalDominatingThetaPath< TGraph
+                                    , TLabelTheta
+                                    , TMQTheta
+                                    , TLabelSetTheta
+                                    , DominationCriterion::strict > bidirectional ( graphConst_ );
+    for ( Types::vertexId source = 0
+        ; source < graph_.NumberOfVertices()
+        ; ++source )
+    {
+        dtpTheta_.Source ( source );
+        dtpTheta_.Run();
+        bidirectional.Source ( source );
+
+        for ( Types::vertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            bidirectional.Target ( target );
+            bidirectional.Run();
+
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , bidirectional.Result ( resultPaths ) );
+            std::sort ( expectedPaths.begin(), expectedPaths.end() );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , bidirectional.UpperBound() );
+        }
+    }
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunDTPthetaWithMappingHeaps )
+{
+    using TVertexId = Types::vertexId;
+    DominatingThetaPath< TGraph, TLabelTheta, MappingDaryHeap<TVertexId, TLabelTheta>, TLabelSetTheta > dtpDary    ( graphConst_ );
+    DominatingThetaPath< TGraph, TLabelTheta, PairingHeap<TVertexId, TLabelTheta>,     TLabelSetTheta > dtpPairing ( graphConst_ );
+
+    for ( TVertexId source = 0
+        ; source < graph_.NumberOfVertices()
+        ; ++source )
+    {
+        dtpTheta_.Source   ( source ); dtpTheta_.Run();
+        dtpDary.Source     ( source ); dtpDary.Run();
+        dtpPairing.Source  ( source ); dtpPairing.Run();
+        EXPECT_EQ ( dtpTheta_.NumberOfLabels(), dtpDary.NumberOfLabels() );
+        EXPECT_EQ ( dtpTheta_.NumberOfLabels(), dtpPairing.NumberOfLabels() );
+
+        for ( TVertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            std::vector<std::vector<TVertexId>> expectedPaths;
+            std::vector<std::vector<TVertexId>> daryPaths;
+            std::vector<std::vector<TVertexId>> pairingPaths;
+            Types::real const expected = dtpTheta_.Result ( expectedPaths, target );
+            EXPECT_EQ ( expected, dtpDary.Result    ( daryPaths,    target ) );
+            EXPECT_EQ ( expected, dtpPairing.Result ( pairingPaths, target ) );
+            std::sort ( expectedPaths.begin(), expectedPaths.end() );
+            std::sort ( daryPaths.begin(),     daryPaths.end() );
+            std::sort ( pairingPaths.begin(),  pairingPaths.end() );
+            EXPECT_EQ ( expectedPaths, daryPaths );
+            EXPECT_EQ ( expectedPaths, pairingPaths );
+        }
+    }
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4a
+        , RunDTPWithRadixHeap )
+{
+    using TVertexId = Types::vertexId;
+    DominatingThetaPath< TGraph, TLabel, RadixHeap<TVertexId, TLabel>, TLabelSet > dtpRadix ( graphConst_ );
+
+    for ( TVertexId source = 0
+        ; source < graph_.NumberOfVertices()
+        ; ++source )
+    {
+        dtp_.Source     ( source ); dtp_.Run();
+        dtpRadix.Source ( source ); dtpRadix.Run();
+        EXPECT_EQ ( dtp_.NumberOfLabels(), dtpRadix.NumberOfLabels() );
+
+        for ( TVertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            std::vector<std::vector<TVertexId>> expectedPaths;
+            std::vector<std::vector<TVertexId>> radixPaths;
+            EXPECT_EQ ( dtp_.Result ( expectedPaths, target ), dtpRadix.Result ( radixPaths, target ) );
+            std::sort ( expectedPaths.begin(), expectedPaths.end() );
+            std::sort ( radixPaths.begin(),    radixPaths.end() );
+            EXPECT_EQ ( expectedPaths, radixPaths );
+        }
+    }
+}
+
 #pragma mark TEST_DOMINATING_THETA_PATH_WITH_GRAPH_ACM_FIGURE_4B
 
 TEST_F  ( TestDTPUsingAcm2018MtsfFigure4b
@@ -358,4 +671,66 @@ TEST_F  ( TestDTPUsingAcm2018MtsfFigure4b
     EXPECT_EQ ( result, 2 );
 }
 
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4b
+        , RunDTPPointToPoint )
+{
+    TDtp pointToPoint ( graphConst_ );
+    for ( Types::vertexId target = 0
+        ; target < graph_.NumberOfVertices()
+        ; ++target )
+    {
+        pointToPoint.Target ( target );
+
+        for ( Types::vertexId source = 0
+            ; source < graph_.NumberOfVertices()
+            ; ++source )
+        {
+            dtp_.Source ( source );
+            dtp_.Run();
+            pointToPoint.Source ( source );
+            pointToPoint.Run();
+            EXPECT_LE ( pointToPoint.NumberOfLabels(), dtp_.NumberOfLabels() );
+
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( dtp_.Result ( expectedPaths, target )
+                      , pointToPoint.Result ( resultPaths, target ) );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+        }
+    }
+}
+
+TEST_F  ( TestDTPUsingAcm2018MtsfFigure4b
+        , RunBidirectionalDTPtheta )
+{
+    BidirectionalDominatingThetaPath< TGraph
+                                    , TLabelTheta
+                                    , TMQTheta
+                                    , TLabelSetTheta
+                                    , DominationCriterion::strict > bidirectional ( graphConst_ );
+    for ( Types::vertexId source = 0
+        ; source < graph_.NumberOfVertices()
+        ; ++source )
+    {
+        dtpTheta_.Source ( source );
+        dtpTheta_.Run();
+        bidirectional.Source ( source );
+
+        for ( Types::vertexId target = 0
+            ; target < graph_.NumberOfVertices()
+            ; ++target )
+        {
+            bidirectional.Target ( target );
+            bidirectional.Run();
+
+            std::vector<std::vector<Types::vertexId>> expectedPaths;
+            std::vector<std::vector<Types::vertexId>> resultPaths;
+            EXPECT_EQ ( dtpTheta_.Result ( expectedPaths, target )
+                      , bidirectional.Result ( resultPaths ) );
+            std::sort ( expectedPaths.begin(), expectedPaths.end() );
+            EXPECT_EQ ( expectedPaths, resultPaths );
+        }
+    }
+}
+
 } // namespace egoa::test
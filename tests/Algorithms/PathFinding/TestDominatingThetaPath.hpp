@@ -11,12 +11,14 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include "Algorithms/PathFinding/BidirectionalDominatingThetaPath.hpp"
 #include "Algorithms/PathFinding/DominatingThetaPath.hpp"
 
 #include "IO/PowerGridIO.hpp"
 
 #include "DataStructures/Networks/PowerGrid.hpp"
 
+#include "DataStructures/Graphs/DynamicGraph.hpp"
 #include "DataStructures/Graphs/StaticGraph.hpp"
 
 #include "DataStructures/Labels/SusceptanceNormLabel.hpp"
@@ -25,8 +27,12 @@
 #include "DataStructures/Container/Queues/Bucket.hpp"
 #include "DataStructures/Container/Queues/BinaryHeap.hpp"
 #include "DataStructures/Container/Queues/MappingBinaryHeap.hpp"
+#include "DataStructures/Container/Queues/MappingDaryHeap.hpp"
+#include "DataStructures/Container/Queues/PairingHeap.hpp"
+#include "DataStructures/Container/Queues/RadixHeap.hpp"
 
 #include "DataStructures/Container/DominationCriterion.hpp"
+#include "DataStructures/Container/Allocators/ArenaAllocator.hpp"
 
 namespace egoa::test {
 
@@ -104,20 +110,36 @@ class TestDTPPowerGridSpecific : public TestDominatingThetaPath {
                                                    , TMQTheta
                                                    , TLabelSetTheta
                                                    , DominationCriterion::strict >;
+
+        // Power Grid DTP whose labels and label sets draw from the arena
+        using TVertexSetArena  = std::unordered_set< Types::vertexId
+                                                   , std::hash<Types::vertexId>
+                                                   , std::equal_to<Types::vertexId>
+                                                   , ArenaAllocator<Types::vertexId> >;
+        using TLabelThetaArena = VoltageAngleDifferenceLabel<TGraph::TEdge, TVertexSetArena>;
+        using TDtpThetaArena   = DominatingThetaPath < TGraph
+                                                     , TLabelThetaArena
+                                                     , MappingBinaryHeap<typename TGraph::TVertexId, TLabelThetaArena>
+                                                     , Bucket< BinaryHeap<TLabelThetaArena, ArenaAllocator<TLabelThetaArena>>
+                                                             , ArenaAllocator<TLabelThetaArena> >
+                                                     , DominationCriterion::strict >;
     protected:
         TestDTPPowerGridSpecific ()
         : TestDominatingThetaPath()
         , dtpTheta_( graphConst_ )
+        , dtpThetaArena_( graphConst_ )
         {}
 
         TestDTPPowerGridSpecific ( TGraph && graph )
         : TestDominatingThetaPath ( graph )
         , dtpTheta_( graphConst_ )
+        , dtpThetaArena_( graphConst_ )
         {}
 
         TestDTPPowerGridSpecific ( TGraph const & graph )
         : TestDominatingThetaPath ( graph )
         , dtpTheta_( graphConst_ )
+        , dtpThetaArena_( graphConst_ )
         {}
 
         inline void TestEdgeValues ( Types::edgeId edgeId
@@ -144,6 +166,7 @@ class TestDTPPowerGridSpecific : public TestDominatingThetaPath {
         Types::string   const TestCaseAcm2018MtsfFigure4b_ = "../../framework/tests/Data/PowerGrids/ieee_2018_acm_eEnergy_MTSF_Figure4b.m";
         Types::vertexId const source_ = 0;
         TDtpTheta             dtpTheta_;
+        TDtpThetaArena        dtpThetaArena_;
 };
 
 /**
@@ -188,12 +211,55 @@ class TestDTPUsingAcm2018MtsfFigure4a : public TestDTPPowerGridSpecific {
         virtual void SetUp() override {
             dtp_.Clear();
             dtpTheta_.Clear();
+            dtpThetaArena_.Clear();
         }
 };
 
 using TestDTPUsingAcm2018MtsfFigure4aDeathTest         = TestDTPUsingAcm2018MtsfFigure4a;
 using TestDTPUsingAcm2018MtsfFigure4aExceptionHandling = TestDTPUsingAcm2018MtsfFigure4a;
 
+/**
+ * @brief      Fixture to test DTP on a DynamicGraph copy of Figure 4a
+ */
+class TestDTPUsingAcm2018MtsfFigure4aDynamicGraph : public TestDTPUsingAcm2018MtsfFigure4a {
+    protected:
+        using TDynamicGraph       = DynamicGraph<TVertexProperties, TEdgeProperties>;
+        using TDynamicLabel       = SusceptanceNormLabel<TDynamicGraph::TEdge>;
+        using TDynamicDtp         = DominatingThetaPath < TDynamicGraph
+                                                        , TDynamicLabel
+                                                        , MappingBinaryHeap<typename TDynamicGraph::TVertexId, TDynamicLabel>
+                                                        , Bucket< BinaryHeap<TDynamicLabel> >
+                                                        , DominationCriterion::strict >;
+        using TDynamicLabelTheta  = VoltageAngleDifferenceLabel<TDynamicGraph::TEdge>;
+        using TDynamicDtpTheta    = DominatingThetaPath < TDynamicGraph
+                                                        , TDynamicLabelTheta
+                                                        , MappingBinaryHeap<typename TDynamicGraph::TVertexId, TDynamicLabelTheta>
+                                                        , Bucket< BinaryHeap<TDynamicLabelTheta> >
+                                                        , DominationCriterion::strict >;
+    protected:
+        TestDTPUsingAcm2018MtsfFigure4aDynamicGraph ()
+        : TestDTPUsingAcm2018MtsfFigure4a()
+        , dynamicGraph_( "Acm2018MtsfFigure4a" )
+        {
+            for ( Types::vertexId vertexId = 0
+                ; vertexId < graph_.NumberOfVertices()
+                ; ++vertexId )
+            {
+                dynamicGraph_.AddVertex ( graphConst_.VertexAt ( vertexId ).Properties() );
+            }
+            for ( Types::edgeId edgeId = 0
+                ; edgeId < graph_.NumberOfEdges()
+                ; ++edgeId )
+            {
+                auto const & edge = graphConst_.EdgeAt ( edgeId );
+                dynamicGraph_.AddEdge ( edge.Source(), edge.Target(), edge.Properties() );
+            }
+        }
+
+    protected:
+        TDynamicGraph dynamicGraph_;
+};
+
 /**
  * @brief      Fixtures to test DTP using Figure 4b
  */
@@ -218,6 +284,7 @@ class TestDTPUsingAcm2018MtsfFigure4b : public TestDTPPowerGridSpecific {
         virtual void SetUp() override {
             dtp_.Clear();
             dtpTheta_.Clear();
+            dtpThetaArena_.Clear();
         }
 };
 
@@ -37,4 +37,75 @@ TYPED_TEST(TestSpanningTreeFiveVertexGraph, Run) {
     EXPECT_EQ(expectedResult, result);
 }
 
+#pragma mark GRID
+
+TYPED_TEST(TestSpanningTreeGrid, Run) {
+    this->algo_.Run();
+    auto result = this->algo_.Result();
+    EXPECT_EQ(this->ExpectedResult(), result);
+}
+
+#pragma mark FILTER_KRUSKAL
+
+TEST_F(TestFilterKruskalGrid, BaseCaseSizes) {
+    for (Types::count baseCaseSize : {0, 1, 2, 16, 100000}) {
+        FilterKruskal<TGraph> kruskal(graph_, PrivateIdBasedComparator(graph_));
+        kruskal.BaseCaseSize() = baseCaseSize;
+        kruskal.Run();
+        EXPECT_EQ(ExpectedResult(), kruskal.Result()) << "base case size " << baseCaseSize;
+    }
+}
+
+TEST_F(TestSpanningTreeEqualWeights, FilterKruskal) {
+    for (Types::count baseCaseSize : {1, 8, 1024}) {
+        FilterKruskal<TGraph> kruskal(graph_, PrivateIdBasedComparator(graph_));
+        kruskal.BaseCaseSize() = baseCaseSize;
+        kruskal.Run();
+        ExpectSpanningTreeOfWeightZero(kruskal.Result());
+    }
+}
+
+#pragma mark BORUVKA
+
+TEST_F(TestSpanningTreeEqualWeights, Boruvka) {
+    Boruvka<TGraph> boruvka(graph_, PrivateIdBasedComparator(graph_));
+    boruvka.Run();
+    ExpectSpanningTreeOfWeightZero(boruvka.Result());
+}
+
+TEST(TestBoruvka, SpanningForest) {
+    TGraph graph;
+    for (Types::count counter = 0; counter < 6; ++counter) {
+        graph.AddVertex(MinimalProperties(counter));
+    }
+    graph.AddEdge(0, 1, MinimalProperties(3));
+    graph.AddEdge(1, 2, MinimalProperties(1));
+    graph.AddEdge(2, 0, MinimalProperties(2));
+    graph.AddEdge(3, 3, MinimalProperties(0));
+    graph.AddEdge(4, 3, MinimalProperties(7));
+    graph.AddEdge(3, 4, MinimalProperties(5));
+
+    Boruvka<TGraph> boruvka(graph, PrivateIdBasedComparator(graph));
+    boruvka.Run();
+
+    Subgraph<TGraph> expectedResult(&graph, {0, 1, 2, 3, 4, 5}, {1, 2, 5});
+    EXPECT_EQ(expectedResult, boruvka.Result());
+}
+
+#pragma mark PROPERTY_COLUMNS
+
+TEST_F(TestSpanningTreePropertyColumns, BoruvkaKeepsPropertyColumns) {
+    Boruvka<TElectricalGraph> boruvka(graph_, Comparator());
+    boruvka.Run();
+    EXPECT_EQ(graph_.NumberOfVertices() - 1, boruvka.Result().Edges().size());
+    EXPECT_TRUE(graph_.HasPropertyColumns());
+}
+
+TEST_F(TestSpanningTreePropertyColumns, FilterKruskalKeepsPropertyColumns) {
+    FilterKruskal<TElectricalGraph> kruskal(graph_, Comparator());
+    kruskal.Run();
+    EXPECT_EQ(graph_.NumberOfVertices() - 1, kruskal.Result().Edges().size());
+    EXPECT_TRUE(graph_.HasPropertyColumns());
+}
+
 } // namespace egoa::test
@@ -11,15 +11,24 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
 #include "Auxiliary/Comparators.hpp"
 #include "Auxiliary/Types.hpp"
 
+#include "Algorithms/SpanningTree/Boruvka.hpp"
+#include "Algorithms/SpanningTree/FilterKruskal.hpp"
 #include "Algorithms/SpanningTree/Kruskal.hpp"
 #include "Algorithms/SpanningTree/Prim.hpp"
 
+#include "DataStructures/Container/Queues/MappingDaryHeap.hpp"
+#include "DataStructures/Container/Queues/PairingHeap.hpp"
+
 #include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Graphs/Vertices/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
 
 #include "Helper/TestHelper.hpp"
 
@@ -100,14 +109,181 @@ protected:
     TAlgorithm algo_{graph_, PrivateIdBasedComparator(graph_)};
 };
 
+/**
+ * @brief      A grid of buses with distinct edge weights and a bus with a
+ *             self-loop that is connected to the grid by two parallel edges.
+ *
+ * @details    The grid has more edges than the default base case of
+ *             FilterKruskal. The expected spanning forest is computed by a
+ *             straightforward Kruskal's algorithm.
+ *
+ * @tparam     AlgorithmType  The type of the algorithm under test.
+ */
+template<typename AlgorithmType>
+class TestSpanningTreeGrid : public ::testing::Test {
+protected:
+    using TAlgorithm = AlgorithmType;
+
+    TestSpanningTreeGrid() {
+        for (Types::count counter = 0; counter < numberOfRows_ * numberOfColumns_ + 1; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        for (Types::index row = 0; row < numberOfRows_; ++row) {
+            for (Types::index column = 0; column < numberOfColumns_; ++column) {
+                Types::vertexId const vertex = row * numberOfColumns_ + column;
+                if (column + 1 < numberOfColumns_) {
+                    AddEdge(vertex, vertex + 1);
+                }
+                if (row + 1 < numberOfRows_) {
+                    AddEdge(vertex + numberOfColumns_, vertex);
+                }
+            }
+        }
+        Types::vertexId const bus = numberOfRows_ * numberOfColumns_;
+        AddEdge(bus, bus);
+        AddEdge(0, bus);
+        AddEdge(bus, 0);
+    }
+
+    void AddEdge(Types::vertexId source, Types::vertexId target) {
+        // Distinct pseudo-random weights, since 7919 and 100003 are coprime
+        Types::count const weight = (graph_.NumberOfEdges() * 7919) % 100003;
+        graph_.AddEdge(source, target, MinimalProperties(weight));
+    }
+
+    Subgraph<TGraph> ExpectedResult() {
+        std::vector<Types::edgeId> edges(graph_.NumberOfEdges());
+        std::iota(edges.begin(), edges.end(), 0);
+        std::sort(edges.begin(), edges.end(), PrivateIdBasedComparator(graph_));
+
+        std::vector<Types::vertexId> component(graph_.NumberOfVertices());
+        std::iota(component.begin(), component.end(), 0);
+        std::vector<Types::edgeId> spanningTreeEdges;
+        for (Types::edgeId edge : edges) {
+            Types::vertexId const source = component[graph_.EdgeAt(edge).Source()];
+            Types::vertexId const target = component[graph_.EdgeAt(edge).Target()];
+            if (source == target) continue;
+            std::replace(component.begin(), component.end(), source, target);
+            spanningTreeEdges.push_back(edge);
+        }
+
+        std::vector<Types::vertexId> vertices(graph_.NumberOfVertices());
+        std::iota(vertices.begin(), vertices.end(), 0);
+        return Subgraph<TGraph>(&graph_, vertices, spanningTreeEdges);
+    }
+
+    TGraph graph_;
+    Types::count const numberOfRows_ = 40;
+    Types::count const numberOfColumns_ = 50;
+    TAlgorithm algo_{graph_, PrivateIdBasedComparator(graph_)};
+};
+
+using TestFilterKruskalGrid = TestSpanningTreeGrid<FilterKruskal<TGraph>>;
+
+/**
+ * @brief      A complete graph, in which all edges from even vertices have
+ *             the weight 0 and all other edges have the weight 1.
+ */
+class TestSpanningTreeEqualWeights : public ::testing::Test {
+protected:
+    TestSpanningTreeEqualWeights() {
+        for (Types::count counter = 0; counter < numberOfVertices_; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        for (Types::vertexId source = 0; source < numberOfVertices_; ++source) {
+            for (Types::vertexId target = source + 1; target < numberOfVertices_; ++target) {
+                graph_.AddEdge(source, target, MinimalProperties(source % 2));
+            }
+        }
+    }
+
+    /**
+     * @brief      Expects a spanning tree that contains only edges with the
+     *             weight 0.
+     */
+    void ExpectSpanningTreeOfWeightZero(Subgraph<TGraph> const & result) const {
+        ASSERT_EQ(numberOfVertices_ - 1, result.Edges().size());
+
+        std::vector<Types::vertexId> component(numberOfVertices_);
+        std::iota(component.begin(), component.end(), 0);
+        for (Types::edgeId edge : result.Edges()) {
+            EXPECT_EQ(0, graph_.EdgeAt(edge).Properties().PrivateId());
+            Types::vertexId const source = component[graph_.EdgeAt(edge).Source()];
+            Types::vertexId const target = component[graph_.EdgeAt(edge).Target()];
+            ASSERT_NE(source, target);
+            std::replace(component.begin(), component.end(), source, target);
+        }
+    }
+
+    TGraph graph_;
+    Types::count const numberOfVertices_ = 40;
+};
+
+using TEdgeComparator = std::function<bool(Types::edgeId, Types::edgeId)>;
+
+/**
+ * @brief      A grid of buses with property columns, whose edges are
+ *             ordered by their reactance.
+ *
+ * @details    The grid is large enough that the algorithms read the edges
+ *             from several threads if OpenMP is available.
+ */
+class TestSpanningTreePropertyColumns : public ::testing::Test {
+protected:
+    using TElectricalGraph = StaticGraph<Vertices::ElectricalProperties<>, Edges::ElectricalProperties>;
+
+    TestSpanningTreePropertyColumns() {
+        for (Types::count counter = 0; counter < numberOfRows_ * numberOfColumns_; ++counter) {
+            graph_.AddVertex(Vertices::ElectricalProperties<>());
+        }
+        for (Types::index row = 0; row < numberOfRows_; ++row) {
+            for (Types::index column = 0; column < numberOfColumns_; ++column) {
+                Types::vertexId const vertex = row * numberOfColumns_ + column;
+                if (column + 1 < numberOfColumns_) {
+                    AddEdge(vertex, vertex + 1);
+                }
+                if (row + 1 < numberOfRows_) {
+                    AddEdge(vertex + numberOfColumns_, vertex);
+                }
+            }
+        }
+        graph_.BuildPropertyColumns();
+    }
+
+    void AddEdge(Types::vertexId source, Types::vertexId target) {
+        Edges::ElectricalProperties edge;
+        edge.Reactance() = 1 + (graph_.NumberOfEdges() * 7919) % 100003;
+        graph_.AddEdge(source, target, edge);
+    }
+
+    TEdgeComparator Comparator() const {
+        TElectricalGraph const & graph = graph_;
+        return [&graph](Types::edgeId lhs, Types::edgeId rhs) {
+            return graph.EdgeAt(lhs).Properties().Reactance()
+                 < graph.EdgeAt(rhs).Properties().Reactance();
+        };
+    }
+
+    TElectricalGraph graph_;
+    Types::count const numberOfRows_ = 200;
+    Types::count const numberOfColumns_ = 200;
+};
+
+
 using AlgorithmTypes = ::testing::Types<
                           egoa::Kruskal<TGraph>,
-                          egoa::Prim<TGraph>
+                          egoa::FilterKruskal<TGraph>,
+                          egoa::Boruvka<TGraph>,
+                          egoa::Prim<TGraph>,
+                          egoa::Prim<TGraph, MappingDaryHeap<Types::vertexId, Types::edgeId, 4, TEdgeComparator>>,
+                          egoa::Prim<TGraph, PairingHeap<Types::vertexId, Types::edgeId, TEdgeComparator>>,
+                          egoa::Prim<TGraph, MappingDaryHeap<Types::vertexId, Types::edgeId, 4, PrivateIdBasedComparator<TGraph>>>
                         >;
 
 TYPED_TEST_SUITE(TestSpanningTreeEmpty, AlgorithmTypes);
 TYPED_TEST_SUITE(TestSpanningTreeTriangle, AlgorithmTypes);
 TYPED_TEST_SUITE(TestSpanningTreeFiveVertexGraph, AlgorithmTypes);
+TYPED_TEST_SUITE(TestSpanningTreeGrid, AlgorithmTypes);
 
 } // namespace egoa::test
 
@@ -0,0 +1,182 @@
+/*
+ * TestConcurrentUnionFind.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestConcurrentUnionFind.hpp"
+
+using ::testing::Eq;
+using ::testing::Le;
+
+namespace egoa::test {
+
+#pragma mark FIND_AND_UNION
+
+TEST_F ( TestConcurrentUnionFind, IsSingletonsWhenCreated )
+{
+    EXPECT_THAT ( unionFind_.NumberOfVertices(),   Eq(numberOfVertices_) );
+    EXPECT_THAT ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_) );
+    for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        EXPECT_THAT ( unionFind_.Find ( vertex ), Eq(vertex) );
+        EXPECT_THAT ( unionFind_.Rank ( vertex ), Eq(0) );
+    }
+    EXPECT_FALSE ( unionFind_.InSameComponent ( 0, 1 ) );
+    EXPECT_TRUE  ( unionFind_.InSameComponent ( 1, 1 ) );
+}
+
+TEST_F ( TestConcurrentUnionFind, UnionByRank )
+{
+    EXPECT_TRUE  ( unionFind_.Union ( 3, 2 ) );
+    EXPECT_FALSE ( unionFind_.Union ( 2, 3 ) );
+    EXPECT_TRUE  ( unionFind_.InSameComponent ( 2, 3 ) );
+    EXPECT_THAT  ( unionFind_.Find ( 2 ), Eq(3) );
+    EXPECT_THAT  ( unionFind_.Rank ( 3 ), Eq(1) );
+
+    // The root with the smaller rank is linked below the other root
+    EXPECT_TRUE  ( unionFind_.Union ( 2, 7 ) );
+    EXPECT_THAT  ( unionFind_.Find ( 7 ), Eq(3) );
+    EXPECT_THAT  ( unionFind_.Rank ( 3 ), Eq(1) );
+    EXPECT_THAT  ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_ - 2) );
+}
+
+TEST_F ( TestConcurrentUnionFind, PathOfUnionsIsShallow )
+{
+    for ( Types::vertexId vertex = 0; vertex + 1 < numberOfVertices_; ++vertex )
+    {
+        EXPECT_TRUE ( unionFind_.Union ( vertex, vertex + 1 ) );
+    }
+    EXPECT_THAT ( unionFind_.NumberOfComponents(), Eq(1) );
+
+    // With union by rank, a rank of r requires 2^r vertices
+    for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        EXPECT_THAT ( unionFind_.Rank ( vertex ), Le(9) );
+        EXPECT_TRUE ( unionFind_.InSameComponent ( 0, vertex ) );
+    }
+}
+
+TEST_F ( TestConcurrentUnionFind, FindHalvesPaths )
+{
+    // Balanced unions build a tree of height 3
+    for ( Types::vertexId step = 1; step < 8; step *= 2 )
+    {
+        for ( Types::vertexId vertex = 0; vertex < 8; vertex += 2 * step )
+        {
+            unionFind_.Union ( vertex, vertex + step );
+        }
+    }
+    Types::vertexId const root = unionFind_.Find ( 0 );
+    EXPECT_THAT ( unionFind_.Rank ( root ), Eq(3) );
+
+    for ( Types::vertexId vertex = 0; vertex < 8; ++vertex )
+    {
+        unionFind_.Find ( vertex );
+        unionFind_.Find ( vertex );
+        Types::vertexId const parent = unionFind_.Parent ( vertex );
+        EXPECT_TRUE ( parent == root || unionFind_.Parent ( parent ) == root );
+    }
+}
+
+#pragma mark BATCH_OPERATIONS
+
+TEST_F ( TestConcurrentUnionFindRandomEdges, BatchUnion )
+{
+    EXPECT_THAT ( unionFind_.Union ( edges_ ), Eq(numberOfMerges_) );
+    EXPECT_THAT ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_ - numberOfMerges_) );
+    ExpectExpectedComponents();
+
+    EXPECT_THAT ( unionFind_.Union ( edges_ ), Eq(0) );
+}
+
+TEST_F ( TestConcurrentUnionFindRandomEdges, BatchFind )
+{
+    unionFind_.Union ( edges_ );
+
+    std::vector<Types::vertexId> const vertices = { 5, 5, 999, 0 };
+    std::vector<Types::vertexId> roots;
+    unionFind_.Find ( vertices, roots );
+    ASSERT_THAT ( roots.size(), Eq(4) );
+    for ( Types::index index = 0; index < vertices.size(); ++index )
+    {
+        EXPECT_THAT ( roots[index], Eq(unionFind_.Find ( vertices[index] )) );
+    }
+
+    unionFind_.Find ( std::vector<Types::vertexId>{}, roots );
+    EXPECT_TRUE ( roots.empty() );
+}
+
+#pragma mark UNDO_LOG
+
+TEST_F ( TestConcurrentUnionFind, RollbackToCheckpoint )
+{
+    unionFind_.Union ( 0, 1 );
+    EXPECT_FALSE ( unionFind_.IsLogging() );
+
+    Types::index const first = unionFind_.Checkpoint();
+    EXPECT_TRUE ( unionFind_.IsLogging() );
+    unionFind_.Union ( 1, 2 );
+    unionFind_.Union ( 3, 4 );
+
+    Types::index const second = unionFind_.Checkpoint();
+    unionFind_.Union ( 4, 0 );
+    unionFind_.Union ( 5, 6 );
+    EXPECT_TRUE ( unionFind_.InSameComponent ( 3, 2 ) );
+    EXPECT_THAT ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_ - 5) );
+
+    unionFind_.Rollback ( second );
+    EXPECT_FALSE ( unionFind_.InSameComponent ( 3, 2 ) );
+    EXPECT_FALSE ( unionFind_.InSameComponent ( 5, 6 ) );
+    EXPECT_TRUE  ( unionFind_.InSameComponent ( 3, 4 ) );
+    EXPECT_TRUE  ( unionFind_.InSameComponent ( 0, 2 ) );
+    EXPECT_THAT  ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_ - 3) );
+
+    unionFind_.Rollback ( first );
+    EXPECT_FALSE ( unionFind_.InSameComponent ( 1, 2 ) );
+    EXPECT_FALSE ( unionFind_.InSameComponent ( 3, 4 ) );
+    EXPECT_TRUE  ( unionFind_.InSameComponent ( 0, 1 ) );
+    EXPECT_THAT  ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_ - 1) );
+    for ( Types::vertexId vertex = 2; vertex < 7; ++vertex )
+    {
+        EXPECT_THAT ( unionFind_.Parent ( vertex ), Eq(vertex) );
+        EXPECT_THAT ( unionFind_.Rank ( vertex ),   Eq(0) );
+    }
+}
+
+TEST_F ( TestConcurrentUnionFind, CommitKeepsUnions )
+{
+    unionFind_.Checkpoint();
+    unionFind_.Union ( 0, 1 );
+    unionFind_.Commit();
+    EXPECT_FALSE ( unionFind_.IsLogging() );
+
+    Types::index const checkpoint = unionFind_.Checkpoint();
+    EXPECT_THAT ( checkpoint, Eq(0) );
+    unionFind_.Rollback ( checkpoint );
+    EXPECT_TRUE ( unionFind_.InSameComponent ( 0, 1 ) );
+}
+
+TEST_F ( TestConcurrentUnionFindRandomEdges, RollbackBatchUnion )
+{
+    std::vector<Types::vertexId> parents;
+    for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        parents.push_back ( unionFind_.Parent ( vertex ) );
+    }
+
+    Types::index const checkpoint = unionFind_.Checkpoint();
+    EXPECT_THAT ( unionFind_.Union ( edges_ ), Eq(numberOfMerges_) );
+    ExpectExpectedComponents();
+
+    unionFind_.Rollback ( checkpoint );
+    EXPECT_THAT ( unionFind_.NumberOfComponents(), Eq(numberOfVertices_) );
+    for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        EXPECT_THAT ( unionFind_.Parent ( vertex ), Eq(parents[vertex]) );
+        EXPECT_THAT ( unionFind_.Rank ( vertex ),   Eq(0) );
+    }
+}
+
+} // namespace egoa::test
@@ -0,0 +1,99 @@
+/*
+ * TestConcurrentUnionFind.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_CONCURRENT_UNION_FIND_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_CONCURRENT_UNION_FIND_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Container/ConcurrentUnionFind.hpp"
+#include "DataStructures/Container/UnionFind.hpp"
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+namespace egoa::test {
+
+class TestConcurrentUnionFind : public ::testing::Test {
+    protected:
+        using TEdges = std::vector<std::pair<Types::vertexId, Types::vertexId>>;
+
+        Types::count const  numberOfVertices_ = 1000;
+        ConcurrentUnionFind unionFind_{ numberOfVertices_ };
+};
+
+/**
+ * @brief      Fixture with random edges, whose components are known from
+ *             the sequential UnionFind.
+ */
+class TestConcurrentUnionFindRandomEdges : public TestConcurrentUnionFind {
+    protected:
+        void SetUp () override
+        {
+            std::mt19937_64 generator ( 42 );
+            std::uniform_int_distribution<Types::vertexId> vertexDistribution ( 0, numberOfVertices_ - 1 );
+
+            UnionFind unionFind ( numberOfVertices_ );
+            for ( Types::count counter = 0; counter < 700; ++counter )
+            {
+                Types::vertexId const source = vertexDistribution ( generator );
+                Types::vertexId const target = vertexDistribution ( generator );
+                edges_.emplace_back ( source, target );
+                if ( !unionFind.InSameComponent ( source, target ) )
+                {
+                    unionFind.Union ( source, target );
+                    ++numberOfMerges_;
+                }
+            }
+            for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+            {
+                expectedRoots_.push_back ( unionFind.Find ( vertex ) );
+            }
+        }
+
+        /**
+         * @brief      Expects that two vertices are in the same component
+         *             if and only if they are in the same expected
+         *             component.
+         */
+        void ExpectExpectedComponents ()
+        {
+            std::vector<Types::vertexId> vertices;
+            for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+            {
+                vertices.push_back ( vertex );
+            }
+            std::vector<Types::vertexId> roots;
+            unionFind_.Find ( vertices, roots );
+            ASSERT_EQ ( numberOfVertices_, roots.size() );
+
+            std::vector<Types::vertexId> rootOfExpectedRoot ( numberOfVertices_, Const::NONE );
+            std::vector<Types::vertexId> expectedRootOfRoot ( numberOfVertices_, Const::NONE );
+            for ( Types::vertexId vertex = 0; vertex < numberOfVertices_; ++vertex )
+            {
+                Types::vertexId & root         = rootOfExpectedRoot[expectedRoots_[vertex]];
+                Types::vertexId & expectedRoot = expectedRootOfRoot[roots[vertex]];
+                if ( root == Const::NONE )         root = roots[vertex];
+                if ( expectedRoot == Const::NONE ) expectedRoot = expectedRoots_[vertex];
+                EXPECT_EQ ( root, roots[vertex] );
+                EXPECT_EQ ( expectedRoot, expectedRoots_[vertex] );
+            }
+        }
+
+        TEdges                          edges_;
+        Types::count                    numberOfMerges_ = 0;
+        std::vector<Types::vertexId>    expectedRoots_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_CONCURRENT_UNION_FIND_HPP
@@ -0,0 +1,88 @@
+/*
+ * TestDenseIndexMap.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestDenseIndexMap.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+using ::testing::Eq;
+
+namespace egoa::test {
+
+TEST_F ( TestDenseIndexMap, IsEmptyWhenCreated )
+{
+    EXPECT_TRUE ( map_.empty() );
+    EXPECT_THAT ( map_.size(), Eq(0) );
+    EXPECT_THAT ( map_.count(0), Eq(0) );
+    EXPECT_THROW ( mapConst_.at(0), std::out_of_range );
+}
+
+TEST_F ( TestDenseIndexMap, InsertAndErase )
+{
+    map_[7] = 3;
+    map_[2] = 5;
+    map_[7] = 4;
+    EXPECT_THAT ( map_.size(), Eq(2) );
+    EXPECT_THAT ( mapConst_.at(7), Eq(4) );
+    EXPECT_THAT ( mapConst_.at(2), Eq(5) );
+    EXPECT_THAT ( map_.count(3), Eq(0) );
+    EXPECT_THROW ( mapConst_.at(3), std::out_of_range );
+
+    EXPECT_THAT ( map_.erase(7), Eq(1) );
+    EXPECT_THAT ( map_.erase(7), Eq(0) );
+    EXPECT_THAT ( map_.count(7), Eq(0) );
+    EXPECT_THAT ( map_.size(), Eq(1) );
+
+    // A key that is inserted again starts with a default value
+    EXPECT_THAT ( map_[7], Eq(0) );
+}
+
+TEST_F ( TestDenseIndexMap, ClearStartsNewGeneration )
+{
+    for ( Types::vertexId key = 0; key < 100; ++key )
+    {
+        map_[key] = key + 1;
+    }
+    map_.clear();
+    EXPECT_TRUE ( map_.empty() );
+    for ( Types::vertexId key = 0; key < 100; ++key )
+    {
+        EXPECT_THAT ( map_.count(key), Eq(0) );
+    }
+
+    map_[42] = 1;
+    EXPECT_THAT ( map_.size(), Eq(1) );
+    EXPECT_THAT ( mapConst_.at(42), Eq(1) );
+    EXPECT_THAT ( map_.count(41), Eq(0) );
+}
+
+TEST ( TestMappingBinaryHeapMapType, DefaultForIdentifiersIsDense )
+{
+    using TVertexHeap = MappingBinaryHeap<Types::vertexId, Types::real>;
+    using TRealHeap   = MappingBinaryHeap<Types::integer,  Types::real>;
+    EXPECT_TRUE ( ( std::is_same<TVertexHeap::TMap, DenseIndexMap<Types::vertexId>>::value ) );
+    EXPECT_TRUE ( ( std::is_same<TRealHeap::TMap, std::unordered_map<Types::integer, Types::index>>::value ) );
+
+    TVertexHeap heap;
+    heap.Insert ( 5, 2.0 );
+    heap.Insert ( 1, 3.0 );
+    heap.Insert ( 9, 1.0 );
+    heap.ChangeKey ( 1, 0.5 );
+    EXPECT_TRUE  ( heap.HasKeyOf ( 9 ) );
+    EXPECT_FALSE ( heap.HasKeyOf ( 2 ) );
+    EXPECT_THAT ( heap.DeleteTop().first, Eq(1) );
+    EXPECT_THAT ( heap.DeleteTop().first, Eq(9) );
+
+    heap.Clear();
+    EXPECT_FALSE ( heap.HasKeyOf ( 5 ) );
+    heap.Insert ( 5, 7.0 );
+    EXPECT_THAT ( heap.KeyOf ( 5 ), Eq(7.0) );
+}
+
+} // namespace egoa::test
@@ -0,0 +1,31 @@
+/*
+ * TestDenseIndexMap.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_DENSE_INDEX_MAP_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_DENSE_INDEX_MAP_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Container/DenseIndexMap.hpp"
+#include "DataStructures/Container/Queues/MappingBinaryHeap.hpp"
+
+#include "Auxiliary/Types.hpp"
+
+namespace egoa::test {
+
+class TestDenseIndexMap : public ::testing::Test {
+    protected:
+        using TMap = DenseIndexMap<Types::vertexId>;
+
+        TMap         map_;
+        TMap const & mapConst_ = map_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_DENSE_INDEX_MAP_HPP
@@ -0,0 +1,176 @@
+/*
+ * TestMappingHeaps.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestMappingHeaps.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using ::testing::Eq;
+
+namespace egoa::test {
+
+TYPED_TEST ( TestMappingHeaps, IsEmptyWhenCreated )
+{
+    EXPECT_TRUE ( this->heap_.Empty() );
+    EXPECT_THAT ( this->heap_.Size(), Eq(0) );
+    EXPECT_FALSE ( this->heap_.HasKeyOf ( 3 ) );
+}
+
+TYPED_TEST ( TestMappingHeaps, InsertAndDeleteTop )
+{
+    std::vector<Types::real> keys = { 6.5, 3.0, 5.0, 2.25, 7.0, 9.0, 1.0, 3.0, 0.0 };
+    for ( Types::vertexId element = 0; element < keys.size(); ++element )
+    {
+        this->heap_.Insert ( element, keys[element] );
+    }
+    EXPECT_THAT ( this->heap_.Size(), Eq(keys.size()) );
+    EXPECT_TRUE ( this->heap_.HasKeyOf ( 8 ) );
+    EXPECT_FALSE ( this->heap_.HasKeyOf ( 9 ) );
+    EXPECT_THAT ( this->heap_.KeyOf ( 4 ), Eq(7.0) );
+
+    auto top = this->heap_.DeleteTop();
+    EXPECT_THAT ( top.first,  Eq(8) );
+    EXPECT_THAT ( top.second, Eq(0.0) );
+    EXPECT_FALSE ( this->heap_.HasKeyOf ( 8 ) );
+
+    std::vector<Types::real> result = this->DeleteAll();
+    std::sort ( keys.begin(), keys.end() );
+    keys.erase ( keys.begin() );
+    EXPECT_EQ ( keys, result );
+}
+
+TYPED_TEST ( TestMappingHeaps, ChangeKey )
+{
+    for ( Types::vertexId element = 0; element < 10; ++element )
+    {
+        this->heap_.Emplace ( element, 10.0 + element );
+    }
+    this->heap_.ChangeKey ( 7, 1.0 );
+    this->heap_.ChangeKey ( 2, 30.0 );
+    this->heap_.ChangeKey ( 9, 1.5 );
+    EXPECT_THAT ( this->heap_.KeyOf ( 2 ), Eq(30.0) );
+
+    EXPECT_THAT ( this->heap_.DeleteTop().first, Eq(7) );
+    EXPECT_THAT ( this->heap_.DeleteTop().first, Eq(9) );
+
+    this->heap_.ChangeKey ( 5, 2.0 );
+    EXPECT_THAT ( this->heap_.DeleteTop().first, Eq(5) );
+
+    std::vector<Types::real> result = this->DeleteAll();
+    EXPECT_THAT ( result.size(), Eq(7) );
+    EXPECT_THAT ( result.back(), Eq(30.0) );
+}
+
+TYPED_TEST ( TestMappingHeaps, Delete )
+{
+    for ( Types::vertexId element = 0; element < 6; ++element )
+    {
+        this->heap_.Insert ( element, 1.0 * element );
+    }
+    auto deleted = this->heap_.Delete ( 3 );
+    EXPECT_THAT ( deleted.first,  Eq(3) );
+    EXPECT_THAT ( deleted.second, Eq(3.0) );
+    deleted = this->heap_.Delete ( 0 );
+    EXPECT_THAT ( deleted.first,  Eq(0) );
+    EXPECT_FALSE ( this->heap_.HasKeyOf ( 3 ) );
+
+    std::vector<Types::real> expected = { 1.0, 2.0, 4.0, 5.0 };
+    EXPECT_EQ ( expected, this->DeleteAll() );
+}
+
+TYPED_TEST ( TestMappingHeaps, ClearAndReuse )
+{
+    for ( Types::vertexId element = 0; element < 20; ++element )
+    {
+        this->heap_.Insert ( element, 20.0 - element );
+    }
+    this->heap_.DeleteTop();
+    this->heap_.Clear();
+    EXPECT_TRUE ( this->heap_.Empty() );
+    for ( Types::vertexId element = 0; element < 20; ++element )
+    {
+        EXPECT_FALSE ( this->heap_.HasKeyOf ( element ) );
+    }
+
+    // After clearing, smaller keys than before are allowed again
+    this->heap_.Insert ( 4, 0.5 );
+    this->heap_.Insert ( 2, 0.25 );
+    EXPECT_THAT ( this->heap_.DeleteTop().first, Eq(2) );
+    EXPECT_THAT ( this->heap_.DeleteTop().first, Eq(4) );
+}
+
+TYPED_TEST ( TestMappingHeaps, MonotoneSequenceAsMappingBinaryHeap )
+{ // The access pattern of Dijkstra's algorithm
+    MappingBinaryHeap<Types::vertexId, Types::real> reference;
+    std::mt19937 generator ( 42 );
+    std::uniform_real_distribution<Types::real> weight ( 0.0, 10.0 );
+    std::uniform_int_distribution<Types::vertexId> vertex ( 0, 199 );
+
+    std::vector<bool> isDeleted ( 200, false );
+    this->heap_.Insert ( 0, 0.0 );
+    reference.Insert ( 0, 0.0 );
+    while ( !reference.Empty() )
+    {
+        ASSERT_THAT ( this->heap_.Size(), Eq(reference.Size()) );
+        auto const expected = reference.DeleteTop();
+        auto const result   = this->heap_.DeleteTop();
+        ASSERT_THAT ( result.second, Eq(expected.second) );
+        isDeleted[result.first] = true;
+
+        for ( Types::count counter = 0; counter < 5; ++counter )
+        {
+            Types::vertexId const neighbor = vertex ( generator );
+            Types::real     const key      = result.second + weight ( generator );
+            if ( isDeleted[neighbor] ) continue;
+            if ( !reference.HasKeyOf ( neighbor ) )
+            {
+                EXPECT_FALSE ( this->heap_.HasKeyOf ( neighbor ) );
+                reference.Insert   ( neighbor, key );
+                this->heap_.Insert ( neighbor, key );
+            } else if ( key < reference.KeyOf ( neighbor ) )
+            {
+                EXPECT_THAT ( this->heap_.KeyOf ( neighbor ), Eq(reference.KeyOf ( neighbor )) );
+                reference.ChangeKey   ( neighbor, key );
+                this->heap_.ChangeKey ( neighbor, key );
+            }
+        }
+    }
+    EXPECT_TRUE ( this->heap_.Empty() );
+}
+
+TEST ( TestMappingDaryHeap, ComparatorAtCompileTime )
+{
+    MappingDaryHeap<Types::vertexId, Types::integer, 3, std::greater<Types::integer>> heap;
+    for ( Types::vertexId element = 0; element < 10; ++element )
+    {
+        heap.Insert ( element, element % 4 );
+    }
+    EXPECT_THAT ( heap.TopKey(), Eq(3) );
+    heap.ChangeKey ( 0, 5 );
+    EXPECT_THAT ( heap.TopElement(), Eq(0) );
+    EXPECT_THAT ( heap.Top().second, Eq(5) );
+}
+
+TEST ( TestRadixHeap, SmallerKeysAreDeletedNext )
+{
+    RadixHeap<Types::vertexId, Types::real> heap;
+    heap.Insert ( 0, 4.0 );
+    heap.Insert ( 1, 6.0 );
+    EXPECT_THAT ( heap.DeleteTop().first, Eq(0) );
+
+    // A key below the last deleted one is treated as equal to it
+    heap.Insert ( 2, 1.0 );
+    heap.Insert ( 3, 5.0 );
+    EXPECT_THAT ( heap.KeyOf ( 2 ), Eq(1.0) );
+    EXPECT_THAT ( heap.DeleteTop().first, Eq(2) );
+    EXPECT_THAT ( heap.DeleteTop().first, Eq(3) );
+    EXPECT_THAT ( heap.DeleteTop().first, Eq(1) );
+}
+
+} // namespace egoa::test
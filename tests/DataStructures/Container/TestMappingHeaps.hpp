@@ -0,0 +1,74 @@
+/*
+ * TestMappingHeaps.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_MAPPING_HEAPS_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_MAPPING_HEAPS_HPP
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Container/Queues/MappingBinaryHeap.hpp"
+#include "DataStructures/Container/Queues/MappingDaryHeap.hpp"
+#include "DataStructures/Container/Queues/PairingHeap.hpp"
+#include "DataStructures/Container/Queues/RadixHeap.hpp"
+
+#include "Auxiliary/Types.hpp"
+
+namespace egoa::test {
+
+/**
+ * @brief      Fixture for testing the heaps that map vertex identifiers to
+ *     keys and can be used as queue of DominatingThetaPath.
+ * @details    Since the RadixHeap is monotone, the keys of all tests never
+ *     fall below the last deleted key.
+ *
+ * @tparam     HeapType  The type of the heap.
+ */
+template<typename HeapType>
+class TestMappingHeaps : public ::testing::Test {
+    protected:
+        using THeap     = HeapType;
+        using TElement  = Types::vertexId;
+        using TKey      = Types::real;
+
+        /**
+         * @brief      Deletes all elements and checks that the keys do not
+         *     decrease.
+         *
+         * @return     The keys in the order of their deletion.
+         */
+        std::vector<TKey> DeleteAll ()
+        {
+            std::vector<TKey> keys;
+            while ( !heap_.Empty() )
+            {
+                TKey const key = heap_.DeleteTop().second;
+                if ( !keys.empty() )
+                {
+                    EXPECT_LE ( keys.back(), key );
+                }
+                keys.push_back ( key );
+            }
+            return keys;
+        }
+
+        THeap heap_;
+};
+
+using MappingHeapTypes = ::testing::Types< MappingDaryHeap<Types::vertexId, Types::real>
+                                         , MappingDaryHeap<Types::vertexId, Types::real, 2>
+                                         , PairingHeap<Types::vertexId, Types::real>
+                                         , RadixHeap<Types::vertexId, Types::real> >;
+
+TYPED_TEST_SUITE(TestMappingHeaps, MappingHeapTypes);
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_MAPPING_HEAPS_HPP
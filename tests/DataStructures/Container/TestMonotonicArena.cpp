@@ -0,0 +1,172 @@
+/*
+ * TestMonotonicArena.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestMonotonicArena.hpp"
+#include "Helper/TestHelper.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+using ::testing::Eq;
+
+namespace egoa::test {
+
+TEST_F ( TestMonotonicArena, IsEmptyWhenCreated )
+{
+    EXPECT_THAT ( arena_.NumberOfChunks(), Eq(0) );
+    EXPECT_THAT ( arena_.Capacity(),       Eq(0) );
+    EXPECT_THAT ( MonotonicArena::Current(), Eq(nullptr) );
+}
+
+TEST_F ( TestMonotonicArena, AllocateRespectsAlignment )
+{
+    arena_.Allocate ( 1, 1 );
+    void * pointer = arena_.Allocate ( 24, 16 );
+    EXPECT_THAT ( reinterpret_cast<std::uintptr_t>( pointer ) % 16, Eq(0) );
+    EXPECT_THAT ( arena_.NumberOfChunks(), Eq(1) );
+}
+
+TEST_F ( TestMonotonicArena, AllocateLargerThanChunk )
+{
+    arena_.Allocate ( 1000 );
+    EXPECT_THAT ( arena_.NumberOfChunks(), Eq(1) );
+    EXPECT_GE   ( arena_.Capacity(), 1000 );
+}
+
+TEST_F ( TestMonotonicArena, ResetReusesChunks )
+{
+    void * first = arena_.Allocate ( 100 );
+    for ( Types::count counter = 0; counter < 20; ++counter )
+    {
+        arena_.Allocate ( 100 );
+    }
+    Types::count numberOfChunks = arena_.NumberOfChunks();
+    Types::count capacity       = arena_.Capacity();
+    EXPECT_GT ( numberOfChunks, 1 );
+
+    arena_.Reset();
+    EXPECT_THAT ( arena_.Allocate ( 100 ), Eq(first) );
+    for ( Types::count counter = 0; counter < 20; ++counter )
+    {
+        arena_.Allocate ( 100 );
+    }
+    EXPECT_THAT ( arena_.NumberOfChunks(), Eq(numberOfChunks) );
+    EXPECT_THAT ( arena_.Capacity(),       Eq(capacity) );
+
+    arena_.Release();
+    EXPECT_THAT ( arena_.NumberOfChunks(), Eq(0) );
+}
+
+TEST_F ( TestMonotonicArena, ScopeInstallsCurrentArena )
+{
+    MonotonicArena inner;
+    {
+        MonotonicArena::Scope scope ( arena_ );
+        EXPECT_THAT ( MonotonicArena::Current(), Eq(&arena_) );
+        {
+            MonotonicArena::Scope innerScope ( inner );
+            EXPECT_THAT ( MonotonicArena::Current(), Eq(&inner) );
+        }
+        EXPECT_THAT ( MonotonicArena::Current(), Eq(&arena_) );
+    }
+    EXPECT_THAT ( MonotonicArena::Current(), Eq(nullptr) );
+}
+
+TEST_F ( TestMonotonicArena, AllocatorBindsToCurrentArena )
+{
+    ArenaAllocator<int> heapAllocator;
+    EXPECT_THAT ( heapAllocator.Arena(), Eq(nullptr) );
+
+    MonotonicArena::Scope scope ( arena_ );
+    ArenaAllocator<int> arenaAllocator;
+    EXPECT_THAT ( arenaAllocator.Arena(), Eq(&arena_) );
+    EXPECT_FALSE ( heapAllocator == arenaAllocator );
+    EXPECT_TRUE  ( ArenaAllocator<double>( arenaAllocator ) == arenaAllocator );
+}
+
+TEST_F ( TestMonotonicArena, ContainersUseArena )
+{
+    {
+        MonotonicArena::Scope scope ( arena_ );
+        std::vector<int, ArenaAllocator<int>> numbers;
+        std::unordered_set< Types::vertexId
+                          , std::hash<Types::vertexId>
+                          , std::equal_to<Types::vertexId>
+                          , ArenaAllocator<Types::vertexId> > vertices;
+        for ( int number = 0; number < 100; ++number )
+        {
+            numbers.push_back ( number );
+            vertices.emplace ( number );
+        }
+        EXPECT_THAT ( numbers.size(),   Eq(100) );
+        EXPECT_THAT ( vertices.size(),  Eq(100) );
+        EXPECT_THAT ( vertices.count(42), Eq(1) );
+    }
+    EXPECT_GT ( arena_.NumberOfChunks(), 0 );
+    arena_.Reset();
+}
+
+TEST_F ( TestMonotonicArena, CopyBindsToCurrentArena )
+{
+    std::vector<int, ArenaAllocator<int>> numbers ( { 1, 2, 3 }, ArenaAllocator<int>( &arena_ ) );
+    EXPECT_THAT ( numbers.get_allocator().Arena(), Eq(&arena_) );
+
+    MonotonicArena otherArena;
+    {
+        MonotonicArena::Scope scope ( otherArena );
+        std::vector<int, ArenaAllocator<int>> copy ( numbers );
+        EXPECT_THAT ( copy.get_allocator().Arena(), Eq(&otherArena) );
+        EXPECT_THAT ( copy, Eq(numbers) );
+    }
+}
+
+TEST_F ( TestMonotonicArena, CopyOfHeapContainerOutsideScopeUsesHeap )
+{
+    std::vector<int, ArenaAllocator<int>> numbers ( { 1, 2, 3 } );
+    EXPECT_THAT ( numbers.get_allocator().Arena(), Eq(nullptr) );
+
+    std::vector<int, ArenaAllocator<int>> copy ( numbers );
+    EXPECT_THAT ( copy.get_allocator().Arena(), Eq(nullptr) );
+    EXPECT_THAT ( copy, Eq(numbers) );
+}
+
+TEST_F ( TestMonotonicArena, CopyOfHeapContainerInsideScopeUsesHeap )
+{
+    std::vector<int, ArenaAllocator<int>> numbers ( { 1, 2, 3 } );
+    std::optional<std::vector<int, ArenaAllocator<int>>> copy;
+    {
+        MonotonicArena::Scope scope ( arena_ );
+        copy.emplace ( numbers );
+        EXPECT_THAT ( copy->get_allocator().Arena(), Eq(nullptr) );
+    }
+    arena_.Reset();
+
+    // Overwrite the memory of the arena after the reset
+    {
+        MonotonicArena::Scope scope ( arena_ );
+        std::vector<int, ArenaAllocator<int>> others ( 1024, -1 );
+    }
+    EXPECT_THAT ( *copy, Eq(numbers) );
+}
+
+#ifdef EGOA_ENABLE_ASSERTION
+    TEST_F ( TestMonotonicArena, CopyOfArenaContainerOutsideScopeDeathTest )
+    {
+        std::vector<int, ArenaAllocator<int>> numbers ( { 1, 2, 3 }, ArenaAllocator<int>( &arena_ ) );
+
+        auto assertionString = buildAssertionString ( "ArenaAllocator.hpp"
+                                                    , "ArenaAllocator"
+                                                    , "select_on_container_copy_construction"
+                                                    , R"(arena_ == nullptr .*)");
+        using TNumbers = std::vector<int, ArenaAllocator<int>>;
+        ASSERT_DEATH ( { TNumbers copy ( numbers ); }, assertionString );
+    }
+#endif // EGOA_ENABLE_ASSERTION
+
+} // namespace egoa::test
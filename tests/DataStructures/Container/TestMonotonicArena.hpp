@@ -0,0 +1,35 @@
+/*
+ * TestMonotonicArena.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_MONOTONIC_ARENA_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_MONOTONIC_ARENA_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Container/Allocators/MonotonicArena.hpp"
+#include "DataStructures/Container/Allocators/ArenaAllocator.hpp"
+
+namespace egoa::test {
+
+/**
+ * @brief      Fixture for testing the monotonic arena with a small chunk
+ *     size, so that the tests cover the allocation of further chunks.
+ */
+class TestMonotonicArena : public ::testing::Test {
+    protected:
+        TestMonotonicArena ()
+        : arena_( 256 )
+        {}
+
+    protected:
+        MonotonicArena arena_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_MONOTONIC_ARENA_HPP
@@ -0,0 +1,124 @@
+/*
+ * TestSnapshotMatrix.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestSnapshotMatrix.hpp"
+
+#include <numeric>
+#include <vector>
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+namespace egoa::test {
+
+TEST_F ( TestSnapshotMatrix, IsEmptyWhenCreated )
+{
+    EXPECT_TRUE ( matrix_.Empty() );
+    EXPECT_THAT ( matrix_.NumberOfEntities(),  Eq(0) );
+    EXPECT_THAT ( matrix_.NumberOfSnapshots(), Eq(0) );
+}
+
+TEST_F ( TestSnapshotMatrix, AppendGrowsEntitiesAndSnapshots )
+{
+    matrix_.Resize ( 2 );
+    matrix_.Append ( 0, 1.0 );
+    matrix_.Append ( 0, 2.0 );
+    matrix_.Append ( 0, 3.0 );
+    matrix_.Append ( 1, 4.0 );
+
+    // A new entity is added after snapshots exist
+    matrix_.Resize ( 3 );
+    matrix_.Append ( 2, 5.0 );
+    matrix_.Append ( 2, 6.0 );
+
+    EXPECT_FALSE ( matrix_.Empty() );
+    EXPECT_THAT ( matrix_.NumberOfEntities(),     Eq(3) );
+    EXPECT_THAT ( matrix_.NumberOfSnapshots(),    Eq(3) );
+    EXPECT_THAT ( matrix_.NumberOfSnapshotsOf(0), Eq(3) );
+    EXPECT_THAT ( matrix_.NumberOfSnapshotsOf(1), Eq(1) );
+    EXPECT_THAT ( matrix_.NumberOfSnapshotsOf(2), Eq(2) );
+
+    EXPECT_THAT ( matrixConst_(0, 2), Eq(3.0) );
+    EXPECT_THAT ( matrixConst_(1, 0), Eq(4.0) );
+    EXPECT_THAT ( matrixConst_(2, 1), Eq(6.0) );
+
+    matrix_(1, 0) = 7.0;
+    EXPECT_THAT ( matrixConst_(1, 0), Eq(7.0) );
+}
+
+TEST_F ( TestSnapshotMatrix, SnapshotsAtIsContiguousAndFilled )
+{
+    Types::real const none = static_cast<Types::real>( Const::NONE );
+    matrix_.Resize ( 3 );
+    matrix_.Append ( 0, 1.0 );
+    matrix_.Append ( 0, 2.0 );
+    matrix_.Append ( 2, 3.0 );
+
+    auto row = matrixConst_.SnapshotsAt ( 0 );
+    EXPECT_TRUE ( row.IsContiguous() );
+    EXPECT_THAT ( std::vector<Types::real>( row.begin(), row.end() ), ElementsAre ( 1.0, none, 3.0 ) );
+    EXPECT_THAT ( row.Data() + 1, Eq ( &row[1] ) );
+
+    row = matrixConst_.SnapshotsAt ( 1 );
+    EXPECT_THAT ( std::vector<Types::real>( row.begin(), row.end() ), ElementsAre ( 2.0, none, none ) );
+}
+
+TEST_F ( TestSnapshotMatrix, SnapshotsOfIsStrided )
+{
+    matrix_.Resize ( 4, 8 );
+    for ( Types::index snapshot = 0; snapshot < 10; ++snapshot )
+    {
+        for ( Types::index entity = 0; entity < 4; ++entity )
+        {
+            matrix_.Append ( entity, 10.0 * entity + snapshot );
+        }
+    }
+
+    auto column = matrixConst_.SnapshotsOf ( 2 );
+    EXPECT_THAT ( column.Size(), Eq(10) );
+    EXPECT_FALSE ( column.IsContiguous() );
+    EXPECT_THAT ( column.end() - column.begin(), Eq(10) );
+    EXPECT_THAT ( std::accumulate ( column.begin(), column.end(), 0.0 ), Eq ( 200.0 + 45.0 ) );
+    for ( Types::index snapshot = 0; snapshot < 10; ++snapshot )
+    {
+        EXPECT_THAT ( column[snapshot], Eq ( 20.0 + snapshot ) );
+    }
+
+    // Writes through the view change the matrix
+    for ( auto & value : matrix_.SnapshotsOf ( 3 ) )
+    {
+        value = 0.0;
+    }
+    EXPECT_THAT ( matrixConst_(3, 9), Eq(0.0) );
+    EXPECT_THAT ( matrixConst_(2, 9), Eq(29.0) );
+}
+
+TEST_F ( TestSnapshotMatrix, ShrinkAndClear )
+{
+    Types::real const none = static_cast<Types::real>( Const::NONE );
+    matrix_.Resize ( 2 );
+    matrix_.Append ( 0, 1.0 );
+    matrix_.Append ( 1, 2.0 );
+    matrix_.Append ( 1, 3.0 );
+
+    matrix_.SetNumberOfSnapshotsOf ( 1, 1 );
+    EXPECT_THAT ( matrix_.NumberOfSnapshots(), Eq(1) );
+    matrix_.SetNumberOfSnapshotsOf ( 1, 2 );
+    EXPECT_THAT ( matrixConst_(1, 1), Eq(none) );
+
+    // A removed entity that is added again has no snapshots
+    matrix_.Resize ( 1 );
+    matrix_.Resize ( 2 );
+    EXPECT_THAT ( matrix_.NumberOfSnapshotsOf(1), Eq(0) );
+    EXPECT_THAT ( matrixConst_.SnapshotsAt(0)[1], Eq(none) );
+
+    matrix_.Clear();
+    EXPECT_TRUE ( matrix_.Empty() );
+    EXPECT_THAT ( matrix_.NumberOfEntities(), Eq(0) );
+}
+
+} // namespace egoa::test
@@ -0,0 +1,31 @@
+/*
+ * TestSnapshotMatrix.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_SNAPSHOT_MATRIX_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_SNAPSHOT_MATRIX_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Container/SnapshotMatrix.hpp"
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+namespace egoa::test {
+
+class TestSnapshotMatrix : public ::testing::Test {
+    protected:
+        using TMatrix = SnapshotMatrix<Types::real>;
+
+        TMatrix         matrix_;
+        TMatrix const & matrixConst_ = matrix_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_SNAPSHOT_MATRIX_HPP
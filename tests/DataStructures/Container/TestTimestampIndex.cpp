@@ -0,0 +1,100 @@
+/*
+ * TestTimestampIndex.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestTimestampIndex.hpp"
+
+#include <vector>
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+namespace egoa::test {
+
+TEST_F ( TestTimestampIndex, IsEmptyWhenCreated )
+{
+    std::vector<Types::index> positions;
+    indexConst_.PositionsBetween ( "2013-01-01", "2014-01-01", positions );
+
+    EXPECT_THAT ( indexConst_.Size(), Eq(0) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01 00:00:00" ), Eq(Const::NONE) );
+    EXPECT_THAT ( positions, IsEmpty() );
+}
+
+TEST_F ( TestTimestampIndex, ParsePreservesChronologicalOrder )
+{
+    EXPECT_THAT ( TimestampIndex::Parse ( "now" ),                 Eq(TimestampIndex::NoKey) );
+    EXPECT_THAT ( TimestampIndex::Parse ( "2013-13-01 00:00:00" ), Eq(TimestampIndex::NoKey) );
+    EXPECT_THAT ( TimestampIndex::Parse ( "2013-01-01" )
+                , Eq ( TimestampIndex::Parse ( "2013-01-01 00:00:00" ) ) );
+    EXPECT_THAT ( TimestampIndex::Parse ( "2013-01-01T01:00" )
+                , Eq ( TimestampIndex::Parse ( "2013-01-01 01:00:00" ) ) );
+
+    EXPECT_LT ( TimestampIndex::Parse ( "0000-00-00 00:00:00" ), TimestampIndex::Parse ( "2012-12-31 23:59:59" ) );
+    EXPECT_LT ( TimestampIndex::Parse ( "2012-12-31 23:59:59" ), TimestampIndex::Parse ( "2013-01-01 00:00:00" ) );
+    EXPECT_LT ( TimestampIndex::Parse ( "2013-01-31 00:00:00" ), TimestampIndex::Parse ( "2013-02-01 00:00:00" ) );
+}
+
+TEST_F ( TestTimestampIndex, UnsortedDuplicateAndUnparsedTimestamps )
+{
+    index_.Add ( "2013-01-01 02:00:00", 0 );
+    index_.Add ( "2013-01-01 00:00:00", 1 );
+    index_.Add ( "now",                 2 );
+    index_.Add ( "2013-01-01 01:00:00", 3 );
+    index_.Add ( "2013-01-01 00:00:00", 4 );
+
+    EXPECT_THAT ( indexConst_.Size(), Eq(4) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "now" ),                 Eq(2) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01 00:00:00" ), Eq(1) );
+
+    std::vector<Types::index> positions;
+    indexConst_.PositionsBetween ( "2012-01-01", "2014-01-01", positions );
+    EXPECT_THAT ( positions, ElementsAre ( 1, 3, 0 ) );
+}
+
+TEST_F ( TestTimestampIndex, PositionOfComparesTheString )
+{
+    index_.Add ( "2013-01-01 00:00:00", 0 );
+    index_.Add ( "2013-01-01T01:00",    1 );
+    index_.Add ( "2013-01-01 01:00:00", 2 );
+
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01 00:00:00" ), Eq(0) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01" ),          Eq(Const::NONE) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01T01:00" ),    Eq(1) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01 01:00:00" ), Eq(2) );
+
+    std::vector<Types::index> positions;
+    indexConst_.PositionsBetween ( "2013-01-01", "2013-01-02", positions );
+    EXPECT_THAT ( positions, ElementsAre ( 0, 1 ) );
+}
+
+TEST_F ( TestTimestampIndexOneDay, PositionOf )
+{
+    for ( Types::index position = 0; position < timestamps_.size(); ++position )
+    {
+        EXPECT_THAT ( indexConst_.PositionOf ( timestamps_[position] ), Eq(position) );
+    }
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-01 00:30:00" ), Eq(Const::NONE) );
+    EXPECT_THAT ( indexConst_.PositionOf ( "2013-01-02 00:00:00" ), Eq(Const::NONE) );
+}
+
+TEST_F ( TestTimestampIndexOneDay, PositionsBetween )
+{
+    std::vector<Types::index> positions;
+    indexConst_.PositionsBetween ( "2013-01-01 02:00:00", "2013-01-01 05:00:00", positions );
+    EXPECT_THAT ( positions, ElementsAre ( 2, 3, 4, 5 ) );
+
+    positions.clear();
+    indexConst_.PositionsBetween ( "2013-01-01 21:30:00", "2013-01-02 12:00:00", positions );
+    EXPECT_THAT ( positions, ElementsAre ( 22, 23 ) );
+
+    positions.clear();
+    indexConst_.PositionsBetween ( "2013-01-01 05:00:00", "2013-01-01 02:00:00", positions );
+    EXPECT_THAT ( positions, IsEmpty() );
+}
+
+} // namespace egoa::test
@@ -0,0 +1,48 @@
+/*
+ * TestTimestampIndex.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_TIMESTAMP_INDEX_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_TIMESTAMP_INDEX_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Container/TimestampIndex.hpp"
+
+#include "Auxiliary/Constants.hpp"
+#include "Auxiliary/Types.hpp"
+
+namespace egoa::test {
+
+class TestTimestampIndex : public ::testing::Test {
+    protected:
+        TimestampIndex         index_;
+        TimestampIndex const & indexConst_ = index_;
+};
+
+/**
+ * @brief      Fixture with one day of hourly timestamps.
+ */
+class TestTimestampIndexOneDay : public TestTimestampIndex {
+    protected:
+        void SetUp () override
+        {
+            for ( Types::index hour = 0; hour < 24; ++hour )
+            {
+                timestamps_.emplace_back ( "2013-01-01 "
+                                         + Types::string ( hour < 10 ? "0" : "" )
+                                         + std::to_string ( hour ) + ":00:00" );
+            }
+            index_.Build ( timestamps_ );
+        }
+
+        std::vector<Types::timestampSnapshot> timestamps_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_TIMESTAMP_INDEX_HPP
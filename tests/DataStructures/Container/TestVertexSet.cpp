@@ -0,0 +1,141 @@
+/*
+ * TestVertexSet.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestVertexSet.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using ::testing::Eq;
+
+namespace egoa::test {
+
+TYPED_TEST ( TestVertexSet, IsEmptyWhenCreated )
+{
+    typename TestFixture::TVertexSet vertexSet;
+    EXPECT_TRUE ( vertexSet.empty() );
+    EXPECT_THAT ( vertexSet.size(), Eq(0) );
+    EXPECT_THAT ( vertexSet.count(3), Eq(0) );
+}
+
+TYPED_TEST ( TestVertexSet, InitializerList )
+{
+    typename TestFixture::TVertexSet vertexSet ( {{7}} );
+    EXPECT_THAT ( vertexSet.size(),  Eq(1) );
+    EXPECT_THAT ( vertexSet.count(7), Eq(1) );
+    EXPECT_THAT ( vertexSet.count(6), Eq(0) );
+}
+
+TYPED_TEST ( TestVertexSet, EmplaceDetectsDuplicates )
+{
+    typename TestFixture::TVertexSet vertexSet;
+    std::vector<Types::vertexId> vertices = { 9, 1, 130, 4, 0, 64, 63, 17 };
+
+    for ( Types::vertexId vertexId : vertices )
+    {
+        bool isInsert = false;
+        std::tie ( std::ignore, isInsert ) = vertexSet.emplace ( vertexId );
+        EXPECT_TRUE ( isInsert ) << "Vertex " << vertexId;
+    }
+    for ( Types::vertexId vertexId : vertices )
+    {
+        bool isInsert = true;
+        std::tie ( std::ignore, isInsert ) = vertexSet.emplace ( vertexId );
+        EXPECT_FALSE ( isInsert ) << "Vertex " << vertexId;
+        EXPECT_THAT ( vertexSet.count ( vertexId ), Eq(1) );
+    }
+    EXPECT_THAT ( vertexSet.size(), Eq ( vertices.size() ) );
+    EXPECT_THAT ( vertexSet.count ( 2 ), Eq(0) );
+
+    std::vector<Types::vertexId> elements;
+    vertexSet.for_all_elements ( [&elements]( Types::vertexId vertexId )
+    {
+        elements.push_back ( vertexId );
+    });
+    std::sort ( elements.begin(), elements.end() );
+    std::sort ( vertices.begin(), vertices.end() );
+    EXPECT_EQ ( vertices, elements );
+}
+
+TYPED_TEST ( TestVertexSet, CopiesAreIndependent )
+{
+    typename TestFixture::TVertexSet original ( {{0}} );
+    for ( Types::vertexId vertexId = 1; vertexId < 6; ++vertexId )
+    {
+        original.emplace ( vertexId );
+    }
+
+    typename TestFixture::TVertexSet copy = original;
+    copy.emplace ( 42 );
+
+    EXPECT_THAT ( original.size(),     Eq(6) );
+    EXPECT_THAT ( original.count(42),  Eq(0) );
+    EXPECT_THAT ( copy.size(),         Eq(7) );
+    EXPECT_THAT ( copy.count(42),      Eq(1) );
+    EXPECT_THAT ( copy.count(5),       Eq(1) );
+
+    original.clear();
+    EXPECT_TRUE ( original.empty() );
+    EXPECT_THAT ( copy.count(5),       Eq(1) );
+}
+
+TEST ( TestParentChainVertexSet, ReleasesLongChainsIteratively )
+{
+    Types::count const length = 20000;
+    ParentChainVertexSet copy;
+    {
+        ParentChainVertexSet original;
+        for ( Types::vertexId vertexId = 0; vertexId < length; ++vertexId )
+        {
+            original.emplace ( vertexId );
+        }
+        copy = original;
+        copy.emplace ( length );
+
+        ParentChainVertexSet unshared = original;
+        unshared.clear();
+        unshared = std::move ( original );
+        EXPECT_THAT ( unshared.size(), Eq(length) );
+    }
+
+    // The shared prefix stays alive after the other sets are destroyed
+    EXPECT_THAT ( copy.size(),          Eq(length + 1) );
+    EXPECT_THAT ( copy.count(0),        Eq(1) );
+    EXPECT_THAT ( copy.count(length),   Eq(1) );
+
+    copy.clear();
+    EXPECT_TRUE ( copy.empty() );
+}
+
+TYPED_TEST ( TestVertexSet, LabelConcatenationDetectsCycle )
+{
+    using TSetLabel = typename TestFixture::TLabel;
+    using TEdge     = typename TSetLabel::TElement;
+
+    Edges::ElectricalProperties properties;
+    properties.Reactance()    = 1.0;
+    properties.ThermalLimit() = 1.0;
+
+    TEdge forward  ( 0, 0, 1, properties );
+    TEdge backward ( 1, 1, 0, properties );
+
+    TSetLabel source = TSetLabel::SourceLabel ( 0 );
+
+    bool isInsert = false;
+    TSetLabel label;
+    std::tie ( label, isInsert ) = source + forward;
+    EXPECT_TRUE ( isInsert );
+    EXPECT_THAT ( label.Vertex(), Eq(1) );
+    EXPECT_THAT ( label.VertexSet().size(), Eq(2) );
+    EXPECT_THAT ( source.VertexSet().size(), Eq(1) );
+
+    TSetLabel cycle;
+    std::tie ( cycle, isInsert ) = label + backward;
+    EXPECT_FALSE ( isInsert );
+}
+
+} // namespace egoa::test
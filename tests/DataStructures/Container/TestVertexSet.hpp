@@ -0,0 +1,45 @@
+/*
+ * TestVertexSet.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_VERTEX_SET_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_VERTEX_SET_HPP
+
+#include <unordered_set>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Container/VertexSets/DynamicBitsetVertexSet.hpp"
+#include "DataStructures/Container/VertexSets/SmallVectorVertexSet.hpp"
+#include "DataStructures/Container/VertexSets/ParentChainVertexSet.hpp"
+
+#include "DataStructures/Labels/VoltageAngleDifferenceLabel.hpp"
+
+namespace egoa::test {
+
+/**
+ * @brief      Fixture for testing the vertex set containers of the labels.
+ *
+ * @tparam     VertexSetType  The type of the vertex set.
+ */
+template<typename VertexSetType>
+class TestVertexSet : public ::testing::Test {
+    protected:
+        using TVertexSet = VertexSetType;
+        using TLabel     = VoltageAngleDifferenceLabel< Edges::Edge<Edges::ElectricalProperties>
+                                                      , TVertexSet >;
+};
+
+using VertexSetTypes = ::testing::Types< DynamicBitsetVertexSet
+                                       , SmallVectorVertexSet<4>
+                                       , ParentChainVertexSet >;
+
+TYPED_TEST_SUITE(TestVertexSet, VertexSetTypes);
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__CONTAINER__TEST_VERTEX_SET_HPP
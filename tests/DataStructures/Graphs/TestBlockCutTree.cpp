@@ -63,6 +63,11 @@ TEST_F(TestBlockCutTreeTriangle, Block) {
     EXPECT_FALSE(block.IsBridge());
 }
 
+TEST_F(TestBlockCutTreeTriangle, BuildInParallel) {
+    ExpectSameBlockCutTree(egoa::buildBlockCutTree(graph_),
+                           egoa::buildBlockCutTreeInParallel(graph_));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Star ///////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -129,6 +134,11 @@ TEST_F(TestBlockCutTreeStar, Blocks) {
 
 }
 
+TEST_F(TestBlockCutTreeStar, BuildInParallel) {
+    ExpectSameBlockCutTree(egoa::buildBlockCutTree(graph_),
+                           egoa::buildBlockCutTreeInParallel(graph_));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Triangle with leaf /////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -219,4 +229,101 @@ TEST_F(TestBlockCutTreeTriangleWithLeaf, Bridge) {
     EXPECT_EQ(expectedSubgraph, block.Subgraph());
 }
 
+TEST_F(TestBlockCutTreeTriangleWithLeaf, BuildInParallel) {
+    ExpectSameBlockCutTree(egoa::buildBlockCutTree(graph_),
+                           egoa::buildBlockCutTreeInParallel(graph_));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Bowtie with square /////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+#pragma mark TestBlockCutTreeBowtieWithSquare
+TEST_F(TestBlockCutTreeBowtieWithSquare, BasicProperties) {
+    auto result = egoa::buildBlockCutTree(graph_);
+
+    EXPECT_EQ(4, result.NumberOfBlocks());
+    EXPECT_EQ(3, result.NumberOfCutVertices());
+    for (Types::vertexId id : {0, 2, 4}) {
+        EXPECT_TRUE(result.IsCutVertex(id));
+    }
+}
+
+TEST_F(TestBlockCutTreeBowtieWithSquare, Root) {
+    auto result = egoa::buildBlockCutTree(graph_);
+
+    ASSERT_TRUE(result.IsCutVertex(root_));
+
+    auto const & cutVertex = result.CutVertexAt(root_);
+    EXPECT_EQ(root_, cutVertex.Identifier());
+    ExpectSameContent(result.BlocksOfVertex(root_), cutVertex.Blocks());
+    ASSERT_EQ(2, cutVertex.Blocks().size());
+
+    for (Types::blockId blockId : cutVertex.Blocks()) {
+        auto const & cutVertices = result.BlockAt(blockId).CutVertices();
+        EXPECT_NE(cutVertices.end(), std::find(cutVertices.begin(), cutVertices.end(), root_));
+    }
+}
+
+TEST_F(TestBlockCutTreeBowtieWithSquare, Square) {
+    auto result = egoa::buildBlockCutTree(graph_);
+
+    Types::blockId const bId = result.BlockOfEdge(squareEdges_.front());
+    for (Types::edgeId eId : squareEdges_) {
+        EXPECT_EQ(bId, result.BlockOfEdge(eId));
+    }
+    for (Types::edgeId eId : firstTriangleEdges_) {
+        EXPECT_NE(bId, result.BlockOfEdge(eId));
+    }
+
+    auto const & block = result.BlockAt(bId);
+    EXPECT_EQ(4, block.Subgraph().Vertices().size());
+    EXPECT_TRUE(block.IsLeaf());
+
+    // The block of the tree edge from the parent comes first
+    std::vector<Types::blockId> expectedBlocks{result.BlockOfEdge(firstTriangleEdges_.front()), bId};
+    EXPECT_EQ(expectedBlocks, result.BlocksOfVertex(2));
+}
+
+TEST_F(TestBlockCutTreeBowtieWithSquare, ParallelEdges) {
+    auto result = egoa::buildBlockCutTree(graph_);
+
+    Types::blockId const bId = result.BlockOfEdge(parallelEdges_.front());
+    EXPECT_EQ(bId, result.BlockOfEdge(parallelEdges_.back()));
+
+    auto const & block = result.BlockAt(bId);
+    EXPECT_EQ(2, block.Subgraph().Vertices().size());
+    EXPECT_EQ(2, block.Subgraph().Edges().size());
+    EXPECT_TRUE(block.IsLeaf());
+    EXPECT_FALSE(block.IsBridge());
+    EXPECT_FALSE(result.IsCutVertex(8));
+}
+
+TEST_F(TestBlockCutTreeBowtieWithSquare, BuildInParallel) {
+    ExpectSameBlockCutTree(egoa::buildBlockCutTree(graph_),
+                           egoa::buildBlockCutTreeInParallel(graph_));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Long feeder ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+#pragma mark TestBlockCutTreeLongFeeder
+TEST_F(TestBlockCutTreeLongFeeder, BasicProperties) {
+    auto result = egoa::buildBlockCutTree(graph_);
+
+    EXPECT_EQ(numberOfVertices_ - 2, result.NumberOfBlocks());
+    EXPECT_EQ(numberOfVertices_ - 3, result.NumberOfCutVertices());
+    EXPECT_FALSE(result.IsCutVertex(0));
+    EXPECT_TRUE(result.IsCutVertex(numberOfVertices_ - 3));
+    EXPECT_FALSE(result.IsCutVertex(numberOfVertices_ - 2));
+
+    auto const & triangle = result.BlockAt(result.BlockOfEdge(triangleEdge_));
+    EXPECT_EQ(3, triangle.Subgraph().Edges().size());
+    EXPECT_TRUE(triangle.IsLeaf());
+}
+
+TEST_F(TestBlockCutTreeLongFeeder, BuildInParallel) {
+    ExpectSameBlockCutTree(egoa::buildBlockCutTree(graph_),
+                           egoa::buildBlockCutTreeInParallel(graph_));
+}
+
 } // namespace egoa::test
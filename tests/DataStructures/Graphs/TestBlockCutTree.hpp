@@ -27,6 +27,61 @@ void printBlocks(BlockCutTree<T> const & tree) {
     }
 }
 
+/**
+ * @brief      Expects that two block-cut trees have the same blocks and
+ *             cut-vertices.
+ *
+ * @details    The blocks may be numbered differently. The block of an edge
+ *             determines the mapping between the block identifiers.
+ */
+template<typename T>
+void ExpectSameBlockCutTree(BlockCutTree<T> const & expected, BlockCutTree<T> const & actual) {
+    ASSERT_EQ(expected.NumberOfBlocks(), actual.NumberOfBlocks());
+    EXPECT_EQ(expected.NumberOfCutVertices(), actual.NumberOfCutVertices());
+
+    std::vector<Types::blockId> blockMapping(expected.NumberOfBlocks(), Const::NONE);
+    for (auto const & edge : expected.Graph().Edges()) {
+        Types::blockId const expectedBlock = expected.BlockOfEdge(edge.Identifier());
+        Types::blockId const actualBlock = actual.BlockOfEdge(edge.Identifier());
+        if (expectedBlock == Const::NONE) {
+            EXPECT_EQ(Const::NONE, actualBlock);
+            continue;
+        }
+        if (blockMapping[expectedBlock] == Const::NONE) {
+            blockMapping[expectedBlock] = actualBlock;
+        }
+        EXPECT_EQ(blockMapping[expectedBlock], actualBlock);
+    }
+
+    for (auto const & vertex : expected.Graph().Vertices()) {
+        Types::vertexId const id = vertex.Identifier();
+        std::vector<Types::blockId> expectedBlocks;
+        for (Types::blockId blockId : expected.BlocksOfVertex(id)) {
+            expectedBlocks.push_back(blockMapping[blockId]);
+        }
+        auto const & actualBlocks = actual.BlocksOfVertex(id);
+        ASSERT_EQ(expectedBlocks.size(), actualBlocks.size());
+        EXPECT_EQ(expected.IsCutVertex(id), actual.IsCutVertex(id));
+        if (expectedBlocks.empty()) continue;
+        EXPECT_EQ(expectedBlocks.front(), actualBlocks.front());
+        ExpectSameContent(expectedBlocks, actualBlocks);
+    }
+
+    for (Types::blockId blockId = 0; blockId < expected.NumberOfBlocks(); ++blockId) {
+        auto const & expectedBlock = expected.BlockAt(blockId);
+        auto const & actualBlock = actual.BlockAt(blockMapping[blockId]);
+        auto const & expectedVertices = expectedBlock.Subgraph().Vertices();
+        auto const & actualVertices = actualBlock.Subgraph().Vertices();
+        ExpectSameContent(std::vector<Types::vertexId>(expectedVertices.begin(), expectedVertices.end()),
+                          std::vector<Types::vertexId>(actualVertices.begin(), actualVertices.end()));
+        auto const & expectedEdges = expectedBlock.Subgraph().Edges();
+        auto const & actualEdges = actualBlock.Subgraph().Edges();
+        ExpectSameContent(std::vector<Types::edgeId>(expectedEdges.begin(), expectedEdges.end()),
+                          std::vector<Types::edgeId>(actualEdges.begin(), actualEdges.end()));
+        ExpectSameContent(expectedBlock.CutVertices(), actualBlock.CutVertices());
+    }
+}
+
 class TestBlockCutTreeTriangle : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -95,6 +150,58 @@ protected:
     std::vector<Types::edgeId> largeCycleEdges_;
 };
 
+class TestBlockCutTreeBowtieWithSquare : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (Types::count counter = 0; counter < 9; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+
+        // The back edge (2, 0) is seen before the square at the vertex 2
+        firstTriangleEdges_.push_back(graph_.AddEdge(0, 1, MinimalProperties(1)));
+        firstTriangleEdges_.push_back(graph_.AddEdge(1, 2, MinimalProperties(12)));
+        firstTriangleEdges_.push_back(graph_.AddEdge(2, 0, MinimalProperties(20)));
+        squareEdges_.push_back(graph_.AddEdge(2, 5, MinimalProperties(25)));
+        squareEdges_.push_back(graph_.AddEdge(5, 6, MinimalProperties(56)));
+        squareEdges_.push_back(graph_.AddEdge(6, 7, MinimalProperties(67)));
+        squareEdges_.push_back(graph_.AddEdge(7, 2, MinimalProperties(72)));
+        graph_.AddEdge(0, 3, MinimalProperties(3));
+        graph_.AddEdge(3, 4, MinimalProperties(34));
+        graph_.AddEdge(4, 0, MinimalProperties(40));
+        parallelEdges_.push_back(graph_.AddEdge(4, 8, MinimalProperties(48)));
+        parallelEdges_.push_back(graph_.AddEdge(8, 4, MinimalProperties(84)));
+    }
+
+    TGraph graph_;
+    Types::vertexId root_ = 0;
+    std::vector<Types::edgeId> firstTriangleEdges_;
+    std::vector<Types::edgeId> squareEdges_;
+    std::vector<Types::edgeId> parallelEdges_;
+};
+
+/**
+ * @brief      A long radial feeder that ends in a triangle.
+ *
+ * @details    The recursive depth-first search needs one stack frame per
+ *             vertex on such a path.
+ */
+class TestBlockCutTreeLongFeeder : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (Types::count counter = 0; counter < numberOfVertices_; ++counter) {
+            graph_.AddVertex(MinimalProperties(counter));
+        }
+        for (Types::vertexId vertex = 1; vertex < numberOfVertices_; ++vertex) {
+            graph_.AddEdge(vertex - 1, vertex, MinimalProperties(vertex));
+        }
+        triangleEdge_ = graph_.AddEdge(numberOfVertices_ - 1, numberOfVertices_ - 3, MinimalProperties(0));
+    }
+
+    TGraph graph_;
+    Types::count const numberOfVertices_ = 100000;
+    Types::edgeId triangleEdge_;
+};
+
 } // namespace egoa::test
 
 #endif // EGOA__TESTS__DATA_STRUCTURES__GRAPHS__TEST_BLOCK_CUT_TREE_HPP
@@ -0,0 +1,181 @@
+/*
+ * TestElectricalPropertyColumns.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestElectricalPropertyColumns.hpp"
+
+using ::testing::Eq;
+using ::testing::DoubleEq;
+
+namespace egoa::test {
+
+TEST_F ( TestElectricalPropertyColumns, IsEmptyWhenCreated )
+{
+    ElectricalPropertyColumns columns;
+    EXPECT_THAT ( columns.NumberOfBuses(),    Eq(0) );
+    EXPECT_THAT ( columns.NumberOfBranches(), Eq(0) );
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+}
+
+TEST_F ( TestElectricalPropertyColumns, BranchColumns )
+{
+    ElectricalPropertyColumns columns ( graph_ );
+    ASSERT_THAT ( columns.NumberOfBranches(), Eq(3) );
+
+    for ( Types::edgeId edgeId = 0; edgeId < 3; ++edgeId )
+    {
+        auto const & properties = graph_.EdgeAt ( edgeId ).Properties();
+        EXPECT_THAT ( columns.Branch<BranchColumn::resistance>( edgeId ),        DoubleEq ( properties.Resistance() ) );
+        EXPECT_THAT ( columns.Branch<BranchColumn::reactance>( edgeId ),         DoubleEq ( properties.Reactance() ) );
+        EXPECT_THAT ( columns.Branch<BranchColumn::thermalLimit>( edgeId ),      DoubleEq ( properties.ThermalLimit() ) );
+        EXPECT_THAT ( columns.Branch<BranchColumn::thetaBoundMinimum>( edgeId ), DoubleEq ( properties.ThetaBound().Minimum() ) );
+        EXPECT_THAT ( columns.Branch<BranchColumn::thetaBoundMaximum>( edgeId ), DoubleEq ( properties.ThetaBound().Maximum() ) );
+        EXPECT_THAT ( columns.IsActive ( edgeId ), Eq ( properties.Status() ) );
+    }
+
+    // The DC susceptance is -1/x and 0 for x = 0
+    EXPECT_THAT ( columns.Branch<BranchColumn::dcSusceptance>( 0 ), DoubleEq ( -4.0 ) );
+    EXPECT_THAT ( columns.Branch<BranchColumn::dcSusceptance>( 1 ), DoubleEq ( -2.0 ) );
+    EXPECT_THAT ( columns.Branch<BranchColumn::dcSusceptance>( 2 ), DoubleEq (  0.0 ) );
+
+    Types::real const * reactances = columns.BranchData<BranchColumn::reactance>();
+    EXPECT_THAT ( reactances[1], DoubleEq ( 0.5 ) );
+}
+
+TEST_F ( TestElectricalPropertyColumns, SusceptancesMatchCarrierDifferentiation )
+{
+    ElectricalPropertyColumns columns ( graph_ );
+
+    // The edge without reactance is skipped, since the carrier differentiation exits for it
+    for ( Types::edgeId edgeId = 0; edgeId < 2; ++edgeId )
+    {
+        auto const & properties = graph_.EdgeAt ( edgeId ).Properties();
+        Types::real const dcSusceptance = properties.Susceptance<Edges::CarrierDifferentiationType::DC>();
+        EXPECT_THAT ( columns.Susceptance<Edges::CarrierDifferentiationType::DC>( edgeId ), DoubleEq ( dcSusceptance ) );
+        EXPECT_THAT ( columns.Susceptance<Edges::CarrierDifferentiationType::AC>( edgeId )
+                    , DoubleEq ( properties.Susceptance<Edges::CarrierDifferentiationType::AC>() ) );
+        EXPECT_THAT ( columns.Branch<BranchColumn::susceptanceNorm>( edgeId ), DoubleEq ( fabs ( 1 / dcSusceptance ) ) );
+    }
+    EXPECT_THAT ( columns.Susceptance<Edges::CarrierDifferentiationType::AC>( 2 ), DoubleEq ( 0.0 ) );
+}
+
+TEST_F ( TestElectricalPropertyColumns, LabelsReadFromColumns )
+{
+    using TLabel = VoltageAngleDifferenceLabel<TGraph::TEdge>;
+
+    ElectricalPropertyColumns columns ( graph_ );
+    TGraph::TEdge const & edge = graph_.EdgeAt ( Types::edgeId ( 1 ) );
+    TLabel label ( Types::vertexId ( 1 ) );
+
+    std::pair<TLabel, bool> expected = label + edge;
+    std::pair<TLabel, bool> result   = label + EdgeColumnView<TGraph::TEdge> ( edge, columns );
+
+    EXPECT_TRUE ( result.second );
+    EXPECT_THAT ( result.first.Vertex(),          Eq ( expected.first.Vertex() ) );
+    EXPECT_THAT ( result.first.SusceptanceNorm(), Eq ( expected.first.SusceptanceNorm() ) );
+    EXPECT_THAT ( result.first.MinimumCapacity(), Eq ( expected.first.MinimumCapacity() ) );
+    EXPECT_THAT ( result.first.VertexSet(),       Eq ( expected.first.VertexSet() ) );
+}
+
+TEST_F ( TestElectricalPropertyColumns, BusColumns )
+{
+    ElectricalPropertyColumns columns ( graph_ );
+    ASSERT_THAT ( columns.NumberOfBuses(), Eq(3) );
+
+    for ( Types::vertexId vertexId = 0; vertexId < 3; ++vertexId )
+    {
+        auto const & properties = graph_.VertexAt ( vertexId ).Properties();
+        EXPECT_THAT ( columns.Bus<BusColumn::shuntConductance>( vertexId ), DoubleEq ( properties.ShuntConductance() ) );
+        EXPECT_THAT ( columns.Bus<BusColumn::shuntSusceptance>( vertexId ), DoubleEq ( properties.ShuntSusceptance() ) );
+        EXPECT_THAT ( columns.Bus<BusColumn::nominalVoltage>( vertexId ),   DoubleEq ( properties.NominalVoltage() ) );
+        EXPECT_THAT ( columns.Bus<BusColumn::minimumVoltage>( vertexId ),   DoubleEq ( 0.9 ) );
+        EXPECT_THAT ( columns.Bus<BusColumn::maximumVoltage>( vertexId ),   DoubleEq ( 1.1 ) );
+    }
+    EXPECT_THAT ( columns.BusData<BusColumn::nominalVoltage>()[2], DoubleEq ( 112 ) );
+}
+
+TEST_F ( TestElectricalPropertyColumns, GraphDropsColumnsWhenAnEdgeIsAdded )
+{
+    graph_.BuildPropertyColumns();
+    ASSERT_TRUE ( graph_.HasPropertyColumns() );
+    EXPECT_THAT ( graph_.PropertyColumns().NumberOfBranches(), Eq(3) );
+
+    graph_.AddEdge ( Types::vertexId ( 0 ), Types::vertexId ( 2 ), TEdgeProperties() );
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+
+    graph_.BuildPropertyColumns();
+    EXPECT_THAT ( graph_.PropertyColumns().NumberOfBranches(), Eq(4) );
+
+    graph_.AddVertex ( TVertexProperties() );
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+}
+
+TEST_F ( TestElectricalPropertyColumns, GraphKeepsColumnsOnAccess )
+{
+    graph_.BuildPropertyColumns();
+    TGraph const & graphConst = graph_;
+    graphConst.EdgeAt ( Types::edgeId ( 0 ) );
+    graphConst.VertexAt ( Types::vertexId ( 0 ) );
+    graphConst.for_all_edges ( []( TGraph::TEdge const & ) {} );
+    graphConst.for_all_vertices ( []( TGraph::TVertex const & ) {} );
+    EXPECT_TRUE ( graph_.HasPropertyColumns() );
+
+    // Accessing the properties does not change them
+    graph_.EdgeAt ( Types::edgeId ( 0 ) );
+    graph_.VertexAt ( Types::vertexId ( 0 ) );
+    graph_.for_all_edges<ExecutionPolicy::parallel> ( []( TGraph::TEdge & ) {} );
+    graph_.for_all_vertices<ExecutionPolicy::parallel> ( []( TGraph::TVertex & ) {} );
+    EXPECT_TRUE ( graph_.HasPropertyColumns() );
+
+    graph_.DropPropertyColumns();
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+}
+
+TEST_F ( TestElectricalPropertyColumns, GraphOutdatesColumnsWhenPropertiesChange )
+{
+    graph_.BuildPropertyColumns();
+    graph_.EdgeAt ( Types::edgeId ( 0 ) ).Properties().Reactance() = 2.0;
+    graph_.PropertiesChanged();
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+
+    graph_.BuildPropertyColumns();
+    ASSERT_TRUE ( graph_.HasPropertyColumns() );
+    EXPECT_THAT ( graph_.PropertyColumns().Susceptance<Edges::CarrierDifferentiationType::DC>( 0 ), DoubleEq ( -0.5 ) );
+}
+
+TEST_F ( TestElectricalPropertyColumns, GraphRefreshesColumnsOfChangedEdges )
+{
+    graph_.RefreshPropertyColumns ( { Types::edgeId ( 0 ) } );
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+
+    graph_.BuildPropertyColumns();
+    graph_.EdgeAt ( Types::edgeId ( 1 ) ).Properties().Status()    = false;
+    graph_.EdgeAt ( Types::edgeId ( 1 ) ).Properties().Reactance() = 4.0;
+    graph_.RefreshPropertyColumns ( { Types::edgeId ( 1 ) } );
+    ASSERT_TRUE ( graph_.HasPropertyColumns() );
+
+    ElectricalPropertyColumns const & columns = graph_.PropertyColumns();
+    EXPECT_TRUE  ( columns.IsActive ( 0 ) );
+    EXPECT_FALSE ( columns.IsActive ( 1 ) );
+    EXPECT_THAT ( columns.Branch<BranchColumn::susceptanceNorm>( 1 ), DoubleEq ( 4.0 ) );
+    EXPECT_THAT ( columns.Susceptance<Edges::CarrierDifferentiationType::DC>( 1 ), DoubleEq ( -0.25 ) );
+}
+
+TEST_F ( TestElectricalPropertyColumns, GraphKeepsOutdatedColumnsUntilTheyAreRebuilt )
+{
+    graph_.BuildPropertyColumns();
+    graph_.EdgeAt ( Types::edgeId ( 0 ) ).Properties().Status() = false;
+    graph_.PropertiesChanged();
+
+    graph_.RefreshPropertyColumns ( { Types::edgeId ( 0 ), Types::edgeId ( 1 ), Types::edgeId ( 2 ) } );
+    EXPECT_FALSE ( graph_.HasPropertyColumns() );
+
+    graph_.BuildPropertyColumns();
+    ASSERT_TRUE  ( graph_.HasPropertyColumns() );
+    EXPECT_FALSE ( graph_.PropertyColumns().IsActive ( 0 ) );
+}
+
+} // namespace egoa::test
@@ -0,0 +1,63 @@
+/*
+ * TestElectricalPropertyColumns.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA__TESTS__DATA_STRUCTURES__GRAPHS__TEST_ELECTRICAL_PROPERTY_COLUMNS_HPP
+#define EGOA__TESTS__DATA_STRUCTURES__GRAPHS__TEST_ELECTRICAL_PROPERTY_COLUMNS_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "DataStructures/Graphs/StaticGraph.hpp"
+#include "DataStructures/Graphs/ElectricalPropertyColumns.hpp"
+#include "DataStructures/Graphs/Vertices/ElectricalProperties.hpp"
+#include "DataStructures/Graphs/Edges/ElectricalProperties.hpp"
+#include "DataStructures/Labels/VoltageAngleDifferenceLabel.hpp"
+
+namespace egoa::test {
+
+class TestElectricalPropertyColumns : public ::testing::Test {
+    protected:
+        using TVertexProperties = Vertices::ElectricalProperties<>;
+        using TEdgeProperties   = Edges::ElectricalProperties;
+        using TGraph            = StaticGraph<TVertexProperties, TEdgeProperties>;
+
+        /**
+         * @brief      Creates a triangle, where the edge from 2 to 0 has no
+         *     reactance and is switched off.
+         */
+        TestElectricalPropertyColumns()
+        : graph_("triangle")
+        {
+            for ( Types::index index = 0; index < 3; ++index )
+            {
+                TVertexProperties vertex;
+                vertex.ShuntSusceptance() = 0.5 * index;
+                vertex.NominalVoltage()   = 110 + index;
+                vertex.MinimumVoltage()   = 0.9;
+                vertex.MaximumVoltage()   = 1.1;
+                graph_.AddVertex ( vertex );
+            }
+            for ( Types::index index = 0; index < 3; ++index )
+            {
+                TEdgeProperties edge;
+                edge.Resistance()   = 0.01 * ( index + 1 );
+                edge.Reactance()    = ( index < 2 ) ? 0.25 * ( index + 1 ) : 0.0;
+                edge.ThermalLimit() = 100 + index;
+                edge.ThetaBound()   = Bound<>( -0.5 - index, 0.5 + index );
+                edge.Status()       = ( index < 2 );
+                graph_.AddEdge ( Types::vertexId ( index )
+                               , Types::vertexId ( ( index + 1 ) % 3 )
+                               , edge );
+            }
+        }
+
+        TGraph graph_;
+};
+
+} // namespace egoa::test
+
+#endif // EGOA__TESTS__DATA_STRUCTURES__GRAPHS__TEST_ELECTRICAL_PROPERTY_COLUMNS_HPP
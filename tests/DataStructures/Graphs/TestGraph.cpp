@@ -2244,6 +2244,88 @@ TYPED_TEST(TestGraphFourVertices, ForAllEdgesAtConst) {
     }
 }
 
+#pragma mark ForAllIncidentEdgesAt
+
+TYPED_TEST(TestGraphBidirectedPath, ForAllIncidentEdgesAt) {
+    for (auto id : this->vertexIds_) {
+        std::vector<Types::edgeId>   expectedEdges;
+        std::vector<Types::vertexId> expectedNeighbors;
+        this->graphConst_.template for_all_edges_at<egoa::ExecutionPolicy::sequential>(
+            id,
+            [&](typename TestFixture::TEdge const & edge) {
+                expectedEdges.push_back(edge.Identifier());
+                expectedNeighbors.push_back(edge.Other(id));
+            });
+
+        std::vector<Types::edgeId>   edges;
+        std::vector<Types::vertexId> neighbors;
+        this->graphConst_.template for_all_incident_edges_at<egoa::ExecutionPolicy::sequential>(
+            id,
+            [&](typename TestFixture::TEdge const & edge, Types::vertexId other) {
+                edges.push_back(edge.Identifier());
+                neighbors.push_back(other);
+            });
+
+        EXPECT_EQ(expectedEdges, edges);
+        EXPECT_EQ(expectedNeighbors, neighbors);
+    }
+}
+
+#pragma mark Freeze
+
+TEST_F(TestStaticGraphStar, FreezeKeepsNeighborhoods) {
+    std::vector<std::vector<Types::edgeId>> expected(this->graph_.NumberOfVertices());
+    for (auto id : this->vertexIds_) {
+        this->graphConst_.for_all_edges_at(id, [&](TEdge const & edge) {
+            expected[id].push_back(edge.Identifier());
+        });
+    }
+
+    EXPECT_FALSE(this->graph_.IsFrozen());
+    this->graph_.Freeze();
+    ASSERT_TRUE(this->graph_.IsFrozen());
+
+    egoa::CsrGraph const & csr = this->graphConst_.Csr();
+    EXPECT_EQ(this->graph_.NumberOfVertices(), csr.NumberOfVertices());
+    EXPECT_EQ(2 * this->graph_.NumberOfEdges(), csr.NumberOfEntries());
+
+    for (auto id : this->vertexIds_) {
+        EXPECT_EQ(this->graph_.DegreeAt(id),    csr.DegreeAt(id));
+        EXPECT_EQ(this->graph_.InDegreeAt(id),  csr.InDegreeAt(id));
+        EXPECT_EQ(this->graph_.OutDegreeAt(id), csr.OutDegreeAt(id));
+
+        std::vector<Types::edgeId> edges;
+        this->graphConst_.for_all_edges_at(id, [&](TEdge const & edge) {
+            edges.push_back(edge.Identifier());
+        });
+        EXPECT_EQ(expected[id], edges);
+
+        this->graphConst_.for_all_incident_edges_at(id, [&](TEdge const & edge, Types::vertexId other) {
+            EXPECT_EQ(edge.Other(id), other);
+        });
+    }
+}
+
+TEST_F(TestStaticGraphStar, AddEdgeThawsGraph) {
+    this->graph_.Freeze();
+    ASSERT_TRUE(this->graph_.IsFrozen());
+
+    Types::edgeId id = this->graph_.AddEdge(this->leafIds_[0], this->leafIds_[1], TEdgeProperties(3));
+    EXPECT_FALSE(this->graph_.IsFrozen());
+
+    Types::count numberOfEdges = 0;
+    bool found = false;
+    this->graphConst_.for_all_edges_at(this->leafIds_[0], [&](TEdge const & edge) {
+        ++numberOfEdges;
+        found |= ( edge.Identifier() == id );
+    });
+    EXPECT_EQ(2, numberOfEdges);
+    EXPECT_TRUE(found);
+
+    this->graph_.Freeze();
+    EXPECT_EQ(2, this->graphConst_.Csr().DegreeAt(this->leafIds_[0]));
+}
+
 /// @todo Death tests
 /// @todo Test for loops
 /// @todo Test adding an edge if the graph is empty
@@ -310,6 +310,12 @@ TYPED_TEST_SUITE(TestGraphFourVerticesDeathTest, GraphTypes);
 TYPED_TEST_SUITE(TestGraphBidirectedPath, GraphTypes);
 TYPED_TEST_SUITE(TestGraphStar, GraphTypes);
 
+/**
+ * @brief      Fixture for testing the frozen CSR representation of a
+ *     StaticGraph that contains a star with three leaves.
+ */
+using TestStaticGraphStar = TestGraphStar<egoa::StaticGraph<MinimalProperties, MinimalProperties>>;
+
 
 } // namespace egoa::test
 
@@ -2714,6 +2714,83 @@ TEST_F  ( TestPowerGridAcm2018MtsfFigure4b
 // }
 
 
+// ***********************************************************************
+// ***********************************************************************
+#pragma mark TotalRealPowerGenerationPerSnapshot
+// ***********************************************************************
+// ***********************************************************************
+
+TEST_F ( TestNetworkEmpty
+       , TotalRealPowerGenerationAndLoadPerSnapshot )
+{
+    TVertexProperties vertex;
+    for ( Types::index counter = 0; counter < 3; ++counter )
+    {
+        network_.Graph().AddVertex ( vertex );
+    }
+
+    // The generators differ in their names, since TotalRealPowerGenerationAt
+    // identifies generators by their properties
+    TGeneratorProperties generator;
+    generator.Name()                  = "first";
+    Types::generatorId const first    = network_.AddGeneratorAt ( Types::vertexId ( 0 ), generator );
+    generator.Name()                  = "inactive";
+    generator.Status()                = Vertices::BusStatus::inactive;
+    Types::generatorId const inactive = network_.AddGeneratorAt ( Types::vertexId ( 0 ), generator );
+    generator.Name()                  = "second";
+    generator.Status()                = Vertices::BusStatus::active;
+    Types::generatorId const second   = network_.AddGeneratorAt ( Types::vertexId ( 2 ), generator );
+
+    TLoadProperties load;
+    Types::loadId const firstLoad  = network_.AddLoadAt ( Types::vertexId ( 1 ), load );
+    Types::loadId const secondLoad = network_.AddLoadAt ( Types::vertexId ( 1 ), load );
+
+    for ( Types::index timestamp = 0; timestamp < 4; ++timestamp )
+    {
+        network_.AddSnapshotTimestamp ( "2013-01-01 0" + std::to_string ( timestamp ) + ":00:00" );
+        network_.AddGeneratorRealPowerSnapshotAt ( first,    1.0 + timestamp );
+        network_.AddGeneratorRealPowerSnapshotAt ( inactive, 100.0 );
+        network_.AddGeneratorRealPowerSnapshotAt ( second,   0.5 * timestamp );
+        network_.AddLoadSnapshotAt ( firstLoad,  0.25 );
+        network_.AddLoadSnapshotAt ( secondLoad, 0.5 + timestamp );
+    }
+
+    SnapshotMatrix<Types::real> generation;
+    std::vector<Types::real>    systemGeneration;
+    network_.TotalRealPowerGenerationPerSnapshot<Vertices::GenerationStrategyDifferentiationType::totalVertexPowerGenerationPerSnapshot> (
+        generation, systemGeneration );
+
+    SnapshotMatrix<Types::real> loads;
+    std::vector<Types::real>    systemLoad;
+    network_.TotalRealPowerLoadPerSnapshot ( loads, systemLoad );
+
+    ASSERT_EQ ( 3, generation.NumberOfEntities() );
+    ASSERT_EQ ( 4, generation.NumberOfSnapshots() );
+    ASSERT_EQ ( 4, systemGeneration.size() );
+    ASSERT_EQ ( 3, loads.NumberOfEntities() );
+    ASSERT_EQ ( 4, systemLoad.size() );
+
+    for ( Types::index timestamp = 0; timestamp < 4; ++timestamp )
+    {
+        EXPECT_EQ ( 1.0 + timestamp, generation ( 0, timestamp ) );
+        EXPECT_EQ ( 0.0,             generation ( 1, timestamp ) );
+        EXPECT_EQ ( 0.5 * timestamp, generation ( 2, timestamp ) );
+        EXPECT_EQ ( 1.0 + 1.5 * timestamp, systemGeneration[timestamp] );
+
+        EXPECT_EQ ( 0.0,              loads ( 0, timestamp ) );
+        EXPECT_EQ ( 0.75 + timestamp, loads ( 1, timestamp ) );
+        EXPECT_EQ ( 0.75 + timestamp, systemLoad[timestamp] );
+
+        for ( Types::vertexId vertexId = 0; vertexId < 3; ++vertexId )
+        {
+            EXPECT_EQ ( network_.TotalRealPowerGenerationAt<Vertices::GenerationStrategyDifferentiationType::totalVertexPowerGenerationPerSnapshot> ( vertexId, timestamp )
+                      , generation ( vertexId, timestamp ) );
+            EXPECT_EQ ( network_.TotalRealPowerLoadAt ( vertexId, timestamp )
+                      , loads ( vertexId, timestamp ) );
+        }
+    }
+}
+
 // ***********************************************************************
 // ***********************************************************************
 #pragma mark TotalReactivePowerGenerationBoundAt
@@ -5196,6 +5273,37 @@ TEST_F ( TestPowerGridAcm2018MtsfFigure4b
     EXPECT_EQ ( Const::NONE, index );
 }
 
+TEST_F ( TestNetworkEmpty
+       , PositionOfAddedTimestamps )
+{
+    network_.AddSnapshotTimestamp( "2013-01-01 00:00:00" );
+    network_.AddSnapshotTimestamp( "2013-01-01 01:00:00" );
+    network_.AddSnapshotTimestamp( "2013-01-01 02:00:00" );
+
+    EXPECT_EQ ( 1,           network_.PositionOf ( "2013-01-01 01:00:00" ) );
+    EXPECT_EQ ( Const::NONE, network_.PositionOf ( "2013-01-01 03:00:00" ) );
+}
+
+// ***********************************************************************
+// ***********************************************************************
+#pragma mark PositionsBetween
+// ***********************************************************************
+// ***********************************************************************
+
+TEST_F ( TestNetworkEmpty
+       , PositionsBetween )
+{
+    network_.AddSnapshotTimestamp( "2013-01-01 00:00:00" );
+    network_.AddSnapshotTimestamp( "2013-01-01 01:00:00" );
+    network_.AddSnapshotTimestamp( "2013-01-01 02:00:00" );
+
+    std::vector<Types::index> positions;
+    network_.PositionsBetween ( "2013-01-01 00:30:00"
+                              , "2013-01-01 02:00:00"
+                              , positions );
+    EXPECT_EQ ( std::vector<Types::index>( { 1, 2 } ), positions );
+}
+
 // TEST_F ( TestPowerGridPyPsaExample
 //        , PositionOf )
 // {
@@ -5530,4 +5638,35 @@ TEST_F ( TestPowerGridAcm2018MtsfFigure4a
 //     EXPECT_EQ ( 137, network_.LoadSnapshotOf ( 7, 3 ) );
 // }
 
+#pragma mark SwitchEdges
+
+TEST_F ( TestPowerGridAcm2018MtsfFigure4a
+       , SwitchEdgesRebuildsPropertyColumns )
+{
+    TGraph & graph = network_.Graph();
+    graph.BuildPropertyColumns();
+
+    std::vector<Types::vertexId> vertices;
+    for ( Types::vertexId vertexId = 0; vertexId < graph.NumberOfVertices(); ++vertexId )
+    {
+        vertices.emplace_back ( vertexId );
+    }
+    std::vector<Types::edgeId> edges;
+    for ( Types::edgeId edgeId = 1; edgeId < graph.NumberOfEdges(); ++edgeId )
+    {
+        edges.emplace_back ( edgeId );
+    }
+
+    SwitchEdges ( network_, Subgraph<TGraph> ( &graph, vertices, edges ) );
+
+    TGraph const & graphConst = graph;
+    ASSERT_TRUE  ( graphConst.HasPropertyColumns() );
+    EXPECT_FALSE ( graphConst.EdgeAt ( Types::edgeId ( 0 ) ).Properties().Status() );
+    EXPECT_FALSE ( graphConst.PropertyColumns().IsActive ( 0 ) );
+    for ( Types::edgeId edgeId : edges )
+    {
+        EXPECT_TRUE ( graphConst.PropertyColumns().IsActive ( edgeId ) );
+    }
+}
+
 } // namespace egoa::test
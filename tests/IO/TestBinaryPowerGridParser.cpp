@@ -0,0 +1,97 @@
+/*
+ * TestBinaryPowerGridParser.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestBinaryPowerGridParser.hpp"
+
+#include <sstream>
+
+using ::testing::Eq;
+
+namespace egoa::test {
+
+TEST_F ( TestBinaryPowerGridParser, RoundTripThroughFile )
+{
+    ASSERT_TRUE ( TPowerGridIO::write ( network_, filename_, TPowerGridIO::WriteBinaryCache ) );
+
+    TNetwork network;
+    ASSERT_TRUE ( TPowerGridIO::read ( network, filename_, TPowerGridIO::ReadBinaryCacheFile ) );
+
+    EXPECT_THAT ( network.BaseMva(), Eq(100) );
+    EXPECT_THAT ( network.Graph().Name(), Eq("triangle") );
+    ASSERT_THAT ( network.Graph().NumberOfVertices(), Eq(3) );
+    ASSERT_THAT ( network.Graph().NumberOfEdges(), Eq(3) );
+    for ( Types::vertexId vertexId = 0; vertexId < 3; ++vertexId )
+    {
+        EXPECT_TRUE ( network.Graph().VertexAt ( vertexId ).Properties()
+                   == network_.Graph().VertexAt ( vertexId ).Properties() );
+    }
+    for ( Types::edgeId edgeId = 0; edgeId < 3; ++edgeId )
+    {
+        auto const & edge     = network.Graph().EdgeAt ( edgeId );
+        auto const & expected = network_.Graph().EdgeAt ( edgeId );
+        EXPECT_THAT ( edge.Source(), Eq(expected.Source()) );
+        EXPECT_THAT ( edge.Target(), Eq(expected.Target()) );
+        EXPECT_TRUE ( edge.Properties() == expected.Properties() );
+    }
+    EXPECT_THAT ( network.Graph().DegreeAt ( 1 ), Eq(2) );
+
+    EXPECT_THAT ( network.NumberOfGenerators(), Eq(2) );
+    EXPECT_FALSE ( network.HasGenerator ( Types::generatorId ( 1 ) ) );
+    EXPECT_TRUE ( network.GeneratorAt ( 2 ) == network_.GeneratorAt ( 2 ) );
+    EXPECT_THAT ( network.GeneratorAt ( 2 ).Name(), Eq("gen2") );
+    EXPECT_TRUE ( network.HasGeneratorAt ( Types::vertexId ( 2 ) ) );
+    EXPECT_THAT ( network.NumberOfLoads(), Eq(1) );
+    EXPECT_TRUE ( network.LoadAt ( 0 ) == network_.LoadAt ( 0 ) );
+
+    ASSERT_THAT ( network.NumberOfTimestamps(), Eq(3) );
+    EXPECT_THAT ( network.TimestampAt ( 2 ), Eq("2026-10-16 02:00:00") );
+    EXPECT_THAT ( network.GeneratorRealPowerSnapshotAt ( 0, 2 ), Eq(1.0) );
+    EXPECT_THAT ( network.LoadSnapshotOf ( 0, 1 ), Eq(0.1) );
+}
+
+TEST_F ( TestBinaryPowerGridParser, RoundTripThroughStreamIsIdentical )
+{
+    std::stringstream image;
+    ASSERT_TRUE ( TPowerGridIO::write ( network_, image, TPowerGridIO::WriteBinaryCache ) );
+
+    TNetwork network;
+    ASSERT_TRUE ( TPowerGridIO::ReadBinaryCache ( network, image ) );
+
+    std::stringstream copy;
+    ASSERT_TRUE ( TParser::write ( network, copy ) );
+    EXPECT_THAT ( copy.str(), Eq(image.str()) );
+}
+
+TEST_F ( TestBinaryPowerGridParser, InvalidImageIsRejected )
+{
+    std::stringstream image;
+    ASSERT_TRUE ( TParser::write ( network_, image ) );
+    std::string const content = image.str();
+
+    TNetwork network;
+    network.Graph() = TGraph ( "unchanged" );
+
+    std::string corrupted = content;
+    corrupted[TParser::HeaderSize + 10] ^= 0x01;
+    EXPECT_FALSE ( TParser::read ( network, corrupted.data(), corrupted.size() ) );
+
+    std::string truncated = content.substr ( 0, content.size() - 1 );
+    EXPECT_FALSE ( TParser::read ( network, truncated.data(), truncated.size() ) );
+
+    std::string otherVersion = content;
+    otherVersion[sizeof(TParser::MagicNumber)] ^= 0x01;
+    EXPECT_FALSE ( TParser::read ( network, otherVersion.data(), otherVersion.size() ) );
+
+    std::stringstream text ( "function mpc = case3\n" );
+    EXPECT_FALSE ( TParser::read ( network, text ) );
+
+    EXPECT_FALSE ( TParser::read ( network, filename_ ) );
+    EXPECT_THAT ( network.Graph().Name(), Eq("unchanged") );
+    EXPECT_THAT ( network.Graph().NumberOfVertices(), Eq(0) );
+}
+
+} // namespace egoa::test
@@ -0,0 +1,102 @@
+/*
+ * TestBinaryPowerGridParser.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA___TESTS___IO___TEST_BINARY_POWER_GRID_PARSER_HPP
+#define EGOA___TESTS___IO___TEST_BINARY_POWER_GRID_PARSER_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdio>
+
+#include "IO/PowerGridIO.hpp"
+#include "IO/Parser/BinaryPowerGridParser.hpp"
+
+#include "DataStructures/Networks/PowerGrid.hpp"
+#include "DataStructures/Graphs/StaticGraph.hpp"
+
+namespace egoa::test {
+
+/**
+ * @brief      Fixture for testing the binary power grid parser on a small
+ *     network with snapshots.
+ */
+class TestBinaryPowerGridParser : public ::testing::Test {
+    protected:
+        using TGraph                = StaticGraph< Vertices::ElectricalProperties<>
+                                                 , Edges::ElectricalProperties>;
+        using TVertexProperties     = typename TGraph::TVertexProperties;
+        using TEdgeProperties       = typename TGraph::TEdgeProperties;
+        using TNetwork              = PowerGrid<TGraph>;
+        using TGeneratorProperties  = typename TNetwork::TGeneratorProperties;
+        using TLoadProperties       = typename TNetwork::TLoadProperties;
+        using TParser               = BinaryPowerGridParser<TGraph>;
+        using TPowerGridIO          = PowerGridIO<TGraph>;
+
+        virtual void SetUp () override
+        {
+            network_.BaseMva()          = 100;
+            network_.Graph()            = TGraph ( "triangle" );
+
+            for ( Types::count counter = 0; counter < 3; ++counter )
+            {
+                TVertexProperties vertex;
+                vertex.Name()               = "bus" + std::to_string ( counter );
+                vertex.X()                  = 1.5 * counter;
+                vertex.Country()            = "DE";
+                vertex.MaximumVoltage()     = 1.1;
+                network_.Graph().AddVertex ( vertex );
+            }
+            for ( Types::vertexId source = 0; source < 3; ++source )
+            {
+                TEdgeProperties edge;
+                edge.Name()                 = "line" + std::to_string ( source );
+                edge.Reactance()            = 0.1 + source;
+                edge.ThermalLimit()         = 2.0;
+                edge.ThetaBound()           = Bound<>( -0.5, 0.5 );
+                edge.Susceptance ( -1.0 / edge.Reactance() );
+                network_.Graph().AddEdge ( source, ( source + 1 ) % 3, edge );
+            }
+
+            TGeneratorProperties generator;
+            generator.Name()                = "gen0";
+            generator.RealPowerBound()      = Bound<>( 0.0, 3.0 );
+            generator.MarginalCost()        = 42.0;
+            Types::generatorId const generatorId = network_.AddGeneratorAt ( Types::vertexId ( 0 ), generator );
+            generator.Name()                = "gen1";
+            Types::generatorId const removedId   = network_.AddGeneratorAt ( Types::vertexId ( 2 ), generator );
+            generator.Name()                = "gen2";
+            Types::generatorId const otherId     = network_.AddGeneratorAt ( Types::vertexId ( 2 ), generator );
+            network_.RemoveGeneratorAt ( Types::vertexId ( 2 ), removedId );
+
+            TLoadProperties load;
+            load.Name()                     = "load0";
+            load.RealPowerLoad()            = 0.75;
+            Types::loadId const loadId = network_.AddLoadAt ( Types::vertexId ( 1 ), load );
+
+            for ( Types::index timestamp = 0; timestamp < 3; ++timestamp )
+            {
+                network_.AddSnapshotTimestamp ( "2026-10-16 0" + std::to_string ( timestamp ) + ":00:00" );
+                network_.AddSnapshotWeighting ( 1.0 );
+                network_.AddGeneratorRealPowerSnapshotAt ( generatorId, 0.5 * timestamp );
+                network_.AddGeneratorRealPowerSnapshotAt ( otherId, 0.25 );
+                network_.AddLoadSnapshotAt ( loadId, 0.1 * timestamp );
+            }
+        }
+
+        virtual void TearDown () override
+        {
+            std::remove ( filename_.c_str() );
+        }
+
+        TNetwork            network_;
+        Types::string const filename_ = ::testing::TempDir() + "TestBinaryPowerGridParser.egoa";
+};
+
+} // namespace egoa::test
+
+#endif // EGOA___TESTS___IO___TEST_BINARY_POWER_GRID_PARSER_HPP
@@ -0,0 +1,123 @@
+/*
+ * TestMemoryMappedCsvReader.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#include "TestMemoryMappedCsvReader.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+
+namespace egoa::test {
+
+TEST_F ( TestMemoryMappedCsvReader, FileDoesNotExist )
+{
+    TReader reader ( filename_ + ".missing" );
+    std::vector<std::string_view> fields;
+    EXPECT_FALSE ( reader.IsOpen() );
+    EXPECT_FALSE ( reader.ReadLine ( fields ) );
+}
+
+TEST_F ( TestMemoryMappedCsvReader, EmptyFile )
+{
+    WriteFile ( "" );
+    TReader reader ( filename_ );
+    std::vector<std::string_view> fields;
+    EXPECT_TRUE  ( reader.IsOpen() );
+    EXPECT_FALSE ( reader.ReadLine ( fields ) );
+}
+
+TEST_F ( TestMemoryMappedCsvReader, SplitLines )
+{
+    WriteFile ( "\xEF\xBB\xBFname,v_nom, x ,y\r\n"
+                "1,380,1.5,\n"
+                "\n"
+                "\"AT0 1, hydro\",220,-2e-3,11" );
+    TReader reader ( filename_ );
+    std::vector<std::string_view> fields;
+
+    ASSERT_TRUE ( reader.ReadLine ( fields ) );
+    EXPECT_THAT ( fields, ElementsAre ( "name", "v_nom", "x", "y" ) );
+
+    ASSERT_TRUE ( reader.ReadLine ( fields ) );
+    EXPECT_THAT ( fields, ElementsAre ( "1", "380", "1.5", "" ) );
+
+    // The empty line is skipped and the last line has no line break
+    ASSERT_TRUE ( reader.ReadLine ( fields ) );
+    EXPECT_THAT ( fields, ElementsAre ( "AT0 1, hydro", "220", "-2e-3", "11" ) );
+    EXPECT_THAT ( reader.LineNumber(), Eq(4) );
+
+    EXPECT_FALSE ( reader.ReadLine ( fields ) );
+    EXPECT_TRUE  ( fields.empty() );
+
+    reader.Rewind();
+    ASSERT_TRUE ( reader.ReadLine ( fields ) );
+    EXPECT_THAT ( fields.front(), Eq("name") );
+}
+
+TEST_F ( TestMemoryMappedCsvReader, ReadTableInByteRanges )
+{
+    Types::string content = "name,AT0 0,AT0 1\n";
+    for ( Types::count row = 0; row < 100; ++row )
+    {
+        content += std::to_string ( row ) + "," + std::to_string ( 10 * row ) + ",\n";
+        if ( row % 7 == 0 ) content += "\r\n";
+    }
+    WriteFile ( content );
+
+    TReader reader ( filename_ );
+    std::vector<std::string_view> header;
+    ASSERT_TRUE ( reader.ReadLine ( header ) );
+    EXPECT_THAT ( header.size(), Eq(3) );
+
+    std::vector<std::vector<std::string_view>> expected;
+    std::vector<std::string_view> fields;
+    while ( reader.ReadLine ( fields ) ) expected.push_back ( fields );
+    ASSERT_THAT ( expected.size(), Eq(100) );
+
+    for ( Types::count numberOfChunks : { 1, 2, 3, 8, 1000 } )
+    {
+        reader.Rewind();
+        reader.ReadLine ( header );
+
+        IO::Helper::CsvTable table;
+        reader.ReadTable ( table, numberOfChunks );
+        ASSERT_THAT ( table.NumberOfRows(), Eq(expected.size()) );
+        EXPECT_THAT ( table.NumberOfFields(), Eq(300) );
+        for ( Types::index row = 0; row < table.NumberOfRows(); ++row )
+        {
+            ASSERT_THAT ( table[row].size(), Eq(3) );
+            for ( Types::index column = 0; column < 3; ++column )
+            {
+                EXPECT_THAT ( table[row][column], Eq(expected[row][column]) );
+            }
+        }
+        EXPECT_FALSE ( reader.ReadLine ( fields ) );
+    }
+}
+
+TEST ( TestStringConversion, StringToReal )
+{
+    EXPECT_THAT ( IO::Helper::StringToReal ( "380" ),       Eq(380.0) );
+    EXPECT_THAT ( IO::Helper::StringToReal ( "-0.02" ),     Eq(-0.02) );
+    EXPECT_THAT ( IO::Helper::StringToReal ( "+1.5e-05" ),  Eq(1.5e-05) );
+    EXPECT_THAT ( IO::Helper::StringToReal ( " 12.5MW" ),   Eq(12.5) );
+    EXPECT_THAT ( IO::Helper::StringToReal ( "" ),          Eq(0.0) );
+    EXPECT_THAT ( IO::Helper::StringToReal ( "TRUE" ),      Eq(0.0) );
+}
+
+TEST ( TestStringConversion, StringToInteger )
+{
+    EXPECT_THAT ( IO::Helper::StringToInteger ( "3" ),      Eq(3) );
+    EXPECT_THAT ( IO::Helper::StringToInteger ( "2.0" ),    Eq(2) );
+    EXPECT_THAT ( IO::Helper::StringToInteger ( "-1" ),     Eq(-1) );
+    EXPECT_THAT ( IO::Helper::StringToInteger ( "n/a" ),    Eq(0) );
+}
+
+} // namespace egoa::test
@@ -0,0 +1,45 @@
+/*
+ * TestMemoryMappedCsvReader.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: Franziska Wegner
+ */
+
+#ifndef EGOA___TESTS___IO___TEST_MEMORY_MAPPED_CSV_READER_HPP
+#define EGOA___TESTS___IO___TEST_MEMORY_MAPPED_CSV_READER_HPP
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "IO/Helper/MemoryMappedCsvReader.hpp"
+
+namespace egoa::test {
+
+/**
+ * @brief      Fixture for testing the memory-mapped CSV reader on a file
+ *     that is written to the temporary directory.
+ */
+class TestMemoryMappedCsvReader : public ::testing::Test {
+    protected:
+        using TReader = IO::Helper::MemoryMappedCsvReader;
+
+        virtual void TearDown () override
+        {
+            std::remove ( filename_.c_str() );
+        }
+
+        void WriteFile ( Types::string const & content )
+        {
+            std::ofstream file ( filename_, std::ios::binary );
+            file << content;
+        }
+
+        Types::string const filename_ = ::testing::TempDir() + "TestMemoryMappedCsvReader.csv";
+};
+
+} // namespace egoa::test
+
+#endif // EGOA___TESTS___IO___TEST_MEMORY_MAPPED_CSV_READER_HPP
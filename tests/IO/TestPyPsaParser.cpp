@@ -96,8 +96,8 @@ TEST_F ( TestPyPsaExample, CompareVerticesPropertiesWithLinesData )
         EXPECT_EQ(100            , edge.Properties().Length() );
         EXPECT_EQ(x              , edge.Properties().NumberOfParallelLines() );
         EXPECT_EQ(0.7            , edge.Properties().ThermalLimit() );
-        EXPECT_EQ ( ceil ( (   ( x*1.0 + 2 ) * 1000 / ( x * 1.0 ) ) * 1000 / 1000 )
-                  , ceil ( edge.Properties().NominalApparentPower() * 1000 / 1000 ) );
+        // s_nom is the nominal apparent power of all parallel lines together
+        EXPECT_EQ((x+2)*1000     , edge.Properties().NominalApparentPower() );
         EXPECT_EQ(380            , edge.Properties().NominalVoltage() );
         EXPECT_EQ(4000           , edge.Properties().NominalApparentPowerBound().Minimum() );
         EXPECT_EQ(8000           , edge.Properties().NominalApparentPowerBound().Maximum() );
@@ -286,6 +286,40 @@ TEST_F ( TestPyPsaExample, CheckLoadRealPowerSnapshots )
     );
 }
 
+TEST_F ( TestPyPsaExample, TotalRealPowerPerSnapshotMatchesVertexTotals )
+{
+    SnapshotMatrix<Types::real> generation;
+    std::vector<Types::real>    systemGeneration;
+    networkConst_.template TotalRealPowerGenerationPerSnapshot<Vertices::GenerationStrategyDifferentiationType::totalVertexPowerGenerationPerSnapshot> (
+        generation, systemGeneration );
+
+    SnapshotMatrix<Types::real> load;
+    std::vector<Types::real>    systemLoad;
+    networkConst_.TotalRealPowerLoadPerSnapshot ( load, systemLoad );
+
+    ASSERT_EQ ( networkConst_.Graph().NumberOfVertices(), generation.NumberOfEntities() );
+    ASSERT_EQ ( networkConst_.NumberOfTimestamps(),       generation.NumberOfSnapshots() );
+    ASSERT_EQ ( networkConst_.NumberOfTimestamps(),       systemLoad.size() );
+
+    for ( Types::index timestamp = 0; timestamp < networkConst_.NumberOfTimestamps(); ++timestamp )
+    {
+        Types::real totalGeneration = 0.0;
+        Types::real totalLoad       = 0.0;
+        for ( Types::vertexId vertexId = 0; vertexId < networkConst_.Graph().NumberOfVertices(); ++vertexId )
+        {
+            Types::real pg = networkConst_.template TotalRealPowerGenerationAt<Vertices::GenerationStrategyDifferentiationType::totalVertexPowerGenerationPerSnapshot> (
+                vertexId, timestamp );
+            Types::real pd = networkConst_.TotalRealPowerLoadAt ( vertexId, timestamp );
+            EXPECT_EQ ( pg, generation ( vertexId, timestamp ) );
+            EXPECT_EQ ( pd, load ( vertexId, timestamp ) );
+            totalGeneration += pg;
+            totalLoad       += pd;
+        }
+        EXPECT_EQ ( totalGeneration, systemGeneration[timestamp] );
+        EXPECT_EQ ( totalLoad,       systemLoad[timestamp] );
+    }
+}
+
 TEST_F ( PyPSAExampleInconsistencyGeneratorsDeathTest
        , DeathTestInconsistency )
 {
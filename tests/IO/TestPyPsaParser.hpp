@@ -82,7 +82,7 @@ class TestPyPsaExample : public TestPyPsaParser {
             }
         }
 
-        Types::string   const   TestCaseSmallExample_ = "../../framework/tests/Data/PowerGrids/PyPsaExample";
+        Types::string   const   TestCaseSmallExample_ = "../../framework/tests/Data/PowerGrids/PyPSAExample";
 };
 
 /**
@@ -130,7 +130,7 @@ class PyPSA_PyPSA_data_2018_11_20__elec_s1024_AT : public TestPyPsaParser {
         : TestPyPsaParser ()
         {}
 
-        Types::string   const   TestCaseSmallExample_ = "../../framework/data/PowerGrids/PyPSA/pypsa-iti-collaboration/elec_s1024_AT";;
+        Types::string   const   TestCaseSmallExample_ = "../../framework/data/PowerGrids/PyPSA/pypsa-iti-collaboration/elec_s1024_AT";
 };
 
 } // namespace egoa::test